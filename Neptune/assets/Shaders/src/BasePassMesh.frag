@@ -0,0 +1,37 @@
+/**
+* @file BasePassMesh.frag.
+* @brief This Shader Defines BasePass GPUScene Fragment Shader.
+* @author Spices.
+*/
+
+#version 460
+
+/*****************************************Include*****************************************/
+
+#include "Header/ShaderCommon.h"
+
+/*****************************************************************************************/
+
+/**********************************Shader Input/Output************************************/
+
+layout(location = 0) in vec3 inNormal;             /* @brief World Normal.   */
+layout(location = 1) in vec3 inColor;              /* @brief Vertex Color.   */
+layout(location = 2) in vec2 inTexCoord;           /* @brief Vertex UV.      */
+
+layout(location = 0) out vec4 outColor;            /* @brief Scene Color.    */
+
+/*****************************************************************************************/
+
+/**********************************Shader Entry*******************************************/
+
+void main()
+{
+    /**
+    * @brief Half lambert of a fixed light until materials are bound.
+    */
+    float NoL = dot(normalize(inNormal), normalize(vec3(0.5f, 1.0f, 0.3f))) * 0.5f + 0.5f;
+
+    outColor = vec4(inColor * NoL, 1.0f);
+}
+
+/*****************************************************************************************/
@@ -0,0 +1,50 @@
+/**
+* @file BasePassMesh.vert.
+* @brief This Shader Defines BasePass GPUScene Vertex Shader.
+* @author Spices.
+*/
+
+#version 460
+
+/*****************************************Include*****************************************/
+
+#include "Header/ShaderGPUSceneLayout.glsl"
+
+/*****************************************************************************************/
+
+/**********************************Shader Input/Output************************************/
+
+/**
+* @brief Draw data of this frame.
+*/
+layout(push_constant, scalar) uniform PushConstant
+{
+    MeshDrawConstant push;    /* @see MeshDrawConstant. */
+};
+
+layout(location = 0) out vec3 outNormal;           /* @brief World Normal.   */
+layout(location = 1) out vec3 outColor;            /* @brief Vertex Color.   */
+layout(location = 2) out vec2 outTexCoord;         /* @brief Vertex UV.      */
+
+/*****************************************************************************************/
+
+/**********************************Shader Entry*******************************************/
+
+void main()
+{
+    GPUSceneDesc scene  = SceneDesc(push.descAddress).desc;
+
+    /**
+    * @brief Indices are offset by vertexOffset, firstInstance is MeshInstance index.
+    */
+    Vertex       vertex = SceneVertices(scene.verticesAddress).i[gl_VertexIndex];
+    mat4         model  = SceneInstances(scene.instancesAddress).i[gl_InstanceIndex].model;
+
+    outNormal   = normalize(mat3(model) * vertex.normal);
+    outColor    = vertex.color;
+    outTexCoord = vertex.texCoord;
+
+    gl_Position = push.viewProjection * model * vec4(vertex.position, 1.0f);
+}
+
+/*****************************************************************************************/
@@ -36,6 +36,9 @@ using uint = unsigned int;
 const uint BINDLESS_TEXTURE_MAXNUM        = 65535                     ;   /* @brief Maximum number of BindLess Texture Array.             */
 const uint BINDLESS_TEXTURE_SET           = 1                         ;   /* @brief BindLess Texture Descriptor Set.                      */
 const uint BINDLESS_TEXTURE_BINDING       = 0                         ;   /* @brief BindLess Texture Descriptor Set Binding.              */
+const uint BINDLESS_BUFFER_MAXNUM         = 65535                     ;   /* @brief Maximum number of BindLess Buffer Array.              */
+const uint BINDLESS_BUFFER_BINDING        = 1                         ;   /* @brief BindLess Buffer Descriptor Set Binding.               */
+const uint BINDLESS_PUSH_MAXNUM           = 8                         ;   /* @brief Maximum number of BindLess Index pushed per draw.     */
 const uint MESH_BUFFER_MAXNUM             = 100000                    ;   /* @brief Ray Tracing Renderer Maximum mesh desc buffer count.  */
 const uint DIRECTIONALLIGHT_BUFFER_MAXNUM = 100                       ;   /* @brief Maximum number of Directional lights.                 */
 const uint POINTLIGHT_BUFFER_MAXNUM       = 10000                     ;   /* @brief Maximum number of Point lights.                       */
@@ -49,6 +52,9 @@ const uint SUBGROUP_SIZE                  = NV_SUBGROUP_SIZE          ;   /* @br
 
 const uint POST_BLOOM_MIPMAP              = 5                         ;   /* @brief PostRenderer Bloom mipmap count.                      */
 
+const uint MESH_LOD_MAXNUM                = 8                         ;   /* @brief Maximum number of Lods of a GPUScene Mesh.            */
+const uint MESH_CULL_GROUP_SIZE           = 64                        ;   /* @brief GPUScene Cull Compute Shader local size.              */
+
 /**
 * @brief  Macros for Calculate Constant.
 */
@@ -123,6 +129,20 @@ struct MaterialAttributes
 /*****************************************************************************************/
 
 
+/**************************************BindLess*******************************************/
+
+/**
+* @brief BindLess Index pushed per draw, index into BindLess Texture and Buffer Array.
+*/
+struct BindLessIndex
+{
+	uint textures[BINDLESS_PUSH_MAXNUM];   /* @brief Index of BindLess Texture Array. */
+	uint buffers[BINDLESS_PUSH_MAXNUM];    /* @brief Index of BindLess Buffer Array.  */
+};
+
+/*****************************************************************************************/
+
+
 /*************************************Pre Renderer Data***********************************/
 
 /**
@@ -262,6 +282,88 @@ struct Meshlet
 
 /*****************************************************************************************/
 
+
+/*******************************************GPU Scene*************************************/
+
+/**
+* @brief Index range of a Mesh Lod in GPUScene.
+*/
+struct MeshLod
+{
+	uint    indexCount;                          /* @brief Indices Count this lod.                               */
+	uint    firstIndex;                          /* @brief First Index in GPUScene Indices.                      */
+	int     vertexOffset;                        /* @brief First Vertex of Mesh in GPUScene Vertices.            */
+	float   distance;                            /* @brief Farthest view distance of this lod in bound radius.   */
+};
+
+/**
+* @brief Bound and Lods of a Mesh in GPUScene.
+*/
+struct MeshBounds
+{
+	Sphere  boundSphere;                         /* @brief Bounding Sphere in local world.                       */
+	uint    firstLod;                            /* @brief First MeshLod, finest first.                          */
+	uint    lodCount;                            /* @brief MeshLod Count.( <= MESH_LOD_MAXNUM)                   */
+};
+
+/**
+* @brief Instance of a Mesh in GPUScene.
+*/
+struct MeshInstance
+{
+	mat4    model;                               /* @brief Model Matrix.                                         */
+	uint    mesh;                                /* @brief Index of MeshBounds.                                  */
+};
+
+/**
+* @brief Same layout with VkDrawIndexedIndirectCommand.
+*/
+struct DrawIndexedCommand
+{
+	uint    indexCount;                          /* @brief Indices Count.                                        */
+	uint    instanceCount;                       /* @brief Instances Count.                                      */
+	uint    firstIndex;                          /* @brief First Index.                                          */
+	int     vertexOffset;                        /* @brief Vertex Offset.                                        */
+	uint    firstInstance;                       /* @brief Index of MeshInstance, read by gl_InstanceIndex.      */
+};
+
+/**
+* @brief Buffer Addresses of GPUScene in one frame.
+*/
+struct GPUSceneDesc
+{
+	uint64_t verticesAddress;                    /* @brief Address of the Vertex buffer.                         */
+	uint64_t lodsAddress;                        /* @brief Address of the MeshLod buffer.                        */
+	uint64_t meshesAddress;                      /* @brief Address of the MeshBounds buffer.                     */
+	uint64_t instancesAddress;                   /* @brief Address of the MeshInstance buffer.                   */
+	uint64_t commandsAddress;                    /* @brief Address of the DrawIndexedCommand buffer this frame.  */
+	uint64_t countAddress;                       /* @brief Address of the Draw Count buffer this frame.          */
+};
+
+/**
+* @brief GPUScene Cull Push Constant, 128 bytes.
+*/
+struct MeshCullConstant
+{
+	uint64_t descAddress;                        /* @brief Address of GPUSceneDesc this frame.                   */
+	uint     nInstances;                         /* @brief MeshInstance Count.                                   */
+	uint     padding;                            /* @brief Padding.                                              */
+	vec4     planes[6];                          /* @brief Frustum planes, inside if dot(n, p) + w >= 0.         */
+	vec4     viewPosition;                       /* @brief Camera World Position.                                */
+};
+
+/**
+* @brief GPUScene Draw Push Constant.
+*/
+struct MeshDrawConstant
+{
+	uint64_t descAddress;                        /* @brief Address of GPUSceneDesc this frame.                   */
+	uint64_t padding;                            /* @brief Padding.                                              */
+	mat4     viewProjection;                     /* @brief View Projection Matrix.                               */
+};
+
+/*****************************************************************************************/
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,76 @@
+/**
+* @file ShaderGPUSceneLayout.glsl.
+* @brief This Shader Header File Defines GPUScene Buffers.
+* @author Spices.
+*/
+
+/************************************Pre Compile*******************************************/
+
+#ifndef SHADER_GPUSCENE_LAYOUT
+#define SHADER_GPUSCENE_LAYOUT
+
+#include "ShaderCommon.h"
+
+/*****************************************************************************************/
+
+/****************************************Buffer Data**************************************/
+
+/**
+* @brief GPUScene Description of this frame.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 8) readonly buffer SceneDesc
+{
+    GPUSceneDesc desc;        /* @see GPUSceneDesc. */
+};
+
+/**
+* @brief GPUScene Vertices Buffer.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 4) readonly buffer SceneVertices
+{
+    Vertex i[];               /* @see Vertex. */
+};
+
+/**
+* @brief GPUScene MeshLods Buffer.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 4) readonly buffer SceneLods
+{
+    MeshLod i[];              /* @see MeshLod. */
+};
+
+/**
+* @brief GPUScene MeshBounds Buffer.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 4) readonly buffer SceneMeshes
+{
+    MeshBounds i[];           /* @see MeshBounds. */
+};
+
+/**
+* @brief GPUScene MeshInstances Buffer.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 4) readonly buffer SceneInstances
+{
+    MeshInstance i[];         /* @see MeshInstance. */
+};
+
+/**
+* @brief GPUScene DrawIndexedCommands Buffer.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 4) writeonly buffer SceneCommands
+{
+    DrawIndexedCommand i[];   /* @see DrawIndexedCommand. */
+};
+
+/**
+* @brief GPUScene Draw Count Buffer.
+*/
+layout(buffer_reference, scalar, buffer_reference_align = 4) buffer SceneCount
+{
+    uint count;               /* @brief Draw Count, cleared each frame before cull. */
+};
+
+/*****************************************************************************************/
+
+#endif
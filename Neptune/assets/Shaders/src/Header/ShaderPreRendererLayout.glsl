@@ -36,6 +36,22 @@ layout(set = 0, binding = 1) uniform ShaderInput
 */
 layout (set = BINDLESS_TEXTURE_SET, binding = BINDLESS_TEXTURE_BINDING) uniform sampler2D BindLessTextureBuffer[];
 
+/**
+* @brief BindLess Storage Buffer, reinterpret with buffer_reference if typed access needed.
+*/
+layout (set = BINDLESS_TEXTURE_SET, binding = BINDLESS_BUFFER_BINDING) buffer BindLessBuffer
+{
+    uint data[];
+} BindLessBufferArray[];
+
+/**
+* @brief BindLess Index of this draw.
+*/
+layout (push_constant) uniform PushBindLessIndex
+{
+    BindLessIndex bindLessIndex;      /* @see BindLessIndex */
+};
+
 /*****************************************************************************************/
 
 #endif
\ No newline at end of file
@@ -85,6 +85,9 @@ project "Neptune"
 		"implot",                             -- Dependency: implot
 	}
 
+	-- Opt-in sanitizer, premake5 --sanitize=thread, UnitTest links with it too.
+	buildoptions { platform.GetSanitizeOptions() }
+
 	-- Library: std_image is included this solution, do not use PreCompiler Header.
 	filter "files:vendor/stb_image/**.cpp"
 		enablepch "Off"
@@ -10,6 +10,9 @@
 #include "Window/Window.h"
 #include "World/World/World.h"
 #include "World/Scene/Scene.h"
+#include "Core/Memory/AllocTracker.h"
+#include "Core/Memory/FrameArena.h"
+#include "Core/Memory/HeapCounter.h"
 
 #ifdef NP_PLATFORM_EMSCRIPTEN
 #include <emscripten/emscripten.h>
@@ -20,6 +23,8 @@ namespace Neptune {
     namespace {
         
         UP<Application> S_Instance = nullptr;
+
+        ApplicationInfo S_Info{};
     }
     
     Application& Application::Instance()
@@ -48,17 +53,38 @@ namespace Neptune {
 #endif
     }
 
+    void Application::Configure(const ApplicationInfo& info)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        assert(!S_Instance);
+
+        S_Info = info;
+    }
+
+    const ApplicationInfo& Application::GetInfo()
+    {
+        return S_Info;
+    }
+
     Application::Application()
     {
         NEPTUNE_PROFILE_ZONE
 
+        if (S_Info.headless)
+        {
+            Window::Create(WindowInfo{ S_Info.width, S_Info.height, "Neptune" }, WindowImplement::Headless, S_Info.backend);
+        }
+        else
+        {
 #ifdef NP_PLATFORM_EMSCRIPTEN
-        Window::Create(WindowInfo{1920, 1080, "Neptune"}, WindowImplement::emscripten_glfw, RenderBackendEnum::WebGPU);
+            Window::Create(WindowInfo{ S_Info.width, S_Info.height, "Neptune" }, WindowImplement::emscripten_glfw, RenderBackendEnum::WebGPU);
 #endif
 
 #ifdef NP_PLATFORM_WINDOWS
-        Window::Create(WindowInfo{ 1920, 1080, "Neptune" }, WindowImplement::GLFW, RenderBackendEnum::Vulkan);
+            Window::Create(WindowInfo{ S_Info.width, S_Info.height, "Neptune" }, WindowImplement::GLFW, RenderBackendEnum::Vulkan);
 #endif
+        }
 
         m_SystemManager = CreateUP<SystemManager>();
         m_SystemManager->Initialize();
@@ -72,6 +98,13 @@ namespace Neptune {
 
         Window::Destroy();
 
+#ifdef NP_ALLOC_TRACKER
+
+        // Live bytes left here are leaks or statics.
+        Memory::AllocTracker::WriteReport("AllocReport.txt");
+
+#endif
+
         Log::Reset();
     }
 
@@ -89,6 +122,15 @@ namespace Neptune {
 
 #else
 
+        if (S_Info.headless)
+        {
+            RunHeadless();
+
+            world.OnDetached();
+
+            return;
+        }
+
         const auto& window = Window::Instance();
 
         while(window.IsWindowActive())
@@ -100,6 +142,9 @@ namespace Neptune {
             m_SystemManager->Run();
 
             NEPTUNE_PROFILE_FRAME
+
+            Memory::FrameArena::NextFrame();
+            Memory::HeapCounter::NextFrame();
         }
 
         // on detach world to application.
@@ -109,6 +154,56 @@ namespace Neptune {
 
     }
 
+    void Application::RunHeadless()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        using Clock = std::chrono::steady_clock;
+
+        const auto& window = Window::Instance();
+
+        const auto period = S_Info.frameRate > 0.0f ? std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / S_Info.frameRate)) : Clock::duration::zero();
+
+        const auto begin = Clock::now();
+
+        auto next = begin;
+
+        uint64_t frames = 0;
+
+        while(window.IsWindowActive() && (S_Info.frames == 0 || frames < S_Info.frames))
+        {
+            NEPTUNE_PROFILE_ZONEN("MainLoop")
+
+            window.PollEvents();
+
+            m_SystemManager->Run();
+
+            NEPTUNE_PROFILE_FRAME
+
+            Memory::FrameArena::NextFrame();
+            Memory::HeapCounter::NextFrame();
+
+            ++frames;
+
+            if (period != Clock::duration::zero())
+            {
+                // Pace on an absolute schedule so sleep overshoot does not accumulate.
+                next += period;
+
+                std::this_thread::sleep_until(next);
+            }
+        }
+
+        const double seconds = std::chrono::duration<double>(Clock::now() - begin).count();
+
+        const auto heap = Memory::HeapCounter::LastFrame();
+
+        std::stringstream ss;
+        ss << "Headless: " << frames << " frames in " << seconds << " s, " << (seconds > 0.0 ? frames / seconds : 0.0) << " fps, " << heap.allocations << " heap allocations last frame.";
+
+        NEPTUNE_CORE_INFO(ss.str())
+    }
+
 #ifdef NP_PLATFORM_EMSCRIPTEN
 
     void Application::MainLoop(void* iUserData)
@@ -127,6 +222,9 @@ namespace Neptune {
 
             NEPTUNE_PROFILE_FRAME
 
+            Memory::FrameArena::NextFrame();
+            Memory::HeapCounter::NextFrame();
+
             return;
         }
 
@@ -7,11 +7,28 @@
 #pragma once
 #include "Core/Core.h"
 #include "NonCopyable.h"
+#include "Render/Frontend/Enum.h"
 
 namespace Neptune {
 
     class SystemManager;
 
+    /**
+    * @brief This struct defines the launch information of Application.
+    */
+    struct ApplicationInfo
+    {
+        bool              headless  = false;                        // @brief Render offscreen without Window and swapchain.
+        int               width     = 1920;                         // @brief Window or offscreen width.
+        int               height    = 1080;                         // @brief Window or offscreen height.
+        uint64_t          frames    = 0;                            // @brief Headless frames to run, 0 runs until stopped.
+        float             frameRate = 0.0f;                         // @brief Headless fixed frame rate, 0 runs uncapped.
+        RenderBackendEnum backend   = RenderBackendEnum::Vulkan;    // @brief Render backend, Null records RHI calls without a device.
+        std::string       capture;                                  // @brief Capture frontend RHI calls into this file if not empty.
+        std::string       replay;                                   // @brief Replay this capture file instead of Passes if not empty.
+        std::string       dump;                                     // @brief Write headless readbacks into this folder if not empty.
+    };
+
     /**
     * @brief Application Class.
     * This class defines the Application behaves.
@@ -32,6 +49,20 @@ namespace Neptune {
          */
         static void Destroy();
 
+        /**
+        * @brief Set launch information, call before Instance.
+        *
+        * @param[in] info ApplicationInfo.
+        */
+        static void Configure(const ApplicationInfo& info);
+
+        /**
+        * @brief Get launch information.
+        *
+        * @return Returns ApplicationInfo.
+        */
+        static const ApplicationInfo& GetInfo();
+
     public:
 
         /**
@@ -51,6 +82,11 @@ namespace Neptune {
 
     private:
 
+        /**
+        * @brief MainLoop of headless mode, uncapped or at a fixed frame rate.
+        */
+        void RunHeadless();
+
 #ifdef NP_PLATFORM_EMSCRIPTEN
 
         /**
@@ -0,0 +1,209 @@
+/**
+* @file AtomicBitSet.hpp.
+* @brief The AtomicBitSet Class Definitions and Implementation.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "FlagSet.hpp"
+
+#include <atomic>
+
+namespace Neptune::Container {
+
+    /**
+    * @brief Atomic Bit Set.
+    * Lock free flags of an enum up to 64 bits, each operation is a single atomic.
+    * Set and Reset are fetch_or and fetch_and, so concurrent writers of different bits never lose updates.
+    * Operations spanning two AtomicBitSets are not atomic as a whole.
+    *
+    * @tparam T specific enum type, T::Count is the bits count.
+    */
+    template<typename T>
+    class AtomicBitSet
+    {
+    public:
+
+        using TFlags = FlagSet<T>;               // @brief Value type of this.
+
+        using TSize  = typename TFlags::TSize;   // @brief Size Type of T.
+
+        using TBits  = typename TFlags::TBits;   // @brief Stored bits Type.
+
+    public:
+
+        /**
+        * @brief Constructor Function.
+        */
+        AtomicBitSet() = default;
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] flags FlagSet.
+        */
+        AtomicBitSet(const TFlags& flags) : m_Bits(flags.Bits()) {}
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] t Bit item, T::Count sets all bits.
+        */
+        AtomicBitSet(T t) : m_Bits(TFlags::ToMask(t)) {}
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~AtomicBitSet() = default;
+
+        /**
+        * @brief Copy Constructor Function, copies a snapshot.
+        *
+        * @param[in] other AtomicBitSet.
+        */
+        AtomicBitSet(const AtomicBitSet& other) : m_Bits(other.m_Bits.load(std::memory_order_acquire)) {}
+
+        /**
+        * @brief Copy Assignment Operation, copies a snapshot.
+        *
+        * @param[in] other AtomicBitSet.
+        */
+        AtomicBitSet& operator=(const AtomicBitSet& other)
+        {
+            m_Bits.store(other.m_Bits.load(std::memory_order_acquire), std::memory_order_release);
+
+            return *this;
+        }
+
+        /**
+        * @brief Load a snapshot.
+        *
+        * @return Returns FlagSet.
+        */
+        TFlags Load() const { return TFlags::FromBits(m_Bits.load(std::memory_order_acquire)); }
+
+        /**
+        * @brief Store flags.
+        *
+        * @param[in] flags FlagSet.
+        */
+        void Store(const TFlags& flags) { m_Bits.store(flags.Bits(), std::memory_order_release); }
+
+        /**
+        * @brief |= Bit Operation.
+        *
+        * @param[in] flags FlagSet.
+        *
+        * @return Returns flags before operation.
+        */
+        TFlags operator|=(const TFlags& flags) { return TFlags::FromBits(m_Bits.fetch_or(flags.Bits(), std::memory_order_acq_rel)); }
+
+        /**
+        * @brief &= Bit Operation.
+        *
+        * @param[in] flags FlagSet.
+        *
+        * @return Returns flags before operation.
+        */
+        TFlags operator&=(const TFlags& flags) { return TFlags::FromBits(m_Bits.fetch_and(flags.Bits(), std::memory_order_acq_rel)); }
+
+        /**
+        * @brief ^= Bit Operation.
+        *
+        * @param[in] flags FlagSet.
+        *
+        * @return Returns flags before operation.
+        */
+        TFlags operator^=(const TFlags& flags) { return TFlags::FromBits(m_Bits.fetch_xor(flags.Bits(), std::memory_order_acq_rel)); }
+
+        /**
+        * @brief == Operation.
+        *
+        * @param[in] flags FlagSet.
+        *
+        * @return Returns true if equal.
+        */
+        bool operator==(const TFlags& flags) const { return Load() == flags; }
+
+        /**
+        * @brief To TSize.
+        *
+        * @return Returns TSize.
+        */
+        explicit operator TSize() const { return static_cast<TSize>(m_Bits.load(std::memory_order_acquire)); }
+
+        /**
+        * @brief Set bit with value.
+        *
+        * @param[in] bit Bit item, T::Count sets all bits.
+        * @param[in] value Bit value.
+        *
+        * @return Returns true if bit was set before.
+        */
+        bool Set(T bit, bool value)
+        {
+            const TBits mask = TFlags::ToMask(bit);
+
+            const TBits prev = value ?
+                m_Bits.fetch_or  ( mask, std::memory_order_acq_rel) :
+                m_Bits.fetch_and (~mask, std::memory_order_acq_rel);
+
+            return (prev & mask) != 0;
+        }
+
+        /**
+        * @brief Test bit.
+        *
+        * @param[in] bit Bit item, T::Count tests any bit.
+        *
+        * @return Returns bit value.
+        */
+        bool Test(T bit) const { return (m_Bits.load(std::memory_order_acquire) & TFlags::ToMask(bit)) != 0; }
+
+        /**
+        * @brief Reset all bits.
+        */
+        void Reset() { m_Bits.store(0, std::memory_order_release); }
+
+        /**
+        * @brief Reset bit.
+        *
+        * @param[in] bit Bit item.
+        */
+        void Reset(T bit) { Set(bit, false); }
+
+        /**
+        * @brief Flip all bits.
+        */
+        void Flip() { m_Bits.fetch_xor(TFlags::Mask, std::memory_order_acq_rel); }
+
+        /**
+        * @brief Flip bit.
+        *
+        * @param[in] bit Bit item.
+        */
+        void Flip(T bit) { m_Bits.fetch_xor(TFlags::ToMask(bit), std::memory_order_acq_rel); }
+
+        /**
+        * @brief Is any bit set.
+        *
+        * @return Returns true if exist bit set.
+        */
+        bool Any() const { return m_Bits.load(std::memory_order_acquire) != 0; }
+
+        /**
+        * @brief Is all bits not set.
+        *
+        * @return Returns true if all bits not set.
+        */
+        bool None() const { return m_Bits.load(std::memory_order_acquire) == 0; }
+
+    private:
+
+        std::atomic<TBits> m_Bits{ 0 };  // @brief Stored bits.
+
+        static_assert(std::atomic<TBits>::is_always_lock_free, "AtomicBitSet requires lock free 64 bits atomic.");
+    };
+
+}
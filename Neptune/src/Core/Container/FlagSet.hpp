@@ -0,0 +1,244 @@
+/**
+* @file FlagSet.hpp.
+* @brief The FlagSet Class Definitions and Implementation.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+#include <bit>
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+namespace Neptune::Container {
+
+    /**
+    * @brief Flag Set.
+    * Not synchronized value type flags of an enum up to 64 bits, usable in constant expressions.
+    * Use AtomicBitSet when flags are shared by threads.
+    *
+    * @tparam T specific enum type, T::Count is the bits count.
+    */
+    template<typename T>
+    class FlagSet
+    {
+    public:
+
+        using TSize = std::underlying_type_t<T>; // @brief Size Type of T.
+
+        using TBits = uint64_t;                  // @brief Stored bits Type.
+
+        static_assert(static_cast<size_t>(T::Count) <= 64, "FlagSet supports at most 64 bits.");
+
+        static constexpr TBits Mask = static_cast<size_t>(T::Count) == 64 ? ~TBits{ 0 } : (TBits{ 1 } << static_cast<size_t>(T::Count)) - 1;  // @brief Valid bits.
+
+    public:
+
+        /**
+        * @brief Constructor Function.
+        */
+        constexpr FlagSet() = default;
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] t Bit item, T::Count sets all bits.
+        */
+        constexpr FlagSet(T t)
+        {
+            Set(t, true);
+        }
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] bits Bit items.
+        */
+        constexpr FlagSet(std::initializer_list<T> bits)
+        {
+            for (const auto bit : bits)
+            {
+                Set(bit, true);
+            }
+        }
+
+        /**
+        * @brief Create from raw bits.
+        *
+        * @param[in] bits Raw bits, masked by valid bits.
+        *
+        * @return Returns FlagSet.
+        */
+        static constexpr FlagSet FromBits(TBits bits)
+        {
+            FlagSet result;
+
+            result.m_Bits = bits & Mask;
+
+            return result;
+        }
+
+        /**
+        * @brief Get raw bits.
+        *
+        * @return Returns raw bits.
+        */
+        constexpr TBits Bits() const { return m_Bits; }
+
+        /**
+        * @brief | Bit Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns new FlagSet.
+        */
+        constexpr FlagSet operator|(const FlagSet& other) const { return FromBits(m_Bits | other.m_Bits); }
+
+        /**
+        * @brief & Bit Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns new FlagSet.
+        */
+        constexpr FlagSet operator&(const FlagSet& other) const { return FromBits(m_Bits & other.m_Bits); }
+
+        /**
+        * @brief ^ Bit Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns new FlagSet.
+        */
+        constexpr FlagSet operator^(const FlagSet& other) const { return FromBits(m_Bits ^ other.m_Bits); }
+
+        /**
+        * @brief |= Bit Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns this.
+        */
+        constexpr FlagSet& operator|=(const FlagSet& other) { m_Bits |= other.m_Bits; return *this; }
+
+        /**
+        * @brief &= Bit Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns this.
+        */
+        constexpr FlagSet& operator&=(const FlagSet& other) { m_Bits &= other.m_Bits; return *this; }
+
+        /**
+        * @brief ^= Bit Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns this.
+        */
+        constexpr FlagSet& operator^=(const FlagSet& other) { m_Bits ^= other.m_Bits; return *this; }
+
+        /**
+        * @brief == Operation.
+        *
+        * @param[in] other FlagSet.
+        *
+        * @return Returns true if equal.
+        */
+        constexpr bool operator==(const FlagSet& other) const = default;
+
+        /**
+        * @brief To TSize.
+        *
+        * @return Returns TSize.
+        */
+        constexpr explicit operator TSize() const { return static_cast<TSize>(m_Bits); }
+
+        /**
+        * @brief Set bit with value.
+        *
+        * @param[in] bit Bit item, T::Count sets all bits.
+        * @param[in] value Bit value.
+        */
+        constexpr void Set(T bit, bool value)
+        {
+            const TBits mask = ToMask(bit);
+
+            m_Bits = value ? (m_Bits | mask) : (m_Bits & ~mask);
+        }
+
+        /**
+        * @brief Test bit.
+        *
+        * @param[in] bit Bit item, T::Count tests any bit.
+        *
+        * @return Returns bit value.
+        */
+        constexpr bool Test(T bit) const { return (m_Bits & ToMask(bit)) != 0; }
+
+        /**
+        * @brief Reset all bits.
+        */
+        constexpr void Reset() { m_Bits = 0; }
+
+        /**
+        * @brief Reset bit.
+        *
+        * @param[in] bit Bit item.
+        */
+        constexpr void Reset(T bit) { m_Bits &= ~ToMask(bit); }
+
+        /**
+        * @brief Flip all bits.
+        */
+        constexpr void Flip() { m_Bits ^= Mask; }
+
+        /**
+        * @brief Flip bit.
+        *
+        * @param[in] bit Bit item.
+        */
+        constexpr void Flip(T bit) { m_Bits ^= ToMask(bit); }
+
+        /**
+        * @brief Is any bit set.
+        *
+        * @return Returns true if exist bit set.
+        */
+        constexpr bool Any() const { return m_Bits != 0; }
+
+        /**
+        * @brief Is all bits not set.
+        *
+        * @return Returns true if all bits not set.
+        */
+        constexpr bool None() const { return m_Bits == 0; }
+
+        /**
+        * @brief Count set bits.
+        *
+        * @return Returns set bits count.
+        */
+        constexpr uint32_t Count() const { return static_cast<uint32_t>(std::popcount(m_Bits)); }
+
+        /**
+        * @brief Get mask of a bit.
+        *
+        * @param[in] bit Bit item, T::Count is all bits.
+        *
+        * @return Returns mask.
+        */
+        static constexpr TBits ToMask(T bit)
+        {
+            return bit == T::Count ? Mask : TBits{ 1 } << static_cast<size_t>(static_cast<TSize>(bit));
+        }
+
+    private:
+
+        TBits m_Bits = 0;  // @brief Stored bits.
+    };
+
+}
@@ -0,0 +1,512 @@
+/**
+* @file FlatTree.hpp.
+* @brief The FlatTree Class Definitions and Implementation.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <future>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Neptune::Container {
+
+    /**
+    * @brief Node order of FlatTree.
+    */
+    enum class FlatTreeLayout : uint8_t
+    {
+        PreOrder    = 0,   /* @brief Depth first, a subtree is a contiguous range.           */
+        LevelOrder  = 1,   /* @brief Breadth first, a level is a contiguous range.           */
+    };
+
+    /**
+    * @brief Flat tree.
+    * Nodes are stored contiguously, links are indices (parent, first child, next sibling).
+    * Built in bulk from a parent array, a forest is allowed, roots are siblings of each other.
+    * Concurrent reads are safe, writes are not synchronized.
+    *
+    * @tparam T specific stored type.
+    */
+    template<typename T>
+    class FlatTree
+    {
+    public:
+
+        static constexpr uint32_t Invalid = ~0u;   // @brief Invalid index.
+
+    public:
+
+        /**
+        * @brief Constructor Function.
+        */
+        FlatTree() = default;
+
+        /**
+        * @brief Constructor Function, bulk build.
+        *
+        * @param[in] data Node data.
+        * @param[in] parents Parent index in data of each node, Invalid for roots.
+        * @param[in] layout FlatTreeLayout.
+        */
+        FlatTree(std::vector<T> data, const std::vector<uint32_t>& parents, FlatTreeLayout layout = FlatTreeLayout::PreOrder);
+
+        /**
+        * @brief Destructor Function.
+        */
+        virtual ~FlatTree() = default;
+
+        /**
+        * @brief Copy Constructor Function.
+        */
+        FlatTree(const FlatTree&) = default;
+
+        /**
+        * @brief Move Constructor Function.
+        */
+        FlatTree(FlatTree&&) noexcept = default;
+
+        /**
+        * @brief Copy Assignment Operation.
+        */
+        FlatTree& operator=(const FlatTree&) = default;
+
+        /**
+        * @brief Move Assignment Operation.
+        */
+        FlatTree& operator=(FlatTree&&) noexcept = default;
+
+        /**
+        * @brief Nodes count.
+        *
+        * @return Returns nodes count.
+        */
+        [[nodiscard]] size_t Size() const { return m_Data.size(); }
+
+        /**
+        * @brief Is this empty.
+        *
+        * @return Returns true if empty.
+        */
+        [[nodiscard]] bool Empty() const { return m_Data.empty(); }
+
+        /**
+        * @brief Get Layout.
+        *
+        * @return Returns FlatTreeLayout.
+        */
+        [[nodiscard]] FlatTreeLayout Layout() const { return m_Layout; }
+
+        /**
+        * @brief Get node data.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns node data.
+        */
+        T& operator[](uint32_t node) { return m_Data[node]; }
+
+        /**
+        * @brief Get node data.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns node data.
+        */
+        const T& operator[](uint32_t node) const { return m_Data[node]; }
+
+        /**
+        * @brief Get all nodes data in layout order.
+        *
+        * @return Returns nodes data.
+        */
+        [[nodiscard]] const std::vector<T>& GetData() const { return m_Data; }
+
+        /**
+        * @brief Get parent.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns parent index, Invalid for root.
+        */
+        [[nodiscard]] uint32_t Parent(uint32_t node) const { return m_Parent[node]; }
+
+        /**
+        * @brief Get first child.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns first child index, Invalid for leaf.
+        */
+        [[nodiscard]] uint32_t FirstChild(uint32_t node) const { return m_FirstChild[node]; }
+
+        /**
+        * @brief Get next sibling.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns next sibling index, Invalid for last child.
+        */
+        [[nodiscard]] uint32_t NextSibling(uint32_t node) const { return m_NextSibling[node]; }
+
+        /**
+        * @brief Get depth.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns depth, 0 for root.
+        */
+        [[nodiscard]] uint32_t Depth(uint32_t node) const { return m_Depth[node]; }
+
+        /**
+        * @brief Get index in data passed to constructor.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns source index.
+        */
+        [[nodiscard]] uint32_t Source(uint32_t node) const { return m_Source[node]; }
+
+        /**
+        * @brief Get subtree range, PreOrder layout only.
+        *
+        * @param[in] node Node index.
+        *
+        * @return Returns [begin, end) of nodes in subtree, node itself included.
+        */
+        [[nodiscard]] std::pair<uint32_t, uint32_t> Subtree(uint32_t node) const
+        {
+            assert(m_Layout == FlatTreeLayout::PreOrder);
+
+            return { node, m_SubtreeEnd[node] };
+        }
+
+        /**
+        * @brief Get levels count.
+        *
+        * @return Returns levels count.
+        */
+        [[nodiscard]] uint32_t LevelCount() const { return m_LevelCount; }
+
+        /**
+        * @brief Get level range, LevelOrder layout only.
+        *
+        * @param[in] depth Level depth.
+        *
+        * @return Returns [begin, end) of nodes in level.
+        */
+        [[nodiscard]] std::pair<uint32_t, uint32_t> Level(uint32_t depth) const
+        {
+            assert(m_Layout == FlatTreeLayout::LevelOrder);
+
+            return { m_LevelBegin[depth], m_LevelBegin[depth + 1] };
+        }
+
+        /**
+        * @brief Visit nodes with DFS.
+        *
+        * @param[in] fn Visitor of bool(const T&, uint32_t depth), returns false to stop.
+        */
+        template<typename F>
+        void ViewDFS(F&& fn) const;
+
+        /**
+        * @brief Visit nodes with BFS.
+        *
+        * @param[in] fn Visitor of bool(const T&, uint32_t depth), returns false to stop.
+        */
+        template<typename F>
+        void ViewBFS(F&& fn) const;
+
+        /**
+        * @brief Run a functor on every node level by level, a level is split to threads,
+        * so parents are always done before children. LevelOrder layout only.
+        *
+        * @param[in] fn Functor of void(uint32_t node), nodes of a level run concurrently.
+        * @param[in] threads Threads count, 0 for hardware concurrency.
+        * @param[in] minBatch Fewest nodes worth a thread.
+        */
+        template<typename F>
+        void ParallelForEachLevel(F&& fn, uint32_t threads = 0, uint32_t minBatch = 4096);
+
+    private:
+
+        FlatTreeLayout           m_Layout = FlatTreeLayout::PreOrder;  // @brief Layout.
+        std::vector<T>           m_Data;                               // @brief Nodes data.
+        std::vector<uint32_t>    m_Parent;                             // @brief Parent index.
+        std::vector<uint32_t>    m_FirstChild;                         // @brief First child index.
+        std::vector<uint32_t>    m_NextSibling;                        // @brief Next sibling index.
+        std::vector<uint32_t>    m_Depth;                              // @brief Depth.
+        std::vector<uint32_t>    m_Source;                             // @brief Index in constructor data.
+        std::vector<uint32_t>    m_SubtreeEnd;                         // @brief End of subtree, PreOrder only.
+        std::vector<uint32_t>    m_LevelBegin;                         // @brief Begin of levels and end of last, LevelOrder only.
+        uint32_t                 m_LevelCount = 0;                     // @brief Levels count.
+    };
+
+    template<typename T>
+    FlatTree<T>::FlatTree(std::vector<T> data, const std::vector<uint32_t>& parents, FlatTreeLayout layout)
+        : m_Layout(layout)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        assert(data.size() == parents.size());
+
+        const auto count = static_cast<uint32_t>(data.size());
+
+        // Children of each source node in source order, compressed rows.
+        std::vector<uint32_t> childBegin(count + 1, 0);
+        std::vector<uint32_t> roots;
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (parents[i] == Invalid) roots.push_back(i);
+            else                       ++childBegin[parents[i] + 1];
+        }
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            childBegin[i + 1] += childBegin[i];
+        }
+
+        std::vector<uint32_t> children(childBegin.back());
+        {
+            std::vector<uint32_t> cursor(childBegin.begin(), childBegin.end() - 1);
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                if (parents[i] != Invalid) children[cursor[parents[i]]++] = i;
+            }
+        }
+
+        // Source index of each node in layout order.
+        m_Source.reserve(count);
+
+        if (layout == FlatTreeLayout::PreOrder)
+        {
+            std::vector<uint32_t> stack(roots.rbegin(), roots.rend());
+
+            while (!stack.empty())
+            {
+                const uint32_t node = stack.back();
+                stack.pop_back();
+
+                m_Source.push_back(node);
+
+                for (uint32_t c = childBegin[node + 1]; c > childBegin[node]; --c)
+                {
+                    stack.push_back(children[c - 1]);
+                }
+            }
+        }
+        else
+        {
+            m_Source = roots;
+
+            for (size_t i = 0; i < m_Source.size(); ++i)
+            {
+                const uint32_t node = m_Source[i];
+
+                m_Source.insert(m_Source.end(), children.begin() + childBegin[node], children.begin() + childBegin[node + 1]);
+            }
+        }
+
+        assert(m_Source.size() == count && "FlatTree parents contain a cycle.");
+
+        std::vector<uint32_t> remap(count);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            remap[m_Source[i]] = i;
+        }
+
+        m_Data       .reserve(count);
+        m_Parent     .resize(count);
+        m_FirstChild .assign(count, Invalid);
+        m_NextSibling.assign(count, Invalid);
+        m_Depth      .resize(count);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const uint32_t source = m_Source[i];
+            const uint32_t parent = parents[source];
+
+            m_Data.push_back(std::move(data[source]));
+            m_Parent[i] = parent == Invalid ? Invalid : remap[parent];
+            m_Depth[i]  = parent == Invalid ? 0 : m_Depth[m_Parent[i]] + 1;
+
+            m_LevelCount = std::max(m_LevelCount, m_Depth[i] + 1);
+
+            uint32_t prev = Invalid;
+
+            for (uint32_t c = childBegin[source]; c < childBegin[source + 1]; ++c)
+            {
+                const uint32_t child = remap[children[c]];
+
+                if (prev == Invalid) m_FirstChild[i]     = child;
+                else                 m_NextSibling[prev] = child;
+
+                prev = child;
+            }
+        }
+
+        for (size_t r = 1; r < roots.size(); ++r)
+        {
+            m_NextSibling[remap[roots[r - 1]]] = remap[roots[r]];
+        }
+
+        if (layout == FlatTreeLayout::PreOrder)
+        {
+            std::vector<uint32_t> size(count, 1);
+
+            for (uint32_t i = count; i-- > 0;)
+            {
+                if (m_Parent[i] != Invalid) size[m_Parent[i]] += size[i];
+            }
+
+            m_SubtreeEnd.resize(count);
+
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                m_SubtreeEnd[i] = i + size[i];
+            }
+        }
+        else
+        {
+            m_LevelBegin.assign(m_LevelCount + 1, count);
+
+            for (uint32_t i = count; i-- > 0;)
+            {
+                m_LevelBegin[m_Depth[i]] = i;
+            }
+        }
+    }
+
+    template<typename T>
+    template<typename F>
+    void FlatTree<T>::ViewDFS(F&& fn) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_Layout == FlatTreeLayout::PreOrder)
+        {
+            for (uint32_t i = 0; i < m_Data.size(); ++i)
+            {
+                if (!std::invoke(fn, m_Data[i], m_Depth[i])) return;
+            }
+
+            return;
+        }
+
+        std::vector<uint32_t> stack;
+
+        for (uint32_t root = m_Data.empty() ? Invalid : 0; root != Invalid; root = m_NextSibling[root])
+        {
+            stack.push_back(root);
+
+            while (!stack.empty())
+            {
+                const uint32_t node = stack.back();
+                stack.pop_back();
+
+                if (!std::invoke(fn, m_Data[node], m_Depth[node])) return;
+
+                const size_t top = stack.size();
+
+                for (uint32_t child = m_FirstChild[node]; child != Invalid; child = m_NextSibling[child])
+                {
+                    stack.push_back(child);
+                }
+
+                std::reverse(stack.begin() + top, stack.end());
+            }
+        }
+    }
+
+    template<typename T>
+    template<typename F>
+    void FlatTree<T>::ViewBFS(F&& fn) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_Layout == FlatTreeLayout::LevelOrder)
+        {
+            for (uint32_t i = 0; i < m_Data.size(); ++i)
+            {
+                if (!std::invoke(fn, m_Data[i], m_Depth[i])) return;
+            }
+
+            return;
+        }
+
+        std::vector<uint32_t> queue;
+        queue.reserve(m_Data.size());
+
+        for (uint32_t root = m_Data.empty() ? Invalid : 0; root != Invalid; root = m_NextSibling[root])
+        {
+            queue.push_back(root);
+        }
+
+        for (size_t i = 0; i < queue.size(); ++i)
+        {
+            const uint32_t node = queue[i];
+
+            if (!std::invoke(fn, m_Data[node], m_Depth[node])) return;
+
+            for (uint32_t child = m_FirstChild[node]; child != Invalid; child = m_NextSibling[child])
+            {
+                queue.push_back(child);
+            }
+        }
+    }
+
+    template<typename T>
+    template<typename F>
+    void FlatTree<T>::ParallelForEachLevel(F&& fn, uint32_t threads, uint32_t minBatch)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        assert(m_Layout == FlatTreeLayout::LevelOrder);
+
+        const uint32_t workers = threads ? threads : std::max(1u, std::thread::hardware_concurrency());
+
+        std::vector<std::future<void>> futures;
+
+        for (uint32_t depth = 0; depth < m_LevelCount; ++depth)
+        {
+            const auto [begin, end] = Level(depth);
+
+            const uint32_t parts = std::clamp<uint32_t>((end - begin) / std::max(1u, minBatch), 1, workers);
+            const uint32_t step  = (end - begin + parts - 1) / parts;
+
+            auto work = [&, begin, end, step](uint32_t part) {
+                const uint32_t first = begin + part * step;
+                const uint32_t last  = std::min(end, first + step);
+
+                for (uint32_t node = first; node < last; ++node)
+                {
+                    fn(node);
+                }
+            };
+
+            futures.clear();
+
+            for (uint32_t part = 1; part < parts; ++part)
+            {
+                futures.emplace_back(std::async(std::launch::async, work, part));
+            }
+
+            work(0);
+
+            for (auto& future : futures)
+            {
+                future.get();
+            }
+        }
+    }
+}
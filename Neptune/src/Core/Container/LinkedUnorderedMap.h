@@ -10,14 +10,20 @@
 
 #include <unordered_map>
 #include <shared_mutex>
-#include <list>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <optional>
 
 namespace Neptune::Container {
 
 	/**
 	* @brief The container combines hashmap and list together.
 	* Used in the case that we want iter a hashmap in order.
-	* Thread Safe.
+	* Each hashmap node carries intrusive prev/next links, so Erase, Prev and Next are O(1).
+	* With a capacity it works as a LRU cache: Touch moves an element to end, PushBack evicts from begin.
+	* Thread Safe, each operation takes the lock once.
+	* No reference into the map escapes the lock: lookups return copies, Visit runs a functor under the lock.
 	*/
 	template<typename K, typename V>
 	class LinkedUnorderedMap
@@ -26,9 +32,11 @@ namespace Neptune::Container {
 
 		/**
 		* @brief Constructor Function.
+		*
+		* @param[in] capacity Max elements count in LRU mode, 0 for unbounded.
 		*/
-		LinkedUnorderedMap()
-			: m_Size(0)
+		explicit LinkedUnorderedMap(size_t capacity = 0)
+			: m_Capacity(capacity)
 		{};
 
 		/**
@@ -36,6 +44,20 @@ namespace Neptune::Container {
 		*/
 		virtual ~LinkedUnorderedMap() = default;
 
+		/**
+		* @brief Copy Constructor Function.
+		*
+		* @note Links point into nodes, this Class not allowed copy behaves.
+		*/
+		LinkedUnorderedMap(const LinkedUnorderedMap&) = delete;
+
+		/**
+		* @brief Copy Assignment Operation.
+		*
+		* @note Links point into nodes, this Class not allowed copy behaves.
+		*/
+		LinkedUnorderedMap& operator=(const LinkedUnorderedMap&) = delete;
+
 		/**
 		* @brief Clear this container's data.
 		*/
@@ -43,101 +65,168 @@ namespace Neptune::Container {
 
 		/**
 		* @brief The container's element size.
-		* 
+		*
 		* @return Returns the size of the container.
 		*/
 		size_t Size() const;
 
 		/**
-		* @brief Add an element to this container.
-		* 
+		* @brief Get LRU capacity.
+		*
+		* @return Returns capacity, 0 for unbounded.
+		*/
+		size_t Capacity() const;
+
+		/**
+		* @brief Set LRU capacity, evicts from begin if exceeded.
+		*
+		* @param[in] capacity Max elements count, 0 for unbounded.
+		*/
+		void SetCapacity(size_t capacity);
+
+		/**
+		* @brief Add an element to end of this container.
+		* An existing key keeps its position, or moves to end in LRU mode.
+		*
 		* @param[in] key K the key.
 		* @param[in] value V the value.
 		*/
-		void PushBack(const K& key, const V& value);
+		void PushBack(const K& key, V value);
 
 		/**
 		* @brief Find the value by key.
-		* 
+		*
+		* @param[in] key K the key.
+		*
+		* @return Returns copy of value, empty if not exist.
+		*/
+		std::optional<V> At(const K& key) const;
+
+		/**
+		* @brief Find the value by key and move it to end, a LRU hit.
+		*
 		* @param[in] key K the key.
-		* 
-		* @return Returns the value that founded.
+		*
+		* @return Returns copy of value, empty if not exist.
 		*/
-		V& At(const K& key);
+		std::optional<V> Touch(const K& key);
+
+		/**
+		* @brief Visit the value by key exclusively, order is kept.
+		*
+		* @param[in] key K the key.
+		* @param[in] fn Functor of void(V&), called under the lock.
+		*
+		* @return Returns true if found.
+		*/
+		template<typename F>
+		bool Visit(const K& key, F&& fn);
 
 		/**
 		* @brief Determine whether the key is in the container.
-		* 
+		*
 		* @param[in] key K the key.
-		* 
+		*
 		* @return Returns true if it has key inside the container.
 		*/
 		bool Contains(const K& key) const;
 
 		/**
 		* @brief Remove an element inside the container if founded by key.
-		* 
+		*
 		* @param[in] key K the key.
+		*
+		* @return Returns true if removed.
 		*/
-		void Erase(const K& key);
+		bool Erase(const K& key);
 
 		/**
 		* @brief Iter the container in order.
-		* 
+		*
 		* @param[in] fn The function of how to iter the container.
 		*/
 		template<typename F>
 		void ForEach(F&& fn);
-		
+
 		/**
 		* @brief Get the previous element by the key.
-		* 
+		*
 		* @param[in] key the key.
-		* 
-		* @return Returns the previous element.
-		* 
-		* @note It's slow, so do not use it unnecessary. 
+		*
+		* @return Returns copy of the previous element, empty if not exist.
 		*/
-		V& Prev(const K& key);
+		std::optional<V> Prev(const K& key) const;
 
 		/**
 		* @brief Get the next element by the key.
-		* 
+		*
 		* @param[in] key the key.
-		* 
-		* @return Returns the next element.
-		* 
-		* @note It's slow, so do not use it unnecessary. 
+		*
+		* @return Returns copy of the next element, empty if not exist.
 		*/
-		V& Next(const K& key);
+		std::optional<V> Next(const K& key) const;
 
 		/**
 		* @brief Get the first element of this container.
-		* 
-		* @return Returns the first element found.
+		*
+		* @return Returns copy of the first element, empty if empty.
 		*/
-		V& Begin();
+		std::optional<V> Begin() const;
 
 		/**
 		* @brief Get the end element of this container.
-		* 
-		* @return Returns the end element found.
+		*
+		* @return Returns copy of the end element, empty if empty.
+		*/
+		std::optional<V> End() const;
+
+		/**
+		* @brief Get the end key of this container.
+		*
+		* @return Returns copy of the end key, empty if empty.
+		*/
+		std::optional<K> EndK() const;
+
+	private:
+
+		/**
+		* @brief Hashmap node value with intrusive links.
+		*/
+		struct Node
+		{
+			V            value;               // @brief The value.
+			const K*     key  = nullptr;      // @brief The key stored by hashmap node.
+			Node*        prev = nullptr;      // @brief Previous node in order.
+			Node*        next = nullptr;      // @brief Next node in order.
+		};
+
+		/**
+		* @brief Link a node to end.
+		*
+		* @param[in] node Node.
+		*/
+		void LinkBack(Node* node);
+
+		/**
+		* @brief Unlink a node.
+		*
+		* @param[in] node Node.
 		*/
-		V& End();
+		void Unlink(Node* node);
 
 		/**
-		* @breif Get the end key of this container.
-		* 
-		* @return Returns the end key found.
+		* @brief Evict from begin until capacity satisfied.
 		*/
-		const K& EndK();
-		
+		void Evict();
+
 	private:
-		
-		std::list<K> m_Keys;                 // @brief The container keeps iter in order.
-		std::unordered_map<K, V> m_Map;      // @breif The container keeps quick search.
-		mutable std::shared_mutex m_Mutex;   // @brief Mutex for this container.
-		std::atomic_int m_Size;              // @brief This container size.
+
+		std::unordered_map<K, Node> m_Map;             // @brief The container keeps quick search, nodes are stable.
+		Node*                       m_Head = nullptr;  // @brief First node in order.
+		Node*                       m_Tail = nullptr;  // @brief Last node in order.
+		size_t                      m_Capacity;        // @brief LRU capacity, 0 for unbounded.
+		mutable std::shared_mutex   m_Mutex;           // @brief Mutex for this container.
+		std::atomic<size_t>         m_Size{ 0 };       // @brief This container size.
 	};
 
 	template<typename K, typename V>
@@ -145,8 +234,9 @@ namespace Neptune::Container {
 	{
 		std::unique_lock lock(m_Mutex);
 
-		m_Keys.clear();
 		m_Map.clear();
+		m_Head = nullptr;
+		m_Tail = nullptr;
 		m_Size = 0;
 	}
 
@@ -157,35 +247,96 @@ namespace Neptune::Container {
 	}
 
 	template<typename K, typename V>
-	inline void LinkedUnorderedMap<K, V>::PushBack(const K& key, const V& value)
+	inline size_t LinkedUnorderedMap<K, V>::Capacity() const
 	{
-		auto hasKey = Contains(key);
+		std::shared_lock lock(m_Mutex);
+
+		return m_Capacity;
+	}
 
+	template<typename K, typename V>
+	inline void LinkedUnorderedMap<K, V>::SetCapacity(size_t capacity)
+	{
 		std::unique_lock lock(m_Mutex);
 
-		if (!hasKey)
+		m_Capacity = capacity;
+
+		Evict();
+	}
+
+	template<typename K, typename V>
+	inline void LinkedUnorderedMap<K, V>::PushBack(const K& key, V value)
+	{
+		std::unique_lock lock(m_Mutex);
+
+		auto [it, inserted] = m_Map.try_emplace(key);
+
+		Node* node = &it->second;
+
+		node->value = std::move(value);
+
+		if (inserted)
 		{
-			m_Keys.push_back(key);
+			node->key = &it->first;
+
+			LinkBack(node);
 
 			++m_Size;
+
+			Evict();
+		}
+		else if (m_Capacity != 0 && node != m_Tail)
+		{
+			Unlink(node);
+			LinkBack(node);
 		}
+	}
+
+	template<typename K, typename V>
+	inline std::optional<V> LinkedUnorderedMap<K, V>::At(const K& key) const
+	{
+		std::shared_lock lock(m_Mutex);
+
+		auto it = m_Map.find(key);
+
+		if (it == m_Map.end()) return std::nullopt;
 
-		m_Map[key] = value;
+		return it->second.value;
 	}
 
 	template<typename K, typename V>
-	inline V& LinkedUnorderedMap<K, V>::At(const K& key)
+	inline std::optional<V> LinkedUnorderedMap<K, V>::Touch(const K& key)
 	{
-		auto hasKey = Contains(key);
+		std::unique_lock lock(m_Mutex);
 
-		std::shared_lock lock(m_Mutex);
+		auto it = m_Map.find(key);
+
+		if (it == m_Map.end()) return std::nullopt;
 
-		if (hasKey)
+		Node* node = &it->second;
+
+		if (node != m_Tail)
 		{
-			return m_Map[key];
+			Unlink(node);
+			LinkBack(node);
 		}
 
-		return {};
+		return node->value;
+	}
+
+	template<typename K, typename V>
+	template<typename F>
+	inline bool LinkedUnorderedMap<K, V>::Visit(const K& key, F&& fn)
+	{
+		std::unique_lock lock(m_Mutex);
+
+		auto it = m_Map.find(key);
+
+		if (it == m_Map.end()) return false;
+
+		std::invoke(fn, it->second.value);
+
+		return true;
 	}
 
 	template<typename K, typename V>
@@ -197,20 +348,21 @@ namespace Neptune::Container {
 	}
 
 	template<typename K, typename V>
-	inline void LinkedUnorderedMap<K, V>::Erase(const K& key)
+	inline bool LinkedUnorderedMap<K, V>::Erase(const K& key)
 	{
 		std::unique_lock lock(m_Mutex);
 
 		auto it = m_Map.find(key);
-		
-		if (it != m_Map.end())
-		{
-			m_Keys.remove(key);
-			
-			m_Map.erase(it);
 
-			--m_Size;
-		}
+		if (it == m_Map.end()) return false;
+
+		Unlink(&it->second);
+
+		m_Map.erase(it);
+
+		--m_Size;
+
+		return true;
 	}
 
 	template<typename K, typename V>
@@ -219,87 +371,113 @@ namespace Neptune::Container {
 	{
 		std::shared_lock lock(m_Mutex);
 
-		for (const K& key : m_Keys)
+		for (Node* node = m_Head; node; node = node->next)
 		{
 			/**
 			* @brief The function defines how to iter.
-			* 
+			*
 			* @param[in] key K the key.
 			* @param[in] value V the value.
-			* 
+			*
 			* @return Retunrs True if want break this for loop.
 			*/
-			if(std::invoke(fn, key, m_Map[key])) break;
+			if(std::invoke(fn, *node->key, node->value)) break;
 		}
 	}
 
 	template<typename K, typename V>
-	inline V& LinkedUnorderedMap<K, V>::Prev(const K& key)
+	inline std::optional<V> LinkedUnorderedMap<K, V>::Prev(const K& key) const
 	{
-		if (!Contains(key)) return {};
-
 		std::shared_lock lock(m_Mutex);
-		
-		if (key == m_Keys.front()) return {};
-		
-		for (auto it = m_Keys.begin(); it != m_Keys.end(); ++it)
-		{
-			if (*it == key)
-			{
-				return (*std::prev(it));
-			}
-		}
 
-		return {};
+		auto it = m_Map.find(key);
+
+		if (it == m_Map.end() || !it->second.prev) return std::nullopt;
+
+		return it->second.prev->value;
 	}
 
 	template<typename K, typename V>
-	inline V& LinkedUnorderedMap<K, V>::Next(const K& key)
+	inline std::optional<V> LinkedUnorderedMap<K, V>::Next(const K& key) const
 	{
-		if (!Contains(key)) return {};
-
 		std::shared_lock lock(m_Mutex);
-		
-		if (key == m_Keys.back()) return {};
-		
-		for (auto it = m_Keys.begin(); it != m_Keys.end(); ++it)
-		{
-			if (*it == key)
-			{
-				return (*std::next(it));
-			}
-		}
 
-		return {};
+		auto it = m_Map.find(key);
+
+		if (it == m_Map.end() || !it->second.next) return std::nullopt;
+
+		return it->second.next->value;
 	}
 
 	template<typename K, typename V>
-	V& LinkedUnorderedMap<K, V>::Begin()
+	std::optional<V> LinkedUnorderedMap<K, V>::Begin() const
 	{
 		std::shared_lock lock(m_Mutex);
 
-		if (Size() == 0) return {};
+		if (!m_Head) return std::nullopt;
 
-		return m_Map[m_Keys.front()];
+		return m_Head->value;
 	}
 
 	template<typename K, typename V>
-	V& LinkedUnorderedMap<K, V>::End()
+	std::optional<V> LinkedUnorderedMap<K, V>::End() const
 	{
 		std::shared_lock lock(m_Mutex);
 
-		if (Size() == 0) return {};
+		if (!m_Tail) return std::nullopt;
 
-		return m_Map[m_Keys.back()];
+		return m_Tail->value;
 	}
 
 	template<typename K, typename V>
-	const K& LinkedUnorderedMap<K, V>::EndK()
+	std::optional<K> LinkedUnorderedMap<K, V>::EndK() const
 	{
 		std::shared_lock lock(m_Mutex);
 
-		if (Size() == 0) return {};
+		if (!m_Tail) return std::nullopt;
+
+		return *m_Tail->key;
+	}
+
+	template<typename K, typename V>
+	inline void LinkedUnorderedMap<K, V>::LinkBack(Node* node)
+	{
+		node->prev = m_Tail;
+		node->next = nullptr;
+
+		if (m_Tail) m_Tail->next = node;
+		else        m_Head       = node;
+
+		m_Tail = node;
+	}
 
-		return m_Keys.back();
+	template<typename K, typename V>
+	inline void LinkedUnorderedMap<K, V>::Unlink(Node* node)
+	{
+		if (node->prev) node->prev->next = node->next;
+		else            m_Head           = node->next;
+
+		if (node->next) node->next->prev = node->prev;
+		else            m_Tail           = node->prev;
+
+		node->prev = nullptr;
+		node->next = nullptr;
+	}
+
+	template<typename K, typename V>
+	inline void LinkedUnorderedMap<K, V>::Evict()
+	{
+		if (m_Capacity == 0) return;
+
+		while (m_Map.size() > m_Capacity)
+		{
+			Node* node = m_Head;
+
+			Unlink(node);
+
+			m_Map.erase(m_Map.find(*node->key));
+
+			--m_Size;
+		}
 	}
-}
\ No newline at end of file
+}
@@ -6,16 +6,34 @@
 
 #pragma once
 #include "Core/Core.h"
+
+#include <array>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <shared_mutex>
+#include <unordered_map>
 
 namespace Neptune::Container {
 
 	/**
-	* @brief Thread safe std::unordered_map.
+	* @brief Thread safe std::unordered_map, striped into shards.
+	* Each shard owns a std::unordered_map and a std::shared_mutex, a key only locks its shard,
+	* so threads working on different keys rarely contend.
+	* No reference into the map escapes a lock: Find returns a copy, Visit runs a functor under the shard lock.
+	* Functors must not call back into the same map.
+	*
+	* @tparam K Key.
+	* @tparam V Value.
+	* @tparam Hash Hash of K.
+	* @tparam ShardCount Shards count, power of two.
 	*/
-	template<typename K, typename V>
+	template<typename K, typename V, typename Hash = std::hash<K>, size_t ShardCount = 16>
 	class ThreadUnorderedMap
 	{
+		static_assert(ShardCount > 0 && (ShardCount & (ShardCount - 1)) == 0, "ShardCount must be power of two.");
+
 	public:
 
 		/**
@@ -29,106 +47,232 @@ namespace Neptune::Container {
 		virtual ~ThreadUnorderedMap() = default;
 
 		/**
-		* @brief Is this queue is empty.
-		* 
-		* @reutrn Returns true if empty.
+		* @brief Is this map empty.
+		*
+		* @return Returns true if empty.
+		*/
+		bool Empty() const { return m_Count.load(std::memory_order_relaxed) == 0; }
+
+		/**
+		* @brief Elements count, may be stale while other threads write.
+		*
+		* @return Returns elements count.
+		*/
+		size_t Size() const { return m_Count.load(std::memory_order_relaxed); }
+
+		/**
+		* @brief Insert an element if key not exist.
+		*
+		* @param[in] k Key.
+		* @param[in] v Value.
+		*
+		* @return Returns true if inserted.
 		*/
-		bool Empty() const { return m_Count.load() == 0; }
+		bool Insert(const K& k, V v);
 
 		/**
-		* @brief Insert an element to this.
-		* 
+		* @brief Insert an element or assign value of existing key.
+		*
 		* @param[in] k Key.
 		* @param[in] v Value.
+		*
+		* @return Returns true if inserted, false if assigned.
+		*/
+		bool InsertOrAssign(const K& k, V v);
+
+		/**
+		* @brief Find element in this map.
+		*
+		* @param[in] k Key.
+		*
+		* @return Returns copy of value, empty if not found.
 		*/
-		void Insert(const K& k, const V& v);
+		std::optional<V> Find(const K& k) const;
 
 		/**
-		* @brief Find element in this unordered_map.
-		* 
+		* @brief Visit element exclusively.
+		*
 		* @param[in] k Key.
-		* 
-		* @return Returns value.
+		* @param[in] fn Functor of void(V&), called under shard lock.
+		*
+		* @return Returns true if found.
+		*/
+		template<typename F>
+		bool Visit(const K& k, F&& fn);
+
+		/**
+		* @brief Visit all elements, shard by shard, not a snapshot of whole map.
+		*
+		* @param[in] fn Functor of void(const K&, const V&), called under shard shared lock.
 		*/
-		V& At(const K& k);
+		template<typename F>
+		void VisitAll(F&& fn) const;
 
 		/**
-		* @brief Erase element in this unordered_map.
-		* 
+		* @brief Erase element in this map.
+		*
 		* @param[in] k Key.
+		*
+		* @return Returns true if erased.
 		*/
-		void Erase(const K& k);
-		
+		bool Erase(const K& k);
+
 		/**
-		* @brief Is element in this unordered_map.
-		* 
+		* @brief Is element in this map.
+		*
 		* @param[in] k Key.
-		* 
+		*
 		* @return Returns true if found.
 		*/
 		bool Contains(const K& k) const;
 
 		/**
-		* @brief Clear this unordered_map.
+		* @brief Clear this map.
 		*/
 		void Clear();
 
 	private:
-		
-		mutable std::shared_mutex m_Mutex;    // @brief Mutex of this queue.
-		std::unordered_map<K, V> m_Map;       // @brief This wrapped unordered_map.
-		std::atomic_uint32_t m_Count;         // @brief elements of this unordered_map.
-		
-	};
-	
-	template<typename K, typename V>
-	inline void ThreadUnorderedMap<K, V>::Insert(const K& k, const V& v)
-	{
-		std::unique_lock lock(m_Mutex);
 
-		if (!Contains(k))
+		/**
+		* @brief Shard, aligned to avoid false sharing of mutexes.
+		*/
+		struct alignas(64) Shard
+		{
+			std::shared_mutex                 mutex;  // @brief Mutex of this shard.
+			std::unordered_map<K, V, Hash>    map;    // @brief Elements of this shard.
+		};
+
+		/**
+		* @brief Get shard of a key.
+		*
+		* @param[in] k Key.
+		*
+		* @return Returns Shard.
+		*/
+		Shard& ShardOf(const K& k) const
 		{
-			++m_Count;
+			/**
+			* @brief Fibonacci hashing, std::hash of integers is identity and its low bits repeat.
+			*/
+			const uint64_t h = static_cast<uint64_t>(Hash{}(k)) * 0x9E3779B97F4A7C15ull;
+
+			return m_Shards[static_cast<size_t>(h >> 32) & (ShardCount - 1)];
 		}
-		
-		m_Map[k] = v;
+
+	private:
+
+		mutable std::array<Shard, ShardCount> m_Shards;    // @brief Shards.
+		std::atomic<size_t>                   m_Count{ 0 }; // @brief elements of this map.
+	};
+
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	inline bool ThreadUnorderedMap<K, V, Hash, ShardCount>::Insert(const K& k, V v)
+	{
+		auto& shard = ShardOf(k);
+
+		std::unique_lock lock(shard.mutex);
+
+		const bool inserted = shard.map.try_emplace(k, std::move(v)).second;
+
+		if (inserted) m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		return inserted;
+	}
+
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	inline bool ThreadUnorderedMap<K, V, Hash, ShardCount>::InsertOrAssign(const K& k, V v)
+	{
+		auto& shard = ShardOf(k);
+
+		std::unique_lock lock(shard.mutex);
+
+		const bool inserted = shard.map.insert_or_assign(k, std::move(v)).second;
+
+		if (inserted) m_Count.fetch_add(1, std::memory_order_relaxed);
+
+		return inserted;
+	}
+
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	inline std::optional<V> ThreadUnorderedMap<K, V, Hash, ShardCount>::Find(const K& k) const
+	{
+		auto& shard = ShardOf(k);
+
+		std::shared_lock lock(shard.mutex);
+
+		const auto it = shard.map.find(k);
+
+		if (it == shard.map.end()) return std::nullopt;
+
+		return it->second;
+	}
+
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	template<typename F>
+	inline bool ThreadUnorderedMap<K, V, Hash, ShardCount>::Visit(const K& k, F&& fn)
+	{
+		auto& shard = ShardOf(k);
+
+		std::unique_lock lock(shard.mutex);
+
+		const auto it = shard.map.find(k);
+
+		if (it == shard.map.end()) return false;
+
+		std::invoke(fn, it->second);
+
+		return true;
 	}
-	
-	template<typename K, typename V>
-	inline V& ThreadUnorderedMap<K, V>::At(const K& k)
+
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	template<typename F>
+	inline void ThreadUnorderedMap<K, V, Hash, ShardCount>::VisitAll(F&& fn) const
 	{
-		std::shared_lock lock(m_Mutex);
+		for (auto& shard : m_Shards)
+		{
+			std::shared_lock lock(shard.mutex);
 
-		return m_Map[k];
+			for (const auto& [k, v] : shard.map)
+			{
+				std::invoke(fn, k, v);
+			}
+		}
 	}
-	
-	template<typename K, typename V>
-	inline void ThreadUnorderedMap<K, V>::Erase(const K& k)
+
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	inline bool ThreadUnorderedMap<K, V, Hash, ShardCount>::Erase(const K& k)
 	{
-		std::unique_lock lock(m_Mutex);
+		auto& shard = ShardOf(k);
+
+		std::unique_lock lock(shard.mutex);
+
+		if (shard.map.erase(k) == 0) return false;
+
+		m_Count.fetch_sub(1, std::memory_order_relaxed);
 
-		if (!Contains(k)) return;
-		
-		m_Map.erase(k);
-		
-		--m_Count;
+		return true;
 	}
 
-	template<typename K, typename V>
-	inline bool ThreadUnorderedMap<K, V>::Contains(const K& k) const
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	inline bool ThreadUnorderedMap<K, V, Hash, ShardCount>::Contains(const K& k) const
 	{
-		std::shared_lock lock(m_Mutex);
+		auto& shard = ShardOf(k);
 
-		return m_Map.contains(k);
+		std::shared_lock lock(shard.mutex);
+
+		return shard.map.contains(k);
 	}
 
-	template<typename K, typename V>
-	inline void ThreadUnorderedMap<K, V>::Clear()
+	template<typename K, typename V, typename Hash, size_t ShardCount>
+	inline void ThreadUnorderedMap<K, V, Hash, ShardCount>::Clear()
 	{
-		std::unique_lock lock(m_Mutex);
+		for (auto& shard : m_Shards)
+		{
+			std::unique_lock lock(shard.mutex);
 
-		m_Map.clear();
-		
-		m_Count = 0;
+			m_Count.fetch_sub(shard.map.size(), std::memory_order_relaxed);
+
+			shard.map.clear();
+		}
 	}
-}
\ No newline at end of file
+}
@@ -6,15 +6,23 @@
 
 #pragma once
 #include "Core/Core.h"
-#include "Core/Container/LinkedUnorderedMap.h"
 
-#include <functional>
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
 
 namespace Neptune {
 
 	/**
 	* @brief Basic Class of Delegate.
 	* Instance inherited from it and use delegate feature.
+	* Agents are published as an immutable snapshot, Bind and UnBind copy it and swap the pointer (copy on write).
+	* Broadcast only counts itself as a reader and loads the pointer, so it never locks nor allocates.
+	* Replaced snapshots are freed by a later writer once no Broadcast is running.
+	* Copies of a Delegate share the same Agents.
 	*/
 	template<typename... Args>
 	class Delegate_Basic
@@ -22,11 +30,59 @@ namespace Neptune {
 	public:
 
 		/**
-		* @brief Agent Function.
-		* 
-		* @tparam Args
+		* @brief Subscription Handle, 0 is invalid.
 		*/
-		using Agent = std::function<void(Args...)>;
+		using Handle = uint64_t;
+
+		/**
+		* @brief Agent Function, small buffer callable of void(Args...).
+		* Functor is stored inline and copied bytewise, nothing is allocated.
+		*/
+		class Agent
+		{
+		public:
+
+			static constexpr size_t Capacity = 32;   // @brief Inline storage bytes.
+
+			/**
+			* @brief Constructor Function.
+			*/
+			Agent() = default;
+
+			/**
+			* @brief Constructor Function.
+			*
+			* @tparam F Functor type.
+			* @param[in] fn Functor.
+			*/
+			template<typename F> requires (!std::is_same_v<std::decay_t<F>, Agent>)
+			Agent(F&& fn)
+			{
+				using Fn = std::decay_t<F>;
+
+				static_assert(sizeof(Fn) <= Capacity, "Agent functor exceeds inline storage.");
+				static_assert(alignof(Fn) <= alignof(std::max_align_t), "Agent functor is over aligned.");
+				static_assert(std::is_trivially_copyable_v<Fn> && std::is_trivially_destructible_v<Fn>, "Agent functor must be trivially copyable.");
+
+				::new (static_cast<void*>(m_Storage)) Fn(std::forward<F>(fn));
+
+				m_Invoke = [](const void* storage, Args... args) {
+					(*std::launder(static_cast<Fn*>(const_cast<void*>(storage))))(std::forward<Args>(args)...);
+				};
+			}
+
+			/**
+			* @brief Invoke Agent.
+			*
+			* @param[in] args Params.
+			*/
+			void operator()(Args... args) const { m_Invoke(m_Storage, std::forward<Args>(args)...); }
+
+		private:
+
+			alignas(std::max_align_t) std::byte   m_Storage[Capacity]{};   // @brief Inline functor.
+			void(*m_Invoke)(const void*, Args...) = nullptr;               // @brief Type erased invoker.
+		};
 
 	public:
 
@@ -35,7 +91,7 @@ namespace Neptune {
 		*/
 		Delegate_Basic()
 		{
-			m_Agents = CreateSP<Container::LinkedUnorderedMap<uint64_t, Agent>>();
+			m_State = CreateSP<State>();
 		}
 
 		/**
@@ -44,97 +100,216 @@ namespace Neptune {
 		virtual ~Delegate_Basic() = default;
 
 		/**
-		* @brief Bind Function pointer to delegate.
-		* 
-		* @param[in] func Function pointer.
-		* 
-		* @return Returns true if bind successfully.
+		* @brief Bind Function to delegate.
+		*
+		* @param[in] agent Agent Function.
+		*
+		* @return Returns Handle used for UnBind.
 		*/
-		bool Bind(std::function<void(Args...)> func);
+		Handle Bind(Agent agent);
 
 		/**
-		* @brief UnBind Function pointer from delegate.
-		* 
-		* @param[in] func Function pointer.
-		* 
+		* @brief UnBind Function from delegate.
+		*
+		* @param[in] handle Handle returned by Bind.
+		*
 		* @return Returns true if unbind successfully.
 		*/
-		bool UnBind(std::function<void(Args...)> func);
+		bool UnBind(Handle handle);
 
 		/**
 		* @brief Get size of Agents.
-		* 
+		*
 		* @return Returns the size of Agents.
 		*/
-		size_t Size() const { return m_Agents->size(); }
+		size_t Size() const;
 
 		/**
 		* @brief Determine if this Delegate is empty;
-		* 
+		*
 		* @return Returns true if empty.
 		*/
-		bool Empty() const { return m_Agents->size() == 0; }
+		bool Empty() const { return Size() == 0; }
 
 		/**
-		* @brief Execute all function pointer. 
-		* 
+		* @brief Execute all Agents in bound order.
+		* Agents bound or unbound during Broadcast take effect at next Broadcast.
+		*
 		* @param[in] args .
 		*/
-		void Broadcast(Args&&... args);
+		void Broadcast(Args... args) const;
+
+	private:
+
+		/**
+		* @brief Bound Agent.
+		*/
+		struct Entry
+		{
+			Handle handle;   // @brief Handle.
+			Agent  agent;    // @brief Agent.
+		};
+
+		/**
+		* @brief Immutable Agents snapshot.
+		*/
+		using Snapshot = std::vector<Entry>;
+
+		/**
+		* @brief Shared state of Delegate copies.
+		*/
+		struct State
+		{
+			/**
+			* @brief Destructor Function.
+			*/
+			~State()
+			{
+				delete current.load(std::memory_order_relaxed);
+
+				for (auto snapshot : retired)
+				{
+					delete snapshot;
+				}
+			}
+
+			std::atomic<const Snapshot*>  current{ nullptr };   // @brief Published snapshot.
+			mutable std::atomic<uint32_t> readers{ 0 };         // @brief Running Broadcasts.
+			std::mutex                    writer;               // @brief Mutex of Bind and UnBind.
+			std::vector<const Snapshot*>  retired;              // @brief Replaced snapshots not freed yet.
+			Handle                        next = 1;             // @brief Next Handle.
+		};
+
+		/**
+		* @brief Publish a new snapshot and free replaced ones if no Broadcast is running.
+		* Must be called with writer locked.
+		*
+		* @param[in] snapshot New snapshot.
+		*/
+		void Publish(const Snapshot* snapshot);
 
 	private:
-		
-		SP<Container::LinkedUnorderedMap<uint64_t, Agent>> m_Agents;  // @brief Map of Agent Function Pointer.
+
+		SP<State> m_State;  // @brief Shared Agents state.
 	};
 
 	template<typename ...Args>
-	inline bool Delegate_Basic<Args...>::Bind(std::function<void(Args...)> func)
+	inline typename Delegate_Basic<Args...>::Handle Delegate_Basic<Args...>::Bind(Agent agent)
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		uint64_t* addr = reinterpret_cast<uint64_t*>(&func);
-		
-		if (m_Agents->Contains(*addr))
+		std::unique_lock<std::mutex> lock(m_State->writer);
+
+		const auto current = m_State->current.load(std::memory_order_acquire);
+
+		auto snapshot = current ? new Snapshot(*current) : new Snapshot();
+
+		const Handle handle = m_State->next++;
+
+		snapshot->push_back({ handle, agent });
+
+		Publish(snapshot);
+
+		return handle;
+	}
+
+	template<typename ...Args>
+	inline bool Delegate_Basic<Args...>::UnBind(Handle handle)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		std::unique_lock<std::mutex> lock(m_State->writer);
+
+		const auto current = m_State->current.load(std::memory_order_acquire);
+
+		if (!current)
 		{
-			NEPTUNE_CORE_WARN("Agent Function binding repeatedly.")
-			
+			NEPTUNE_CORE_WARN("Agent Function not bound yet.")
+
 			return false;
 		}
-		
-		m_Agents->PushBack(*addr, func);
+
+		auto snapshot = new Snapshot();
+		snapshot->reserve(current->size());
+
+		for (const auto& entry : *current)
+		{
+			if (entry.handle != handle)
+			{
+				snapshot->push_back(entry);
+			}
+		}
+
+		if (snapshot->size() == current->size())
+		{
+			delete snapshot;
+
+			NEPTUNE_CORE_WARN("Agent Function not bound yet.")
+
+			return false;
+		}
+
+		Publish(snapshot);
 
 		return true;
 	}
 
 	template<typename ...Args>
-	inline bool Delegate_Basic<Args...>::UnBind(std::function<void(Args...)> func)
+	inline size_t Delegate_Basic<Args...>::Size() const
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		uint64_t* addr = reinterpret_cast<uint64_t*>(&func);
-		if (!m_Agents->has_key(*addr))
+		m_State->readers.fetch_add(1);
+
+		const auto current = m_State->current.load();
+		const size_t size = current ? current->size() : 0;
+
+		m_State->readers.fetch_sub(1, std::memory_order_release);
+
+		return size;
+	}
+
+	template<typename ...Args>
+	inline void Delegate_Basic<Args...>::Broadcast(Args... args) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		/**
+		* @brief Count as reader before loading, a writer seeing no reader after swapping knows old snapshots are unused.
+		*/
+		m_State->readers.fetch_add(1);
+
+		if (const auto current = m_State->current.load())
 		{
-			NEPTUNE_CORE_WARN("Agent Function not bound yet.")
-			
-			return false;
+			// Passed as lvalues, an Agent moving an argument out would leave the next one a moved-from value.
+			for (const auto& entry : *current)
+			{
+				entry.agent(args...);
+			}
 		}
-		
-		m_Agents->Erase(*addr);
 
-		return true;
+		m_State->readers.fetch_sub(1, std::memory_order_release);
 	}
 
 	template<typename ...Args>
-	inline void Delegate_Basic<Args...>::Broadcast(Args&&... args)
+	inline void Delegate_Basic<Args...>::Publish(const Snapshot* snapshot)
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		m_Agents->ForEach([&](const auto& k, const auto& v) -> bool {
-			
-			std::invoke(v, std::forward<Args>(args)...);
-			
-			return false;
-		});
+		if (const auto old = m_State->current.exchange(snapshot))
+		{
+			m_State->retired.push_back(old);
+		}
+
+		if (m_State->readers.load() == 0)
+		{
+			for (auto retired : m_State->retired)
+			{
+				delete retired;
+			}
+
+			m_State->retired.clear();
+		}
 	}
 
 /**
@@ -147,6 +322,6 @@ namespace Neptune {
 	public:                                                                \
 		Delegate##name() : Neptune::Delegate_Basic<__VA_ARGS__>() {}       \
 		~Delegate##name() override = default;                              \
-	}; 
+	};
 
-}
\ No newline at end of file
+}
@@ -7,7 +7,7 @@
 #pragma once
 #include "Core/Core.h"
 #include "Event.h"
-#include "Core/Container/BitSet.hpp"
+#include "Core/Container/FlagSet.hpp"
 
 namespace Neptune {
     
@@ -36,7 +36,7 @@ namespace Neptune {
         * 
         * @param[in] flag Input EngineEventBit.
         */
-        EngineEvent(const Container::BitSet<EngineEventBit>& flag)
+        EngineEvent(const Container::FlagSet<EngineEventBit>& flag)
             : m_Flag(flag)
         {}
 
@@ -47,9 +47,7 @@ namespace Neptune {
         */
         EngineEvent(EngineEventBit bit)
             : m_Flag(bit)
-        {
-            m_Flag.Set(bit, true);
-        }
+        {}
 
         /**
         * @brief Destructor Function.
@@ -91,6 +89,6 @@ namespace Neptune {
 
     private:
 
-        Container::BitSet<EngineEventBit> m_Flag{};   // @brief EngineEventBit.
+        Container::FlagSet<EngineEventBit> m_Flag{};  // @brief EngineEventBit.
     };
 }
\ No newline at end of file
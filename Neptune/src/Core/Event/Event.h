@@ -6,9 +6,10 @@
 
 #pragma once
 #include "Core/Core.h"
-#include "Core/Container/BitSet.hpp"
+#include "Core/Container/FlagSet.hpp"
 
-#include <functional>
+#include <ostream>
+#include <string>
 
 namespace Neptune {
 
@@ -62,24 +63,6 @@ namespace Neptune {
         Count                     = 7
     };
 
-namespace Detail {
-
-    /**
-    * @brief Set Event Categories.
-    * 
-    * @param[in] flags The Event Categories.
-    * @param[in] categories The Categories.
-    */
-    template<typename... T>
-    void SetEventCategories(Container::BitSet<EventCategory>& flags, T... categories)
-    {
-        NEPTUNE_PROFILE_ZONE
-        
-        (flags.Set(categories, true), ...);
-    }
-
-}
-    
     /**
     * @brief Defines Event type.
     */
@@ -92,25 +75,20 @@ namespace Detail {
     * @brief Defines Event category.
     */
     #define EVENT_CLASS_CATEGORY(...)                                                   \
-	virtual Container::BitSet<EventCategory> GetCategoryFlags() const override          \
+	virtual Container::FlagSet<EventCategory> GetCategoryFlags() const override         \
     {                                                                                   \
         using enum EventCategory;                                                       \
                                                                                         \
-        static Container::BitSet<EventCategory> s_Category;                             \
-                                                                                        \
-        if (s_Category.None())                                                          \
-        {                                                                               \
-             Detail::SetEventCategories(s_Category, __VA_ARGS__);                       \
-        }                                                                               \
+        static constexpr Container::FlagSet<EventCategory> s_Category{ __VA_ARGS__ };   \
                                                                                         \
         return s_Category;                                                              \
     }
 
     /**
-    * @brief Bind Event.
+    * @brief Bind Event, a lambda capturing this only, fits EventHandler inline storage.
     */
     #define BIND_EVENT_FN(x)                                                           \
-	std::bind(&x, this, std::placeholders::_1)
+	[this](auto& e) { return x(e); }
 
     /**
     * @brief This Class is the basic Event Class.
@@ -125,11 +103,6 @@ namespace Detail {
         */
         virtual ~Event() = default;
 
-        /**
-        * @brief Helper type of Function pointer.
-        */
-        using EventCallbackFn = std::function<void(Event&)>;
-
         /**
         * @brief Allow EventDispatcher access all data of this.
         */
@@ -140,7 +113,7 @@ namespace Detail {
         */
         virtual EventType                          GetEventType()           const = 0;
         virtual const std::string                  GetName()                const = 0;
-        virtual Container::BitSet<EventCategory>   GetCategoryFlags()       const = 0;
+        virtual Container::FlagSet<EventCategory>  GetCategoryFlags()       const = 0;
         virtual std::string                        ToString()               const { return GetName(); }
 
         /**
@@ -157,22 +130,6 @@ namespace Detail {
             return GetCategoryFlags().Test(category);
         }
 
-        /**
-        * @brief Get Global Root Event Function Pointer.
-        * 
-        * @return Returns the Global Root Event Function Pointer.
-        */
-        static EventCallbackFn GetEventCallbackFn();
-
-        /**
-        * @brief Set Global Root Event Function Pointer.
-        * 
-        * @param[in] callback The Global Root Event Function Pointer.
-        * 
-        * @note Usually call it once in whole Application lifetime.
-        */
-        static void SetEventCallbackFn(const EventCallbackFn& callback);
-
         /**
         * @brief True if this event is handled.
         */
@@ -185,17 +142,6 @@ namespace Detail {
     */
     class EventDispatcher
     {
-
-        /**
-        * @brief Helper type of the function pointer to handle specific event.
-        * 
-        * @tparam T Specific Event Class.
-        * 
-        * @return Returns true if it needs block event chain.
-        */
-        template<typename T>
-        using EventFn = std::function<bool(T&)>;
-
     public:
 
         /**
@@ -210,12 +156,14 @@ namespace Detail {
         /**
         * @brief Dispatch the specific Event handle function pointer to Event Class.
         * 
+        * @tparam T Specific Event Class.
+        * @tparam F Functor of bool(T&), returns true if it needs block event chain.
         * @param[in] func Specific Event handle function.
         * 
         * @return Returns true if execute function pointer.
         */
-        template<typename T>
-        bool Dispatch(EventFn<T> func)
+        template<typename T, typename F>
+        bool Dispatch(F&& func)
         {
             NEPTUNE_PROFILE_ZONE
 
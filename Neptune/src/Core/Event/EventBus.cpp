@@ -0,0 +1,234 @@
+/**
+* @file EventBus.cpp.
+* @brief The EventBus Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "EventBus.h"
+
+#include <algorithm>
+
+namespace Neptune {
+
+    namespace {
+
+        constexpr uint32_t SlotBits = 8;                                    // @brief Handle low bits store slot.
+        constexpr uint32_t SlotMask = (1u << SlotBits) - 1;                 // @brief Mask of slot in Handle.
+    }
+
+    void* EventBus::Queue::Allocate(size_t size, size_t align)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        assert(size <= ChunkSize);
+
+        m_Offset = (m_Offset + align - 1) & ~(align - 1);
+
+        if (m_Chunks.empty() || m_Offset + size > ChunkSize)
+        {
+            if (!m_Chunks.empty())
+            {
+                ++m_Chunk;
+            }
+
+            if (m_Chunk == m_Chunks.size())
+            {
+                m_Chunks.push_back(CreateUP<std::byte[]>(ChunkSize));
+            }
+
+            m_Offset = 0;
+        }
+
+        void* memory = m_Chunks[m_Chunk].get() + m_Offset;
+
+        m_Offset += size;
+
+        return memory;
+    }
+
+    void EventBus::Queue::Clear()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        for (const auto& record : records)
+        {
+            record.destroy(record.memory);
+        }
+
+        records.clear();
+
+        m_Chunk  = 0;
+        m_Offset = 0;
+    }
+
+    EventBus& EventBus::Instance()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        static EventBus S_Instance;
+
+        return S_Instance;
+    }
+
+    EventBus::EventBus()
+        : m_Coalesce{ EventType::MouseMoved }
+    {
+        NEPTUNE_PROFILE_ZONE
+    }
+
+    EventBus::~EventBus()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        for (auto& queue : m_Queues)
+        {
+            queue.Clear();
+        }
+    }
+
+    void EventBus::Unsubscribe(Handle handle)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const size_t slot = handle & SlotMask;
+
+        if (handle == 0 || slot >= SlotCount)
+        {
+            return;
+        }
+
+        auto& subscribers = m_Subscribers[slot];
+
+        const auto it = std::find_if(subscribers.begin(), subscribers.end(), [&](const Subscriber& subscriber) {
+            return subscriber.handle == handle;
+        });
+
+        if (it == subscribers.end())
+        {
+            return;
+        }
+
+        if (m_PublishDepth > 0)
+        {
+            it->handle = 0;
+            m_Dirty    = true;
+        }
+        else
+        {
+            subscribers.erase(it);
+        }
+    }
+
+    bool EventBus::Publish(Event& event)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        ++m_PublishDepth;
+        ++m_Stats.published;
+
+        Invoke(static_cast<size_t>(event.GetEventType()), event);
+
+        if (!event.Handled)
+        {
+            Invoke(static_cast<size_t>(EventType::Count), event);
+        }
+
+        if (--m_PublishDepth == 0 && m_Dirty)
+        {
+            Compact();
+        }
+
+        return event.Handled;
+    }
+
+    uint32_t EventBus::Drain()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        uint32_t read;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            read    = m_Write;
+            m_Write = 1 - m_Write;
+        }
+
+        auto& queue = m_Queues[read];
+
+        for (const auto& record : queue.records)
+        {
+            Publish(*record.event);
+        }
+
+        const auto count = static_cast<uint32_t>(queue.records.size());
+
+        m_Stats.drained += count;
+
+        queue.Clear();
+
+        return count;
+    }
+
+    void EventBus::SetCoalesce(EventType type, bool coalesce)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        m_Coalesce.Set(type, coalesce);
+    }
+
+    EventBus::Handle EventBus::Add(EventType type, EventHandler handler)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const auto slot   = static_cast<uint32_t>(type);
+        const Handle handle = (m_NextHandle++ << SlotBits) | slot;
+
+        m_Subscribers[slot].push_back({ handle, handler });
+
+        return handle;
+    }
+
+    void EventBus::Invoke(size_t slot, Event& event)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        auto& subscribers = m_Subscribers[slot];
+
+        /**
+        * @brief Index loop, a handler may subscribe and grow the array.
+        */
+        for (size_t i = 0; i < subscribers.size(); ++i)
+        {
+            if (subscribers[i].handle == 0)
+            {
+                continue;
+            }
+
+            auto handler = subscribers[i].handler;
+
+            if (handler(event))
+            {
+                event.Handled = true;
+                return;
+            }
+        }
+    }
+
+    void EventBus::Compact()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        for (auto& subscribers : m_Subscribers)
+        {
+            std::erase_if(subscribers, [](const Subscriber& subscriber) {
+                return subscriber.handle == 0;
+            });
+        }
+
+        m_Dirty = false;
+    }
+}
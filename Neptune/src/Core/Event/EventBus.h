@@ -0,0 +1,355 @@
+/**
+* @file EventBus.h.
+* @brief The EventBus Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Event.h"
+#include "Core/Container/FlagSet.hpp"
+
+#include <array>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace Neptune {
+
+    /**
+    * @brief Small buffer callable of bool(Event&).
+    * Functor is stored inline and copied bytewise, nothing is allocated.
+    * Lambdas capturing this or a few values fit, capturing a std::function or std::string does not compile.
+    */
+    class EventHandler
+    {
+    public:
+
+        static constexpr size_t Capacity = 32;  // @brief Inline storage bytes.
+
+    public:
+
+        /**
+        * @brief Constructor Function.
+        */
+        EventHandler() = default;
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @tparam F Functor type, returns bool or void.
+        * @param[in] fn Functor.
+        */
+        template<typename F> requires (!std::is_same_v<std::decay_t<F>, EventHandler>)
+        EventHandler(F&& fn)
+        {
+            NEPTUNE_PROFILE_ZONE
+
+            using Fn = std::decay_t<F>;
+
+            static_assert(sizeof(Fn) <= Capacity, "EventHandler functor exceeds inline storage.");
+            static_assert(alignof(Fn) <= alignof(std::max_align_t), "EventHandler functor is over aligned.");
+            static_assert(std::is_trivially_copyable_v<Fn> && std::is_trivially_destructible_v<Fn>, "EventHandler functor must be trivially copyable.");
+
+            ::new (static_cast<void*>(m_Storage)) Fn(std::forward<F>(fn));
+
+            m_Invoke = [](void* storage, Event& event) -> bool {
+
+                auto& f = *std::launder(static_cast<Fn*>(storage));
+
+                if constexpr (std::is_void_v<std::invoke_result_t<Fn&, Event&>>)
+                {
+                    f(event);
+                    return false;
+                }
+                else
+                {
+                    return f(event);
+                }
+            };
+        }
+
+        /**
+        * @brief Invoke handler.
+        *
+        * @param[in] event Event.
+        *
+        * @return Returns true if event is handled.
+        */
+        bool operator()(Event& event) { return m_Invoke(m_Storage, event); }
+
+        /**
+        * @brief Is handler valid.
+        *
+        * @return Returns true if valid.
+        */
+        explicit operator bool() const { return m_Invoke != nullptr; }
+
+    private:
+
+        alignas(std::max_align_t) std::byte   m_Storage[Capacity]{};   // @brief Inline functor.
+        bool(*m_Invoke)(void*, Event&)       = nullptr;                // @brief Type erased invoker.
+    };
+
+    /**
+    * @brief EventBus statistics.
+    */
+    struct EventBusStats
+    {
+        uint64_t published = 0;     // @brief Events published to subscribers.
+        uint64_t queued    = 0;     // @brief Events enqueued.
+        uint64_t coalesced = 0;     // @brief Enqueued events merged into the previous one.
+        uint64_t drained   = 0;     // @brief Events published by Drain.
+    };
+
+    /**
+    * @brief EventBus Class.
+    * Typed publish subscribe of Events, replaces the global std::function callback.
+    * Subscribers are kept in arrays per EventType and are called in subscribed order, a handler returning true stops the event.
+    * Publish dispatches immediately on the caller thread, Enqueue stores the event into a per frame queue
+    * which is published by Drain in batch, usually at the beginning of a frame.
+    * Consecutive queued events of a coalescing EventType (MouseMoved by default) keep only the latest one.
+    * Subscribe, Unsubscribe, Publish and Drain are main thread only, Enqueue may be called from any thread.
+    */
+    class EventBus : public NonCopyable
+    {
+    public:
+
+        using Handle = uint32_t;                                   // @brief Subscription handle, 0 is invalid.
+
+    public:
+
+        /**
+        * @brief Get EventBus.
+        *
+        * @return Returns EventBus.
+        */
+        static EventBus& Instance();
+
+        /**
+        * @brief Constructor Function.
+        */
+        EventBus();
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~EventBus();
+
+        /**
+        * @brief Subscribe a specific Event.
+        *
+        * @tparam T Specific Event Class.
+        * @tparam F Functor of bool(T&) or void(T&).
+        * @param[in] fn Functor.
+        *
+        * @return Returns Handle.
+        */
+        template<typename T, typename F>
+        Handle Subscribe(F&& fn);
+
+        /**
+        * @brief Subscribe all Events, called after typed subscribers.
+        *
+        * @tparam F Functor of bool(Event&) or void(Event&).
+        * @param[in] fn Functor.
+        *
+        * @return Returns Handle.
+        */
+        template<typename F>
+        Handle SubscribeAll(F&& fn) { return Add(EventType::Count, EventHandler(std::forward<F>(fn))); }
+
+        /**
+        * @brief Unsubscribe.
+        *
+        * @param[in] handle Handle.
+        */
+        void Unsubscribe(Handle handle);
+
+        /**
+        * @brief Publish a Event immediately.
+        *
+        * @param[in] event Event.
+        *
+        * @return Returns true if event is handled.
+        */
+        bool Publish(Event& event);
+
+        /**
+        * @brief Construct a specific Event into the deferred queue.
+        *
+        * @tparam T Specific Event Class.
+        * @param[in] args Event constructor params.
+        */
+        template<typename T, typename ...Args>
+        void Enqueue(Args&&... args);
+
+        /**
+        * @brief Publish all queued Events in order and reset the queue.
+        * Events enqueued while draining are published by next Drain.
+        *
+        * @return Returns drained Events count.
+        */
+        uint32_t Drain();
+
+        /**
+        * @brief Set whether a EventType coalesces in the deferred queue.
+        *
+        * @param[in] type EventType.
+        * @param[in] coalesce True if coalesce.
+        */
+        void SetCoalesce(EventType type, bool coalesce);
+
+        /**
+        * @brief Get statistics.
+        *
+        * @return Returns EventBusStats.
+        */
+        const EventBusStats& GetStats() const { return m_Stats; }
+
+        /**
+        * @brief Reset statistics.
+        */
+        void ResetStats() { m_Stats = {}; }
+
+    private:
+
+        /**
+        * @brief Subscriber.
+        */
+        struct Subscriber
+        {
+            Handle        handle;   // @brief Handle, 0 if unsubscribed while publishing.
+            EventHandler  handler;  // @brief Handler.
+        };
+
+        /**
+        * @brief Queued Event record.
+        */
+        struct Record
+        {
+            void*         memory;                // @brief Memory in queue chunk.
+            Event*        event;                 // @brief Event constructed in memory.
+            void(*destroy)(void*);               // @brief Destructor of specific Event.
+            EventType     type;                  // @brief EventType.
+        };
+
+        /**
+        * @brief Deferred Queue, Events live in chunks which are reused across frames.
+        */
+        class Queue
+        {
+        public:
+
+            static constexpr size_t ChunkSize = 16 * 1024;  // @brief Bytes per chunk.
+
+            /**
+            * @brief Allocate memory of an Event.
+            *
+            * @param[in] size Bytes.
+            * @param[in] align Alignment.
+            *
+            * @return Returns memory.
+            */
+            void* Allocate(size_t size, size_t align);
+
+            /**
+            * @brief Destroy all Events and rewind chunks.
+            */
+            void Clear();
+
+            std::vector<Record>         records;      // @brief Records in enqueued order.
+
+        private:
+
+            std::vector<UP<std::byte[]>> m_Chunks;      // @brief Chunks.
+            size_t                       m_Chunk  = 0;  // @brief Current chunk.
+            size_t                       m_Offset = 0;  // @brief Offset in current chunk.
+        };
+
+        /**
+        * @brief Add a Subscriber.
+        *
+        * @param[in] type EventType, Count for all.
+        * @param[in] handler EventHandler.
+        *
+        * @return Returns Handle.
+        */
+        Handle Add(EventType type, EventHandler handler);
+
+        /**
+        * @brief Call Subscribers of a slot.
+        *
+        * @param[in] slot Slot index.
+        * @param[in] event Event.
+        */
+        void Invoke(size_t slot, Event& event);
+
+        /**
+        * @brief Remove unsubscribed Subscribers after publishing.
+        */
+        void Compact();
+
+    private:
+
+        static constexpr size_t SlotCount = static_cast<size_t>(EventType::Count) + 1;
+
+        std::array<std::vector<Subscriber>, SlotCount>  m_Subscribers;          // @brief Subscribers per EventType, last slot for all.
+        Handle                                          m_NextHandle = 1;       // @brief Next Handle.
+        uint32_t                                        m_PublishDepth = 0;     // @brief Nested Publish depth.
+        bool                                            m_Dirty = false;        // @brief Unsubscribed while publishing.
+        std::array<Queue, 2>                            m_Queues;               // @brief Double buffered deferred queues.
+        uint32_t                                        m_Write = 0;            // @brief Queue written by Enqueue.
+        Container::FlagSet<EventType>                   m_Coalesce;             // @brief Coalescing EventTypes.
+        std::mutex                                      m_Mutex;                // @brief Mutex of deferred queue.
+        EventBusStats                                   m_Stats;                // @brief Statistics.
+    };
+
+    template<typename T, typename F>
+    EventBus::Handle EventBus::Subscribe(F&& fn)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        static_assert(std::is_base_of_v<Event, T>, "EventBus::Subscribe requires a Event type.");
+
+        return Add(T::GetStaticType(), EventHandler([fn = std::forward<F>(fn)](Event& event) mutable {
+            return fn(static_cast<T&>(event));
+        }));
+    }
+
+    template<typename T, typename ...Args>
+    void EventBus::Enqueue(Args&&... args)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        static_assert(std::is_base_of_v<Event, T>, "EventBus::Enqueue requires a Event type.");
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        auto& queue = m_Queues[m_Write];
+
+        ++m_Stats.queued;
+
+        if (m_Coalesce.Test(T::GetStaticType()) && !queue.records.empty() && queue.records.back().type == T::GetStaticType())
+        {
+            auto& record = queue.records.back();
+
+            record.destroy(record.memory);
+            record.event = ::new (record.memory) T(std::forward<Args>(args)...);
+
+            ++m_Stats.coalesced;
+            return;
+        }
+
+        void* memory = queue.Allocate(sizeof(T), alignof(T));
+
+        queue.records.push_back({
+            memory,
+            ::new (memory) T(std::forward<Args>(args)...),
+            [](void* p) { std::launder(static_cast<T*>(p))->~T(); },
+            T::GetStaticType()
+        });
+    }
+}
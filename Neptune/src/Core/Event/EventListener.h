@@ -7,6 +7,7 @@
 #pragma once
 #include "Core/Core.h"
 #include "Event.h"
+#include "Core/Container/AtomicBitSet.hpp"
 
 namespace Neptune {
     
@@ -103,7 +104,7 @@ namespace Neptune {
         /**
         * @brief Interested event type.
         */
-        Container::BitSet<EventType> m_Interested{};
+        Container::AtomicBitSet<EventType> m_Interested{};
     };
 
     template<typename T>
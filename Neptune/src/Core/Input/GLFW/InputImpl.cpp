@@ -19,6 +19,9 @@ namespace Neptune::GLFW {
         // Get GLFW Window Pointer.
         const auto window = static_cast<GLFWwindow*>(Window::Instance().NativeWindow());
 
+        // Headless Window has no input.
+        if (!window) return false;
+
         // Query GLFW Window Key State.
         const auto state = glfwGetKey(window, keycode);
 
@@ -32,6 +35,9 @@ namespace Neptune::GLFW {
         // Get GLFW Window Pointer.
         const auto window = static_cast<GLFWwindow*>(Window::Instance().NativeWindow());
 
+        // Headless Window has no input.
+        if (!window) return false;
+
         // Query GLFW Window Mouse State.
         const auto state = glfwGetMouseButton(window, button);
 
@@ -45,6 +51,9 @@ namespace Neptune::GLFW {
         // Get GLFW Window Pointer.
         const auto window = static_cast<GLFWwindow*>(Window::Instance().NativeWindow());
 
+        // Headless Window has no input.
+        if (!window) return { 0.0f, 0.0f };
+
         // Query GLFW Window Cursor Position.
         double xPos, yPos;
         glfwGetCursorPos(window, &xPos, &yPos);
@@ -7,15 +7,26 @@
 #include "Pchheader.h"
 #include "Console.h"
 
+#include <bit>
+#include <cstdio>
+
 namespace Neptune {
 
     namespace {
-        
+
         std::unordered_map<std::string, SP<Console>> m_GlobalConsolePool;  // @brief Global Console Pool.
+
+        constexpr size_t LevelCount = 7;  // @brief spdlog levels, trace to off.
+
+        /**
+        * @brief Interned level names, indexed by spdlog level.
+        */
+        constexpr const char* s_LevelNames[LevelCount] = { "Trace", "Debug", "Info", "Warn", "Error", "Critical", "Off" };
     }
 
-    Console::Console(uint32_t maxInfos)
-        : m_MaxInfos(maxInfos)
+    Console::Console(uint32_t capacity)
+        : m_Slots(std::make_unique<Slot[]>(std::bit_ceil(std::max(capacity, 2u))))
+        , m_Mask(std::bit_ceil(std::max(capacity, 2u)) - 1)
     {}
 
     std::shared_ptr<Console> Console::Registry(const std::string& name)
@@ -30,11 +41,112 @@ namespace Neptune {
         return m_GlobalConsolePool[name];
     }
 
+    const char* Console::LevelName(uint8_t level)
+    {
+        return level < LevelCount ? s_LevelNames[level] : "Unknown";
+    }
+
+    glm::vec4 Console::LevelColor(uint8_t level)
+    {
+        switch (level)
+        {
+            case spdlog::level::level_enum::trace:
+            case spdlog::level::level_enum::debug:    return glm::vec4(0.83f, 0.83f, 0.83f, 1.0f);
+            case spdlog::level::level_enum::info:     return glm::vec4(0.574f, 0.829f, 1.0f, 1.0f);
+            case spdlog::level::level_enum::warn:     return glm::vec4(0.974f, 0.896f, 0.39f, 1.0f);
+            case spdlog::level::level_enum::err:      return glm::vec4(1.0f, 0.641f, 0.59f, 1.0f);
+            case spdlog::level::level_enum::critical: return glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
+            default:                                  return glm::vec4(1.0f);
+        }
+    }
+
+    uint64_t Console::Count(uint8_t level) const
+    {
+        return level < LevelCount ? m_Counts[level].load(std::memory_order_relaxed) : 0;
+    }
+
+    size_t Console::Snapshot(std::span<ConsoleRecord> records, uint64_t from) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const uint64_t written = m_Written.load(std::memory_order_acquire);
+
+        uint64_t begin = std::max(from, m_Cleared.load(std::memory_order_acquire));
+        begin = std::max(begin, written - std::min<uint64_t>(written, Capacity()));
+        begin = std::max(begin, written - std::min<uint64_t>(written, records.size()));
+
+        size_t count = 0;
+
+        for (uint64_t index = begin; index < written; ++index)
+        {
+            const Slot& slot = m_Slots[index & m_Mask];
+            const uint64_t expected = 2 * (index + 1);
+
+            if (slot.sequence.load(std::memory_order_acquire) != expected) continue;
+
+            uint64_t words[Words];
+
+            for (size_t i = 0; i < Words; ++i)
+            {
+                words[i] = slot.words[i].load(std::memory_order_relaxed);
+            }
+
+            std::atomic_thread_fence(std::memory_order_acquire);
+
+            // Overwritten while copying.
+            if (slot.sequence.load(std::memory_order_relaxed) != expected) continue;
+
+            std::memcpy(&records[count++], words, sizeof(ConsoleRecord));
+        }
+
+        return count;
+    }
+
+    std::string_view Console::LoggerName(uint16_t logger) const
+    {
+        if (logger >= m_NameCount.load(std::memory_order_acquire)) return "?";
+
+        return m_Names[logger];
+    }
+
+    size_t Console::Format(const ConsoleRecord& record, std::span<char> out) const
+    {
+        if (out.empty()) return 0;
+
+        const auto time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::time_point(std::chrono::system_clock::duration(record.time)));
+
+        std::tm tm{};
+
+#if defined(_MSC_VER)
+        localtime_s(&tm, &time);
+#else
+        localtime_r(&time, &tm);
+#endif
+
+        const std::string_view logger = LoggerName(record.logger);
+
+        const int written = std::snprintf(
+            out.data(),
+            out.size(),
+            "[%02d:%02d:%02d] [%.*s] [%s] %.*s",
+            tm.tm_hour,
+            tm.tm_min,
+            tm.tm_sec,
+            static_cast<int>(logger.size()),
+            logger.data(),
+            LevelName(record.level),
+            static_cast<int>(record.length),
+            record.text
+        );
+
+        return written < 0 ? 0 : std::min<size_t>(written, out.size() - 1);
+    }
+
     void Console::Clear()
     {
         NEPTUNE_PROFILE_ZONE
 
-        m_InfoData.Clear();
+        m_Cleared.store(m_Written.load(std::memory_order_acquire), std::memory_order_release);
     }
 
     void Console::Push(const std::string& cmd)
@@ -49,91 +161,55 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
-        //std::lock_guard<std::mutex> lock(mutex_);
+        const std::string_view payload(msg.payload.data(), msg.payload.size());
 
-        std::stringstream ss;
+        ConsoleRecord record;
+        record.time      = msg.time.time_since_epoch().count();
+        record.logger    = Intern(std::string_view(msg.logger_name.data(), msg.logger_name.size()));
+        record.level     = static_cast<uint8_t>(msg.level);
+        record.truncated = payload.size() > ConsoleRecord::TextSize;
+        record.length    = static_cast<uint32_t>(std::min(payload.size(), ConsoleRecord::TextSize));
 
-        /**
-        * @brief Get Log time.
-        */
-        time_t t = std::chrono::system_clock::to_time_t(msg.time);
-        std::string times = ctime(&t);
-        times.pop_back();
+        std::memcpy(record.text, payload.data(), record.length);
+        std::memset(record.text + record.length, 0, ConsoleRecord::TextSize - record.length);
 
-        /**
-        * @brief Get Log level.
-        */
-        InfoLevelHelper helper;
+        uint64_t words[Words];
+        std::memcpy(words, &record, sizeof(record));
+
+        const uint64_t index = m_Written.load(std::memory_order_relaxed);
+        Slot& slot = m_Slots[index & m_Mask];
 
-        switch (msg.level)
+        // Odd while written, readers copying this slot skip it.
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        for (size_t i = 0; i < Words; ++i)
         {
-            case spdlog::level::level_enum::trace:
-            {
-                helper.level = "Trace";
-                helper.color = glm::vec4(0.83f, 0.83f, 0.83f, 1.0f);
-                ss << "[" << times << "] [" << msg.logger_name.data() << "] [" << helper.level << "] " << msg.payload.data();
-                helper.str = ss.str();
-                if (m_InfoData.m_TraceLogInfos.size() == m_MaxInfos)
-                {
-                    m_InfoData.m_TraceLogInfos.pop();
-                }
-                m_InfoData.m_TraceLogInfos.push(helper);
-                break;
-            }
-            case spdlog::level::level_enum::info:
-            {
-                helper.level = "Info";
-                helper.color = glm::vec4(0.574f, 0.829f, 1.0f, 1.0f);
-                ss << "[" << times << "] [" << msg.logger_name.data() << "] [" << helper.level << "] " << msg.payload.data();
-                helper.str = ss.str();
-                if (m_InfoData.m_InfoLogInfos.size() == m_MaxInfos)
-                {
-                    m_InfoData.m_InfoLogInfos.pop();
-                }
-                m_InfoData.m_InfoLogInfos.push(helper);
-                break;
-            }
-            case spdlog::level::level_enum::warn:
-            {
-                helper.level = "Warn";
-                helper.color = glm::vec4(0.974f, 0.896f, 0.39f, 1.0f);
-                ss << "[" << times << "] [" << msg.logger_name.data() << "] [" << helper.level << "] " << msg.payload.data();
-                helper.str = ss.str();
-                if (m_InfoData.m_WarnLogInfos.size() == m_MaxInfos)
-                {
-                    m_InfoData.m_WarnLogInfos.pop();
-                }
-                m_InfoData.m_WarnLogInfos.push(helper);
-                break;
-            }
-            case spdlog::level::level_enum::err:
-            {
-                helper.level = "Error";
-                helper.color = glm::vec4(1.0f, 0.641f, 0.59f, 1.0f);
-                ss << "[" << times << "] [" << msg.logger_name.data() << "] [" << helper.level << "] " << msg.payload.data();
-                helper.str = ss.str();
-                if (m_InfoData.m_ErrorLogInfos.size() == m_MaxInfos)
-                {
-                    m_InfoData.m_ErrorLogInfos.pop();
-                }
-                m_InfoData.m_ErrorLogInfos.push(helper);
-                break;
-            }
-            case spdlog::level::level_enum::critical:
-            {
-                helper.level = "Critical";
-                helper.color = glm::vec4(1.0f, 0.0f, 0.0f, 1.0f);
-                ss << "[" << times << "] [" << msg.logger_name.data() << "] [" << helper.level << "] " << msg.payload.data();
-                helper.str = ss.str();
-                if (m_InfoData.m_CriticalLogInfos.size() == m_MaxInfos)
-                {
-                    m_InfoData.m_CriticalLogInfos.pop();
-                }
-                m_InfoData.m_CriticalLogInfos.push(helper);
-                break;
-            }
-            default:
-                break;
+            slot.words[i].store(words[i], std::memory_order_relaxed);
+        }
+
+        slot.sequence.store(2 * (index + 1), std::memory_order_release);
+        m_Written.store(index + 1, std::memory_order_release);
+
+        if (record.level < LevelCount) m_Counts[record.level].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    uint16_t Console::Intern(std::string_view name)
+    {
+        name = name.substr(0, NameSize - 1);
+
+        const uint32_t count = m_NameCount.load(std::memory_order_relaxed);
+
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            if (name == m_Names[i]) return static_cast<uint16_t>(i);
         }
+
+        if (count == MaxLoggers) return NoLogger;
+
+        std::memcpy(m_Names[count], name.data(), name.size());
+        m_NameCount.store(count + 1, std::memory_order_release);
+
+        return static_cast<uint16_t>(count);
     }
 }
\ No newline at end of file
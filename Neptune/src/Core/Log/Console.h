@@ -7,71 +7,89 @@
 #pragma once
 #include "Core/Core.h"
 
-#include <spdlog/sinks/basic_file_sink.h>
+#include <spdlog/sinks/base_sink.h>
+#include <spdlog/details/null_mutex.h>
 #include <glm/glm.hpp>
 
+#include <atomic>
+#include <span>
+
 namespace Neptune {
 
     /**
-    * @brief Help data of specific level of information.
+    * @brief A console line, fixed size so the ring never allocates.
     */
-    struct InfoLevelHelper
+    struct ConsoleRecord
     {
-        std::string str;    // @brief Info information.
-        std::string level;  // @brief specific level of this information.
-        glm::vec4 color;    // @brief specific color of this information.
-    };
+        static constexpr size_t TextSize = 240;  // @brief Message bytes kept, longer messages are truncated.
 
-    /**
-    * @brief Console Information Data.
-    */
-    struct InfoData
-    {
-        std::queue<InfoLevelHelper> m_TraceLogInfos;    // @brief trace    queue.
-        std::queue<InfoLevelHelper> m_InfoLogInfos;     // @brief info     queue.
-        std::queue<InfoLevelHelper> m_WarnLogInfos;     // @brief warn     queue.
-        std::queue<InfoLevelHelper> m_ErrorLogInfos;    // @brief error    queue.
-        std::queue<InfoLevelHelper> m_CriticalLogInfos; // @brief critical queue.
+        int64_t  time;            // @brief system_clock ticks of the log call.
+        uint16_t logger;          // @brief Interned logger name, see Console::LoggerName.
+        uint8_t  level;           // @brief spdlog level.
+        uint8_t  truncated;       // @brief 1 if message was longer than TextSize.
+        uint32_t length;          // @brief Message bytes in text.
+        char     text[TextSize];  // @brief Message, not null terminated.
 
         /**
-         * @brief clear console buffer. 
-         */
-        void Clear()
-        {
-            NEPTUNE_PROFILE_ZONE
-
-            std::queue<InfoLevelHelper>().swap(m_TraceLogInfos);
-            std::queue<InfoLevelHelper>().swap(m_InfoLogInfos);
-            std::queue<InfoLevelHelper>().swap(m_WarnLogInfos);
-            std::queue<InfoLevelHelper>().swap(m_ErrorLogInfos);
-            std::queue<InfoLevelHelper>().swap(m_CriticalLogInfos);
-        }
+        * @brief Get message.
+        *
+        * @return Returns message view.
+        */
+        std::string_view Text() const { return { text, length }; }
     };
 
+    static_assert(sizeof(ConsoleRecord) == 256, "ConsoleRecord must stay a whole number of words.");
+
     /**
     * @brief Console Entity Class.
+    * Lines live in a preallocated ring of ConsoleRecord, each slot guarded by a sequence number.
+    * The log backend is the only writer, UI threads copy lines out with Snapshot without locking or allocating.
     */
-    class Console : public spdlog::sinks::base_sink<std::mutex>
+    class Console : public spdlog::sinks::base_sink<spdlog::details::null_mutex>
     {
+    public:
+
+        static constexpr size_t   MaxLoggers = 16;          // @brief Interned logger names.
+        static constexpr size_t   NameSize   = 32;          // @brief Bytes of an interned name, longer names are truncated.
+        static constexpr uint16_t NoLogger   = UINT16_MAX;  // @brief Logger id once names table is full.
+
     public:
 
         /**
         * @brief Registry a console to ConsolePool.
-        * 
+        *
         * @param[in] name ConsoleName.
-        * 
+        *
         * @return Returns Registered Console form Pool.
         */
         static std::shared_ptr<Console> Registry(const std::string& name);
 
+        /**
+        * @brief Get name of a level.
+        *
+        * @param[in] level spdlog level.
+        *
+        * @return Returns name, a static string.
+        */
+        static const char* LevelName(uint8_t level);
+
+        /**
+        * @brief Get color of a level.
+        *
+        * @param[in] level spdlog level.
+        *
+        * @return Returns color.
+        */
+        static glm::vec4 LevelColor(uint8_t level);
+
     public:
 
         /**
         * @brief Constructor Function.
-        * 
-        * @param[in] maxInfos Maximum Num of Information.
+        *
+        * @param[in] capacity Lines kept, rounded up to a power of two.
         */
-        Console(uint32_t maxInfos = 50);
+        Console(uint32_t capacity = 1024);
 
         /**
         * @brief Destructor Function.
@@ -79,20 +97,66 @@ namespace Neptune {
         ~Console() override = default;
 
         /**
-        * @brief Get Console Infos.
-        * 
-        * @return Returns Console Infos.
+        * @brief Get lines capacity.
+        *
+        * @return Returns capacity.
         */
-        const InfoData& GetInfos() const { return m_InfoData; }
+        size_t Capacity() const { return m_Mask + 1; }
 
         /**
-        * @brief Clear Console Infos.
+        * @brief Get lines written since creation, including overwritten ones.
+        *
+        * @return Returns lines count, also the index of next line.
+        */
+        uint64_t Written() const { return m_Written.load(std::memory_order_acquire); }
+
+        /**
+        * @brief Get lines written of a level since creation.
+        *
+        * @param[in] level spdlog level.
+        *
+        * @return Returns lines count.
+        */
+        uint64_t Count(uint8_t level) const;
+
+        /**
+        * @brief Copy lines out, oldest first, lock free.
+        * Lines overwritten while copying are skipped.
+        *
+        * @param[out] records Destination, the newest lines that fit are copied.
+        * @param[in] from Index of first line wanted, pass the last Written to read only new lines.
+        *
+        * @return Returns lines copied.
+        */
+        size_t Snapshot(std::span<ConsoleRecord> records, uint64_t from = 0) const;
+
+        /**
+        * @brief Get an interned logger name.
+        *
+        * @param[in] logger ConsoleRecord::logger.
+        *
+        * @return Returns name.
+        */
+        std::string_view LoggerName(uint16_t logger) const;
+
+        /**
+        * @brief Format a line as [time] [logger] [level] message.
+        *
+        * @param[in] record ConsoleRecord.
+        * @param[out] out Destination, null terminated.
+        *
+        * @return Returns bytes written, without terminator.
+        */
+        size_t Format(const ConsoleRecord& record, std::span<char> out) const;
+
+        /**
+        * @brief Clear Console Infos, lines written before are hidden from Snapshot.
         */
         void Clear();
 
         /**
         * @brief Push a Command to Console.
-        * 
+        *
         * @param[in] cmd Command.
         * @todo Implemented it.
         */
@@ -102,19 +166,46 @@ namespace Neptune {
 
         /**
         * @brief Inherited from spdlog, run when a message pushed.
-        * 
+        *
         * @param[in] msg spdlog message.
         */
         void sink_it_(const spdlog::details::log_msg& msg) override;
 
         /**
-        * @brief Inherited from spdlog, run when spdlog flush.
+        * @brief Inherited from spdlog, run when spdlog flush, lines stay until overwritten.
         */
-        void flush_() override { Clear(); }
+        void flush_() override {}
 
-    protected:
+    private:
+
+        /**
+        * @brief Intern a logger name, writer only.
+        *
+        * @param[in] name Logger name.
+        *
+        * @return Returns id, NoLogger if table is full.
+        */
+        uint16_t Intern(std::string_view name);
 
-        uint32_t m_MaxInfos;     // @brief Maximum Num of Information's.
-        InfoData m_InfoData;     // @brief Console Information.
+    private:
+
+        static constexpr size_t Words = sizeof(ConsoleRecord) / sizeof(uint64_t);  // @brief Words of a record.
+
+        /**
+        * @brief A ring slot, sequence is odd while written and 2 * (index + 1) once line index is complete.
+        */
+        struct Slot
+        {
+            std::atomic<uint64_t> sequence{ 0 };     // @brief Sequence number.
+            std::atomic<uint64_t> words[Words]{};    // @brief ConsoleRecord bits.
+        };
+
+        std::unique_ptr<Slot[]> m_Slots;                          // @brief Ring slots.
+        size_t                  m_Mask;                           // @brief Capacity - 1.
+        std::atomic<uint64_t>   m_Written{ 0 };                   // @brief Lines written.
+        std::atomic<uint64_t>   m_Cleared{ 0 };                   // @brief Written at last Clear.
+        std::atomic<uint64_t>   m_Counts[8]{};                    // @brief Lines written of each level.
+        char                    m_Names[MaxLoggers][NameSize]{};  // @brief Interned logger names.
+        std::atomic<uint32_t>   m_NameCount{ 0 };                 // @brief Interned names count.
     };
 }
\ No newline at end of file
@@ -12,26 +12,39 @@
 namespace Neptune {
 
     namespace {
-        
-        SP<Log> s_Log = nullptr;
+
+        UP<Log>           s_Log = nullptr;          // @brief This instance.
+        std::atomic<Log*> s_Instance{ nullptr };    // @brief This instance, read by every push.
+        std::mutex        s_Mutex;                  // @brief Guards creation and reset.
     }
-    
-    SP<Log> Log::Get()
+
+    Log& Log::Get()
     {
+        if (Log* log = s_Instance.load(std::memory_order_acquire))
+        {
+            return *log;
+        }
+
         NEPTUNE_PROFILE_ZONE
 
+        std::unique_lock<std::mutex> lock(s_Mutex);
+
         if(!s_Log)
         {
-            s_Log = CreateSP<LogImpl>();
+            s_Log = CreateUP<LogImpl>();
+            s_Instance.store(s_Log.get(), std::memory_order_release);
         }
 
-        return s_Log;
+        return *s_Log;
     }
 
     void Log::Reset()
     {
         NEPTUNE_PROFILE_ZONE
 
+        std::unique_lock<std::mutex> lock(s_Mutex);
+
+        s_Instance.store(nullptr, std::memory_order_release);
         s_Log.reset();
     }
 
@@ -6,31 +6,55 @@
 
 #pragma once
 #include "Core/NonCopyable.h"
+#include "LogQueue.h"
 
 #include <iostream>
 #include <memory>
+#include <thread>
 
 namespace Neptune {
 
     /**
     * @brief Log Class defines log behaves.
+    * Call sites encode a record into the ring of their thread, a backend thread formats and writes it to sinks.
     */
     class Log : public NonCopyable
     {
     public:
-        
+
         /**
-        * @brief Get this instance.
-        * 
+        * @brief Get this instance, created with its backend thread on first use.
+        *
         * @return Returns this instance.
         */
-        static std::shared_ptr<Log> Get();
+        static Log& Get();
 
         /**
-        * @brief Reset this instance.
+        * @brief Reset this instance, writes queued records first.
         */
         static void Reset();
 
+        /**
+        * @brief Push a record with deferred formatting.
+        *
+        * @param[in] channel LogChannel.
+        * @param[in] level LogLevel.
+        * @param[in] format Format string literal, one {} field per argument.
+        * @param[in] arg First argument.
+        * @param[in] args Other arguments.
+        */
+        template<typename Arg, typename... Args>
+        static void Push(LogChannel channel, LogLevel level, LogFormat<std::type_identity_t<Arg>, std::type_identity_t<Args>...> format, const Arg& arg, const Args&... args);
+
+        /**
+        * @brief Push a pre-built message, copied into the record.
+        *
+        * @param[in] channel LogChannel.
+        * @param[in] level LogLevel.
+        * @param[in] message Message.
+        */
+        static void Push(LogChannel channel, LogLevel level, std::string_view message);
+
     public:
 
         /**
@@ -43,25 +67,36 @@ namespace Neptune {
         */
         virtual ~Log() = default;
 
-        virtual void CoreTrace   (const std::string& msg) = 0;
-        virtual void CoreInfo    (const std::string& msg) = 0;
-        virtual void CoreWarn    (const std::string& msg) = 0;
-        virtual void CoreError   (const std::string& msg) = 0;
-        virtual void CoreCritical(const std::string& msg) = 0;
+        /**
+        * @brief Block until records pushed before are written to sinks.
+        */
+        virtual void Flush() = 0;
 
-        virtual void ClientTrace   (const std::string& msg) = 0;
-        virtual void ClientInfo    (const std::string& msg) = 0;
-        virtual void ClientWarn    (const std::string& msg) = 0;
-        virtual void ClientError   (const std::string& msg) = 0;
-        virtual void ClientCritical(const std::string& msg) = 0;
+        /**
+        * @brief Is backend thread draining the ring of calling thread.
+        *
+        * @return Returns false once stopping, and on backend thread itself.
+        */
+        virtual bool IsDraining() const = 0;
 
         /**
         * @brief Get Initialized state.
-        * 
+        *
         * @return Returns Initialized state.
         */
         bool IsInitialized() const { return m_IsInitialized; }
 
+    private:
+
+        /**
+        * @brief Write a record to ring of calling thread, waits a bounded time while the ring is full, then drops it.
+        *
+        * @param[in] level LogLevel.
+        * @param[in] write Encodes the record, returns false if ring is full.
+        */
+        template<typename F>
+        static void Write([[maybe_unused]] LogLevel level, F&& write);
+
     protected:
 
         /**
@@ -69,23 +104,54 @@ namespace Neptune {
         */
         bool m_IsInitialized = false;
     };
+
+    template<typename F>
+    void Log::Write([[maybe_unused]] LogLevel level, F&& write)
+    {
+        Log& log = Get();
+
+        if (!LogQueue::Write(LogQueue::Producer(), std::forward<F>(write), [&]() { return log.IsDraining(); })) return;
+
+#ifdef NP_PLATFORM_EMSCRIPTEN
+
+        // No backend thread, records are written by the pushing thread.
+        log.Flush();
+
+#else
+
+        // Written before returning, the process may abort right after.
+        if (level == LogLevel::Critical) log.Flush();
+
+#endif
+    }
+
+    template<typename Arg, typename... Args>
+    void Log::Push(LogChannel channel, LogLevel level, LogFormat<std::type_identity_t<Arg>, std::type_identity_t<Args>...> format, const Arg& arg, const Args&... args)
+    {
+        Write(level, [&](LogRing& ring) { return ring.Write(channel, level, format.format, arg, args...); });
+    }
+
+    inline void Log::Push(LogChannel channel, LogLevel level, std::string_view message)
+    {
+        Write(level, [&](LogRing& ring) { return ring.Write(channel, level, nullptr, message); });
+    }
 }
 
 #ifdef NEPTUNE_DEBUG
 
-// Core log macros
-#define NEPTUNE_CORE_TRACE(...)    { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->CoreTrace      (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_CORE_INFO(...)     { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->CoreInfo       (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_CORE_WARN(...)     { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->CoreWarn       (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_CORE_ERROR(...)    { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->CoreError      (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_CORE_CRITICAL(...) { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->CoreCritical   (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
+// Core log macros, a single argument is the message, otherwise a format string literal followed by its arguments.
+#define NEPTUNE_CORE_TRACE(...)    { ::Neptune::Log::Push(::Neptune::LogChannel::Core,   ::Neptune::LogLevel::Trace,    __VA_ARGS__); }
+#define NEPTUNE_CORE_INFO(...)     { ::Neptune::Log::Push(::Neptune::LogChannel::Core,   ::Neptune::LogLevel::Info,     __VA_ARGS__); }
+#define NEPTUNE_CORE_WARN(...)     { ::Neptune::Log::Push(::Neptune::LogChannel::Core,   ::Neptune::LogLevel::Warn,     __VA_ARGS__); }
+#define NEPTUNE_CORE_ERROR(...)    { ::Neptune::Log::Push(::Neptune::LogChannel::Core,   ::Neptune::LogLevel::Error,    __VA_ARGS__); }
+#define NEPTUNE_CORE_CRITICAL(...) { ::Neptune::Log::Push(::Neptune::LogChannel::Core,   ::Neptune::LogLevel::Critical, __VA_ARGS__); }
 
 // Client log macro
-#define NEPTUNE_TRACE(...)         { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->ClientTrace    (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_INFO(...)          { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->ClientInfo     (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_WARN(...)          { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->ClientWarn     (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_ERROR(...)         { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->ClientError    (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
-#define NEPTUNE_CRITICAL(...)      { if(auto logPtr = Neptune::Log::Get(); logPtr->IsInitialized()) { logPtr->ClientCritical (__VA_ARGS__); } else { std::cout << __VA_ARGS__ << std::endl; } }
+#define NEPTUNE_TRACE(...)         { ::Neptune::Log::Push(::Neptune::LogChannel::Client, ::Neptune::LogLevel::Trace,    __VA_ARGS__); }
+#define NEPTUNE_INFO(...)          { ::Neptune::Log::Push(::Neptune::LogChannel::Client, ::Neptune::LogLevel::Info,     __VA_ARGS__); }
+#define NEPTUNE_WARN(...)          { ::Neptune::Log::Push(::Neptune::LogChannel::Client, ::Neptune::LogLevel::Warn,     __VA_ARGS__); }
+#define NEPTUNE_ERROR(...)         { ::Neptune::Log::Push(::Neptune::LogChannel::Client, ::Neptune::LogLevel::Error,    __VA_ARGS__); }
+#define NEPTUNE_CRITICAL(...)      { ::Neptune::Log::Push(::Neptune::LogChannel::Client, ::Neptune::LogLevel::Critical, __VA_ARGS__); }
 
 #endif // NEPTUNE_DEBUG
 
@@ -105,4 +171,4 @@ namespace Neptune {
 #define NEPTUNE_ERROR(...)
 #define NEPTUNE_CRITICAL(...)
 
-#endif // NEPTUNE_RELEASE
\ No newline at end of file
+#endif // NEPTUNE_RELEASE
@@ -7,34 +7,74 @@
 #include "Pchheader.h"
 #include "LogImpl.h"
 #include "Console.h"
+#include "Core/Memory/AllocTracker.h"
 
 #include <spdlog/sinks/stdout_color_sinks.h>
+#include <spdlog/sinks/rotating_file_sink.h>
 
 namespace Neptune {
 
+    namespace {
+
+        constexpr auto FlushInterval = std::chrono::seconds(5);         // @brief Sinks flush interval.
+        constexpr auto IdleWait      = std::chrono::milliseconds(1);    // @brief Backend wait when queues are empty.
+
+        thread_local bool s_IsBackend = false;  // @brief Is calling thread the backend thread.
+
+        /**
+        * @brief Convert LogLevel to spdlog level.
+        *
+        * @param[in] level LogLevel.
+        *
+        * @return Returns spdlog level.
+        */
+        spdlog::level::level_enum ToSpdlog(LogLevel level)
+        {
+            switch (level)
+            {
+                case LogLevel::Trace:    return spdlog::level::trace;
+                case LogLevel::Info:     return spdlog::level::info;
+                case LogLevel::Warn:     return spdlog::level::warn;
+                case LogLevel::Error:    return spdlog::level::err;
+                case LogLevel::Critical: return spdlog::level::critical;
+                default:                 return spdlog::level::info;
+            }
+        }
+    }
+
     LogImpl::LogImpl() : Log()
     {
         NEPTUNE_PROFILE_ZONE
 
         spdlog::set_pattern("[%Y-%m-%d %H:%M:%S] [%n] [%l] %v");
 
-#ifndef NP_PLATFORM_EMSCRIPTEN
-        spdlog::flush_every(std::chrono::seconds(5));
-#endif
-
         auto max_size = 1048576 * 5;
         auto max_files = 3;
 
+        // Sinks are only written by the backend thread.
+        std::vector<spdlog::sink_ptr> sinks;
+
         // console log.
-        const auto ide_console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        const auto ide_console_sink = std::make_shared<spdlog::sinks::stdout_color_sink_st>();
         ide_console_sink->set_level(spdlog::level::trace);
+        sinks.push_back(ide_console_sink);
 
-        const auto console_sink = Console::Registry("Console");
+#ifndef NP_PLATFORM_EMSCRIPTEN
+
+        // file log.
+        try
+        {
+            sinks.push_back(std::make_shared<spdlog::sinks::rotating_file_sink_st>("Neptune.log", max_size, max_files));
+        }
+        catch (const spdlog::spdlog_ex& ex)
+        {
+            std::cout << "Log: File sink disabled: " << ex.what() << std::endl;
+        }
+
+#endif
 
         // console slate log.
-        std::vector<spdlog::sink_ptr> sinks;
-        sinks.push_back(ide_console_sink);
-        sinks.push_back(console_sink);
+        sinks.push_back(Console::Registry("Console"));
 
         m_CoreLogger = std::make_shared<spdlog::logger>("Engine", begin(sinks), end(sinks));
         m_CoreLogger->set_level(spdlog::level::trace);
@@ -43,28 +83,130 @@ namespace Neptune {
         m_ClientLogger->set_level(spdlog::level::trace);
 
         m_IsInitialized = true;
+
+#ifndef NP_PLATFORM_EMSCRIPTEN
+
+        m_Thread = std::thread([this]() { Run(); });
+        m_Draining.store(true, std::memory_order_release);
+
+#endif
     }
 
     LogImpl::~LogImpl ()
     {
         NEPTUNE_PROFILE_ZONE
 
+        // Producers stop waiting on full rings, nothing drains them until the final Drain.
+        m_Draining.store(false, std::memory_order_release);
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_Stop = true;
+        }
+
+        m_Wake.notify_one();
+
+        if (m_Thread.joinable())
+        {
+            m_Thread.join();
+        }
+
+        // Records pushed while stopping.
+        Drain();
+
         m_IsInitialized = false;
 
+        m_CoreLogger->flush();
+
         m_CoreLogger.reset();
         m_ClientLogger.reset();
         spdlog::drop_all();
     }
 
-    void LogImpl::CoreTrace     (const std::string& msg) { m_CoreLogger->trace   (msg); }
-    void LogImpl::CoreInfo      (const std::string& msg) { m_CoreLogger->info    (msg); }
-    void LogImpl::CoreWarn      (const std::string& msg) { m_CoreLogger->warn    (msg); }
-    void LogImpl::CoreError     (const std::string& msg) { m_CoreLogger->error   (msg); }
-    void LogImpl::CoreCritical  (const std::string& msg) { m_CoreLogger->critical(msg); }
-
-    void LogImpl::ClientTrace   (const std::string& msg) { m_CoreLogger->trace   (msg); }
-    void LogImpl::ClientInfo    (const std::string& msg) { m_CoreLogger->info    (msg); }
-    void LogImpl::ClientWarn    (const std::string& msg) { m_CoreLogger->warn    (msg); }
-    void LogImpl::ClientError   (const std::string& msg) { m_CoreLogger->error   (msg); }
-    void LogImpl::ClientCritical(const std::string& msg) { m_CoreLogger->critical(msg); }
+    void LogImpl::Flush()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (!m_Thread.joinable())
+        {
+            Drain();
+            return;
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        // The pass running now may have passed the ring already, the next one has not.
+        const uint64_t target = m_Passes + 2;
+
+        m_Wake.notify_one();
+        m_Drained.wait(lock, [&]() { return m_Passes >= target || m_Stop; });
+    }
+
+    bool LogImpl::IsDraining() const
+    {
+        // The backend thread never waits on itself, a record it logs on a full ring is dropped.
+        return m_Draining.load(std::memory_order_acquire) && !s_IsBackend;
+    }
+
+    void LogImpl::Run()
+    {
+        NEPTUNE_PROFILE_THREAD_N("Log")
+
+        s_IsBackend = true;
+
+        auto lastFlush = std::chrono::steady_clock::now();
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        while (!m_Stop)
+        {
+            lock.unlock();
+
+            const size_t count = Drain();
+
+            if (const auto now = std::chrono::steady_clock::now(); now - lastFlush >= FlushInterval)
+            {
+                m_CoreLogger->flush();
+                lastFlush = now;
+            }
+
+            lock.lock();
+
+            ++m_Passes;
+            m_Drained.notify_all();
+
+            if (count == 0 && !m_Stop)
+            {
+                m_Wake.wait_for(lock, IdleWait);
+            }
+        }
+
+        m_Drained.notify_all();
+    }
+
+    size_t LogImpl::Drain()
+    {
+        const size_t count = LogQueue::Drain([this](const LogRecord& record) { Write(record); });
+
+        // Written to sinks directly, a record pushed here could be dropped as well.
+        if (const uint64_t dropped = LogQueue::Dropped(); dropped != m_Dropped)
+        {
+            m_CoreLogger->warn("Log: {} records dropped, log rings were full.", dropped - m_Dropped);
+            m_Dropped = dropped;
+        }
+
+        return count;
+    }
+
+    void LogImpl::Write(const LogRecord& record)
+    {
+        NEPTUNE_ALLOC_TAG(Log)
+
+        LogQueue::Format(record, m_Message);
+
+        const auto& logger = record.channel == LogChannel::Client ? m_ClientLogger : m_CoreLogger;
+        const auto  time   = spdlog::log_clock::time_point(spdlog::log_clock::duration(record.time));
+
+        logger->log(time, spdlog::source_loc{}, ToSpdlog(record.level), spdlog::string_view_t(m_Message.data(), m_Message.size()));
+    }
 }
\ No newline at end of file
@@ -15,10 +15,13 @@
 #include <spdlog/fmt/ostr.h>
 #pragma warning(pop)
 
+#include <condition_variable>
+
 namespace Neptune {
 
     /**
     * @brief Log Class defines log behaves.
+    * Owns the backend thread, which drains LogQueue, formats records and writes them to stdout, file and Console sinks.
     */
     class LogImpl : public Log
     {
@@ -34,17 +37,38 @@ namespace Neptune {
         */
         ~LogImpl() override;
 
-        void CoreTrace   (const std::string& msg) override;
-        void CoreInfo    (const std::string& msg) override;
-        void CoreWarn    (const std::string& msg) override;
-        void CoreError   (const std::string& msg) override;
-        void CoreCritical(const std::string& msg) override;
+        /**
+        * @brief Block until records pushed before are written to sinks.
+        */
+        void Flush() override;
+
+        /**
+        * @brief Is backend thread draining the ring of calling thread.
+        *
+        * @return Returns false once stopping, and on backend thread itself.
+        */
+        bool IsDraining() const override;
+
+    private:
+
+        /**
+        * @brief Backend thread loop.
+        */
+        void Run();
+
+        /**
+        * @brief Format and write queued records.
+        *
+        * @return Returns records count.
+        */
+        size_t Drain();
 
-        void ClientTrace   (const std::string& msg) override;
-        void ClientInfo    (const std::string& msg) override;
-        void ClientWarn    (const std::string& msg) override;
-        void ClientError   (const std::string& msg) override;
-        void ClientCritical(const std::string& msg) override;
+        /**
+        * @brief Format and write a record.
+        *
+        * @param[in] record LogRecord.
+        */
+        void Write(const LogRecord& record);
 
     private:
 
@@ -57,5 +81,50 @@ namespace Neptune {
         * @brief Game Stage Logger.
         */
         std::shared_ptr<spdlog::logger> m_ClientLogger;
+
+        /**
+        * @brief Message of record being written, reused.
+        */
+        std::string m_Message;
+
+        /**
+        * @brief Backend thread.
+        */
+        std::thread m_Thread;
+
+        /**
+        * @brief Guards m_Stop and m_Passes.
+        */
+        std::mutex m_Mutex;
+
+        /**
+        * @brief Wakes backend thread.
+        */
+        std::condition_variable m_Wake;
+
+        /**
+        * @brief Notified after each drain pass.
+        */
+        std::condition_variable m_Drained;
+
+        /**
+        * @brief Drain passes finished.
+        */
+        uint64_t m_Passes = 0;
+
+        /**
+        * @brief Is backend thread asked to stop.
+        */
+        bool m_Stop = false;
+
+        /**
+        * @brief Is backend thread running, producers wait on full rings only while set.
+        */
+        std::atomic<bool> m_Draining{ false };
+
+        /**
+        * @brief Dropped records already reported, backend thread only.
+        */
+        uint64_t m_Dropped = 0;
     };
 }
\ No newline at end of file
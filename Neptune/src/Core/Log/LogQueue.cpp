@@ -0,0 +1,342 @@
+/**
+* @file LogQueue.cpp.
+* @brief The LogQueue Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "Core/Core.h"
+#include "LogQueue.h"
+
+// This ignores all warnings raised inside External headers
+#pragma warning(push, 0)
+#include <spdlog/fmt/fmt.h>
+#pragma warning(pop)
+
+namespace Neptune {
+
+    namespace {
+
+        constexpr size_t MaxDrain = LogRing::Capacity / sizeof(LogRecord);  // @brief Most records popped from a ring per Drain.
+
+        /**
+        * @brief Rings of all producer threads.
+        */
+        struct Registry
+        {
+            std::mutex               mutex;  // @brief Guards rings.
+            std::vector<SP<LogRing>> rings;  // @brief Registered rings.
+        };
+
+        /**
+        * @brief Get Registry, never destroyed so threads exiting after main can still retire their rings.
+        *
+        * @return Returns Registry.
+        */
+        Registry& GetRegistry()
+        {
+            static auto registry = new Registry;
+            return *registry;
+        }
+
+        /**
+        * @brief Ring of a thread, retired when the thread exits.
+        */
+        struct ProducerSlot
+        {
+            SP<LogRing> ring;  // @brief Ring of this thread.
+
+            /**
+            * @brief Destructor Function.
+            */
+            ~ProducerSlot()
+            {
+                if (ring) ring->Retire();
+            }
+        };
+
+        thread_local ProducerSlot s_Producer;  // @brief Ring of calling thread.
+
+        std::atomic<uint64_t> s_Dropped{ 0 };  // @brief Records dropped on full rings.
+
+        /**
+        * @brief Read an unaligned value.
+        *
+        * @param[in,out] src Source, advanced past value.
+        *
+        * @return Returns value.
+        */
+        template<typename T>
+        T Read(const std::byte*& src)
+        {
+            T value;
+            std::memcpy(&value, src, sizeof(T));
+            src += sizeof(T);
+            return value;
+        }
+
+        /**
+        * @brief Format a value with a spec.
+        *
+        * @param[in,out] out Output.
+        * @param[in] spec Field as written in format string, {} or {:spec}.
+        * @param[in] value Value.
+        */
+        template<typename T>
+        void FormatValue(std::string& out, std::string_view spec, T value)
+        {
+            fmt::vformat_to(std::back_inserter(out), fmt::string_view(spec.data(), spec.size()), fmt::make_format_args(value));
+        }
+
+        /**
+        * @brief Format a LogValue with a spec.
+        *
+        * @param[in,out] out Output.
+        * @param[in] spec Field as written in format string.
+        * @param[in] value LogValue.
+        */
+        void FormatValue(std::string& out, std::string_view spec, const LogValue& value)
+        {
+            switch (value.type)
+            {
+                case LogArgType::Int:     FormatValue(out, spec, value.i); break;
+                case LogArgType::UInt:    FormatValue(out, spec, value.u); break;
+                case LogArgType::Float:   FormatValue(out, spec, value.f); break;
+                case LogArgType::Bool:    FormatValue(out, spec, value.b); break;
+                case LogArgType::Char:    FormatValue(out, spec, value.c); break;
+                case LogArgType::String:  FormatValue(out, spec, fmt::string_view(value.s.data(), value.s.size())); break;
+                case LogArgType::Pointer: FormatValue(out, spec, value.p); break;
+            }
+        }
+    }
+
+    LogRing::LogRing()
+        : m_Data(std::make_unique<std::byte[]>(Capacity))
+    {}
+
+    std::byte* LogRing::Reserve(size_t size)
+    {
+        const uint64_t head = m_Head.load(std::memory_order_relaxed);
+        const size_t   pos  = head & (Capacity - 1);
+        const size_t   end  = Capacity - pos;
+
+        // Records never wrap, the end of the ring is skipped when too short.
+        const size_t skip = end < size ? end : 0;
+
+        if (head + skip + size - m_CachedTail > Capacity)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+
+            if (head + skip + size - m_CachedTail > Capacity) return nullptr;
+        }
+
+        if (skip >= sizeof(LogRecord))
+        {
+            LogRecord padding{};
+            padding.size    = static_cast<uint32_t>(skip);
+            padding.padding = 1;
+
+            std::memcpy(m_Data.get() + pos, &padding, sizeof(padding));
+        }
+
+        m_Reserved = head + skip;
+
+        return m_Data.get() + (m_Reserved & (Capacity - 1));
+    }
+
+    void LogRing::Commit(size_t size)
+    {
+        m_Head.store(m_Reserved + size, std::memory_order_release);
+    }
+
+    const LogRecord* LogRing::Front()
+    {
+        uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+
+        while (true)
+        {
+            if (tail == m_CachedHead)
+            {
+                m_CachedHead = m_Head.load(std::memory_order_acquire);
+
+                if (tail == m_CachedHead) return nullptr;
+            }
+
+            const size_t pos = tail & (Capacity - 1);
+            const size_t end = Capacity - pos;
+
+            if (end < sizeof(LogRecord))
+            {
+                tail += end;
+                m_Tail.store(tail, std::memory_order_release);
+                continue;
+            }
+
+            const auto record = reinterpret_cast<const LogRecord*>(m_Data.get() + pos);
+
+            if (record->padding)
+            {
+                tail += record->size;
+                m_Tail.store(tail, std::memory_order_release);
+                continue;
+            }
+
+            return record;
+        }
+    }
+
+    void LogRing::Pop()
+    {
+        const uint64_t tail = m_Tail.load(std::memory_order_relaxed);
+        const auto record = reinterpret_cast<const LogRecord*>(m_Data.get() + (tail & (Capacity - 1)));
+
+        m_Tail.store(tail + record->size, std::memory_order_release);
+    }
+
+    bool LogRing::Empty() const
+    {
+        return m_Tail.load(std::memory_order_acquire) == m_Head.load(std::memory_order_acquire);
+    }
+
+    LogRing& LogQueue::Producer()
+    {
+        if (!s_Producer.ring)
+        {
+            auto ring = CreateSP<LogRing>();
+
+            auto& registry = GetRegistry();
+            std::unique_lock<std::mutex> lock(registry.mutex);
+
+            registry.rings.push_back(ring);
+            s_Producer.ring = std::move(ring);
+        }
+
+        return *s_Producer.ring;
+    }
+
+    size_t LogQueue::Drain(const std::function<void(const LogRecord&)>& fn)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        auto& registry = GetRegistry();
+        std::unique_lock<std::mutex> lock(registry.mutex);
+
+        size_t count = 0;
+
+        for (auto& ring : registry.rings)
+        {
+            // The retire flag is read before draining, so a retired ring seen empty afterwards gets no more records.
+            const bool retired = ring->Retired();
+
+            // Bounded so a busy producer cannot starve the other rings.
+            for (size_t i = 0; i < MaxDrain; ++i)
+            {
+                const LogRecord* record = ring->Front();
+
+                if (!record) break;
+
+                fn(*record);
+                ring->Pop();
+                ++count;
+            }
+
+            if (retired && ring->Empty()) ring.reset();
+        }
+
+        std::erase(registry.rings, nullptr);
+
+        return count;
+    }
+
+    uint64_t LogQueue::Dropped()
+    {
+        return s_Dropped.load(std::memory_order_relaxed);
+    }
+
+    void LogQueue::Drop()
+    {
+        s_Dropped.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    size_t LogQueue::Decode(const LogRecord& record, LogValue* values)
+    {
+        const std::byte* src = reinterpret_cast<const std::byte*>(&record + 1);
+
+        for (uint8_t i = 0; i < record.args; ++i)
+        {
+            LogValue& value = values[i];
+            value.type = static_cast<LogArgType>(*src++);
+
+            switch (value.type)
+            {
+                case LogArgType::String:
+                {
+                    const auto length = Read<uint32_t>(src);
+                    value.s = std::string_view(reinterpret_cast<const char*>(src), length);
+                    src += length;
+                    break;
+                }
+                case LogArgType::Float:   value.f = Read<double>(src);                                          break;
+                case LogArgType::Bool:    value.b = Read<uint64_t>(src) != 0;                                   break;
+                case LogArgType::Char:    value.c = static_cast<char>(Read<uint64_t>(src));                     break;
+                case LogArgType::Pointer: value.p = reinterpret_cast<const void*>(static_cast<uintptr_t>(Read<uint64_t>(src))); break;
+                case LogArgType::UInt:    value.u = Read<uint64_t>(src);                                        break;
+                default:                  value.i = Read<int64_t>(src);                                         break;
+            }
+        }
+
+        return record.args;
+    }
+
+    void LogQueue::Format(const LogRecord& record, std::string& out)
+    {
+        LogValue values[LogRing::MaxArgs];
+        const size_t count = Decode(record, values);
+
+        out.clear();
+
+        if (!record.format)
+        {
+            if (count) out.assign(values[0].s);
+            return;
+        }
+
+        const std::string_view format = record.format;
+        size_t arg = 0;
+
+        try
+        {
+            for (size_t i = 0; i < format.size(); ++i)
+            {
+                const char c = format[i];
+
+                if ((c == '{' || c == '}') && i + 1 < format.size() && format[i + 1] == c)
+                {
+                    out.push_back(c);
+                    ++i;
+                    continue;
+                }
+
+                if (c != '{')
+                {
+                    out.push_back(c);
+                    continue;
+                }
+
+                const size_t close = format.find('}', i);
+
+                if (close == std::string_view::npos || arg >= count) break;
+
+                FormatValue(out, format.substr(i, close - i + 1), values[arg++]);
+
+                i = close;
+            }
+        }
+        catch (const std::exception& e)
+        {
+            // Specs are not checked at compile time, a bad one keeps the raw format.
+            out.assign(record.format);
+            out.append(" [format error: ").append(e.what()).append("]");
+        }
+    }
+}
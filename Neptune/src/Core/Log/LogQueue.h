@@ -0,0 +1,512 @@
+/**
+* @file LogQueue.h.
+* @brief The LogQueue Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/NonCopyable.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+
+namespace Neptune {
+
+    /**
+    * @brief Severity of a log record.
+    */
+    enum class LogLevel : uint8_t
+    {
+        Trace = 0,
+        Info,
+        Warn,
+        Error,
+        Critical,
+    };
+
+    /**
+    * @brief Logger a record is written to.
+    */
+    enum class LogChannel : uint8_t
+    {
+        Core = 0,
+        Client,
+    };
+
+    /**
+    * @brief Type of an encoded argument.
+    */
+    enum class LogArgType : uint8_t
+    {
+        Int = 0,
+        UInt,
+        Float,
+        Bool,
+        Char,
+        String,
+        Pointer,
+    };
+
+    /**
+    * @brief Decoded argument, String views the ring until its record is popped.
+    */
+    struct LogValue
+    {
+        LogArgType type = LogArgType::Int;  // @brief Argument type.
+
+        union
+        {
+            int64_t     i = 0;              // @brief Int.
+            uint64_t    u;                  // @brief UInt.
+            double      f;                  // @brief Float.
+            bool        b;                  // @brief Bool.
+            char        c;                  // @brief Char.
+            const void* p;                  // @brief Pointer.
+        };
+
+        std::string_view s;                 // @brief String.
+    };
+
+    /**
+    * @brief Header of a record in LogRing, encoded arguments follow it.
+    */
+    struct LogRecord
+    {
+        uint32_t    size;     // @brief Bytes of header and arguments, multiple of 8.
+        LogLevel    level;    // @brief Severity.
+        LogChannel  channel;  // @brief Logger.
+        uint8_t     args;     // @brief Arguments count.
+        uint8_t     padding;  // @brief 1 if record only fills ring end before wrap.
+        const char* format;   // @brief Format string literal, its address is the format ID, nullptr for a pre-built message.
+        int64_t     time;     // @brief system_clock ticks at push.
+    };
+
+    namespace LogDetail {
+
+        /**
+        * @brief Called when fields and arguments count mismatch, not constexpr so the error shows at compile time.
+        */
+        void FormatArgumentsMismatch();
+
+        /**
+        * @brief Count {} fields of a format string, {{ and }} are escapes.
+        *
+        * @param[in] format Format string.
+        *
+        * @return Returns fields count.
+        */
+        consteval size_t CountFields(const char* format)
+        {
+            size_t count = 0;
+
+            for (const char* c = format; *c; ++c)
+            {
+                if (*c == '{' && c[1] == '{') { ++c; continue; }
+                if (*c == '{') ++count;
+            }
+
+            return count;
+        }
+
+        /**
+        * @brief Stored type of an argument, arrays decay to const pointers.
+        */
+        template<typename T>
+        using Arg = std::conditional_t<std::is_array_v<T>, const std::remove_extent_t<T>*, std::decay_t<T>>;
+
+        /**
+        * @brief Is T a string argument.
+        */
+        template<typename T>
+        inline constexpr bool IsString =
+            std::is_same_v<T, std::string>      ||
+            std::is_same_v<T, std::string_view> ||
+            std::is_same_v<T, const char*>      ||
+            std::is_same_v<T, char*>;
+
+        /**
+        * @brief Is T an encodable argument.
+        */
+        template<typename T>
+        inline constexpr bool IsSupported = std::is_arithmetic_v<T> || std::is_enum_v<T> || std::is_pointer_v<T> || IsString<T>;
+
+        /**
+        * @brief Get type of an argument.
+        *
+        * @tparam T Decayed argument type.
+        *
+        * @return Returns LogArgType.
+        */
+        template<typename T>
+        constexpr LogArgType TypeOf()
+        {
+            if constexpr (IsString<T>)                        return LogArgType::String;
+            else if constexpr (std::is_same_v<T, bool>)       return LogArgType::Bool;
+            else if constexpr (std::is_same_v<T, char>)       return LogArgType::Char;
+            else if constexpr (std::is_floating_point_v<T>)   return LogArgType::Float;
+            else if constexpr (std::is_pointer_v<T>)          return LogArgType::Pointer;
+            else if constexpr (std::is_enum_v<T>)             return std::is_signed_v<std::underlying_type_t<T>> ? LogArgType::Int : LogArgType::UInt;
+            else if constexpr (std::is_signed_v<T>)           return LogArgType::Int;
+            else                                              return LogArgType::UInt;
+        }
+
+        /**
+        * @brief Get string of a string argument.
+        *
+        * @param[in] value Argument.
+        *
+        * @return Returns string view.
+        */
+        template<typename T>
+        std::string_view View(const T& value)
+        {
+            if constexpr (std::is_pointer_v<T>) return value ? std::string_view(value) : std::string_view("(null)");
+            else                                return std::string_view(value);
+        }
+
+        /**
+        * @brief Bytes of an argument besides string content.
+        *
+        * @tparam T Decayed argument type.
+        *
+        * @return Returns bytes.
+        */
+        template<typename T>
+        constexpr size_t FixedSize()
+        {
+            return IsString<T> ? 1 + sizeof(uint32_t) : 1 + sizeof(uint64_t);
+        }
+
+        /**
+        * @brief Take string content bytes of an argument from a budget.
+        *
+        * @param[in] value Argument.
+        * @param[in,out] budget Bytes left for string content.
+        *
+        * @return Returns string content bytes, 0 if not a string.
+        */
+        template<typename T>
+        uint32_t Take(const T& value, size_t& budget)
+        {
+            if constexpr (IsString<T>)
+            {
+                const size_t length = std::min(View(value).size(), budget);
+                budget -= length;
+                return static_cast<uint32_t>(length);
+            }
+            else
+            {
+                return 0;
+            }
+        }
+
+        /**
+        * @brief Encode an argument.
+        *
+        * @param[in] dst Destination.
+        * @param[in] value Argument.
+        * @param[in] length String content bytes, from Take.
+        *
+        * @return Returns byte after argument.
+        */
+        template<typename T>
+        std::byte* Encode(std::byte* dst, const T& value, uint32_t length)
+        {
+            *dst++ = static_cast<std::byte>(TypeOf<T>());
+
+            if constexpr (IsString<T>)
+            {
+                std::memcpy(dst, &length, sizeof(length));
+                std::memcpy(dst + sizeof(length), View(value).data(), length);
+                return dst + sizeof(length) + length;
+            }
+            else
+            {
+                uint64_t bits = 0;
+
+                if constexpr (std::is_floating_point_v<T>)
+                {
+                    const double f = static_cast<double>(value);
+                    std::memcpy(&bits, &f, sizeof(f));
+                }
+                else if constexpr (std::is_pointer_v<T>)
+                {
+                    bits = reinterpret_cast<uintptr_t>(value);
+                }
+                else
+                {
+                    bits = static_cast<uint64_t>(value);
+                }
+
+                std::memcpy(dst, &bits, sizeof(bits));
+                return dst + sizeof(bits);
+            }
+        }
+    }
+
+    /**
+    * @brief Format string checked against its arguments count at compile time.
+    * Only string literals are accepted, their address is stable and serves as format ID.
+    *
+    * @tparam Args Arguments types.
+    */
+    template<typename... Args>
+    struct LogFormat
+    {
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] str Format string literal with one {} field per argument.
+        */
+        template<size_t N>
+        consteval LogFormat(const char (&str)[N])
+            : format(str)
+        {
+            if (LogDetail::CountFields(str) != sizeof...(Args)) LogDetail::FormatArgumentsMismatch();
+        }
+
+        const char* format;  // @brief Format string literal.
+    };
+
+    /**
+    * @brief Single producer single consumer ring of binary log records.
+    * Each thread writes its own ring, the log backend thread drains all of them.
+    */
+    class LogRing : public NonCopyable
+    {
+    public:
+
+        static constexpr size_t Capacity  = 64 * 1024;     // @brief Ring bytes, power of two.
+        static constexpr size_t MaxRecord = Capacity / 4;  // @brief Largest record, longer strings are truncated.
+        static constexpr size_t MaxArgs   = 16;            // @brief Most arguments of a record.
+
+    public:
+
+        /**
+        * @brief Constructor Function.
+        */
+        LogRing();
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~LogRing() = default;
+
+        /**
+        * @brief Encode a record, producer only.
+        *
+        * @param[in] channel LogChannel.
+        * @param[in] level LogLevel.
+        * @param[in] format Format string literal, nullptr if args is a single pre-built message.
+        * @param[in] args Arguments.
+        *
+        * @return Returns false if ring is full.
+        */
+        template<typename... Args>
+        bool Write(LogChannel channel, LogLevel level, const char* format, const Args&... args);
+
+        /**
+        * @brief Get oldest record, consumer only.
+        *
+        * @return Returns record, nullptr if ring is empty.
+        */
+        const LogRecord* Front();
+
+        /**
+        * @brief Pop record returned by Front, consumer only.
+        */
+        void Pop();
+
+        /**
+        * @brief Is ring empty.
+        *
+        * @return Returns true if all records are popped.
+        */
+        bool Empty() const;
+
+        /**
+        * @brief Mark ring as not written anymore, called when its thread exits.
+        */
+        void Retire() { m_Retired.store(true, std::memory_order_release); }
+
+        /**
+        * @brief Is ring retired.
+        *
+        * @return Returns true if its thread exited.
+        */
+        bool Retired() const { return m_Retired.load(std::memory_order_acquire); }
+
+    private:
+
+        /**
+        * @brief Reserve contiguous bytes, producer only.
+        *
+        * @param[in] size Bytes, multiple of 8.
+        *
+        * @return Returns bytes, nullptr if ring is full.
+        */
+        std::byte* Reserve(size_t size);
+
+        /**
+        * @brief Publish bytes of last Reserve, producer only.
+        *
+        * @param[in] size Bytes.
+        */
+        void Commit(size_t size);
+
+    private:
+
+        std::unique_ptr<std::byte[]>       m_Data;            // @brief Ring bytes.
+        alignas(64) std::atomic<uint64_t>  m_Head{ 0 };       // @brief Write position, stored by producer.
+        uint64_t                           m_Reserved = 0;    // @brief Write position after Reserve padding, producer only.
+        uint64_t                           m_CachedTail = 0;  // @brief Last loaded read position, producer only.
+        alignas(64) std::atomic<uint64_t>  m_Tail{ 0 };       // @brief Read position, stored by consumer.
+        uint64_t                           m_CachedHead = 0;  // @brief Last loaded write position, consumer only.
+        std::atomic<bool>                  m_Retired{ false };// @brief Is its thread exited.
+    };
+
+    /**
+    * @brief Registry of producer rings and binary record decoding.
+    */
+    class LogQueue
+    {
+    public:
+
+        static constexpr auto MaxWait = std::chrono::milliseconds(100);  // @brief Longest wait on a full ring before its record is dropped.
+
+    public:
+
+        /**
+        * @brief Get ring of calling thread, registered on first use.
+        *
+        * @return Returns LogRing.
+        */
+        static LogRing& Producer();
+
+        /**
+        * @brief Pop records of all rings in push order of each ring, bounded per ring, removes drained retired rings.
+        *
+        * @param[in] fn Called with each record, strings of decoded arguments live until it returns.
+        *
+        * @return Returns records count.
+        */
+        static size_t Drain(const std::function<void(const LogRecord&)>& fn);
+
+        /**
+        * @brief Decode arguments of a record.
+        *
+        * @param[in] record LogRecord.
+        * @param[out] values At least LogRing::MaxArgs values.
+        *
+        * @return Returns arguments count.
+        */
+        static size_t Decode(const LogRecord& record, LogValue* values);
+
+        /**
+        * @brief Format message of a record, fields take arguments in order and accept fmt specs.
+        *
+        * @param[in] record LogRecord.
+        * @param[out] out Message, cleared first.
+        */
+        static void Format(const LogRecord& record, std::string& out);
+
+        /**
+        * @brief Write a record to a ring, retries while the ring is full and drained, up to MaxWait.
+        *
+        * @param[in] ring LogRing.
+        * @param[in] write Encodes the record, returns false if ring is full.
+        * @param[in] draining Returns false if nothing drains the ring for the calling thread.
+        *
+        * @return Returns false if the record was dropped.
+        */
+        template<typename F, typename D>
+        static bool Write(LogRing& ring, F&& write, D&& draining);
+
+        /**
+        * @brief Get records dropped since start because their ring stayed full.
+        *
+        * @return Returns records count.
+        */
+        static uint64_t Dropped();
+
+    private:
+
+        /**
+        * @brief Count a dropped record.
+        */
+        static void Drop();
+    };
+
+    template<typename... Args>
+    bool LogRing::Write(LogChannel channel, LogLevel level, const char* format, const Args&... args)
+    {
+        static_assert(sizeof...(Args) <= MaxArgs, "Too many log arguments.");
+        static_assert((LogDetail::IsSupported<LogDetail::Arg<Args>> && ...), "Log arguments must be arithmetic, enum, pointer or string, format other types first.");
+
+        size_t budget = MaxRecord - sizeof(LogRecord) - (LogDetail::FixedSize<LogDetail::Arg<Args>>() + ... + 0) - 8;
+
+        uint32_t lengths[sizeof...(Args) + 1] = {};
+        size_t   index   = 0;
+
+        ((lengths[index++] = LogDetail::Take<LogDetail::Arg<Args>>(args, budget)), ...);
+
+        size_t size = sizeof(LogRecord) + (LogDetail::FixedSize<LogDetail::Arg<Args>>() + ... + 0);
+        for (size_t i = 0; i < sizeof...(Args); ++i) size += lengths[i];
+        size = (size + 7) & ~size_t(7);
+
+        std::byte* dst = Reserve(size);
+
+        if (!dst) return false;
+
+        const LogRecord record{
+            static_cast<uint32_t>(size),
+            level,
+            channel,
+            static_cast<uint8_t>(sizeof...(Args)),
+            0,
+            format,
+            std::chrono::system_clock::now().time_since_epoch().count()
+        };
+
+        std::memcpy(dst, &record, sizeof(record));
+
+        std::byte* cursor = dst + sizeof(record);
+        index = 0;
+
+        ((cursor = LogDetail::Encode<LogDetail::Arg<Args>>(cursor, args, lengths[index++])), ...);
+
+        Commit(size);
+
+        return true;
+    }
+
+    template<typename F, typename D>
+    bool LogQueue::Write(LogRing& ring, F&& write, D&& draining)
+    {
+        if (write(ring)) return true;
+
+        // Bounded, a stopped or stalled backend must not hang the calling thread.
+        const auto deadline = std::chrono::steady_clock::now() + MaxWait;
+
+        while (draining() && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+
+            if (write(ring)) return true;
+        }
+
+        Drop();
+
+        return false;
+    }
+}
@@ -0,0 +1,349 @@
+/**
+* @file AllocTracker.cpp.
+* @brief The AllocTracker Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "AllocTracker.h"
+#include "FrameArena.h"
+
+#include <atomic>
+#include <fstream>
+#include <iomanip>
+
+namespace Neptune::Memory {
+
+    namespace {
+
+        constexpr size_t TagCount     = static_cast<size_t>(AllocTag::Count);  // @brief Tags count.
+        constexpr size_t MaxDepth     = 32;                                     // @brief Deepest tag stack.
+        constexpr size_t SiteCapacity = 4096;                                   // @brief Call site slots, slot 0 collects overflow.
+        constexpr size_t MaxProbe     = 64;                                     // @brief Slots probed before overflow.
+
+        /**
+        * @brief Atomic counts of a tag, constant initialized so operator new can run before any constructor.
+        */
+        struct AtomicTagStats
+        {
+            std::atomic<uint64_t> allocations{ 0 };       // @brief Allocations since program begin.
+            std::atomic<uint64_t> bytes{ 0 };             // @brief Bytes allocated since program begin.
+            std::atomic<uint64_t> frees{ 0 };             // @brief Frees since program begin.
+            std::atomic<uint64_t> freedBytes{ 0 };        // @brief Bytes freed since program begin.
+            std::atomic<uint64_t> frameAllocations{ 0 };  // @brief Allocations of last closed frame.
+            std::atomic<uint64_t> frameBytes{ 0 };        // @brief Bytes of last closed frame.
+            uint64_t              beginAllocations = 0;   // @brief Allocations at frame begin, main thread only.
+            uint64_t              beginBytes = 0;         // @brief Bytes at frame begin, main thread only.
+
+            /**
+            * @brief Record an allocation.
+            *
+            * @param[in] size Bytes.
+            */
+            void Alloc(uint64_t size)
+            {
+                allocations.fetch_add(1, std::memory_order_relaxed);
+                bytes.fetch_add(size, std::memory_order_relaxed);
+            }
+
+            /**
+            * @brief Record a free.
+            *
+            * @param[in] size Bytes.
+            */
+            void Free(uint64_t size)
+            {
+                frees.fetch_add(1, std::memory_order_relaxed);
+                freedBytes.fetch_add(size, std::memory_order_relaxed);
+            }
+
+            /**
+            * @brief Latch counts of closed frame.
+            */
+            void NextFrame()
+            {
+                const uint64_t a = allocations.load(std::memory_order_relaxed);
+                const uint64_t b = bytes.load(std::memory_order_relaxed);
+
+                frameAllocations.store(a - beginAllocations, std::memory_order_relaxed);
+                frameBytes.store(b - beginBytes, std::memory_order_relaxed);
+
+                beginAllocations = a;
+                beginBytes       = b;
+            }
+
+            /**
+            * @brief Load counts, live counts are derived so each event touches two counters.
+            *
+            * @return Returns AllocTagStats.
+            */
+            AllocTagStats Load() const
+            {
+                const uint64_t f  = frees.load(std::memory_order_relaxed);
+                const uint64_t fb = freedBytes.load(std::memory_order_relaxed);
+                const uint64_t a  = allocations.load(std::memory_order_relaxed);
+                const uint64_t b  = bytes.load(std::memory_order_relaxed);
+
+                return {
+                    b - fb,
+                    a - f,
+                    a,
+                    b,
+                    f,
+                    frameAllocations.load(std::memory_order_relaxed),
+                    frameBytes.load(std::memory_order_relaxed)
+                };
+            }
+        };
+
+        /**
+        * @brief Counts of a call site.
+        */
+        struct Site
+        {
+            std::atomic<uintptr_t> key{ 0 };          // @brief Return address, 0 if slot empty.
+            std::atomic<uint64_t>  allocations{ 0 };  // @brief Allocations.
+            std::atomic<uint64_t>  bytes{ 0 };        // @brief Bytes allocated.
+            std::atomic<uint64_t>  freedBytes{ 0 };   // @brief Bytes freed.
+        };
+
+        /**
+        * @brief Tag stack of a thread.
+        */
+        struct TagStack
+        {
+            AllocTag tags[MaxDepth];  // @brief Pushed tags.
+            uint32_t depth;           // @brief Pushed count, may exceed MaxDepth.
+        };
+
+        constinit AtomicTagStats          s_Tags[TagCount];        // @brief Counts of each tag.
+        constinit AtomicTagStats          s_Device;                // @brief Counts of device memory.
+        constinit Site                    s_Sites[SiteCapacity];   // @brief Call sites, open addressing.
+        constinit thread_local TagStack   s_Stack{};               // @brief Tag stack of calling thread.
+
+        /**
+        * @brief Find or claim slot of a call site.
+        *
+        * @param[in] site Return address.
+        *
+        * @return Returns slot, 0 if table is full around it.
+        */
+        uint32_t SiteSlot(const void* site) noexcept
+        {
+            const auto key = reinterpret_cast<uintptr_t>(site);
+
+            if (key == 0) return 0;
+
+            const uint64_t hash = static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+
+            for (size_t probe = 0; probe < MaxProbe; ++probe)
+            {
+                const size_t slot = 1 + ((hash >> 32) + probe) % (SiteCapacity - 1);
+
+                uintptr_t current = s_Sites[slot].key.load(std::memory_order_acquire);
+
+                if (current == 0 && s_Sites[slot].key.compare_exchange_strong(current, key, std::memory_order_acq_rel))
+                {
+                    return static_cast<uint32_t>(slot);
+                }
+
+                if (current == key) return static_cast<uint32_t>(slot);
+            }
+
+            return 0;
+        }
+    }
+
+    void AllocTracker::OnAlloc(Header* header, size_t size, const void* site) noexcept
+    {
+        const AllocTag tag = CurrentTag();
+
+        header->size = size;
+        header->site = SiteSlot(site);
+        header->tag  = tag;
+
+        s_Tags[static_cast<size_t>(tag)].Alloc(size);
+
+        auto& slot = s_Sites[header->site];
+        slot.allocations.fetch_add(1, std::memory_order_relaxed);
+        slot.bytes.fetch_add(size, std::memory_order_relaxed);
+
+        NEPTUNE_PROFILE_ALLOC_N(header + 1, size, TagName(tag))
+    }
+
+    void AllocTracker::OnFree(const Header* header) noexcept
+    {
+        NEPTUNE_PROFILE_FREE_N(header + 1, TagName(header->tag))
+
+        s_Tags[static_cast<size_t>(header->tag)].Free(header->size);
+
+        s_Sites[header->site].freedBytes.fetch_add(header->size, std::memory_order_relaxed);
+    }
+
+    void AllocTracker::OnDeviceAlloc([[maybe_unused]] const void* handle, uint64_t size) noexcept
+    {
+        s_Device.Alloc(size);
+
+        NEPTUNE_PROFILE_ALLOC_N(handle, size, "Device")
+    }
+
+    void AllocTracker::OnDeviceFree([[maybe_unused]] const void* handle, uint64_t size) noexcept
+    {
+        NEPTUNE_PROFILE_FREE_N(handle, "Device")
+
+        s_Device.Free(size);
+    }
+
+    void AllocTracker::PushTag(AllocTag tag) noexcept
+    {
+        if (s_Stack.depth < MaxDepth) s_Stack.tags[s_Stack.depth] = tag;
+
+        ++s_Stack.depth;
+    }
+
+    void AllocTracker::PopTag() noexcept
+    {
+        --s_Stack.depth;
+    }
+
+    AllocTag AllocTracker::CurrentTag() noexcept
+    {
+        if (s_Stack.depth == 0) return AllocTag::Untagged;
+
+        return s_Stack.tags[std::min<size_t>(s_Stack.depth, MaxDepth) - 1];
+    }
+
+    const char* AllocTracker::TagName(AllocTag tag)
+    {
+        switch (tag)
+        {
+            case AllocTag::Untagged:   return "Untagged";
+            case AllocTag::Video:      return "Video";
+            case AllocTag::Render:     return "Render";
+            case AllocTag::World:      return "World";
+            case AllocTag::Slate:      return "Slate";
+            case AllocTag::Log:        return "Log";
+            default:                   return "Unknown";
+        }
+    }
+
+    void AllocTracker::NextFrame()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        for (auto& tag : s_Tags)
+        {
+            tag.NextFrame();
+        }
+
+        s_Device.NextFrame();
+    }
+
+    AllocTagStats AllocTracker::GetTagStats(AllocTag tag)
+    {
+        return s_Tags[static_cast<size_t>(tag)].Load();
+    }
+
+    AllocTagStats AllocTracker::GetDeviceStats()
+    {
+        return s_Device.Load();
+    }
+
+    std::vector<AllocSiteStats> AllocTracker::TopSites(size_t count)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::vector<AllocSiteStats> sites;
+
+        for (const auto& site : s_Sites)
+        {
+            const uint64_t allocations = site.allocations.load(std::memory_order_relaxed);
+
+            if (allocations == 0) continue;
+
+            const uint64_t bytes = site.bytes.load(std::memory_order_relaxed);
+
+            sites.push_back({
+                reinterpret_cast<const void*>(site.key.load(std::memory_order_relaxed)),
+                allocations,
+                bytes,
+                bytes - site.freedBytes.load(std::memory_order_relaxed)
+            });
+        }
+
+        count = std::min(count, sites.size());
+
+        std::partial_sort(sites.begin(), sites.begin() + count, sites.end(), [](const auto& a, const auto& b) {
+            return a.bytes > b.bytes;
+        });
+
+        sites.resize(count);
+
+        return sites;
+    }
+
+    bool AllocTracker::WriteReport(const std::string& path, size_t sites)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::ofstream file(path, std::ios::out | std::ios::trunc);
+
+        if (!file.is_open())
+        {
+            NEPTUNE_CORE_WARN("AllocTracker: Failed to open report file: " + path)
+            return false;
+        }
+
+        auto row = [&](const char* name, const AllocTagStats& stats) {
+            file << std::left  << std::setw(10) << name
+                 << std::right << std::setw(16) << stats.liveBytes
+                 << std::setw(12) << stats.liveCount
+                 << std::setw(14) << stats.allocations
+                 << std::setw(18) << stats.bytes
+                 << std::setw(14) << stats.frees
+                 << std::setw(14) << stats.frameAllocations
+                 << std::setw(16) << stats.frameBytes << '\n';
+        };
+
+        file << "Allocation report, frame " << FrameArena::Frame() << ", tracker " << (Enabled() ? "on" : "off") << "\n\n";
+
+        file << std::left  << std::setw(10) << "Tag"
+             << std::right << std::setw(16) << "LiveBytes"
+             << std::setw(12) << "LiveCount"
+             << std::setw(14) << "Allocations"
+             << std::setw(18) << "Bytes"
+             << std::setw(14) << "Frees"
+             << std::setw(14) << "FrameAllocs"
+             << std::setw(16) << "FrameBytes" << '\n';
+
+        for (size_t i = 0; i < TagCount; ++i)
+        {
+            const auto tag = static_cast<AllocTag>(i);
+
+            row(TagName(tag), GetTagStats(tag));
+        }
+
+        row("Device", GetDeviceStats());
+
+        // Resolve addresses with addr2line or the debugger, slot 0 collects sites beyond the table.
+        file << "\nTop call sites by bytes\n\n";
+
+        file << std::left  << std::setw(20) << "Site"
+             << std::right << std::setw(14) << "Allocations"
+             << std::setw(18) << "Bytes"
+             << std::setw(16) << "LiveBytes" << '\n';
+
+        for (const auto& site : TopSites(sites))
+        {
+            std::stringstream address;
+            address << site.site;
+
+            file << std::left  << std::setw(20) << (site.site ? address.str() : "Other")
+                 << std::right << std::setw(14) << site.allocations
+                 << std::setw(18) << site.bytes
+                 << std::setw(16) << site.liveBytes << '\n';
+        }
+
+        return true;
+    }
+}
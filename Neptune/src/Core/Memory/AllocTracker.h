@@ -0,0 +1,252 @@
+/**
+* @file AllocTracker.h.
+* @brief The AllocTracker Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Core/NonCopyable.h"
+
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+
+/**
+* @brief Return address of current function.
+*/
+#define NEPTUNE_RETURN_ADDRESS _ReturnAddress()
+#else
+
+/**
+* @brief Return address of current function.
+*/
+#define NEPTUNE_RETURN_ADDRESS __builtin_return_address(0)
+#endif
+
+namespace Neptune::Memory {
+
+    /**
+    * @brief Subsystem heap allocations are attributed to.
+    */
+    enum class AllocTag : uint8_t
+    {
+        Untagged = 0,
+        Video,
+        Render,
+        World,
+        Slate,
+        Log,
+
+        Count
+    };
+
+    /**
+    * @brief Counts of a tag.
+    */
+    struct AllocTagStats
+    {
+        uint64_t liveBytes        = 0;  // @brief Bytes not freed yet.
+        uint64_t liveCount        = 0;  // @brief Allocations not freed yet.
+        uint64_t allocations      = 0;  // @brief Allocations since program begin.
+        uint64_t bytes            = 0;  // @brief Bytes allocated since program begin.
+        uint64_t frees            = 0;  // @brief Frees since program begin.
+        uint64_t frameAllocations = 0;  // @brief Allocations of last closed frame.
+        uint64_t frameBytes       = 0;  // @brief Bytes allocated in last closed frame.
+    };
+
+    /**
+    * @brief Counts of a call site.
+    */
+    struct AllocSiteStats
+    {
+        const void* site        = nullptr;  // @brief Return address of operator new.
+        uint64_t    allocations = 0;        // @brief Allocations.
+        uint64_t    bytes       = 0;        // @brief Bytes allocated.
+        uint64_t    liveBytes   = 0;        // @brief Bytes not freed yet.
+    };
+
+    /**
+    * @brief Attributes heap allocations to subsystem tags and call sites.
+    * Global operator new feeds it when built with NP_ALLOC_TRACKER, VMA device memory callbacks feed device counts.
+    * Bookkeeping is lock free and never allocates, so it runs inside operator new.
+    */
+    class AllocTracker
+    {
+    public:
+
+        /**
+        * @brief Header placed before each tracked allocation.
+        */
+        struct Header
+        {
+            uint64_t size;     // @brief Bytes requested.
+            uint32_t site;     // @brief Call site slot.
+            AllocTag tag;      // @brief Tag at allocation.
+            uint8_t  pad[3];   // @brief Keep user memory 16 bytes aligned.
+        };
+
+        static_assert(sizeof(Header) == 16, "Header must keep malloc alignment.");
+
+    public:
+
+        /**
+        * @brief Is tracker built in.
+        *
+        * @return Returns true if NP_ALLOC_TRACKER is defined.
+        */
+        static constexpr bool Enabled()
+        {
+#ifdef NP_ALLOC_TRACKER
+            return true;
+#else
+            return false;
+#endif
+        }
+
+        /**
+        * @brief Record an allocation and fill its header.
+        *
+        * @param[in] header Header of allocation.
+        * @param[in] size Bytes requested.
+        * @param[in] site Call site.
+        */
+        static void OnAlloc(Header* header, size_t size, const void* site) noexcept;
+
+        /**
+        * @brief Record a free.
+        *
+        * @param[in] header Header of allocation.
+        */
+        static void OnFree(const Header* header) noexcept;
+
+        /**
+        * @brief Record a device memory allocation.
+        *
+        * @param[in] handle Device memory handle.
+        * @param[in] size Bytes.
+        */
+        static void OnDeviceAlloc(const void* handle, uint64_t size) noexcept;
+
+        /**
+        * @brief Record a device memory free.
+        *
+        * @param[in] handle Device memory handle.
+        * @param[in] size Bytes.
+        */
+        static void OnDeviceFree(const void* handle, uint64_t size) noexcept;
+
+        /**
+        * @brief Push tag of calling thread.
+        *
+        * @param[in] tag AllocTag.
+        */
+        static void PushTag(AllocTag tag) noexcept;
+
+        /**
+        * @brief Pop tag of calling thread.
+        */
+        static void PopTag() noexcept;
+
+        /**
+        * @brief Get tag of calling thread.
+        *
+        * @return Returns AllocTag.
+        */
+        static AllocTag CurrentTag() noexcept;
+
+        /**
+        * @brief Get name of a tag.
+        *
+        * @param[in] tag AllocTag.
+        *
+        * @return Returns name, a static string.
+        */
+        static const char* TagName(AllocTag tag);
+
+        /**
+        * @brief Close current frame, latches churn of each tag.
+        */
+        static void NextFrame();
+
+        /**
+        * @brief Get counts of a tag.
+        *
+        * @param[in] tag AllocTag.
+        *
+        * @return Returns AllocTagStats.
+        */
+        static AllocTagStats GetTagStats(AllocTag tag);
+
+        /**
+        * @brief Get counts of device memory.
+        *
+        * @return Returns AllocTagStats.
+        */
+        static AllocTagStats GetDeviceStats();
+
+        /**
+        * @brief Get call sites with most bytes allocated.
+        *
+        * @param[in] count Sites count.
+        *
+        * @return Returns sites, most bytes first.
+        */
+        static std::vector<AllocSiteStats> TopSites(size_t count);
+
+        /**
+        * @brief Write tags, device memory and top call sites to a text file.
+        *
+        * @param[in] path File path.
+        * @param[in] sites Call sites count.
+        *
+        * @return Returns true if written.
+        */
+        static bool WriteReport(const std::string& path, size_t sites = 32);
+    };
+
+    /**
+    * @brief Push a tag for a scope.
+    */
+    class AllocTagScope : public NonCopyable
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] tag AllocTag.
+        */
+        explicit AllocTagScope(AllocTag tag) { AllocTracker::PushTag(tag); }
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~AllocTagScope() { AllocTracker::PopTag(); }
+    };
+}
+
+#ifdef NP_ALLOC_TRACKER
+
+#define NEPTUNE_ALLOC_TAG_CONCAT_IMPL(a, b) a##b
+#define NEPTUNE_ALLOC_TAG_CONCAT(a, b) NEPTUNE_ALLOC_TAG_CONCAT_IMPL(a, b)
+
+/**
+* @brief Attribute heap allocations of this scope to a tag.
+*
+* @param[in] tag AllocTag enumerator.
+*/
+#define NEPTUNE_ALLOC_TAG(tag) ::Neptune::Memory::AllocTagScope NEPTUNE_ALLOC_TAG_CONCAT(allocTagScope, __LINE__)(::Neptune::Memory::AllocTag::tag);
+
+#else
+
+/**
+* @brief Attribute heap allocations of this scope to a tag.
+*
+* @param[in] tag AllocTag enumerator.
+*/
+#define NEPTUNE_ALLOC_TAG(tag)
+
+#endif
@@ -0,0 +1,47 @@
+/**
+* @file FrameArena.cpp.
+* @brief The FrameArena Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "FrameArena.h"
+
+#include <atomic>
+
+namespace Neptune::Memory {
+
+    namespace {
+
+        std::atomic<uint64_t> s_Frame{ 0 };  // @brief Current frame index.
+    }
+
+    LinearArena& FrameArena::Get()
+    {
+        thread_local LinearArena arena;
+        thread_local uint64_t    frame = 0;
+
+        const uint64_t current = s_Frame.load(std::memory_order_acquire);
+
+        if (frame != current)
+        {
+            arena.Reset();
+
+            frame = current;
+        }
+
+        return arena;
+    }
+
+    void FrameArena::NextFrame()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        s_Frame.fetch_add(1, std::memory_order_release);
+    }
+
+    uint64_t FrameArena::Frame()
+    {
+        return s_Frame.load(std::memory_order_acquire);
+    }
+}
@@ -0,0 +1,70 @@
+/**
+* @file FrameArena.h.
+* @brief The FrameArena Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "LinearArena.h"
+
+#include <vector>
+
+namespace Neptune::Memory {
+
+    /**
+    * @brief Per frame, per thread LinearArena.
+    * Each thread owns an arena which is reset the first time it is used in a new frame,
+    * so memory from it lives until the frame ends and must not be handed to another frame.
+    * Work spread to other threads must join before the frame ends.
+    */
+    class FrameArena
+    {
+    public:
+
+        /**
+        * @brief Get arena of calling thread, reset if frame changed since last use.
+        *
+        * @return Returns LinearArena.
+        */
+        static LinearArena& Get();
+
+        /**
+        * @brief End current frame, called once per frame by Application.
+        */
+        static void NextFrame();
+
+        /**
+        * @brief Get current frame index.
+        *
+        * @return Returns frame index.
+        */
+        static uint64_t Frame();
+    };
+
+    /**
+    * @brief std::vector on FrameArena of calling thread.
+    *
+    * @tparam T Element.
+    */
+    template<typename T>
+    using FrameVector = std::pmr::vector<T>;
+
+    /**
+    * @brief Create an empty FrameVector.
+    *
+    * @tparam T Element.
+    * @param[in] capacity Reserved elements.
+    *
+    * @return Returns FrameVector.
+    */
+    template<typename T>
+    FrameVector<T> MakeFrameVector(size_t capacity = 0)
+    {
+        FrameVector<T> vector(&FrameArena::Get());
+
+        vector.reserve(capacity);
+
+        return vector;
+    }
+}
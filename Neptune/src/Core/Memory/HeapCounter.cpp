@@ -0,0 +1,211 @@
+/**
+* @file HeapCounter.cpp.
+* @brief The HeapCounter Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "HeapCounter.h"
+#include "AllocTracker.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace Neptune::Memory {
+
+    namespace {
+
+        /**
+        * @brief Atomic HeapStats, constant initialized so operator new can run before any constructor.
+        */
+        struct AtomicHeapStats
+        {
+            std::atomic<uint64_t> allocations{ 0 };  // @brief Calls of operator new.
+            std::atomic<uint64_t> frees{ 0 };        // @brief Calls of operator delete.
+            std::atomic<uint64_t> bytes{ 0 };        // @brief Bytes requested by operator new.
+
+            /**
+            * @brief Load counts.
+            *
+            * @return Returns HeapStats.
+            */
+            HeapStats Load() const
+            {
+                return {
+                    allocations.load(std::memory_order_relaxed),
+                    frees.load(std::memory_order_relaxed),
+                    bytes.load(std::memory_order_relaxed)
+                };
+            }
+
+            /**
+            * @brief Store counts.
+            *
+            * @param[in] stats HeapStats.
+            */
+            void Store(const HeapStats& stats)
+            {
+                allocations.store(stats.allocations, std::memory_order_relaxed);
+                frees.store(stats.frees, std::memory_order_relaxed);
+                bytes.store(stats.bytes, std::memory_order_relaxed);
+            }
+        };
+
+        constinit AtomicHeapStats s_Total;       // @brief Counts since program begin.
+        constinit AtomicHeapStats s_FrameBegin;  // @brief Total at current frame begin.
+        constinit AtomicHeapStats s_LastFrame;   // @brief Counts of last closed frame.
+
+        /**
+        * @brief Subtract two HeapStats.
+        *
+        * @param[in] a Later counts.
+        * @param[in] b Earlier counts.
+        *
+        * @return Returns a - b.
+        */
+        HeapStats Diff(const HeapStats& a, const HeapStats& b)
+        {
+            return { a.allocations - b.allocations, a.frees - b.frees, a.bytes - b.bytes };
+        }
+
+        /**
+        * @brief Allocate and count.
+        *
+        * @param[in] size Bytes.
+        * @param[in] site Call site of operator new.
+        *
+        * @return Returns memory, nullptr if out of memory.
+        */
+        void* Allocate(size_t size, [[maybe_unused]] const void* site) noexcept
+        {
+            s_Total.allocations.fetch_add(1, std::memory_order_relaxed);
+            s_Total.bytes.fetch_add(size, std::memory_order_relaxed);
+
+#ifdef NP_ALLOC_TRACKER
+
+            auto header = static_cast<AllocTracker::Header*>(std::malloc(sizeof(AllocTracker::Header) + size));
+
+            if (!header) return nullptr;
+
+            AllocTracker::OnAlloc(header, size, site);
+
+            return header + 1;
+
+#else
+
+            return std::malloc(size ? size : 1);
+
+#endif
+        }
+
+        /**
+        * @brief Free and count.
+        *
+        * @param[in] p Memory.
+        */
+        void Free(void* p) noexcept
+        {
+            if (!p) return;
+
+            s_Total.frees.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef NP_ALLOC_TRACKER
+
+            auto header = static_cast<AllocTracker::Header*>(p) - 1;
+
+            AllocTracker::OnFree(header);
+
+            std::free(header);
+
+#else
+
+            std::free(p);
+
+#endif
+        }
+    }
+
+    void HeapCounter::NextFrame()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const HeapStats total = s_Total.Load();
+
+        s_LastFrame.Store(Diff(total, s_FrameBegin.Load()));
+        s_FrameBegin.Store(total);
+
+        AllocTracker::NextFrame();
+    }
+
+    HeapStats HeapCounter::LastFrame()
+    {
+        return s_LastFrame.Load();
+    }
+
+    HeapStats HeapCounter::CurrentFrame()
+    {
+        return Diff(s_Total.Load(), s_FrameBegin.Load());
+    }
+
+    HeapStats HeapCounter::Total()
+    {
+        return s_Total.Load();
+    }
+}
+
+// Aligned forms keep the standard library implementation and are neither counted nor tracked.
+
+void* operator new(size_t size)
+{
+    if (void* p = Neptune::Memory::Allocate(size, NEPTUNE_RETURN_ADDRESS)) return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new[](size_t size)
+{
+    if (void* p = Neptune::Memory::Allocate(size, NEPTUNE_RETURN_ADDRESS)) return p;
+
+    throw std::bad_alloc();
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return Neptune::Memory::Allocate(size, NEPTUNE_RETURN_ADDRESS);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return Neptune::Memory::Allocate(size, NEPTUNE_RETURN_ADDRESS);
+}
+
+void operator delete(void* p) noexcept
+{
+    Neptune::Memory::Free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    Neptune::Memory::Free(p);
+}
+
+void operator delete(void* p, size_t) noexcept
+{
+    Neptune::Memory::Free(p);
+}
+
+void operator delete[](void* p, size_t) noexcept
+{
+    Neptune::Memory::Free(p);
+}
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    Neptune::Memory::Free(p);
+}
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    Neptune::Memory::Free(p);
+}
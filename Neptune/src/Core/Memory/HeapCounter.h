@@ -0,0 +1,56 @@
+/**
+* @file HeapCounter.h.
+* @brief The HeapCounter Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+namespace Neptune::Memory {
+
+    /**
+    * @brief Heap counts.
+    */
+    struct HeapStats
+    {
+        uint64_t allocations = 0;  // @brief Calls of operator new.
+        uint64_t frees       = 0;  // @brief Calls of operator delete.
+        uint64_t bytes       = 0;  // @brief Bytes requested by operator new.
+    };
+
+    /**
+    * @brief Counts global operator new and delete, replaced in HeapCounter.cpp.
+    * Counters are relaxed atomics, cheap enough to stay on in every build.
+    */
+    class HeapCounter
+    {
+    public:
+
+        /**
+        * @brief Close current frame, called once per frame by Application.
+        */
+        static void NextFrame();
+
+        /**
+        * @brief Get counts of last closed frame.
+        *
+        * @return Returns HeapStats.
+        */
+        static HeapStats LastFrame();
+
+        /**
+        * @brief Get counts since current frame begin.
+        *
+        * @return Returns HeapStats.
+        */
+        static HeapStats CurrentFrame();
+
+        /**
+        * @brief Get counts since program begin.
+        *
+        * @return Returns HeapStats.
+        */
+        static HeapStats Total();
+    };
+}
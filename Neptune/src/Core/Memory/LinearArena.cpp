@@ -0,0 +1,118 @@
+/**
+* @file LinearArena.cpp.
+* @brief The LinearArena Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "LinearArena.h"
+
+namespace Neptune::Memory {
+
+    LinearArena::LinearArena(size_t blockSize, std::pmr::memory_resource* upstream)
+        : m_Upstream(upstream)
+        , m_BlockSize(blockSize)
+    {}
+
+    LinearArena::~LinearArena()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        Release();
+    }
+
+    void LinearArena::Rewind(const Marker& marker)
+    {
+        m_Current = marker.block;
+        m_Offset  = marker.offset;
+    }
+
+    void LinearArena::Reset()
+    {
+        m_Current = nullptr;
+        m_Offset  = 0;
+    }
+
+    void LinearArena::Release()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        while (m_Head)
+        {
+            Block* next = m_Head->next;
+
+            m_Upstream->deallocate(m_Head, sizeof(Block) + m_Head->size, alignof(std::max_align_t));
+
+            m_Head = next;
+        }
+
+        m_Current    = nullptr;
+        m_Offset     = 0;
+        m_Capacity   = 0;
+        m_BlockCount = 0;
+    }
+
+    void* LinearArena::do_allocate(size_t bytes, size_t alignment)
+    {
+        if (m_Current)
+        {
+            if (void* p = Bump(m_Current, m_Offset, bytes, alignment)) return p;
+        }
+
+        // Reuse a kept block after the cursor before asking upstream.
+        Block* next = m_Current ? m_Current->next : m_Head;
+
+        while (next)
+        {
+            size_t offset = 0;
+
+            if (void* p = Bump(next, offset, bytes, alignment))
+            {
+                m_Current = next;
+                m_Offset  = offset;
+
+                return p;
+            }
+
+            next = next->next;
+        }
+
+        NEPTUNE_PROFILE_ZONEN("LinearArena::Grow")
+
+        const size_t size = std::max(m_BlockSize, bytes + alignment);
+
+        auto block = static_cast<Block*>(m_Upstream->allocate(sizeof(Block) + size, alignof(std::max_align_t)));
+        block->size = size;
+
+        if (m_Current)
+        {
+            block->next = m_Current->next;
+            m_Current->next = block;
+        }
+        else
+        {
+            block->next = m_Head;
+            m_Head = block;
+        }
+
+        m_Capacity += size;
+        ++m_BlockCount;
+
+        m_Current = block;
+        m_Offset  = 0;
+
+        return Bump(m_Current, m_Offset, bytes, alignment);
+    }
+
+    void* LinearArena::Bump(Block* block, size_t& offset, size_t bytes, size_t alignment)
+    {
+        const auto base    = reinterpret_cast<uintptr_t>(block + 1);
+        const auto aligned = (base + offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+
+        if (aligned + bytes > base + block->size) return nullptr;
+
+        offset = aligned + bytes - base;
+
+        return reinterpret_cast<void*>(aligned);
+    }
+}
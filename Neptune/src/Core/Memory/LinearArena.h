@@ -0,0 +1,190 @@
+/**
+* @file LinearArena.h.
+* @brief The LinearArena Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Core/NonCopyable.h"
+
+#include <memory_resource>
+
+namespace Neptune::Memory {
+
+    /**
+    * @brief Chunked bump allocator.
+    * Allocation moves a cursor forward, deallocation is a no-op, memory comes back at once by Reset or Rewind.
+    * Blocks are kept on Reset and reused, so a warm arena does not touch the heap.
+    * Not thread safe, use one arena per thread.
+    */
+    class LinearArena : public std::pmr::memory_resource, public NonCopyable
+    {
+    private:
+
+        /**
+        * @brief Block header, data follows it.
+        */
+        struct Block
+        {
+            Block* next;  // @brief Next block.
+            size_t size;  // @brief Bytes of data.
+        };
+
+    public:
+
+        /**
+        * @brief Position of the cursor, used to rewind.
+        */
+        struct Marker
+        {
+            Block* block  = nullptr;  // @brief Current block.
+            size_t offset = 0;        // @brief Offset in current block.
+        };
+
+    public:
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] blockSize Bytes of a block.
+        * @param[in] upstream Resource blocks come from.
+        */
+        explicit LinearArena(size_t blockSize = 64 * 1024, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~LinearArena() override;
+
+        /**
+        * @brief Get cursor position.
+        *
+        * @return Returns Marker.
+        */
+        Marker GetMarker() const { return { m_Current, m_Offset }; }
+
+        /**
+        * @brief Move cursor back, memory allocated after marker is released.
+        *
+        * @param[in] marker Marker got before.
+        */
+        void Rewind(const Marker& marker);
+
+        /**
+        * @brief Release all allocations, blocks are kept.
+        */
+        void Reset();
+
+        /**
+        * @brief Release all allocations and blocks.
+        */
+        void Release();
+
+        /**
+        * @brief Get bytes of all blocks.
+        *
+        * @return Returns bytes.
+        */
+        size_t Capacity() const { return m_Capacity; }
+
+        /**
+        * @brief Get blocks count.
+        *
+        * @return Returns blocks count.
+        */
+        size_t BlockCount() const { return m_BlockCount; }
+
+        /**
+        * @brief Construct an object in this arena, its destructor is never called.
+        *
+        * @tparam T Trivially destructible type.
+        * @param[in] args Constructor arguments.
+        *
+        * @return Returns object.
+        */
+        template<typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "LinearArena does not call destructors.");
+
+            return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+    private:
+
+        /**
+        * @brief Allocate memory.
+        *
+        * @param[in] bytes Bytes.
+        * @param[in] alignment Alignment.
+        *
+        * @return Returns memory.
+        */
+        void* do_allocate(size_t bytes, size_t alignment) override;
+
+        /**
+        * @brief Deallocate memory, no-op.
+        */
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        /**
+        * @brief Is resource equal to this.
+        *
+        * @param[in] other Other resource.
+        *
+        * @return Returns true if same object.
+        */
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        /**
+        * @brief Bump cursor in a block.
+        *
+        * @param[in] block Block.
+        * @param[in] offset Offset in block.
+        * @param[in] bytes Bytes.
+        * @param[in] alignment Alignment.
+        *
+        * @return Returns memory, nullptr if not fit.
+        */
+        static void* Bump(Block* block, size_t& offset, size_t bytes, size_t alignment);
+
+    private:
+
+        std::pmr::memory_resource* m_Upstream;           // @brief Resource blocks come from.
+        size_t                     m_BlockSize;          // @brief Bytes of a block.
+        Block*                     m_Head = nullptr;     // @brief First block.
+        Block*                     m_Current = nullptr;  // @brief Block cursor in, nullptr before first allocation.
+        size_t                     m_Offset = 0;         // @brief Cursor in current block.
+        size_t                     m_Capacity = 0;       // @brief Bytes of all blocks.
+        size_t                     m_BlockCount = 0;     // @brief Blocks count.
+    };
+
+    /**
+    * @brief Rewind an arena at scope exit.
+    */
+    class ArenaScope : public NonCopyable
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] arena LinearArena.
+        */
+        explicit ArenaScope(LinearArena& arena)
+            : m_Arena(arena)
+            , m_Marker(arena.GetMarker())
+        {}
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~ArenaScope() { m_Arena.Rewind(m_Marker); }
+
+    private:
+
+        LinearArena&        m_Arena;   // @brief LinearArena.
+        LinearArena::Marker m_Marker;  // @brief Cursor at scope begin.
+    };
+}
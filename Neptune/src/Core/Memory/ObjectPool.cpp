@@ -0,0 +1,104 @@
+/**
+* @file ObjectPool.cpp.
+* @brief The ObjectPool Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "ObjectPool.h"
+
+namespace Neptune::Memory {
+
+    PoolResource::PoolResource(
+        size_t                     blockSize      ,
+        size_t                     blockAlign     ,
+        size_t                     blocksPerChunk ,
+        std::pmr::memory_resource* upstream
+    )
+        : m_Upstream(upstream)
+        , m_BlockAlign(std::max(blockAlign, alignof(FreeBlock)))
+        , m_BlocksPerChunk(std::max<size_t>(blocksPerChunk, 1))
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        // Blocks hold a free list link and stay aligned back to back.
+        m_BlockSize   = (std::max(blockSize, sizeof(FreeBlock)) + m_BlockAlign - 1) & ~(m_BlockAlign - 1);
+        m_ChunkHeader = (sizeof(Chunk) + m_BlockAlign - 1) & ~(m_BlockAlign - 1);
+    }
+
+    PoolResource::~PoolResource()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        while (m_Chunks)
+        {
+            Chunk* next = m_Chunks->next;
+
+            m_Upstream->deallocate(m_Chunks, m_ChunkHeader + m_BlockSize * m_BlocksPerChunk, m_BlockAlign);
+
+            m_Chunks = next;
+        }
+    }
+
+    size_t PoolResource::InUse() const
+    {
+        std::unique_lock lock(m_Mutex);
+
+        return m_InUse;
+    }
+
+    size_t PoolResource::ChunkCount() const
+    {
+        std::unique_lock lock(m_Mutex);
+
+        return m_ChunkCount;
+    }
+
+    void* PoolResource::do_allocate(size_t bytes, size_t alignment)
+    {
+        if (!Fits(bytes, alignment)) return m_Upstream->allocate(bytes, alignment);
+
+        std::unique_lock lock(m_Mutex);
+
+        if (!m_Free)
+        {
+            NEPTUNE_PROFILE_ZONEN("PoolResource::Grow")
+
+            auto chunk = static_cast<Chunk*>(m_Upstream->allocate(m_ChunkHeader + m_BlockSize * m_BlocksPerChunk, m_BlockAlign));
+
+            chunk->next = m_Chunks;
+            m_Chunks = chunk;
+            ++m_ChunkCount;
+
+            auto first = reinterpret_cast<std::byte*>(chunk) + m_ChunkHeader;
+
+            // Link in reverse so blocks are handed out in address order.
+            for (size_t i = m_BlocksPerChunk; i > 0; --i)
+            {
+                auto block = reinterpret_cast<FreeBlock*>(first + (i - 1) * m_BlockSize);
+
+                block->next = m_Free;
+                m_Free = block;
+            }
+        }
+
+        FreeBlock* block = m_Free;
+        m_Free = block->next;
+        ++m_InUse;
+
+        return block;
+    }
+
+    void PoolResource::do_deallocate(void* p, size_t bytes, size_t alignment)
+    {
+        if (!Fits(bytes, alignment)) return m_Upstream->deallocate(p, bytes, alignment);
+
+        std::unique_lock lock(m_Mutex);
+
+        auto block = static_cast<FreeBlock*>(p);
+
+        block->next = m_Free;
+        m_Free = block;
+        --m_InUse;
+    }
+}
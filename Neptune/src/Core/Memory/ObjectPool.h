@@ -0,0 +1,273 @@
+/**
+* @file ObjectPool.h.
+* @brief The ObjectPool Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Core/NonCopyable.h"
+
+#include <memory_resource>
+#include <mutex>
+
+namespace Neptune::Memory {
+
+    /**
+    * @brief Fixed size block resource.
+    * Blocks of one size are carved from chunks and recycled through a free list,
+    * requests of other size or alignment go to upstream.
+    * Thread safe.
+    */
+    class PoolResource : public std::pmr::memory_resource, public NonCopyable
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] blockSize Bytes of a block.
+        * @param[in] blockAlign Alignment of a block.
+        * @param[in] blocksPerChunk Blocks carved from one upstream chunk.
+        * @param[in] upstream Resource chunks come from.
+        */
+        PoolResource(
+            size_t                     blockSize      ,
+            size_t                     blockAlign     ,
+            size_t                     blocksPerChunk = 64,
+            std::pmr::memory_resource* upstream       = std::pmr::new_delete_resource()
+        );
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~PoolResource() override;
+
+        /**
+        * @brief Get pool shared by all users of a block size.
+        * Never destroyed, so objects released during static destruction stay valid.
+        *
+        * @tparam Size Bytes of a block.
+        * @tparam Align Alignment of a block.
+        *
+        * @return Returns PoolResource.
+        */
+        template<size_t Size, size_t Align>
+        static PoolResource& Shared()
+        {
+            static auto pool = new PoolResource(Size, Align);
+
+            return *pool;
+        }
+
+        /**
+        * @brief Get blocks handed out.
+        *
+        * @return Returns blocks count.
+        */
+        size_t InUse() const;
+
+        /**
+        * @brief Get chunks allocated from upstream.
+        *
+        * @return Returns chunks count.
+        */
+        size_t ChunkCount() const;
+
+    private:
+
+        /**
+        * @brief Allocate memory.
+        *
+        * @param[in] bytes Bytes.
+        * @param[in] alignment Alignment.
+        *
+        * @return Returns memory.
+        */
+        void* do_allocate(size_t bytes, size_t alignment) override;
+
+        /**
+        * @brief Deallocate memory.
+        *
+        * @param[in] p Memory.
+        * @param[in] bytes Bytes.
+        * @param[in] alignment Alignment.
+        */
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+
+        /**
+        * @brief Is resource equal to this.
+        *
+        * @param[in] other Other resource.
+        *
+        * @return Returns true if same object.
+        */
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        /**
+        * @brief Is request served by pool.
+        *
+        * @param[in] bytes Bytes.
+        * @param[in] alignment Alignment.
+        *
+        * @return Returns true if fits a block.
+        */
+        bool Fits(size_t bytes, size_t alignment) const { return bytes <= m_BlockSize && alignment <= m_BlockAlign; }
+
+    private:
+
+        /**
+        * @brief Free block, linked through its own memory.
+        */
+        struct FreeBlock
+        {
+            FreeBlock* next;  // @brief Next free block.
+        };
+
+        /**
+        * @brief Chunk header, blocks follow it.
+        */
+        struct Chunk
+        {
+            Chunk* next;  // @brief Next chunk.
+        };
+
+        std::pmr::memory_resource* m_Upstream;          // @brief Resource chunks come from.
+        size_t                     m_BlockSize;         // @brief Bytes of a block, multiple of alignment.
+        size_t                     m_BlockAlign;        // @brief Alignment of a block.
+        size_t                     m_BlocksPerChunk;    // @brief Blocks of a chunk.
+        size_t                     m_ChunkHeader;       // @brief Bytes before first block of a chunk.
+
+        mutable std::mutex         m_Mutex;             // @brief Mutex of free list.
+        FreeBlock*                 m_Free = nullptr;    // @brief Free list.
+        Chunk*                     m_Chunks = nullptr;  // @brief Chunks.
+        size_t                     m_ChunkCount = 0;    // @brief Chunks count.
+        size_t                     m_InUse = 0;         // @brief Blocks handed out.
+    };
+
+    /**
+    * @brief Typed object pool over a PoolResource.
+    *
+    * @tparam T Object.
+    */
+    template<typename T>
+    class ObjectPool : public NonCopyable
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] objectsPerChunk Objects carved from one upstream chunk.
+        */
+        explicit ObjectPool(size_t objectsPerChunk = 64)
+            : m_Resource(sizeof(T), alignof(T), objectsPerChunk)
+        {}
+
+        /**
+        * @brief Destructor Function.
+        * Objects still alive are not destroyed, their memory is released.
+        */
+        ~ObjectPool() = default;
+
+        /**
+        * @brief Construct an object.
+        *
+        * @param[in] args Constructor arguments.
+        *
+        * @return Returns object.
+        */
+        template<typename... Args>
+        T* New(Args&&... args)
+        {
+            return new (m_Resource.allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+        }
+
+        /**
+        * @brief Destroy an object created by New.
+        *
+        * @param[in] object Object.
+        */
+        void Delete(T* object)
+        {
+            if (!object) return;
+
+            object->~T();
+
+            m_Resource.deallocate(object, sizeof(T), alignof(T));
+        }
+
+        /**
+        * @brief Get objects alive.
+        *
+        * @return Returns objects count.
+        */
+        size_t Size() const { return m_Resource.InUse(); }
+
+    private:
+
+        PoolResource m_Resource;  // @brief Blocks of T.
+    };
+
+    /**
+    * @brief Stateless allocator, single objects come from PoolResource::Shared of their size.
+    * Used by std::allocate_shared, which rebinds it to its control block type.
+    *
+    * @tparam T Value type.
+    */
+    template<typename T>
+    struct PoolAllocator
+    {
+        using value_type = T;
+
+        PoolAllocator() = default;
+
+        template<typename U>
+        PoolAllocator(const PoolAllocator<U>&) noexcept {}
+
+        /**
+        * @brief Allocate memory.
+        *
+        * @param[in] n Elements count.
+        *
+        * @return Returns memory.
+        */
+        T* allocate(size_t n)
+        {
+            if (n == 1) return static_cast<T*>(PoolResource::Shared<sizeof(T), alignof(T)>().allocate(sizeof(T), alignof(T)));
+
+            return std::allocator<T>{}.allocate(n);
+        }
+
+        /**
+        * @brief Deallocate memory.
+        *
+        * @param[in] p Memory.
+        * @param[in] n Elements count.
+        */
+        void deallocate(T* p, size_t n) noexcept
+        {
+            if (n == 1) return PoolResource::Shared<sizeof(T), alignof(T)>().deallocate(p, sizeof(T), alignof(T));
+
+            std::allocator<T>{}.deallocate(p, n);
+        }
+
+        template<typename U>
+        bool operator==(const PoolAllocator<U>&) const noexcept { return true; }
+    };
+
+    /**
+    * @brief Create a shared pointer whose object and control block come from a pool.
+    * Use it instead of CreateSP for objects created and released every frame.
+    *
+    * @tparam T Object.
+    * @param[in] args Constructor arguments.
+    *
+    * @return Returns shared pointer.
+    */
+    template<typename T, typename... Args>
+    SP<T> CreatePooledSP(Args&&... args)
+    {
+        return std::allocate_shared<T>(PoolAllocator<T>{}, std::forward<Args>(args)...);
+    }
+}
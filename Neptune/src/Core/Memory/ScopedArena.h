@@ -0,0 +1,70 @@
+/**
+* @file ScopedArena.h.
+* @brief The ScopedArena Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Core/NonCopyable.h"
+#include "FrameArena.h"
+
+#include <memory_resource>
+
+namespace Neptune::Memory {
+
+    /**
+    * @brief Stack buffer arena for a scope.
+    * Allocations are served from an inline buffer first and spill to FrameArena of calling thread,
+    * all memory is released when the scope exits.
+    *
+    * @tparam N Bytes of inline buffer.
+    */
+    template<size_t N = 1024>
+    class ScopedArena : public NonCopyable
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        */
+        ScopedArena()
+            : m_Resource(m_Buffer, N, &FrameArena::Get())
+        {}
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~ScopedArena() = default;
+
+        /**
+        * @brief Get memory resource.
+        *
+        * @return Returns memory resource.
+        */
+        std::pmr::memory_resource* Resource() { return &m_Resource; }
+
+        /**
+        * @brief Create an empty std::pmr::vector on this arena.
+        *
+        * @tparam T Element.
+        * @param[in] capacity Reserved elements.
+        *
+        * @return Returns vector.
+        */
+        template<typename T>
+        std::pmr::vector<T> Vector(size_t capacity = 0)
+        {
+            std::pmr::vector<T> vector(&m_Resource);
+
+            vector.reserve(capacity);
+
+            return vector;
+        }
+
+    private:
+
+        alignas(std::max_align_t) std::byte  m_Buffer[N];  // @brief Inline buffer.
+        std::pmr::monotonic_buffer_resource  m_Resource;   // @brief Resource over inline buffer.
+    };
+}
@@ -6,6 +6,7 @@
 
 #pragma once
 #include "Core/Core.h"
+#include "Render/Frontend/Core.h"
 
 namespace Neptune::Data {
 
@@ -14,9 +15,15 @@ namespace Neptune::Data {
 	*/
 	struct Clock
 	{
-		uint32_t m_FrameIndex = 0;         // @brief Render Frame Index.
-		uint32_t m_ImageIndex = 0;         // @brief Swapchain image Index.
-		float    m_FrameTime = 0.0f;       // @brief Frame Run Time.
-		float    m_EngineTime = 0.0f;      // @brief Engine Run Time.
+		uint32_t m_FrameIndex     = 0;                     // @brief Render Frame Index.
+		uint32_t m_ImageIndex     = 0;                     // @brief Swapchain image Index.
+		float    m_FrameTime      = 0.0f;                  // @brief Frame Run Time.
+		float    m_EngineTime     = 0.0f;                  // @brief Engine Run Time.
+
+		uint32_t m_FramesInFlight = DefaultFrameInFlight;  // @brief Frames In Flight, 1 to MaxFrameInFlight.
+		bool     m_LowLatency     = false;                 // @brief Wait last frame before recording a new one.
+		float    m_CpuWaitTime    = 0.0f;                  // @brief CPU time blocked on frame pacing(ms).
+		float    m_GpuIdleTime    = 0.0f;                  // @brief Graphic queue idle time between frames(ms).
+		uint32_t m_CmdAllocations = 0;                     // @brief Thread CommandBuffers allocated during last frame, 0 in steady state.
 	};
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+/**
+* @file ChromeTrace.cpp.
+* @brief The ChromeTrace Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "ChromeTrace.h"
+
+#include <iomanip>
+
+namespace Neptune {
+
+    ChromeTrace::~ChromeTrace()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        EndSession();
+    }
+
+    void ChromeTrace::BeginSession(const std::string& filepath)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        InternalEndSession();
+
+        m_OutputStream.open(filepath);
+
+        if (!m_OutputStream.is_open())
+        {
+            NEPTUNE_CORE_ERROR("ChromeTrace could not open trace file.")
+            return;
+        }
+
+        m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}";
+        m_OutputStream.flush();
+    }
+
+    void ChromeTrace::EndSession()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        InternalEndSession();
+    }
+
+    void ChromeTrace::WriteThreadName(uint32_t tid, const std::string& name)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::stringstream json;
+
+        json << ",{";
+        json << "\"args\":{\"name\":\"" << name << "\"},";
+        json << "\"name\":\"thread_name\",";
+        json << "\"ph\":\"M\",";
+        json << "\"pid\":0,";
+        json << "\"tid\":" << tid;
+        json << "}";
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        if (m_OutputStream.is_open())
+        {
+            m_OutputStream << json.str();
+        }
+    }
+
+    void ChromeTrace::WriteZone(const std::string& category, const std::string& name, uint32_t tid, double begin, double duration)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::stringstream json;
+
+        json << std::setprecision(3) << std::fixed;
+        json << ",{";
+        json << "\"cat\":\"" << category << "\",";
+        json << "\"dur\":" << duration << ',';
+        json << "\"name\":\"" << name << "\",";
+        json << "\"ph\":\"X\",";
+        json << "\"pid\":0,";
+        json << "\"tid\":" << tid << ",";
+        json << "\"ts\":" << begin;
+        json << "}";
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        if (m_OutputStream.is_open())
+        {
+            m_OutputStream << json.str();
+        }
+    }
+
+    int64_t ChromeTrace::Now()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    void ChromeTrace::InternalEndSession()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (!m_OutputStream.is_open()) return;
+
+        m_OutputStream << "]}";
+        m_OutputStream.close();
+    }
+}
@@ -0,0 +1,85 @@
+/**
+* @file ChromeTrace.h.
+* @brief The ChromeTrace Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Core/NonCopyable.h"
+
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace Neptune {
+
+	/**
+	* @brief ChromeTrace Class.
+	* This class writes complete events to a chrome://tracing (Trace Event Format) json file.
+	*/
+	class ChromeTrace : public NonCopyable
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		ChromeTrace() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		virtual ~ChromeTrace();
+
+		/**
+		* @brief Begin a trace session, close the last one if opened.
+		*
+		* @param[in] filepath Trace file path.
+		*/
+		void BeginSession(const std::string& filepath);
+
+		/**
+		* @brief End trace session.
+		*/
+		void EndSession();
+
+		/**
+		* @brief Name a trace lane.
+		*
+		* @param[in] tid Lane id.
+		* @param[in] name Lane name.
+		*/
+		void WriteThreadName(uint32_t tid, const std::string& name);
+
+		/**
+		* @brief Write a complete event.
+		*
+		* @param[in] category Event category.
+		* @param[in] name Event name.
+		* @param[in] tid Lane id.
+		* @param[in] begin Begin time in microseconds.
+		* @param[in] duration Duration in microseconds.
+		*/
+		void WriteZone(const std::string& category, const std::string& name, uint32_t tid, double begin, double duration);
+
+		/**
+		* @brief Get time used by trace events.
+		*
+		* @return Returns steady clock time in nanoseconds.
+		*/
+		static int64_t Now();
+
+	private:
+
+		/**
+		* @brief End trace session without lock.
+		*/
+		void InternalEndSession();
+
+	private:
+
+		std::ofstream            m_OutputStream;            // @brief Trace file stream.
+		std::mutex               m_Mutex;                   // @brief Mutex of stream.
+	};
+}
@@ -127,4 +127,24 @@
 */
 #define NEPTUNE_PROFILE_THREAD_LEAVE(name)
 
+/**
+* @brief Create a GPU Context.
+*
+* @param[in] context GPU Context id, written by this macro.
+* @param[in] gpuTime GPU timestamp sampled now.
+* @param[in] period GPU timestamp period in nanoseconds.
+* @param[in] name GPU Context name.
+*/
+#define NEPTUNE_PROFILE_GPU_CONTEXT(context, gpuTime, period, name)
+
+/**
+* @brief Mark a resolved GPU Zone.
+*
+* @param[in] context GPU Context id.
+* @param[in] name GPU Zone name.
+* @param[in] gpuBegin GPU begin timestamp.
+* @param[in] gpuEnd GPU end timestamp.
+*/
+#define NEPTUNE_PROFILE_GPU_ZONE(context, name, gpuBegin, gpuEnd)
+
 #endif
@@ -15,6 +15,96 @@ namespace Neptune::Tracy {
 	ProfilerImpl::ProfilerImpl()
 	{}
 
+	uint8_t ProfilerImpl::GpuContext(int64_t gpuTime, float period, const char* name)
+	{
+#ifdef TRACY_ENABLE
+
+		using namespace tracy;
+
+		const uint8_t context = GetGpuCtxCounter().fetch_add(1, std::memory_order_relaxed);
+
+		{
+			auto item = Profiler::QueueSerial();
+			MemWrite(&item->hdr.type, QueueType::GpuNewContext);
+			MemWrite(&item->gpuNewContext.cpuTime, Profiler::GetTime());
+			MemWrite(&item->gpuNewContext.gpuTime, gpuTime);
+			memset(&item->gpuNewContext.thread, 0, sizeof(item->gpuNewContext.thread));
+			MemWrite(&item->gpuNewContext.period, period);
+			MemWrite(&item->gpuNewContext.context, context);
+			MemWrite(&item->gpuNewContext.flags, uint8_t(0));
+			MemWrite(&item->gpuNewContext.type, GpuContextType::Vulkan);
+			Profiler::QueueSerialFinish();
+		}
+
+		{
+			const auto size = strlen(name);
+			auto ptr = static_cast<char*>(tracy_malloc(size));
+			memcpy(ptr, name, size);
+
+			auto item = Profiler::QueueSerial();
+			MemWrite(&item->hdr.type, QueueType::GpuContextName);
+			MemWrite(&item->gpuContextNameFat.context, context);
+			MemWrite(&item->gpuContextNameFat.ptr, reinterpret_cast<uint64_t>(ptr));
+			MemWrite(&item->gpuContextNameFat.size, static_cast<uint16_t>(size));
+			Profiler::QueueSerialFinish();
+		}
+
+		return context;
+
+#else
+
+		return 0;
+
+#endif
+	}
+
+	void ProfilerImpl::GpuZone(uint8_t context, const char* name, int64_t gpuBegin, int64_t gpuEnd)
+	{
+#ifdef TRACY_ENABLE
+
+		using namespace tracy;
+
+		static std::atomic<uint16_t> s_QueryId = 0;
+
+		const uint16_t beginId = s_QueryId.fetch_add(2, std::memory_order_relaxed);
+		const uint16_t endId   = beginId + 1;
+
+		const auto srcloc = Profiler::AllocSourceLocation(__LINE__, __FILE__, strlen(__FILE__), name, strlen(name), name, strlen(name));
+
+		{
+			auto item = Profiler::QueueSerial();
+			MemWrite(&item->hdr.type, QueueType::GpuZoneBeginAllocSrcLocSerial);
+			MemWrite(&item->gpuZoneBegin.cpuTime, Profiler::GetTime());
+			MemWrite(&item->gpuZoneBegin.srcloc, srcloc);
+			MemWrite(&item->gpuZoneBegin.thread, GetThreadHandle());
+			MemWrite(&item->gpuZoneBegin.queryId, beginId);
+			MemWrite(&item->gpuZoneBegin.context, context);
+			Profiler::QueueSerialFinish();
+		}
+
+		{
+			auto item = Profiler::QueueSerial();
+			MemWrite(&item->hdr.type, QueueType::GpuZoneEndSerial);
+			MemWrite(&item->gpuZoneEnd.cpuTime, Profiler::GetTime());
+			MemWrite(&item->gpuZoneEnd.thread, GetThreadHandle());
+			MemWrite(&item->gpuZoneEnd.queryId, endId);
+			MemWrite(&item->gpuZoneEnd.context, context);
+			Profiler::QueueSerialFinish();
+		}
+
+		for (auto [queryId, gpuTime] : { std::pair{ beginId, gpuBegin }, std::pair{ endId, gpuEnd } })
+		{
+			auto item = Profiler::QueueSerial();
+			MemWrite(&item->hdr.type, QueueType::GpuTime);
+			MemWrite(&item->gpuTime.gpuTime, gpuTime);
+			MemWrite(&item->gpuTime.queryId, queryId);
+			MemWrite(&item->gpuTime.context, context);
+			Profiler::QueueSerialFinish();
+		}
+
+#endif
+	}
+
 }
 
 #endif
\ No newline at end of file
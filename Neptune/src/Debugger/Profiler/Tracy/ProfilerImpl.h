@@ -10,6 +10,7 @@
 
 #include <tracy/Tracy.hpp>
 #include <common/TracySystem.hpp>
+#include <client/TracyProfiler.hpp>
 
 namespace Neptune::Tracy {
 
@@ -21,6 +22,27 @@ namespace Neptune::Tracy {
 	public:
 
 		ProfilerImpl();
+
+		/**
+		* @brief Create a tracy GPU Context.
+		*
+		* @param[in] gpuTime GPU timestamp sampled now.
+		* @param[in] period GPU timestamp period in nanoseconds.
+		* @param[in] name GPU Context name.
+		*
+		* @return Returns GPU Context id.
+		*/
+		static uint8_t GpuContext(int64_t gpuTime, float period, const char* name);
+
+		/**
+		* @brief Emit a resolved tracy GPU Zone.
+		*
+		* @param[in] context GPU Context id.
+		* @param[in] name GPU Zone name.
+		* @param[in] gpuBegin GPU begin timestamp.
+		* @param[in] gpuEnd GPU end timestamp.
+		*/
+		static void GpuZone(uint8_t context, const char* name, int64_t gpuBegin, int64_t gpuEnd);
 	};
 
 #define NEPTUNE_PROFILE_FRAME                                             FrameMark;
@@ -40,6 +62,8 @@ namespace Neptune::Tracy {
 #define NEPTUNE_PROFILE_SLOCK_B                                           SharedLockableBase(std::shared_mutex);
 #define NEPTUNE_PROFILE_THREAD_ENTER(name, group)                         TracyFiberEnterHint(name, group);
 #define NEPTUNE_PROFILE_THREAD_LEAVE(name)                                TracyFiberLeave(name);
+#define NEPTUNE_PROFILE_GPU_CONTEXT(context, gpuTime, period, name)       context = Neptune::Tracy::ProfilerImpl::GpuContext(gpuTime, period, name);
+#define NEPTUNE_PROFILE_GPU_ZONE(context, name, gpuBegin, gpuEnd)         Neptune::Tracy::ProfilerImpl::GpuZone(context, name, gpuBegin, gpuEnd);
 
 /********************************************* Those Macros and environment must be defined in preprocessor ******************************************************/
 
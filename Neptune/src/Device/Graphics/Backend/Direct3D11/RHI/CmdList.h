@@ -17,6 +17,8 @@ namespace Neptune::RHI {
 	class RenderPass;
 	class Pipeline;
 	class DescriptorList;
+	class GPUScene;
+	class RenderTarget;
 }
 
 namespace Neptune::Direct3D11 {
@@ -55,6 +57,13 @@ namespace Neptune::Direct3D11 {
 		*/
 		void SetGraphicCmdList(const Data::Clock& clock) override;
 
+		/**
+		* @brief Interface of Set Compute CommandList Context.
+		*
+		* @param[in] clock Clock.
+		*/
+		void SetComputeCmdList(const Data::Clock& clock) override;
+
 		/**
 		* @brief Interface of Get Current CommandList.
 		* 
@@ -98,6 +107,16 @@ namespace Neptune::Direct3D11 {
 		*/
 		void CmdDrawFullScreenTriangle() const override;
 
+		/**
+		* @brief Interface of Draw.
+		*
+		* @param[in] vertexCount Vertex count.
+		* @param[in] instanceCount Instance count.
+		* @param[in] firstVertex First vertex.
+		* @param[in] firstInstance First instance.
+		*/
+		void CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const override;
+
 		/**
 		* @brief Interface of SetViewport.
 		*
@@ -105,6 +124,40 @@ namespace Neptune::Direct3D11 {
 		*/
 		void CmdSetViewport(const glm::vec2& viewPortSize) const override;
 
+		/**
+		* @brief Interface of PushConstants.
+		*
+		* @param[in] data PushConstants data.
+		* @param[in] bytes PushConstants bytes.
+		*/
+		void CmdPushConstants(const void* data, uint32_t bytes) const override;
+
+		/**
+		* @brief Interface of Cull GPUScene instances into indirect commands.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		* @param[in] viewPosition Camera world position.
+		*/
+		void CmdCullGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const override;
+
+		/**
+		* @brief Interface of Draw GPUScene indirect commands of last cull.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		*/
+		void CmdDrawGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection) const override;
+
+		/**
+		* @brief Interface of Blit a RenderTarget into another.
+		*
+		* @param[in] src Source RenderTarget.
+		* @param[in] dst Destination RenderTarget.
+		* @param[in] extent Blitted extent from origin.
+		*/
+		void CmdBlitRenderTarget(const SP<RHI::RenderTarget>& src, const SP<RHI::RenderTarget>& dst, const glm::vec2& extent) const override;
+
 	protected:
 
 		uint32_t                      m_FrameIndex     = 0;                                     // @brief Frame index.
@@ -84,6 +84,13 @@ namespace Neptune::Direct3D11 {
 		*/
 		void CombineSharedLayout(const RHI::RHIDescriptorList::Impl* shared) override;
 
+		/**
+		* @brief Interface of Add BindLess Heap as a set.
+		*
+		* @param[in] set .
+		*/
+		void AddBindLessHeap(uint32_t set) override;
+
 		/**
 		* @brief Interface of Build DescriptorList.
 		*/
@@ -61,6 +61,14 @@ namespace Neptune::Direct3D11 {
 		*/
 		void Build(uint32_t count = MaxFrameInFlight) override;
 
+		/**
+		* @brief Interface of Rebind a Color Attachment of a built RenderPass.
+		*
+		* @param[in] index Color Attachment index.
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget) override;
+
 	private:
 
 	};
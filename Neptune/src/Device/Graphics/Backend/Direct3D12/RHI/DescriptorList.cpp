@@ -42,6 +42,12 @@ namespace Neptune::Direct3D12 {
 
 	}
 
+	void DescriptorList::AddBindLessHeap(uint32_t set)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+	}
+
 	void DescriptorList::Build()
 	{
 		NEPTUNE_PROFILE_ZONE
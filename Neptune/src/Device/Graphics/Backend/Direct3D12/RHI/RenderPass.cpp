@@ -30,6 +30,12 @@ namespace Neptune::Direct3D12 {
 
 
 	}
+
+	void RenderPass::SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+	}
 	
 }
 
@@ -80,6 +80,13 @@ namespace Neptune::Direct3D12 {
 		*/
 		uint32_t GetHeight() const override { return 0; }
 
+		/**
+		* @brief Interface of Get BindLess Index.
+		*
+		* @return Returns stable index in BindLess texture heap.
+		*/
+		uint32_t GetBindLessIndex() const override { return 0; }
+
 	};
 }
 
@@ -0,0 +1,82 @@
+/**
+* @file GraphicsBackend.cpp.
+* @brief The GraphicsBackend Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "GraphicsBackend.h"
+#include "Infrastructure/InfrastructureHeader.h"
+#include "RHI/RHIHeader.h"
+#include "Core/Memory/ObjectPool.h"
+
+namespace Neptune::Null {
+
+    GraphicsBackend::GraphicsBackend()
+        : GraphicsFrontend(GraphicsBackendEnum::Null)
+    {}
+
+    void GraphicsBackend::OnInitialize(const Window* window)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        m_Context = CreateSP<Context>();
+
+        m_Context->Registry<ICommandLog>();
+    }
+
+    void GraphicsBackend::OnShutDown()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        m_Context->UnRegistry();
+    }
+
+    Context& GraphicsBackend::GetContext() const
+    {
+        return *m_Context;
+    }
+
+    void GraphicsBackend::Wait() const
+    {
+        NEPTUNE_PROFILE_ZONE
+    }
+
+    std::any GraphicsBackend::CreateRHI(RHI::ERHI e, void* payload) const
+	{
+        NEPTUNE_PROFILE_ZONE
+
+        switch(e)
+		{
+            case RHI::ERHI::RenderPass:       return std::dynamic_pointer_cast<RHI::RHIRenderPass::Impl>    (CreateSP<RenderPass>           (*m_Context));
+			case RHI::ERHI::DescriptorList:   return std::dynamic_pointer_cast<RHI::RHIDescriptorList::Impl>(CreateSP<DescriptorList>       (*m_Context));
+			case RHI::ERHI::Pipeline:         return std::dynamic_pointer_cast<RHI::RHIPipeline::Impl>      (CreateSP<Pipeline>             (*m_Context));
+			case RHI::ERHI::Shader:           return std::dynamic_pointer_cast<RHI::RHIShader::Impl>        (CreateSP<Shader>               (*m_Context));
+			case RHI::ERHI::RenderTarget:     return std::dynamic_pointer_cast<RHI::RHIRenderTarget::Impl>  (CreateSP<RenderTarget>         (*m_Context));
+			case RHI::ERHI::VertexBuffer:     return std::dynamic_pointer_cast<RHI::RHIVertexBuffer::Impl>  (CreateSP<VertexBuffer>         (*m_Context));
+			case RHI::ERHI::IndexBuffer:      return std::dynamic_pointer_cast<RHI::RHIIndexBuffer::Impl>   (CreateSP<IndexBuffer>          (*m_Context));
+            case RHI::ERHI::CmdList:          return std::dynamic_pointer_cast<RHI::RHICmdList::Impl>       (Memory::CreatePooledSP<CmdList>              (*m_Context));
+			case RHI::ERHI::CmdList2:         return std::dynamic_pointer_cast<RHI::RHICmdList2::Impl>      (Memory::CreatePooledSP<CmdList2>             (*m_Context));
+			case RHI::ERHI::GPUScene:         return std::dynamic_pointer_cast<RHI::RHIGPUScene::Impl>      (CreateSP<GPUScene>             (*m_Context));
+			case RHI::ERHI::Decoder:          return std::dynamic_pointer_cast<RHI::RHIDecoder::Impl>       (CreateSP<Decoder>              (*m_Context));
+			case RHI::ERHI::OpticalFlow:      return std::dynamic_pointer_cast<RHI::RHIOpticalFlow::Impl>   (CreateSP<OpticalFlow>          (*m_Context));
+			default:                          NEPTUNE_CORE_ERROR("Null do not support this RHI.")            return nullptr;
+		}
+	}
+
+    std::unordered_map<std::string, std::any> GraphicsBackend::AccessInfrastructure() const
+	{
+        NEPTUNE_PROFILE_ZONE
+
+		std::unordered_map<std::string, std::any> infrastructure;
+
+		infrastructure["CommandLog"] = m_Context->Get<ICommandLog>();
+
+		return infrastructure;
+	}
+}
+
+#endif
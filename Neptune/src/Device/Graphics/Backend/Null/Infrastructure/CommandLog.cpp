@@ -0,0 +1,160 @@
+/**
+* @file CommandLog.cpp.
+* @brief The CommandLog Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "CommandLog.h"
+
+namespace Neptune::Null {
+
+    void CommandLog::Record(ECommand command, uint32_t bytes)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const auto index = static_cast<size_t>(command);
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        m_Entries.push_back({ command, bytes });
+
+        ++m_Counts[index];
+
+        m_Bytes[index] += bytes;
+    }
+
+    void CommandLog::BeginFrame()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            m_Entries.clear();
+        }
+
+        Record(ECommand::BeginFrame);
+    }
+
+    std::vector<CommandLog::Entry> CommandLog::GetEntries() const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        return m_Entries;
+    }
+
+    uint64_t CommandLog::GetCount(ECommand command) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        return m_Counts[static_cast<size_t>(command)];
+    }
+
+    uint64_t CommandLog::GetBytes(ECommand command) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        return m_Bytes[static_cast<size_t>(command)];
+    }
+
+    std::string CommandLog::Report() const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        std::stringstream ss;
+
+        ss << "Null CommandLog:";
+
+        for (size_t i = 0; i < Size; ++i)
+        {
+            if (m_Counts[i] == 0) continue;
+
+            ss << "\n    " << ToString(static_cast<ECommand>(i)) << ": " << m_Counts[i] << " calls, " << m_Bytes[i] << " bytes";
+        }
+
+        return ss.str();
+    }
+
+    const char* CommandLog::ToString(ECommand command)
+    {
+        switch (command)
+        {
+            case ECommand::AddSwapChainAttachment:                  return "AddSwapChainAttachment";
+            case ECommand::AddColorAttachment:                      return "AddColorAttachment";
+            case ECommand::BuildRenderPass:                         return "BuildRenderPass";
+            case ECommand::SetColorAttachment:                      return "SetColorAttachment";
+            case ECommand::AddUniformBuffer:                        return "AddUniformBuffer";
+            case ECommand::AddUniformTexture:                       return "AddUniformTexture";
+            case ECommand::UpdateUniformBuffer:                     return "UpdateUniformBuffer";
+            case ECommand::UpdateUniformTexture:                    return "UpdateUniformTexture";
+            case ECommand::CombineSharedLayout:                     return "CombineSharedLayout";
+            case ECommand::AddBindLessHeap:                         return "AddBindLessHeap";
+            case ECommand::BuildDescriptorList:                     return "BuildDescriptorList";
+            case ECommand::SetPipelineDefault:                      return "SetPipelineDefault";
+            case ECommand::SetPipelineRenderPass:                   return "SetPipelineRenderPass";
+            case ECommand::SetPipelineDescriptorList:               return "SetPipelineDescriptorList";
+            case ECommand::SetVertexAttributeLayout:                return "SetVertexAttributeLayout";
+            case ECommand::SetCullMode:                             return "SetCullMode";
+            case ECommand::AddShader:                               return "AddShader";
+            case ECommand::BuildGraphicPipeline:                    return "BuildGraphicPipeline";
+            case ECommand::SetShaderSource:                         return "SetShaderSource";
+            case ECommand::SetShaderName:                           return "SetShaderName";
+            case ECommand::CreateRenderTarget:                      return "CreateRenderTarget";
+            case ECommand::CreateBindingID:                         return "CreateBindingID";
+            case ECommand::CopyToRenderTarget:                      return "CopyToRenderTarget";
+            case ECommand::SetGeometry:                             return "SetGeometry";
+            case ECommand::SetMeshes:                               return "SetMeshes";
+            case ECommand::SetInstances:                            return "SetInstances";
+            case ECommand::UpdateInstances:                         return "UpdateInstances";
+            case ECommand::SetCullShader:                           return "SetCullShader";
+            case ECommand::SetGraphicCmdList:                       return "SetGraphicCmdList";
+            case ECommand::SetComputeCmdList:                       return "SetComputeCmdList";
+            case ECommand::SetCmdListRenderPass:                    return "SetCmdListRenderPass";
+            case ECommand::BeginRenderPass:                         return "BeginRenderPass";
+            case ECommand::EndRenderPass:                           return "EndRenderPass";
+            case ECommand::BindDescriptor:                          return "BindDescriptor";
+            case ECommand::BindPipeline:                            return "BindPipeline";
+            case ECommand::DrawFullScreenTriangle:                  return "DrawFullScreenTriangle";
+            case ECommand::Draw:                                    return "Draw";
+            case ECommand::SetViewport:                             return "SetViewport";
+            case ECommand::PushConstants:                           return "PushConstants";
+            case ECommand::CullGPUScene:                            return "CullGPUScene";
+            case ECommand::DrawGPUScene:                            return "DrawGPUScene";
+            case ECommand::BlitRenderTarget:                        return "BlitRenderTarget";
+            case ECommand::BeginCmdList2:                           return "BeginCmdList2";
+            case ECommand::EndCmdList2:                             return "EndCmdList2";
+            case ECommand::SubmitWait:                              return "SubmitWait";
+            case ECommand::SetGraphicCmdList2:                      return "SetGraphicCmdList2";
+            case ECommand::SetVideoDecodeCmdList:                   return "SetVideoDecodeCmdList";
+            case ECommand::SetOpticalFlowCmdList:                   return "SetOpticalFlowCmdList";
+            case ECommand::ParserDataChunk:                         return "ParserDataChunk";
+            case ECommand::SetDecodeRenderTarget:                   return "SetDecodeRenderTarget";
+            case ECommand::SetDecodeReference:                      return "SetDecodeReference";
+            case ECommand::SetDecodeFlowVector:                     return "SetDecodeFlowVector";
+            case ECommand::PushNextFrameToRenderTarget:             return "PushNextFrameToRenderTarget";
+            case ECommand::SetOpticalFlowInput:                     return "SetOpticalFlowInput";
+            case ECommand::SetOpticalFlowReference:                 return "SetOpticalFlowReference";
+            case ECommand::SetOpticalFlowVector:                    return "SetOpticalFlowVector";
+            case ECommand::CreateOpticalFlowSession:                return "CreateOpticalFlowSession";
+            case ECommand::OpticalFlowExecute:                      return "OpticalFlowExecute";
+            case ECommand::BeginFrame:                              return "BeginFrame";
+            case ECommand::EndFrame:                                return "EndFrame";
+
+            default:                                                return "NonNamed";
+        }
+    }
+}
+
+#endif
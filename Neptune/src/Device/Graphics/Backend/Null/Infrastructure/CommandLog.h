@@ -0,0 +1,202 @@
+/**
+* @file CommandLog.h.
+* @brief The CommandLog Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Neptune::Null {
+
+	using ICommandLog = IInfrastructure<class CommandLog, EInfrastructure::CommandLog>;
+
+	/**
+	* @brief Enum of recorded RHI calls.
+	*/
+	enum class ECommand : uint8_t
+	{
+		AddSwapChainAttachment = 0,
+		AddColorAttachment,
+		BuildRenderPass,
+		SetColorAttachment,
+
+		AddUniformBuffer,
+		AddUniformTexture,
+		UpdateUniformBuffer,
+		UpdateUniformTexture,
+		CombineSharedLayout,
+		AddBindLessHeap,
+		BuildDescriptorList,
+
+		SetPipelineDefault,
+		SetPipelineRenderPass,
+		SetPipelineDescriptorList,
+		SetVertexAttributeLayout,
+		SetCullMode,
+		AddShader,
+		BuildGraphicPipeline,
+
+		SetShaderSource,
+		SetShaderName,
+
+		CreateRenderTarget,
+		CreateBindingID,
+		CopyToRenderTarget,
+
+		SetGeometry,
+		SetMeshes,
+		SetInstances,
+		UpdateInstances,
+		SetCullShader,
+
+		SetGraphicCmdList,
+		SetComputeCmdList,
+		SetCmdListRenderPass,
+		BeginRenderPass,
+		EndRenderPass,
+		BindDescriptor,
+		BindPipeline,
+		DrawFullScreenTriangle,
+		Draw,
+		SetViewport,
+		PushConstants,
+		CullGPUScene,
+		DrawGPUScene,
+		BlitRenderTarget,
+
+		BeginCmdList2,
+		EndCmdList2,
+		SubmitWait,
+		SetGraphicCmdList2,
+		SetVideoDecodeCmdList,
+		SetOpticalFlowCmdList,
+
+		ParserDataChunk,
+		SetDecodeRenderTarget,
+		SetDecodeReference,
+		SetDecodeFlowVector,
+		PushNextFrameToRenderTarget,
+
+		SetOpticalFlowInput,
+		SetOpticalFlowReference,
+		SetOpticalFlowVector,
+		CreateOpticalFlowSession,
+		OpticalFlowExecute,
+
+		BeginFrame,
+		EndFrame,
+
+		Count
+	};
+
+	/**
+	* @brief Null::CommandLog Class.
+	* This class defines the Null::CommandLog behaves.
+	* Calls of the current frame are kept as 8 byte entries, totals of counts and bytes
+	* are kept since creation. Entries are cleared by BeginFrame without releasing capacity.
+	*/
+	class CommandLog : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief One recorded call.
+		*/
+		struct Entry
+		{
+			ECommand                 command;           // @brief Recorded call.
+			uint32_t                 bytes;             // @brief Bytes passed by the call.
+		};
+
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		CommandLog(Context& context, EInfrastructure e) : Infrastructure(context, e) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~CommandLog() override = default;
+
+		/**
+		* @brief Record a call.
+		*
+		* @param[in] command ECommand.
+		* @param[in] bytes Bytes passed by the call.
+		*/
+		void Record(ECommand command, uint32_t bytes = 0);
+
+		/**
+		* @brief Clear entries of last frame and record BeginFrame.
+		*/
+		void BeginFrame();
+
+		/**
+		* @brief Get entries of current frame.
+		*
+		* @return Returns entries.
+		*/
+		std::vector<Entry> GetEntries() const;
+
+		/**
+		* @brief Get count of a call since creation.
+		*
+		* @param[in] command ECommand.
+		*
+		* @return Returns count.
+		*/
+		uint64_t GetCount(ECommand command) const;
+
+		/**
+		* @brief Get bytes of a call since creation.
+		*
+		* @param[in] command ECommand.
+		*
+		* @return Returns bytes.
+		*/
+		uint64_t GetBytes(ECommand command) const;
+
+		/**
+		* @brief Get a readable table of counts and bytes per call.
+		*
+		* @return Returns report.
+		*/
+		std::string Report() const;
+
+		/**
+		* @brief Turn ECommand to string.
+		*
+		* @param[in] command ECommand.
+		*
+		* @return Returns string ECommand.
+		*/
+		static const char* ToString(ECommand command);
+
+	private:
+
+		static constexpr size_t Size = static_cast<size_t>(ECommand::Count);
+
+		std::vector<Entry>                 m_Entries;                 // @brief Entries of current frame.
+		std::array<uint64_t, Size>         m_Counts{};                // @brief Counts since creation.
+		std::array<uint64_t, Size>         m_Bytes{};                 // @brief Bytes since creation.
+		mutable std::mutex                 m_Mutex;                   // @brief Mutex of entries and totals.
+	};
+
+}
+
+#endif
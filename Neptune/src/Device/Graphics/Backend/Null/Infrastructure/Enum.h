@@ -0,0 +1,25 @@
+/**
+* @file Enum.h.
+* @brief The Enum Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+namespace Neptune::Null {
+
+    /**
+    * @brief Enum of Infrastructure.
+    */
+    enum class EInfrastructure : uint8_t
+    {
+        CommandLog = 0,                      // @brief Recorded RHI Calls.
+
+        Count
+    };
+
+}
+
+#endif
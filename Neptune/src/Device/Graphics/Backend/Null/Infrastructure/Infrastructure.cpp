@@ -0,0 +1,32 @@
+/**
+* @file Infrastructure.cpp.
+* @brief The Infrastructure Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Infrastructure.h"
+
+namespace Neptune::Null {
+
+	Infrastructure::Infrastructure(Context& context, EInfrastructure e)
+		: Super(context, e)
+	{}
+
+	std::string Infrastructure::ToString() const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        switch (m_EInfrastructure)
+        {
+            case EInfrastructure::CommandLog:                         return "CommandLog";
+
+            default:                                                  return "NonNamed";
+        }
+    }
+}
+
+#endif
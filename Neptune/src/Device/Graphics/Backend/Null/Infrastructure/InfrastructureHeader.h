@@ -0,0 +1,13 @@
+/**
+* @file InfrastructureHeader.h.
+* @brief The InfrastructureHeader Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+#endif
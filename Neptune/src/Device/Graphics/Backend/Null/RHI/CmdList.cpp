@@ -0,0 +1,131 @@
+/**
+* @file CmdList.cpp.
+* @brief The CmdList Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "CmdList.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+#include "Data/Clock.h"
+#include "Header/ShaderCommon.h"
+
+namespace Neptune::Null {
+
+	void CmdList::SetGraphicCmdList(const Data::Clock& clock)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_FrameIndex = clock.m_FrameIndex;
+		m_ImageIndex = clock.m_ImageIndex;
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetGraphicCmdList);
+	}
+
+	void CmdList::SetComputeCmdList(const Data::Clock& clock)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_FrameIndex = clock.m_FrameIndex;
+		m_ImageIndex = clock.m_ImageIndex;
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetComputeCmdList);
+	}
+
+	void* CmdList::GetCommandList() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		return nullptr;
+	}
+
+	void CmdList::SetRenderPass(const SP<RHI::RenderPass>& renderPass)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetCmdListRenderPass);
+	}
+
+	void CmdList::CmdBeginRenderPass() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BeginRenderPass);
+	}
+
+	void CmdList::CmdEndRenderPass() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::EndRenderPass);
+	}
+
+	void CmdList::CmdBindDescriptor(const SP<RHI::DescriptorList>& descriptorList) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BindDescriptor);
+	}
+
+	void CmdList::CmdBindPipeline(const SP<RHI::Pipeline>& pipeline)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BindPipeline);
+	}
+
+	void CmdList::CmdDrawFullScreenTriangle() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::DrawFullScreenTriangle);
+	}
+
+	void CmdList::CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::Draw);
+	}
+
+	void CmdList::CmdSetViewport(const glm::vec2& viewPortSize) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetViewport);
+	}
+
+	void CmdList::CmdPushConstants(const void* data, uint32_t bytes) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::PushConstants, bytes);
+	}
+
+	void CmdList::CmdCullGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::CullGPUScene, sizeof(ShaderCommon::MeshCullConstant));
+	}
+
+	void CmdList::CmdDrawGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::DrawGPUScene, sizeof(ShaderCommon::MeshDrawConstant));
+	}
+
+	void CmdList::CmdBlitRenderTarget(const SP<RHI::RenderTarget>& src, const SP<RHI::RenderTarget>& dst, const glm::vec2& extent) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BlitRenderTarget);
+	}
+
+}
+
+#endif
@@ -0,0 +1,163 @@
+/**
+* @file CmdList.h.
+* @brief The CmdList Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/CmdList.h"
+
+namespace Neptune::RHI {
+
+	class RenderPass;
+	class Pipeline;
+	class DescriptorList;
+	class GPUScene;
+	class RenderTarget;
+}
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::CmdList Class.
+	* This class defines the Null::CmdList behaves.
+	*/
+	class CmdList : public ContextAccessor, public RHI::RHICmdList::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit CmdList(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~CmdList() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Set Graphic CommandList Context.
+		*
+		* @param[in] clock Clock.
+		*/
+		void SetGraphicCmdList(const Data::Clock& clock) override;
+
+		/**
+		* @brief Interface of Set Compute CommandList Context.
+		*
+		* @param[in] clock Clock.
+		*/
+		void SetComputeCmdList(const Data::Clock& clock) override;
+
+		/**
+		* @brief Interface of Get Current CommandList.
+		* 
+		* @return Returns Current CommandList.
+		*/
+		void* GetCommandList() const override;
+		
+		/**
+		* @brief Interface of Set RenderPass Reference.
+		*
+		* @param[in] renderPass RenderPass.
+		*/
+		void SetRenderPass(const SP<RHI::RenderPass>& renderPass) override;
+
+		/**
+		* @brief Interface of BeginRenderPass.
+		*/
+		void CmdBeginRenderPass() const override;
+
+		/**
+		* @brief Interface of EndRenderPass.
+		*/
+		void CmdEndRenderPass() const override;
+
+		/**
+		* @brief Interface of BindDescriptor.
+		*
+		* @param[in] descriptorList DescriptorList.
+		*/
+		void CmdBindDescriptor(const SP<RHI::DescriptorList>& descriptorList) const override;
+
+		/**
+		* @brief Interface of BindPipeline.
+		*
+		* @param[in] pipeline Pipeline.
+		*/
+		void CmdBindPipeline(const SP<RHI::Pipeline>& pipeline) override;
+
+		/**
+		* @brief Interface of DrawFullScreenTriangle.
+		*/
+		void CmdDrawFullScreenTriangle() const override;
+
+		/**
+		* @brief Interface of Draw.
+		*
+		* @param[in] vertexCount Vertex count.
+		* @param[in] instanceCount Instance count.
+		* @param[in] firstVertex First vertex.
+		* @param[in] firstInstance First instance.
+		*/
+		void CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const override;
+
+		/**
+		* @brief Interface of SetViewport.
+		*
+		* @param[in] viewPortSize .
+		*/
+		void CmdSetViewport(const glm::vec2& viewPortSize) const override;
+
+		/**
+		* @brief Interface of PushConstants.
+		*
+		* @param[in] data PushConstants data.
+		* @param[in] bytes PushConstants bytes.
+		*/
+		void CmdPushConstants(const void* data, uint32_t bytes) const override;
+
+		/**
+		* @brief Interface of Cull GPUScene instances into indirect commands.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		* @param[in] viewPosition Camera world position.
+		*/
+		void CmdCullGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const override;
+
+		/**
+		* @brief Interface of Draw GPUScene indirect commands of last cull.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		*/
+		void CmdDrawGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection) const override;
+
+		/**
+		* @brief Interface of Blit a RenderTarget into another.
+		*
+		* @param[in] src Source RenderTarget.
+		* @param[in] dst Destination RenderTarget.
+		* @param[in] extent Blitted extent from origin.
+		*/
+		void CmdBlitRenderTarget(const SP<RHI::RenderTarget>& src, const SP<RHI::RenderTarget>& dst, const glm::vec2& extent) const override;
+
+	protected:
+
+		uint32_t                      m_FrameIndex     = 0;                                     // @brief Frame index.
+		uint32_t                      m_ImageIndex     = 0;                                     // @brief Image index.
+	};
+}
+
+#endif
\ No newline at end of file
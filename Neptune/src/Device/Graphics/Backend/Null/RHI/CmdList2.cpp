@@ -0,0 +1,60 @@
+/**
+* @file CmdList2.cpp.
+* @brief The CmdList2 Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "CmdList2.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void CmdList2::Begin() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BeginCmdList2);
+	}
+
+	void CmdList2::End() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::EndCmdList2);
+	}
+
+	void CmdList2::SubmitWait()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SubmitWait);
+	}
+
+	void CmdList2::SetGraphicCmdList()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetGraphicCmdList2);
+	}
+
+	void CmdList2::SetVideoDecodeCmdList()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetVideoDecodeCmdList);
+	}
+
+	void CmdList2::SetOpticalFlowCmdList()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetOpticalFlowCmdList);
+	}
+
+}
+
+#endif
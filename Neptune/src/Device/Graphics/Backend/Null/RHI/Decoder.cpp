@@ -0,0 +1,53 @@
+/**
+* @file Decoder.cpp.
+* @brief The Decoder Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Decoder.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void Decoder::ParserDataChunk(uint8_t* data, uint64_t size)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::ParserDataChunk, static_cast<uint32_t>(size));
+	}
+
+	void Decoder::SetDecodeRenderTarget(const SP<RHI::RenderTarget>& renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetDecodeRenderTarget);
+	}
+
+	void Decoder::SetReferenceRenderTarget(const SP<RHI::RenderTarget>& renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetDecodeReference);
+	}
+
+	void Decoder::SetFlowVectorRenderTarget(const SP<RHI::RenderTarget>& renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetDecodeFlowVector);
+	}
+
+	void Decoder::PushNextFrameToRenderTarget()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::PushNextFrameToRenderTarget);
+	}
+
+}
+
+#endif
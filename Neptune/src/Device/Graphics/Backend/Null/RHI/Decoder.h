@@ -0,0 +1,83 @@
+/**
+* @file Decoder.h.
+* @brief The Decoder Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/Decoder.h"
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::Decoder Class.
+	* This class defines the Null::Decoder behaves.
+	* Nothing is decoded, calls are only recorded.
+	*/
+	class Decoder : public ContextAccessor, public RHI::RHIDecoder::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit Decoder(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~Decoder() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Parser DataChunk.
+		*
+		* @param[in] data Bitstream data.
+		* @param[in] size Bitstream bytes.
+		*/
+		void ParserDataChunk(uint8_t* data, uint64_t size) override;
+
+		/**
+		* @brief Interface of Get Decoded Picture Count.
+		*
+		* @return Returns 0, Null decodes no picture.
+		*/
+		uint32_t GetDecodedPictureCount() override { return 0; }
+
+		/**
+		* @brief Interface of Set Decode RenderTarget.
+		*
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void SetDecodeRenderTarget(const SP<RHI::RenderTarget>& renderTarget) override;
+
+		/**
+		* @brief Interface of Set Reference RenderTarget.
+		*
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void SetReferenceRenderTarget(const SP<RHI::RenderTarget>& renderTarget) override;
+
+		/**
+		* @brief Interface of Set FlowVector RenderTarget.
+		*
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void SetFlowVectorRenderTarget(const SP<RHI::RenderTarget>& renderTarget) override;
+
+		/**
+		* @brief Interface of Push NextFrame to RenderTarget.
+		*/
+		void PushNextFrameToRenderTarget() override;
+	};
+}
+
+#endif
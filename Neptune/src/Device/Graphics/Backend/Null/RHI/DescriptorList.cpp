@@ -0,0 +1,94 @@
+/**
+* @file DescriptorList.cpp.
+* @brief The DescriptorList Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "DescriptorList.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	namespace {
+
+		/**
+		* @brief Key of a binding.
+		*
+		* @param[in] set Set.
+		* @param[in] binding Binding.
+		*
+		* @return Returns key.
+		*/
+		uint64_t BindingKey(uint32_t set, uint32_t binding)
+		{
+			return static_cast<uint64_t>(set) << 32 | binding;
+		}
+	}
+
+	void DescriptorList::AddUniformBuffer(uint32_t set, uint32_t binding, uint32_t bytes)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_UniformBytes[BindingKey(set, binding)] = bytes;
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::AddUniformBuffer, bytes);
+	}
+
+	void DescriptorList::AddUniformTexture(uint32_t set, uint32_t binding, SP<RHI::RenderTarget> renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::AddUniformTexture);
+	}
+
+	void DescriptorList::UpdateUniformBuffer(uint32_t set, uint32_t binding, void* data)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto it = m_UniformBytes.find(BindingKey(set, binding));
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::UpdateUniformBuffer, it != m_UniformBytes.end() ? it->second : 0);
+	}
+
+	void DescriptorList::UpdateUniformTexture(uint32_t set, uint32_t binding, SP<RHI::RenderTarget> renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::UpdateUniformTexture);
+	}
+
+	void DescriptorList::CombineSharedLayout(const RHI::RHIDescriptorList::Impl* shared)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (shared)
+		{
+			const auto& bytes = static_cast<const DescriptorList*>(shared)->m_UniformBytes;
+
+			m_UniformBytes.insert(bytes.begin(), bytes.end());
+		}
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::CombineSharedLayout);
+	}
+
+	void DescriptorList::AddBindLessHeap(uint32_t set)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::AddBindLessHeap);
+	}
+
+	void DescriptorList::Build()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BuildDescriptorList);
+	}
+
+}
+
+#endif
@@ -0,0 +1,105 @@
+/**
+* @file DescriptorList.h.
+* @brief The DescriptorList Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/DescriptorList.h"
+
+namespace Neptune::RHI {
+
+	class RenderTarget;
+}
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::DescriptorList Class.
+	* This class defines the Null::DescriptorList behaves.
+	*/
+	class DescriptorList : public ContextAccessor, public RHI::RHIDescriptorList::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit DescriptorList(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~DescriptorList() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Add UniformBuffer.
+		*
+		* @param[in] set .
+		* @param[in] binding .
+		* @param[in] bytes UniformBuffer bytes.
+		*/
+		void AddUniformBuffer(uint32_t set, uint32_t binding, uint32_t bytes) override;
+
+		/**
+		* @brief Interface of Add UniformTexture.
+		*
+		* @param[in] set .
+		* @param[in] binding .
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void AddUniformTexture(uint32_t set, uint32_t binding, SP<RHI::RenderTarget> renderTarget) override;
+
+		/**
+		* @brief Interface of Update UniformBuffer.
+		*
+		* @param[in] set .
+		* @param[in] binding .
+		* @param[in] data UniformBuffer data.
+		*/
+		void UpdateUniformBuffer(uint32_t set, uint32_t binding, void* data) override;
+
+		/**
+		* @brief Interface of Update UniformTexture.
+		*
+		* @param[in] set .
+		* @param[in] binding .
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void UpdateUniformTexture(uint32_t set, uint32_t binding, SP<RHI::RenderTarget> renderTarget) override;
+
+		/**
+		* @brief Interface of Combine Shared DescriptorList.
+		*
+		* @param[in] shared RHIDescriptorList::Impl.
+		*/
+		void CombineSharedLayout(const RHI::RHIDescriptorList::Impl* shared) override;
+
+		/**
+		* @brief Interface of Add BindLess Heap as a set.
+		*
+		* @param[in] set .
+		*/
+		void AddBindLessHeap(uint32_t set) override;
+
+		/**
+		* @brief Interface of Build DescriptorList.
+		*/
+		void Build() override;
+
+	private:
+
+		std::unordered_map<uint64_t, uint32_t> m_UniformBytes;   // @brief Uniform Buffer bytes keyed by set << 32 | binding.
+	};
+}
+
+#endif
\ No newline at end of file
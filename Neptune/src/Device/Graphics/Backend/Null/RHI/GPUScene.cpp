@@ -0,0 +1,53 @@
+/**
+* @file GPUScene.cpp.
+* @brief The GPUScene Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "GPUScene.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void GPUScene::SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetGeometry, static_cast<uint32_t>(vertices.size() * sizeof(ShaderCommon::Vertex) + indices.size() * sizeof(uint32_t)));
+	}
+
+	void GPUScene::SetMeshes(const std::vector<ShaderCommon::MeshBounds>& meshes, const std::vector<ShaderCommon::MeshLod>& lods)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetMeshes, static_cast<uint32_t>(meshes.size() * sizeof(ShaderCommon::MeshBounds) + lods.size() * sizeof(ShaderCommon::MeshLod)));
+	}
+
+	void GPUScene::SetInstances(const std::vector<ShaderCommon::MeshInstance>& instances)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetInstances, static_cast<uint32_t>(instances.size() * sizeof(ShaderCommon::MeshInstance)));
+	}
+
+	void GPUScene::UpdateInstances(uint32_t first, const ShaderCommon::MeshInstance* instances, uint32_t count)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::UpdateInstances, static_cast<uint32_t>(count * sizeof(ShaderCommon::MeshInstance)));
+	}
+
+	void GPUScene::SetCullShader(SP<RHI::Shader> shader)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetCullShader, 0);
+	}
+
+}
+
+#endif
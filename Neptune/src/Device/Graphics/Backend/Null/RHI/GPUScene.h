@@ -0,0 +1,80 @@
+/**
+* @file GPUScene.h.
+* @brief The GPUScene Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/GPUScene.h"
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::GPUScene Class.
+	* This class defines the Null::GPUScene behaves.
+	*/
+	class GPUScene : public ContextAccessor, public RHI::RHIGPUScene::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit GPUScene(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~GPUScene() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Set Geometry shared by all Meshes.
+		*
+		* @param[in] vertices Vertices.
+		* @param[in] indices Indices, relative to MeshLod vertexOffset.
+		*/
+		void SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices) override;
+
+		/**
+		* @brief Interface of Set Meshes.
+		*
+		* @param[in] meshes MeshBounds.
+		* @param[in] lods MeshLods.
+		*/
+		void SetMeshes(const std::vector<ShaderCommon::MeshBounds>& meshes, const std::vector<ShaderCommon::MeshLod>& lods) override;
+
+		/**
+		* @brief Interface of Set Instances, instance count may change.
+		*
+		* @param[in] instances MeshInstances.
+		*/
+		void SetInstances(const std::vector<ShaderCommon::MeshInstance>& instances) override;
+
+		/**
+		* @brief Interface of Update a range of Instances.
+		*
+		* @param[in] first First MeshInstance.
+		* @param[in] instances MeshInstances.
+		* @param[in] count MeshInstance count.
+		*/
+		void UpdateInstances(uint32_t first, const ShaderCommon::MeshInstance* instances, uint32_t count) override;
+
+		/**
+		* @brief Interface of Set Cull Compute Shader.
+		*
+		* @param[in] shader Shader of MeshCull.comp.
+		*/
+		void SetCullShader(SP<RHI::Shader> shader) override;
+	};
+}
+
+#endif
@@ -0,0 +1,14 @@
+/**
+* @file IndexBuffer.cpp.
+* @brief The IndexBuffer Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "IndexBuffer.h"
+
+
+#endif
\ No newline at end of file
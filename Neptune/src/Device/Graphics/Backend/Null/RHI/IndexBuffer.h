@@ -0,0 +1,39 @@
+/**
+* @file IndexBuffer.h.
+* @brief The IndexBuffer Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/IndexBuffer.h"
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::IndexBuffer Class.
+	* This class defines the Null::IndexBuffer behaves.
+	*/
+	class IndexBuffer : public ContextAccessor, public RHI::RHIIndexBuffer::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit IndexBuffer(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~IndexBuffer() override = default;
+	};
+}
+
+#endif
\ No newline at end of file
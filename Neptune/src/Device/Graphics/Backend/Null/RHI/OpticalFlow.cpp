@@ -0,0 +1,55 @@
+/**
+* @file OpticalFlow.cpp.
+* @brief The OpticalFlow Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "OpticalFlow.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void OpticalFlow::SetInputRenderTarget(SP<RHI::RenderTarget> rt)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetOpticalFlowInput);
+	}
+
+	void OpticalFlow::SetReferenceRenderTarget(SP<RHI::RenderTarget> rt)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetOpticalFlowReference);
+	}
+
+	void OpticalFlow::SetFlowVectorRenderTarget(SP<RHI::RenderTarget> rt)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetOpticalFlowVector);
+	}
+
+	bool OpticalFlow::CreateOpticalFlowSession()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::CreateOpticalFlowSession);
+
+		return true;
+	}
+
+	void OpticalFlow::OpticalFlowExecute()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::OpticalFlowExecute);
+	}
+
+}
+
+#endif
@@ -0,0 +1,75 @@
+/**
+* @file OpticalFlow.h.
+* @brief The OpticalFlow Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/OpticalFlow.h"
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::OpticalFlow Class.
+	* This class defines the Null::OpticalFlow behaves.
+	* No flow is computed, calls are only recorded.
+	*/
+	class OpticalFlow : public ContextAccessor, public RHI::RHIOpticalFlow::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit OpticalFlow(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~OpticalFlow() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Set Input RenderTarget.
+		*
+		* @param[in] rt RenderTarget.
+		*/
+		void SetInputRenderTarget(SP<RHI::RenderTarget> rt) override;
+
+		/**
+		* @brief Interface of Set Reference RenderTarget.
+		*
+		* @param[in] rt RenderTarget.
+		*/
+		void SetReferenceRenderTarget(SP<RHI::RenderTarget> rt) override;
+
+		/**
+		* @brief Interface of Set FlowVector RenderTarget.
+		*
+		* @param[in] rt RenderTarget.
+		*/
+		void SetFlowVectorRenderTarget(SP<RHI::RenderTarget> rt) override;
+
+		/**
+		* @brief Interface of Create OpticalFlow Session.
+		*
+		* @return Returns true, Null session always succeeds.
+		*/
+		bool CreateOpticalFlowSession() override;
+
+		/**
+		* @brief Interface of OpticalFlow Execute.
+		*/
+		void OpticalFlowExecute() override;
+	};
+}
+
+#endif
@@ -0,0 +1,67 @@
+/**
+* @file Pipeline.cpp.
+* @brief The Pipeline Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Pipeline.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void Pipeline::SetDefault()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetPipelineDefault);
+	}
+
+	void Pipeline::SetRenderPass(SP<RHI::RenderPass> renderPass)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetPipelineRenderPass);
+	}
+
+	void Pipeline::SetDescriptorList(SP<RHI::DescriptorList> descriptorList)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetPipelineDescriptorList);
+	}
+
+	void Pipeline::SetVertexAttributeLayout()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetVertexAttributeLayout);
+	}
+
+	void Pipeline::SetCullMode(CullMode mode)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetCullMode);
+	}
+
+	void Pipeline::AddShader(ShaderStage stage, SP<RHI::Shader> shader)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::AddShader);
+	}
+
+	void Pipeline::BuildGraphicPipeline()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BuildGraphicPipeline);
+	}
+
+}
+
+#endif
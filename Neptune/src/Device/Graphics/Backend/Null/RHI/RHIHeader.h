@@ -0,0 +1,24 @@
+/**
+* @file RHIHeader.h.
+* @brief The RHIHeader Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Device/Graphics/Backend/Null/RHI/RenderPass.h"
+#include "Device/Graphics/Backend/Null/RHI/DescriptorList.h"
+#include "Device/Graphics/Backend/Null/RHI/Pipeline.h"
+#include "Device/Graphics/Backend/Null/RHI/Shader.h"
+#include "Device/Graphics/Backend/Null/RHI/RenderTarget.h"
+#include "Device/Graphics/Backend/Null/RHI/VertexBuffer.h"
+#include "Device/Graphics/Backend/Null/RHI/IndexBuffer.h"
+#include "Device/Graphics/Backend/Null/RHI/CmdList.h"
+#include "Device/Graphics/Backend/Null/RHI/CmdList2.h"
+#include "Device/Graphics/Backend/Null/RHI/GPUScene.h"
+#include "Device/Graphics/Backend/Null/RHI/Decoder.h"
+#include "Device/Graphics/Backend/Null/RHI/OpticalFlow.h"
+
+#endif
\ No newline at end of file
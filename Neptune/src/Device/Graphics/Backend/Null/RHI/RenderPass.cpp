@@ -0,0 +1,46 @@
+/**
+* @file RenderPass.cpp.
+* @brief The RenderPass Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "RenderPass.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void RenderPass::AddSwapChainAttachment()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::AddSwapChainAttachment);
+	}
+
+	void RenderPass::AddColorAttachment(SP<RHI::RenderTarget> renderTarget, const RenderTargetAttachmentInfo& info)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::AddColorAttachment, sizeof(info));
+	}
+
+	void RenderPass::Build(uint32_t count)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::BuildRenderPass);
+	}
+
+	void RenderPass::SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetColorAttachment);
+	}
+
+}
+
+#endif
@@ -0,0 +1,74 @@
+/**
+* @file RenderPass.h.
+* @brief The RenderPass Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/RenderPass.h"
+
+namespace Neptune::RHI {
+
+	class RenderTarget;
+}
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::RenderPass Class.
+	* This class defines the Null::RenderPass behaves.
+	*/
+	class RenderPass : public ContextAccessor, public RHI::RHIRenderPass::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit RenderPass(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~RenderPass() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Add SwapChain Attachment.
+		*/
+		void AddSwapChainAttachment() override;
+
+		/**
+		* @brief Interface of Add Color Attachment.
+		*
+		* @param[in] renderTarget RenderTarget.
+		* @param[in] info RenderTargetAttachmentInfo.
+		*/
+		void AddColorAttachment(SP<RHI::RenderTarget> renderTarget, const RenderTargetAttachmentInfo& info) override;
+
+		/**
+		* @brief Interface of Build RenderPass.
+		*
+		* @param[in] count Flight Frames.
+		*/
+		void Build(uint32_t count = MaxFrameInFlight) override;
+
+		/**
+		* @brief Interface of Rebind a Color Attachment of a built RenderPass.
+		*
+		* @param[in] index Color Attachment index.
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget) override;
+	};
+}
+
+#endif
\ No newline at end of file
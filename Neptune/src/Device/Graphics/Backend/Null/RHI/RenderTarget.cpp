@@ -0,0 +1,78 @@
+/**
+* @file RenderTarget.cpp.
+* @brief The RenderTarget Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "RenderTarget.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+#include "Resource/Texture/RenderTarget.h"
+
+namespace Neptune::Null {
+
+	namespace {
+
+		/**
+		* @brief Get bytes of a RenderTarget.
+		*
+		* @param[in] info RenderTargetCreateInfo.
+		*
+		* @return Returns bytes.
+		*/
+		uint64_t RenderTargetBytes(const RenderTargetCreateInfo& info)
+		{
+			const uint64_t texels = static_cast<uint64_t>(info.width) * info.height;
+
+			switch (info.format)
+			{
+				case TextureFormat::RGBA8_UNORM:               return texels * 4;
+				case TextureFormat::RGBA16_SFLOAT:             return texels * 8;
+				case TextureFormat::R8_G8B8_2PLANE_420_UNORM:  return texels * 3 / 2;
+				default:                                       return 0;
+			}
+		}
+	}
+
+	void RenderTarget::CreateRenderTarget(const RenderTargetCreateInfo& info)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_Format = info.format;
+		m_Width  = info.width;
+		m_Height = info.height;
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::CreateRenderTarget, static_cast<uint32_t>(std::min<uint64_t>(RenderTargetBytes(info), UINT32_MAX)));
+	}
+
+	void* RenderTarget::CreateBindingID()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::CreateBindingID);
+
+		return nullptr;
+	}
+
+	bool RenderTarget::CopyToRenderTarget(const RHI::RenderTarget* target)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::CopyToRenderTarget);
+
+		return true;
+	}
+
+	TextureFormat RenderTarget::GetFormat() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		return m_Format;
+	}
+
+}
+
+#endif
@@ -0,0 +1,98 @@
+/**
+* @file RenderTarget.h.
+* @brief The RenderTarget Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/RenderTarget.h"
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::RenderTarget Class.
+	* This class defines the Null::RenderTarget behaves.
+	*/
+	class RenderTarget : public ContextAccessor, public RHI::RHIRenderTarget::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		RenderTarget(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~RenderTarget() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Create RenderTarget.
+		*
+		* @param[in] info RenderTargetCreateInfo.
+		*/
+		void CreateRenderTarget(const RenderTargetCreateInfo& info) override;
+
+		/**
+		* @brief Interface of Create BindingID.
+		*
+		* @return Returns BindingID.
+		*/
+		void* CreateBindingID() override;
+
+		/**
+		* @brief Interface of Copy To RenderTarget.
+		*
+		* @param[in] target RenderTarget.
+		*
+		* @return Returns true if succeeded.
+		*/
+		bool CopyToRenderTarget(const RHI::RenderTarget* target) override;
+
+		/**
+		* @brief Interface of Get Format.
+		*
+		* @return Returns format.
+		*/
+		TextureFormat GetFormat() const override;
+
+		/**
+		* @brief Interface of Get Width.
+		*
+		* @return Returns width.
+		*/
+		uint32_t GetWidth() const override { return m_Width; }
+
+		/**
+		* @brief Interface of Get Height.
+		*
+		* @return Returns height.
+		*/
+		uint32_t GetHeight() const override { return m_Height; }
+
+		/**
+		* @brief Interface of Get BindLess Index.
+		*
+		* @return Returns stable index in BindLess texture heap.
+		*/
+		uint32_t GetBindLessIndex() const override { return 0; }
+
+	private:
+
+		TextureFormat m_Format{};         // @brief Created format.
+		uint32_t m_Width = 0;             // @brief Created width.
+		uint32_t m_Height = 0;            // @brief Created height.
+	};
+}
+
+#endif
\ No newline at end of file
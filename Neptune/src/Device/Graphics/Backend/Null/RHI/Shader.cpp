@@ -0,0 +1,32 @@
+/**
+* @file Shader.cpp.
+* @brief The Shader Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Shader.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/CommandLog.h"
+
+namespace Neptune::Null {
+
+	void Shader::SetSource(const std::vector<uint8_t>& source)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetShaderSource, static_cast<uint32_t>(source.size()));
+	}
+
+	void Shader::SetName(const std::string& name)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		GetContext().Get<ICommandLog>()->Record(ECommand::SetShaderName, static_cast<uint32_t>(name.size()));
+	}
+
+}
+
+#endif
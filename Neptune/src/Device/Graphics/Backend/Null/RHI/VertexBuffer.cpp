@@ -0,0 +1,13 @@
+/**
+* @file VertexBuffer.cpp.
+* @brief The VertexBuffer Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "VertexBuffer.h"
+
+#endif
\ No newline at end of file
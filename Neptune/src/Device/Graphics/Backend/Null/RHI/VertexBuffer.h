@@ -0,0 +1,39 @@
+/**
+* @file VertexBuffer.h.
+* @brief The VertexBuffer Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Frontend/RHI/VertexBuffer.h"
+
+namespace Neptune::Null {
+
+	/**
+	* @brief Null::VertexBuffer Class.
+	* This class defines the Null::VertexBuffer behaves.
+	*/
+	class VertexBuffer : public ContextAccessor, public RHI::RHIVertexBuffer::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit VertexBuffer(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~VertexBuffer() override = default;
+	};
+}
+
+#endif
\ No newline at end of file
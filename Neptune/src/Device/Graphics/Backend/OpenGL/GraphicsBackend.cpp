@@ -11,6 +11,7 @@
 #include "GraphicsBackend.h"
 #include "Infrastructure/InfrastructureHeader.h"
 #include "RHI/RHIHeader.h"
+#include "Core/Memory/ObjectPool.h"
 #include "Window/Window.h"
 
 namespace Neptune::OpenGL {
@@ -67,10 +68,11 @@ namespace Neptune::OpenGL {
 			case RHI::ERHI::RenderTarget:     return std::dynamic_pointer_cast<RHI::RHIRenderTarget::Impl>  (CreateSP<RenderTarget>         (*m_Context));
 			case RHI::ERHI::VertexBuffer:     return std::dynamic_pointer_cast<RHI::RHIVertexBuffer::Impl>  (CreateSP<VertexBuffer>         (*m_Context));
 			case RHI::ERHI::IndexBuffer:      return std::dynamic_pointer_cast<RHI::RHIIndexBuffer::Impl>   (CreateSP<IndexBuffer>          (*m_Context));
-            case RHI::ERHI::CmdList:          return std::dynamic_pointer_cast<RHI::RHICmdList::Impl>       (CreateSP<CmdList>              (*m_Context));
-			case RHI::ERHI::CmdList2:         return std::dynamic_pointer_cast<RHI::RHICmdList2::Impl>      (CreateSP<CmdList2>             (*m_Context));
+            case RHI::ERHI::CmdList:          return std::dynamic_pointer_cast<RHI::RHICmdList::Impl>       (Memory::CreatePooledSP<CmdList>              (*m_Context));
+			case RHI::ERHI::CmdList2:         return std::dynamic_pointer_cast<RHI::RHICmdList2::Impl>      (Memory::CreatePooledSP<CmdList2>             (*m_Context));
             case RHI::ERHI::Decoder:          NEPTUNE_CORE_ERROR("OpenGL do not support Decoder RHI.")       return nullptr;
             case RHI::ERHI::OpticalFlow:      NEPTUNE_CORE_ERROR("OpenGL do not support OpticalFlow RHI.")   return nullptr;
+            case RHI::ERHI::GPUScene:         NEPTUNE_CORE_ERROR("OpenGL do not support GPUScene RHI.")   return nullptr;
 			default:                          NEPTUNE_CORE_ERROR("OpenGL do not support this RHI.")          return nullptr;
 		}
 	}
@@ -21,6 +21,14 @@ namespace Neptune::OpenGL {
 		m_ImageIndex = clock.m_ImageIndex;
 	}
 
+	void CmdList::SetComputeCmdList(const Data::Clock& clock)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_FrameIndex = clock.m_FrameIndex;
+		m_ImageIndex = clock.m_ImageIndex;
+	}
+
 	void* CmdList::GetCommandList() const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -58,12 +66,42 @@ namespace Neptune::OpenGL {
 		
 	}
 
+	void CmdList::CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+	{
+		NEPTUNE_PROFILE_ZONE
+		
+	}
+
 	void CmdList::CmdSetViewport(const glm::vec2& viewPortSize) const
 	{
 		NEPTUNE_PROFILE_ZONE
 		
 	}
 
+	void CmdList::CmdPushConstants(const void* data, uint32_t bytes) const
+	{
+		NEPTUNE_PROFILE_ZONE
+		
+	}
+
+	void CmdList::CmdCullGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const
+	{
+		NEPTUNE_PROFILE_ZONE
+		
+	}
+
+	void CmdList::CmdDrawGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection) const
+	{
+		NEPTUNE_PROFILE_ZONE
+		
+	}
+
+	void CmdList::CmdBlitRenderTarget(const SP<RHI::RenderTarget>& src, const SP<RHI::RenderTarget>& dst, const glm::vec2& extent) const
+	{
+		NEPTUNE_PROFILE_ZONE
+		
+	}
+
 	void CmdList::SetRenderPass(const SP<RHI::RenderPass>& renderPass)
 	{
 		NEPTUNE_PROFILE_ZONE
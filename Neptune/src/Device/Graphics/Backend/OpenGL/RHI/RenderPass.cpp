@@ -30,6 +30,12 @@ namespace Neptune::OpenGL {
 
 
 	}
+
+	void RenderPass::SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+	}
 	
 }
 
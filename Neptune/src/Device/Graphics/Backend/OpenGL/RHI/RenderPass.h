@@ -63,6 +63,14 @@ namespace Neptune::OpenGL {
 		*/
 		void Build(uint32_t count = MaxFrameInFlight) override;
 
+		/**
+		* @brief Interface of Rebind a Color Attachment of a built RenderPass.
+		*
+		* @param[in] index Color Attachment index.
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget) override;
+
 	private:
 
 		std::vector<SP<Unit::FrameBuffer>>                m_FrameBuffers;                    // @brief Container of FrameBuffer.
@@ -127,6 +127,7 @@ namespace Neptune::Vulkan {
 		{
 			case ShaderStage::Vertex:    return VK_SHADER_STAGE_VERTEX_BIT;
 			case ShaderStage::Fragment:  return VK_SHADER_STAGE_FRAGMENT_BIT;
+			case ShaderStage::Compute:   return VK_SHADER_STAGE_COMPUTE_BIT;
 			default:
 			{
 				NEPTUNE_CORE_WARN("Unsupported ShaderStage To VkShaderStageFlagBits.")
@@ -24,6 +24,24 @@ namespace Neptune::Vulkan {
 	
 	constexpr uint32_t DescriptorPoolSize = 1000;                          // @brief DescriptorPool Size.
 
+	constexpr uint32_t BindLessTextureSize = 65535;                        // @brief BindLess Texture Slot Counts.
+
+	constexpr uint32_t BindLessBufferSize = 65535;                         // @brief BindLess Buffer Slot Counts.
+
+	constexpr uint32_t BindLessTextureBinding = 0;                         // @brief BindLess Texture Binding.
+
+	constexpr uint32_t BindLessBufferBinding = 1;                          // @brief BindLess Buffer Binding.
+
+	constexpr uint32_t PushConstantSize = 128;                             // @brief PushConstant Bytes, minimum guaranteed by spec.
+
+	constexpr uint32_t MaxGpuZones = 128;                                  // @brief GpuProfiler Zones per frame.
+
+	constexpr uint32_t MaxGpuSubmitZones = 64;                             // @brief GpuProfiler Zones of in flight submissions.
+
+	constexpr VkDeviceSize StagingRingSize = 64ull * 1024 * 1024;           // @brief UploadManager Staging Ring Bytes.
+
+	constexpr VkDeviceSize StagingAlignment = 16;                          // @brief UploadManager Staging Offset Alignment, covers texel block sizes.
+
 	#define VK_VERSION VK_API_VERSION_1_4                                  // @brief Use Vulkan 1.4.
 
 	#define VKImageHostOperation 0                                         // @brief Not use host operation.
@@ -11,6 +11,7 @@
 #include "GraphicsBackend.h"
 #include "Infrastructure/InfrastructureHeader.h"
 #include "RHI/RHIHeader.h"
+#include "Core/Memory/ObjectPool.h"
 #include "Converter.h"
 #include "Window/Window.h"
 
@@ -37,7 +38,7 @@ namespace Neptune::Vulkan {
     	
 		m_Context = CreateSP<Context>();
 
-		m_Context->Registry<IInstance>(window ? window->Extension() : std::vector{ VK_KHR_SURFACE_EXTENSION_NAME });
+		m_Context->Registry<IInstance>(window ? window->Extension() : std::vector<const char*>{});
 		m_Context->Registry<IDebugUtilsObject>();
 		if (window)
 		{
@@ -49,10 +50,9 @@ namespace Neptune::Vulkan {
 		m_Context->Registry<IMemoryAllocator>();
 					  
 		m_Context->Registry<IGraphicQueueSemaphore>(MaxFrameInFlight);
-		m_Context->Registry<IGraphicFence>(MaxFrameInFlight);
+		m_Context->Registry<IGraphicTimelineSemaphore>();
 
-		m_Context->Registry<IComputeQueueSemaphore>(MaxFrameInFlight);
-		m_Context->Registry<IComputeFence>(MaxFrameInFlight);
+		m_Context->Registry<IComputeTimelineSemaphore>();
 
 		m_Context->Registry<IGraphicCommandPool>();
 		m_Context->Registry<IGraphicCommandBuffer>(MaxFrameInFlight);
@@ -60,14 +60,25 @@ namespace Neptune::Vulkan {
 		m_Context->Registry<IComputeCommandPool>();
 		m_Context->Registry<IComputeCommandBuffer>(MaxFrameInFlight);
 
+		m_Context->Registry<IDescriptorSetLayoutCache>();
 		m_Context->Registry<IDescriptorPool>();
+		m_Context->Registry<IBindLessHeap>();
 
 		m_Context->Registry<IGraphicThreadCommandPool>();
 		m_Context->Registry<IComputeThreadCommandPool>();
 		m_Context->Registry<ITransferThreadCommandPool>();
-		m_Context->Registry<IVideoEncodeThreadCommandPool>();
-		m_Context->Registry<IVideoDecodeThreadCommandPool>();
-		m_Context->Registry<IOpticalFlowThreadCommandPool>();
+
+		// Video and optical flow queues are optional in headless mode.
+		const auto& families = m_Context->Get<IPhysicalDevice>()->GetQueueFamilies();
+
+		if (families.videoEncode) m_Context->Registry<IVideoEncodeThreadCommandPool>();
+		if (families.videoDecode) m_Context->Registry<IVideoDecodeThreadCommandPool>();
+		if (families.opticalFlow) m_Context->Registry<IOpticalFlowThreadCommandPool>();
+
+		m_Context->Registry<IGpuProfiler>();
+		m_Context->Registry<IUploadManager>();
+		m_Context->Registry<IReadback>();
+		m_Context->Registry<IReleaseQueue>();
 	}
 
 	void GraphicsBackend::OnShutDown()
@@ -93,6 +104,18 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		if (e == RHI::ERHI::Decoder && !m_Context->Has<IVideoDecodeThreadQueue>())
+		{
+			NEPTUNE_CORE_ERROR("Vulkan Device has no video decode queue.")
+			return SP<RHI::RHIDecoder::Impl>();
+		}
+
+		if (e == RHI::ERHI::OpticalFlow && !m_Context->Has<IOpticalFlowThreadQueue>())
+		{
+			NEPTUNE_CORE_ERROR("Vulkan Device has no optical flow queue.")
+			return SP<RHI::RHIOpticalFlow::Impl>();
+		}
+
 		switch(e)
 		{
 			case RHI::ERHI::RenderPass:       return std::dynamic_pointer_cast<RHI::RHIRenderPass::Impl>    (CreateSP<RenderPass>           (*m_Context));
@@ -102,10 +125,11 @@ namespace Neptune::Vulkan {
 			case RHI::ERHI::RenderTarget:     return std::dynamic_pointer_cast<RHI::RHIRenderTarget::Impl>  (CreateSP<RenderTarget>         (*m_Context));
 			case RHI::ERHI::VertexBuffer:     return std::dynamic_pointer_cast<RHI::RHIVertexBuffer::Impl>  (CreateSP<VertexBuffer>         (*m_Context));
 			case RHI::ERHI::IndexBuffer:      return std::dynamic_pointer_cast<RHI::RHIIndexBuffer::Impl>   (CreateSP<IndexBuffer>          (*m_Context));
-			case RHI::ERHI::CmdList:          return std::dynamic_pointer_cast<RHI::RHICmdList::Impl>       (CreateSP<CmdList>              (*m_Context));
-			case RHI::ERHI::CmdList2:         return std::dynamic_pointer_cast<RHI::RHICmdList2::Impl>      (CreateSP<CmdList2>             (*m_Context));
+			case RHI::ERHI::CmdList:          return std::dynamic_pointer_cast<RHI::RHICmdList::Impl>       (Memory::CreatePooledSP<CmdList>              (*m_Context));
+			case RHI::ERHI::CmdList2:         return std::dynamic_pointer_cast<RHI::RHICmdList2::Impl>      (Memory::CreatePooledSP<CmdList2>             (*m_Context));
 			case RHI::ERHI::Decoder:          return std::dynamic_pointer_cast<RHI::RHIDecoder::Impl>       (Decoder::Create                (*m_Context, payload));
 			case RHI::ERHI::OpticalFlow:      return std::dynamic_pointer_cast<RHI::RHIOpticalFlow::Impl>   (CreateSP<OpticalFlowSession>   (*m_Context));
+			case RHI::ERHI::GPUScene:         return std::dynamic_pointer_cast<RHI::RHIGPUScene::Impl>      (CreateSP<GPUScene>             (*m_Context));
 			default:                          NEPTUNE_CORE_ERROR("Vulkan do not support this RHI.")          return nullptr;
 		}
 	}
@@ -0,0 +1,241 @@
+/**
+* @file BindLessHeap.cpp.
+* @brief The BindLessHeap Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "BindLessHeap.h"
+#include "Device.h"
+#include "PhysicalDevice.h"
+#include "DebugUtilsObject.h"
+
+namespace Neptune::Vulkan {
+
+    BindLessHeap::BindLessHeap(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        Create();
+    }
+
+    uint32_t BindLessHeap::AcquireTexture(VkImageView view, VkSampler sampler)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        uint32_t index;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            index = m_Textures.Allocate();
+        }
+
+        if (index == m_Textures.capacity)
+        {
+            NEPTUNE_CORE_ERROR("BindLessHeap texture slots exhausted.")
+            return index;
+        }
+
+        VkDescriptorImageInfo             imageInfo{};
+        imageInfo.imageLayout           = VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL;
+        imageInfo.imageView             = view;
+        imageInfo.sampler               = sampler;
+
+        VkWriteDescriptorSet              write{};
+        write.sType                     = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet                    = m_DescriptorSet.GetHandle();
+        write.dstBinding                = BindLessTextureBinding;
+        write.dstArrayElement           = index;
+        write.descriptorType            = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+        write.descriptorCount           = 1;
+        write.pImageInfo                = &imageInfo;
+
+        m_DescriptorSet.UpdateDescriptorSet(write);
+
+        return index;
+    }
+
+    void BindLessHeap::ReleaseTexture(uint32_t index)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (index >= m_Textures.capacity) return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        m_Textures.retired[m_FrameIndex].push_back(index);
+    }
+
+    uint32_t BindLessHeap::AcquireBuffer(VkBuffer buffer, VkDeviceSize range)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        uint32_t index;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            index = m_Buffers.Allocate();
+        }
+
+        if (index == m_Buffers.capacity)
+        {
+            NEPTUNE_CORE_ERROR("BindLessHeap buffer slots exhausted.")
+            return index;
+        }
+
+        VkDescriptorBufferInfo            bufferInfo{};
+        bufferInfo.buffer               = buffer;
+        bufferInfo.offset               = 0;
+        bufferInfo.range                = range;
+
+        VkWriteDescriptorSet              write{};
+        write.sType                     = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+        write.dstSet                    = m_DescriptorSet.GetHandle();
+        write.dstBinding                = BindLessBufferBinding;
+        write.dstArrayElement           = index;
+        write.descriptorType            = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        write.descriptorCount           = 1;
+        write.pBufferInfo               = &bufferInfo;
+
+        m_DescriptorSet.UpdateDescriptorSet(write);
+
+        return index;
+    }
+
+    void BindLessHeap::ReleaseBuffer(uint32_t index)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (index >= m_Buffers.capacity) return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        m_Buffers.retired[m_FrameIndex].push_back(index);
+    }
+
+    void BindLessHeap::Recycle(uint32_t frameIndex)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        for (auto* slots : { &m_Textures, &m_Buffers })
+        {
+            auto& retired = slots->retired[frameIndex];
+
+            slots->free.insert(slots->free.end(), retired.begin(), retired.end());
+
+            retired.clear();
+        }
+
+        m_FrameIndex = frameIndex;
+    }
+
+    uint32_t BindLessHeap::SlotAllocator::Allocate()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (!free.empty())
+        {
+            const uint32_t index = free.back();
+
+            free.pop_back();
+
+            return index;
+        }
+
+        return next < capacity ? next++ : capacity;
+    }
+
+    void BindLessHeap::Create()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        VkPhysicalDeviceDescriptorIndexingProperties          indexingProperties{};
+        indexingProperties.sType                            = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES;
+
+        VkPhysicalDeviceProperties2                           properties{};
+        properties.sType                                    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+        properties.pNext                                    = &indexingProperties;
+
+        vkGetPhysicalDeviceProperties2(GetContext().Get<IPhysicalDevice>()->Handle(), &properties);
+
+        m_Textures.capacity = std::min({ BindLessTextureSize, indexingProperties.maxDescriptorSetUpdateAfterBindSampledImages, indexingProperties.maxPerStageDescriptorUpdateAfterBindSampledImages });
+        m_Buffers.capacity  = std::min({ BindLessBufferSize,  indexingProperties.maxDescriptorSetUpdateAfterBindStorageBuffers, indexingProperties.maxPerStageDescriptorUpdateAfterBindStorageBuffers });
+
+        const auto& device = GetContext().Get<IDevice>()->Handle();
+
+        {
+            std::array<VkDescriptorPoolSize, 2>      poolSizes{};
+            poolSizes[0].type                      = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            poolSizes[0].descriptorCount           = m_Textures.capacity;
+            poolSizes[1].type                      = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            poolSizes[1].descriptorCount           = m_Buffers.capacity;
+
+            VkDescriptorPoolCreateInfo               createInfo{};
+            createInfo.sType                       = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+            createInfo.poolSizeCount               = static_cast<uint32_t>(poolSizes.size());
+            createInfo.pPoolSizes                  = poolSizes.data();
+            createInfo.maxSets                     = 1;
+            createInfo.flags                       = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT
+                                                   | VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+
+            m_DescriptorPool.CreateDescriptorPool(device, createInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(m_DescriptorPool, ToString())
+        }
+
+        {
+            std::array<VkDescriptorSetLayoutBinding, 2>   bindings{};
+            bindings[0].binding                         = BindLessTextureBinding;
+            bindings[0].descriptorType                  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
+            bindings[0].descriptorCount                 = m_Textures.capacity;
+            bindings[0].stageFlags                      = VK_SHADER_STAGE_ALL;
+            bindings[1].binding                         = BindLessBufferBinding;
+            bindings[1].descriptorType                  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+            bindings[1].descriptorCount                 = m_Buffers.capacity;
+            bindings[1].stageFlags                      = VK_SHADER_STAGE_ALL;
+
+            std::array<VkDescriptorBindingFlags, 2>       bindingFlags{};
+            bindingFlags[0]                             = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+            bindingFlags[1]                             = VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT | VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT;
+
+            VkDescriptorSetLayoutBindingFlagsCreateInfo   flagsInfo{};
+            flagsInfo.sType                             = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+            flagsInfo.bindingCount                      = static_cast<uint32_t>(bindingFlags.size());
+            flagsInfo.pBindingFlags                     = bindingFlags.data();
+
+            VkDescriptorSetLayoutCreateInfo               createInfo{};
+            createInfo.sType                            = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+            createInfo.bindingCount                     = static_cast<uint32_t>(bindings.size());
+            createInfo.pBindings                        = bindings.data();
+            createInfo.flags                            = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+            createInfo.pNext                            = &flagsInfo;
+
+            m_Layout.CreateDescriptorSetLayout(device, createInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(m_Layout, ToString())
+        }
+
+        {
+            VkDescriptorSetAllocateInfo              allocInfo{};
+            allocInfo.sType                        = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+            allocInfo.descriptorPool               = m_DescriptorPool.GetHandle();
+            allocInfo.pSetLayouts                  = &m_Layout.GetHandle();
+            allocInfo.descriptorSetCount           = 1;
+
+            m_DescriptorSet.AllocateDescriptorSet(device, allocInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(m_DescriptorSet, ToString())
+        }
+    }
+
+}
+
+#endif
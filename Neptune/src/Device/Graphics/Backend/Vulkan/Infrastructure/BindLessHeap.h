@@ -0,0 +1,143 @@
+/**
+* @file BindLessHeap.h.
+* @brief The BindLessHeap Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/DescriptorPool.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/DescriptorSetLayout.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/DescriptorSet.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace Neptune::Vulkan {
+
+	using IBindLessHeap = IInfrastructure<class BindLessHeap, EInfrastructure::BindLessHeap>;
+
+	/**
+	* @brief Vulkan::BindLessHeap Class.
+	* This class defines the Vulkan::BindLessHeap behaves.
+	* One update-after-bind DescriptorSet holds all sampled textures and storage buffers,
+	* resources hold a stable slot index for their whole lifetime.
+	*/
+	class BindLessHeap : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		BindLessHeap(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~BindLessHeap() override = default;
+
+		/**
+		* @brief Get DescriptorSet Unit Handle.
+		*
+		* @return Returns DescriptorSet Unit Handle.
+		*/
+		const Unit::DescriptorSet::Handle& Handle() const { return m_DescriptorSet.GetHandle(); }
+
+		/**
+		* @brief Get DescriptorSetLayout Unit Handle.
+		*
+		* @return Returns DescriptorSetLayout Unit Handle.
+		*/
+		const Unit::DescriptorSetLayout::Handle& GetLayout() const { return m_Layout.GetHandle(); }
+
+		/**
+		* @brief Acquire a texture slot and write image to it.
+		*
+		* @param[in] view VkImageView.
+		* @param[in] sampler VkSampler.
+		*
+		* @return Returns texture slot index.
+		*/
+		uint32_t AcquireTexture(VkImageView view, VkSampler sampler);
+
+		/**
+		* @brief Release a texture slot, slot is reused after frames in flight retired.
+		*
+		* @param[in] index texture slot index.
+		*/
+		void ReleaseTexture(uint32_t index);
+
+		/**
+		* @brief Acquire a buffer slot and write buffer to it.
+		*
+		* @param[in] buffer VkBuffer.
+		* @param[in] range Buffer range.
+		*
+		* @return Returns buffer slot index.
+		*/
+		uint32_t AcquireBuffer(VkBuffer buffer, VkDeviceSize range = VK_WHOLE_SIZE);
+
+		/**
+		* @brief Release a buffer slot, slot is reused after frames in flight retired.
+		*
+		* @param[in] index buffer slot index.
+		*/
+		void ReleaseBuffer(uint32_t index);
+
+		/**
+		* @brief Recycle slots released while frame was recorded last time.
+		* Call after the fence of this frame was waited.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void Recycle(uint32_t frameIndex);
+
+	private:
+
+		/**
+		* @brief Create BindLessHeap.
+		*/
+		void Create();
+
+	private:
+
+		/**
+		* @brief Slot Allocator of one binding.
+		*/
+		struct SlotAllocator
+		{
+			uint32_t                                           capacity = 0;      // @brief Slot capacity.
+			uint32_t                                           next     = 0;      // @brief Next never used slot.
+			std::vector<uint32_t>                              free;              // @brief Recycled slots.
+			std::array<std::vector<uint32_t>, MaxFrameInFlight> retired;          // @brief Slots released per frame.
+
+			/**
+			* @brief Allocate a slot.
+			*
+			* @return Returns slot index, capacity if exhausted.
+			*/
+			uint32_t Allocate();
+		};
+
+		Unit::DescriptorPool                m_DescriptorPool;                    // @brief This DescriptorPool.
+		Unit::DescriptorSetLayout           m_Layout;                            // @brief This DescriptorSetLayout.
+		Unit::DescriptorSet                 m_DescriptorSet;                     // @brief This DescriptorSet.
+		SlotAllocator                       m_Textures;                          // @brief Texture slots.
+		SlotAllocator                       m_Buffers;                           // @brief Buffer slots.
+		uint32_t                            m_FrameIndex = 0;                    // @brief Frame index released slots belong to.
+		std::mutex                          m_Mutex;                             // @brief Mutex of slots.
+
+	};
+
+}
+
+#endif
@@ -14,65 +14,184 @@
 
 namespace Neptune::Vulkan {
 
+    namespace {
+
+        constexpr uint32_t MaxPoolSize = DescriptorPoolSize * 8;     // @brief Upper bound of pool growth.
+    }
+
     DescriptorPool::DescriptorPool(Context& context, EInfrastructure e)
         : Infrastructure(context, e)
     {
         NEPTUNE_PROFILE_ZONE
 
-        Create();
+        m_Pools.emplace_back(Create(m_PoolSize, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT));
     }
 
-    void DescriptorPool::Create()
+    void DescriptorPool::Allocate(Unit::DescriptorSet& set, VkDescriptorSetLayout layout, std::span<const VkDescriptorSetLayoutBinding> bindings)
     {
         NEPTUNE_PROFILE_ZONE
 
-        std::vector<VkDescriptorPoolSize> poolSizes{};
+        VkDescriptorSetAllocateInfo        allocInfo{};
+        allocInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pSetLayouts            = &layout;
+        allocInfo.descriptorSetCount     = 1;
 
+        const auto device = GetContext().Get<IDevice>()->Handle();
+
+        std::unique_lock lock(m_Mutex);
+
+        // Newest pool first, older pools only have room left by freed sets.
+        for (auto it = m_Pools.rbegin(); it != m_Pools.rend(); ++it)
         {
-            VkDescriptorPoolSize             poolSize{};
-            poolSize.type                  = VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER;
-            poolSize.descriptorCount       = DescriptorPoolSize;
+            allocInfo.descriptorPool = (*it)->GetHandle();
 
-            poolSizes.emplace_back(poolSize);
+            if (set.TryAllocateDescriptorSet(device, allocInfo))
+            {
+                return;
+            }
         }
 
+        m_PoolSize = std::min(m_PoolSize * 2, MaxPoolSize);
+
+        // Sized from the layout too, so a set larger than any pool still fits the new one.
+        m_Pools.emplace_back(Create(m_PoolSize, VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT, bindings));
+
+        allocInfo.descriptorPool = m_Pools.back()->GetHandle();
+
+        set.AllocateDescriptorSet(device, allocInfo);
+    }
+
+    VkDescriptorSet DescriptorPool::AllocateTransient(VkDescriptorSetLayout layout, std::span<const VkDescriptorSetLayoutBinding> bindings)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        VkDescriptorSetAllocateInfo        allocInfo{};
+        allocInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+        allocInfo.pSetLayouts            = &layout;
+        allocInfo.descriptorSetCount     = 1;
+
+        std::unique_lock lock(m_Mutex);
+
+        ++m_TransientCount;
+
+        auto& pools = m_FramePools[m_FrameIndex];
+
+        VkDescriptorSet set = VK_NULL_HANDLE;
+
+        if (!pools.empty())
         {
-            VkDescriptorPoolSize             poolSize{};
-            poolSize.type                  = VK_DESCRIPTOR_TYPE_STORAGE_IMAGE;
-            poolSize.descriptorCount       = DescriptorPoolSize;
+            allocInfo.descriptorPool = pools.back()->GetHandle();
 
-            poolSizes.emplace_back(poolSize);
+            const auto result = pools.back()->AllocateDescriptorSets(allocInfo, &set);
+
+            if (result == VK_SUCCESS)
+            {
+                return set;
+            }
+
+            if (result != VK_ERROR_OUT_OF_POOL_MEMORY && result != VK_ERROR_FRAGMENTED_POOL)
+            {
+                VK_CHECK(result)
+                return VK_NULL_HANDLE;
+            }
         }
 
+        if (!m_FreePools.empty())
         {
-            VkDescriptorPoolSize             poolSize{};
-            poolSize.type                  = VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER;
-            poolSize.descriptorCount       = DescriptorPoolSize; 
+            pools.emplace_back(m_FreePools.back());
+            m_FreePools.pop_back();
 
-            poolSizes.emplace_back(poolSize);
+            allocInfo.descriptorPool = pools.back()->GetHandle();
+
+            if (pools.back()->AllocateDescriptorSets(allocInfo, &set) == VK_SUCCESS)
+            {
+                return set;
+            }
         }
 
+        // Sized from the layout too, so a set larger than a reset pool still fits the new one.
+        pools.emplace_back(Create(DescriptorPoolSize, 0, bindings));
+
+        allocInfo.descriptorPool = pools.back()->GetHandle();
+
+        VK_CHECK(pools.back()->AllocateDescriptorSets(allocInfo, &set))
+
+        return set;
+    }
+
+    void DescriptorPool::Recycle(uint32_t frameIndex)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock lock(m_Mutex);
+
+        for (auto& pool : m_FramePools[frameIndex])
+        {
+            pool->Reset();
+
+            m_FreePools.emplace_back(std::move(pool));
+        }
+
+        m_FramePools[frameIndex].clear();
+
+        m_FrameIndex = frameIndex;
+
+        ++m_Recycles;
+    }
+
+    SP<Unit::DescriptorPool> DescriptorPool::Create(uint32_t maxSets, VkDescriptorPoolCreateFlags flags, std::span<const VkDescriptorSetLayoutBinding> bindings)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        constexpr std::array<VkDescriptorType, 4> types = {
+            VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER,
+            VK_DESCRIPTOR_TYPE_STORAGE_IMAGE,
+            VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER,
+            VK_DESCRIPTOR_TYPE_STORAGE_BUFFER
+        };
+
+        std::vector<VkDescriptorPoolSize> poolSizes{};
+
+        for (auto type : types)
         {
             VkDescriptorPoolSize             poolSize{};
-            poolSize.type                  = VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
-            poolSize.descriptorCount       = DescriptorPoolSize; 
+            poolSize.type                  = type;
+            poolSize.descriptorCount       = maxSets;
 
             poolSizes.emplace_back(poolSize);
         }
 
+        for (const auto& binding : bindings)
+        {
+            auto it = std::ranges::find(poolSizes, binding.descriptorType, &VkDescriptorPoolSize::type);
+
+            if (it == poolSizes.end())
+            {
+                it = poolSizes.insert(poolSizes.end(), VkDescriptorPoolSize{ binding.descriptorType, 0 });
+            }
+
+            it->descriptorCount += binding.descriptorCount;
+        }
+
         VkDescriptorPoolCreateInfo           createInfo{};
-		createInfo.sType                   = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
-		createInfo.poolSizeCount           = static_cast<uint32_t>(poolSizes.size());
-		createInfo.pPoolSizes              = poolSizes.data();
-		createInfo.maxSets                 = DescriptorPoolSize;
-		createInfo.flags                   = VK_DESCRIPTOR_POOL_CREATE_FREE_DESCRIPTOR_SET_BIT 
+        createInfo.sType                   = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+        createInfo.poolSizeCount           = static_cast<uint32_t>(poolSizes.size());
+        createInfo.pPoolSizes              = poolSizes.data();
+        createInfo.maxSets                 = maxSets;
+        createInfo.flags                   = flags
                                            | VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
 
-        m_DescriptorPool.CreateDescriptorPool(GetContext().Get<IDevice>()->Handle(), createInfo);
+        auto pool = CreateSP<Unit::DescriptorPool>();
+
+        pool->CreateDescriptorPool(GetContext().Get<IDevice>()->Handle(), createInfo);
+
+        DEBUGUTILS_SETOBJECTNAME(*pool, ToString())
+
+        ++m_PoolCount;
 
-        DEBUGUTILS_SETOBJECTNAME(m_DescriptorPool, ToString())
+        return pool;
     }
 
 }
 
-#endif
\ No newline at end of file
+#endif
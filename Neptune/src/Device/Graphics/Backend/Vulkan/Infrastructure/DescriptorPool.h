@@ -11,6 +11,13 @@
 #include "Core/Core.h"
 #include "Infrastructure.h"
 #include "Device/Graphics/Backend/Vulkan/Unit/DescriptorPool.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/DescriptorSet.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <span>
+#include <vector>
 
 namespace Neptune::Vulkan {
 
@@ -19,6 +26,8 @@ namespace Neptune::Vulkan {
 	/**
 	* @brief Vulkan::DescriptorPool Class.
 	* This class defines the Vulkan::DescriptorPool behaves.
+	* Long-lived sets are allocated from a chain of freeable pools which grows when exhausted,
+	* transient sets are allocated from per frame pools which are reset in bulk.
 	*/
 	class DescriptorPool : public Infrastructure
 	{
@@ -38,25 +47,94 @@ namespace Neptune::Vulkan {
 		~DescriptorPool() override = default;
 
 		/**
-		* @brief Get Unit Handle.
+		* @brief Get Unit Handle of first long-lived pool, used by external libraries.
 		*
 		* @return Returns Unit Handle.
 		*/
-		const Unit::DescriptorPool::Handle& Handle() const { return m_DescriptorPool.GetHandle(); }
+		const Unit::DescriptorPool::Handle& Handle() const { return m_Pools.front()->GetHandle(); }
+
+		/**
+		* @brief Allocate a long-lived DescriptorSet, it is freed by its destructor.
+		*
+		* @param[in] set Unit::DescriptorSet.
+		* @param[in] layout VkDescriptorSetLayout.
+		* @param[in] bindings VkDescriptorSetLayoutBinding of layout, sizes a new pool if none has room.
+		*/
+		void Allocate(Unit::DescriptorSet& set, VkDescriptorSetLayout layout, std::span<const VkDescriptorSetLayoutBinding> bindings);
+
+		/**
+		* @brief Allocate a DescriptorSet valid until the current frame is recycled.
+		*
+		* @param[in] layout VkDescriptorSetLayout.
+		* @param[in] bindings VkDescriptorSetLayoutBinding of layout, sizes a new pool if none has room.
+		*
+		* @return Returns VkDescriptorSet.
+		*/
+		VkDescriptorSet AllocateTransient(VkDescriptorSetLayout layout, std::span<const VkDescriptorSetLayoutBinding> bindings);
+
+		/**
+		* @brief Reset pools of transient sets allocated while frame was recorded last time.
+		* Call after the fence of this frame was waited.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void Recycle(uint32_t frameIndex);
+
+		/**
+		* @brief Get frame index transient sets are allocated for.
+		*
+		* @return Returns frame index.
+		*/
+		uint32_t GetFrameIndex() const { return m_FrameIndex; }
+
+		/**
+		* @brief Get count of Recycle calls, transient sets allocated before the last one are gone.
+		*
+		* @return Returns count of Recycle calls.
+		*/
+		uint64_t GetRecycles() const { return m_Recycles; }
+
+		/**
+		* @brief Get count of transient sets allocated since start.
+		*
+		* @return Returns count of transient sets.
+		*/
+		uint64_t GetTransientCount() const { return m_TransientCount; }
+
+		/**
+		* @brief Get count of created VkDescriptorPool.
+		*
+		* @return Returns count of created VkDescriptorPool.
+		*/
+		uint32_t GetPoolCount() const { return m_PoolCount; }
 
 	private:
 
 		/**
 		* @brief Create DescriptorPool.
+		*
+		* @param[in] maxSets Sets and descriptors per type the pool holds.
+		* @param[in] flags VkDescriptorPoolCreateFlags.
+		* @param[in] bindings Bindings of a set the pool must hold, descriptors of their types are raised to fit.
+		*
+		* @return Returns DescriptorPool.
 		*/
-		void Create();
+		SP<Unit::DescriptorPool> Create(uint32_t maxSets, VkDescriptorPoolCreateFlags flags, std::span<const VkDescriptorSetLayoutBinding> bindings = {});
 
 	private:
 
-		Unit::DescriptorPool m_DescriptorPool; // @brief this DescriptorPool
+		std::vector<SP<Unit::DescriptorPool>>                                 m_Pools;                                // @brief Chain of long-lived pools.
+		std::array<std::vector<SP<Unit::DescriptorPool>>, MaxFrameInFlight>   m_FramePools;                           // @brief Transient pools in use per frame.
+		std::vector<SP<Unit::DescriptorPool>>                                 m_FreePools;                            // @brief Reset transient pools.
+		uint32_t                                                              m_PoolSize = DescriptorPoolSize;        // @brief Size of next long-lived pool.
+		uint32_t                                                              m_PoolCount = 0;                        // @brief Created pools.
+		uint32_t                                                              m_FrameIndex = 0;                       // @brief Frame index transient sets belong to.
+		std::atomic<uint64_t>                                                 m_Recycles = 0;                         // @brief Recycle calls.
+		std::atomic<uint64_t>                                                 m_TransientCount = 0;                   // @brief Transient sets allocated.
+		std::mutex                                                            m_Mutex;                                // @brief Mutex of pools.
 
 	};
 
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,118 @@
+/**
+* @file DescriptorSetLayoutCache.cpp.
+* @brief The DescriptorSetLayoutCache Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "DescriptorSetLayoutCache.h"
+#include "Device.h"
+#include "DebugUtilsObject.h"
+
+namespace Neptune::Vulkan {
+
+    namespace {
+
+        /**
+        * @brief Mix a value into a hash.
+        *
+        * @param[in] seed Hash.
+        * @param[in] value Value.
+        */
+        void Combine(size_t& seed, uint64_t value)
+        {
+            seed ^= std::hash<uint64_t>{}(value) + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2);
+        }
+    }
+
+    bool DescriptorSetLayoutCache::KeyEqual::operator()(const KeyView& a, const KeyView& b) const
+    {
+        if (a.bindings.size() != b.bindings.size() || !std::ranges::equal(a.flags, b.flags)) return false;
+
+        for (size_t i = 0; i < a.bindings.size(); ++i)
+        {
+            const auto& x = a.bindings[i];
+            const auto& y = b.bindings[i];
+
+            if (x.binding            != y.binding            ||
+                x.descriptorType     != y.descriptorType     ||
+                x.descriptorCount    != y.descriptorCount    ||
+                x.stageFlags         != y.stageFlags         ||
+                x.pImmutableSamplers != y.pImmutableSamplers)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    size_t DescriptorSetLayoutCache::KeyHash::operator()(const KeyView& key) const
+    {
+        size_t seed = key.bindings.size();
+
+        for (const auto& binding : key.bindings)
+        {
+            Combine(seed, binding.binding);
+            Combine(seed, binding.descriptorType);
+            Combine(seed, binding.descriptorCount);
+            Combine(seed, binding.stageFlags);
+        }
+
+        for (auto flag : key.flags)
+        {
+            Combine(seed, flag);
+        }
+
+        return seed;
+    }
+
+    DescriptorSetLayoutCache::DescriptorSetLayoutCache(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {}
+
+    SP<Unit::DescriptorSetLayout> DescriptorSetLayoutCache::Get(std::span<const VkDescriptorSetLayoutBinding> bindings, std::span<const VkDescriptorBindingFlags> flags)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        assert(bindings.size() == flags.size());
+
+        std::unique_lock lock(m_Mutex);
+
+        if (const auto it = m_Layouts.find(KeyView{ bindings, flags }); it != m_Layouts.end())
+        {
+            ++m_Hits;
+
+            return it->second;
+        }
+
+        VkDescriptorSetLayoutBindingFlagsCreateInfo         bindingFlags{};
+        bindingFlags.sType                                = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+        bindingFlags.pNext                                = nullptr;
+        bindingFlags.pBindingFlags                        = flags.data();
+        bindingFlags.bindingCount                         = static_cast<uint32_t>(flags.size());
+
+        VkDescriptorSetLayoutCreateInfo                     layoutCreateInfo{};
+        layoutCreateInfo.sType                            = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+        layoutCreateInfo.bindingCount                     = static_cast<uint32_t>(bindings.size());
+        layoutCreateInfo.pBindings                        = bindings.data();
+        layoutCreateInfo.flags                            = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+        layoutCreateInfo.pNext                            = &bindingFlags;
+
+        auto layout = CreateSP<Unit::DescriptorSetLayout>();
+
+        layout->CreateDescriptorSetLayout(GetContext().Get<IDevice>()->Handle(), layoutCreateInfo);
+
+        DEBUGUTILS_SETOBJECTNAME(*layout, "DescriptorSetLayout")
+
+        m_Layouts.emplace(Key{ { bindings.begin(), bindings.end() }, { flags.begin(), flags.end() } }, layout);
+
+        return layout;
+    }
+
+}
+
+#endif
@@ -0,0 +1,155 @@
+/**
+* @file DescriptorSetLayoutCache.h.
+* @brief The DescriptorSetLayoutCache Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/DescriptorSetLayout.h"
+
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::Vulkan {
+
+	using IDescriptorSetLayoutCache = IInfrastructure<class DescriptorSetLayoutCache, EInfrastructure::DescriptorSetLayoutCache>;
+
+	/**
+	* @brief Vulkan::DescriptorSetLayoutCache Class.
+	* This class defines the Vulkan::DescriptorSetLayoutCache behaves.
+	* Equivalent binding descriptions share one DescriptorSetLayout.
+	*/
+	class DescriptorSetLayoutCache : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		DescriptorSetLayoutCache(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~DescriptorSetLayoutCache() override = default;
+
+		/**
+		* @brief Get or create an update-after-bind DescriptorSetLayout.
+		*
+		* A hit looks up by view and copies nothing, the key is stored only on miss.
+		*
+		* @param[in] bindings VkDescriptorSetLayoutBinding, sorted by binding.
+		* @param[in] flags VkDescriptorBindingFlags of each binding.
+		*
+		* @return Returns DescriptorSetLayout.
+		*/
+		SP<Unit::DescriptorSetLayout> Get(std::span<const VkDescriptorSetLayoutBinding> bindings, std::span<const VkDescriptorBindingFlags> flags);
+
+		/**
+		* @brief Get count of created DescriptorSetLayout.
+		*
+		* @return Returns count of created DescriptorSetLayout.
+		*/
+		size_t GetCount() const { return m_Layouts.size(); }
+
+		/**
+		* @brief Get count of Get calls served from cache.
+		*
+		* @return Returns count of cache hits.
+		*/
+		uint64_t GetHits() const { return m_Hits; }
+
+	private:
+
+		/**
+		* @brief Non owning cache key, used to look up.
+		*/
+		struct KeyView
+		{
+			std::span<const VkDescriptorSetLayoutBinding>   bindings;     // @brief Bindings.
+			std::span<const VkDescriptorBindingFlags>       flags;        // @brief Binding flags.
+		};
+
+		/**
+		* @brief Cache key of a DescriptorSetLayout.
+		*/
+		struct Key
+		{
+			std::vector<VkDescriptorSetLayoutBinding>   bindings;     // @brief Bindings.
+			std::vector<VkDescriptorBindingFlags>       flags;        // @brief Binding flags.
+
+			/**
+			* @brief Get view of this key.
+			*
+			* @return Returns KeyView.
+			*/
+			KeyView View() const { return { bindings, flags }; }
+		};
+
+		/**
+		* @brief Hash of Key and KeyView.
+		*/
+		struct KeyHash
+		{
+			using is_transparent = void;
+
+			/**
+			* @brief Hash KeyView.
+			*
+			* @param[in] key KeyView.
+			*
+			* @return Returns hash.
+			*/
+			size_t operator()(const KeyView& key) const;
+
+			/**
+			* @brief Hash Key.
+			*
+			* @param[in] key Key.
+			*
+			* @return Returns hash.
+			*/
+			size_t operator()(const Key& key) const { return (*this)(key.View()); }
+		};
+
+		/**
+		* @brief Equal of Key and KeyView.
+		*/
+		struct KeyEqual
+		{
+			using is_transparent = void;
+
+			/**
+			* @brief Compare KeyView.
+			*
+			* @param[in] a KeyView.
+			* @param[in] b KeyView.
+			*
+			* @return Returns true if equivalent.
+			*/
+			bool operator()(const KeyView& a, const KeyView& b) const;
+
+			bool operator()(const Key& a, const Key& b) const { return (*this)(a.View(), b.View()); }
+			bool operator()(const Key& a, const KeyView& b) const { return (*this)(a.View(), b); }
+			bool operator()(const KeyView& a, const Key& b) const { return (*this)(a, b.View()); }
+		};
+
+		std::unordered_map<Key, SP<Unit::DescriptorSetLayout>, KeyHash, KeyEqual>    m_Layouts;         // @brief Created layouts.
+		uint64_t                                                                     m_Hits = 0;        // @brief Cache hits.
+		std::mutex                                                                   m_Mutex;           // @brief Mutex of layouts.
+
+	};
+
+}
+
+#endif
@@ -45,9 +45,11 @@ namespace Neptune::Vulkan {
 		queueFamilies[families.present    .value()][1] = std::vector<VkQueue>(1,                VK_NULL_HANDLE);
 		queueFamilies[families.compute    .value()][2] = std::vector<VkQueue>(1 + NThreadQueue, VK_NULL_HANDLE);
 		queueFamilies[families.transfer   .value()][3] = std::vector<VkQueue>(1,                VK_NULL_HANDLE);
-		queueFamilies[families.videoEncode.value()][4] = std::vector<VkQueue>(1,                VK_NULL_HANDLE);
-		queueFamilies[families.videoDecode.value()][5] = std::vector<VkQueue>(1,                VK_NULL_HANDLE);
-		queueFamilies[families.opticalFlow.value()][6] = std::vector<VkQueue>(1,                VK_NULL_HANDLE);
+
+		// Video and optical flow queues are optional in headless mode.
+		if (families.videoEncode) queueFamilies[families.videoEncode.value()][4] = std::vector<VkQueue>(1, VK_NULL_HANDLE);
+		if (families.videoDecode) queueFamilies[families.videoDecode.value()][5] = std::vector<VkQueue>(1, VK_NULL_HANDLE);
+		if (families.opticalFlow) queueFamilies[families.opticalFlow.value()][6] = std::vector<VkQueue>(1, VK_NULL_HANDLE);
 
 		std::vector<VkDeviceQueueCreateInfo> queueCreateInfos;
 		std::vector<SP<std::vector<float>>> QueuePriorities;
@@ -86,15 +88,17 @@ namespace Neptune::Vulkan {
 
 		VkPhysicalDeviceVulkan13Features                          vk13Frature{};
 		vk13Frature.sType                                       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
-		vk13Frature.pNext                                       = &videoMain1Frature;
+		vk13Frature.pNext                                       = physicalDevice->IsExtensionEnabled(VK_KHR_VIDEO_MAINTENANCE_1_EXTENSION_NAME) ?
+		                                                          static_cast<void*>(&videoMain1Frature) : static_cast<void*>(&ycbcrFeature);
 
-		VkPhysicalDeviceDescriptorIndexingFeatures                descriptorIndexingFeatures {};
-		descriptorIndexingFeatures.sType                        = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES;
-		descriptorIndexingFeatures.pNext                        = &vk13Frature;  
+		// Descriptor indexing, timeline semaphore, buffer device address and draw indirect count.
+		VkPhysicalDeviceVulkan12Features                          vk12Frature{};
+		vk12Frature.sType                                       = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+		vk12Frature.pNext                                       = &vk13Frature;
 
 		VkPhysicalDeviceFaultFeaturesEXT                          faultFeatures{};
 		faultFeatures.sType                                     = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FAULT_FEATURES_EXT;
-		faultFeatures.pNext                                     = &descriptorIndexingFeatures;
+		faultFeatures.pNext                                     = &vk12Frature;
 
 		VkPhysicalDeviceFeatures2                                 deviceFeatures{};
 		deviceFeatures.sType                                    = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
@@ -107,8 +111,8 @@ namespace Neptune::Vulkan {
 		createInfo.pQueueCreateInfos                            = queueCreateInfos.data();
 		createInfo.queueCreateInfoCount                         = queueCreateInfos.size();
 		createInfo.pEnabledFeatures                             = VK_NULL_HANDLE;
-		createInfo.enabledExtensionCount                        = physicalDevice->GetExtensionRequirements().size();
-		createInfo.ppEnabledExtensionNames                      = physicalDevice->GetExtensionRequirements().data();
+		createInfo.enabledExtensionCount                        = physicalDevice->GetExtensions().size();
+		createInfo.ppEnabledExtensionNames                      = physicalDevice->GetExtensions().data();
 		createInfo.enabledLayerCount                            = 0;
 		createInfo.pNext                                        = &deviceFeatures;
 
@@ -134,9 +138,6 @@ namespace Neptune::Vulkan {
 		auto present     = queueFamilies[families.graphic    .value()][0][0];
 		auto compute     = queueFamilies[families.graphic    .value()][0][0];
 		auto transfer    = queueFamilies[families.graphic    .value()][0][0];
-		auto videoEncode = queueFamilies[families.videoEncode.value()][4][0];
-		auto videoDecode = queueFamilies[families.videoDecode.value()][5][0];
-		auto opticalFlow = queueFamilies[families.opticalFlow.value()][6][0];
 
 #else // Split Commands to different Queues.
 
@@ -144,9 +145,6 @@ namespace Neptune::Vulkan {
 		auto present     = queueFamilies[families.present    .value()][0][0];
 		auto compute     = queueFamilies[families.compute    .value()][2][0];
 		auto transfer    = queueFamilies[families.transfer   .value()][3][0];
-		auto videoEncode = queueFamilies[families.videoEncode.value()][4][0];
-		auto videoDecode = queueFamilies[families.videoDecode.value()][5][0];
-		auto opticalFlow = queueFamilies[families.opticalFlow.value()][6][0];
 
 #endif
 
@@ -160,9 +158,6 @@ namespace Neptune::Vulkan {
 		GetContext().Registry<IGraphicThreadQueue>();
 		GetContext().Registry<IComputeThreadQueue>();
 		GetContext().Registry<ITransferThreadQueue>();
-		GetContext().Registry<IVideoEncodeThreadQueue>();
-		GetContext().Registry<IVideoDecodeThreadQueue>();
-		GetContext().Registry<IOpticalFlowThreadQueue>();
 
 		for (int i = 0; i < NThreadQueue; i++)
 		{
@@ -171,9 +166,24 @@ namespace Neptune::Vulkan {
 		}
 
 		GetContext().Get<ITransferThreadQueue>()->Add(transfer);
-		GetContext().Get<IVideoEncodeThreadQueue>()->Add(videoEncode);
-		GetContext().Get<IVideoDecodeThreadQueue>()->Add(videoDecode);
-		GetContext().Get<IOpticalFlowThreadQueue>()->Add(opticalFlow);
+
+		if (families.videoEncode)
+		{
+			GetContext().Registry<IVideoEncodeThreadQueue>();
+			GetContext().Get<IVideoEncodeThreadQueue>()->Add(queueFamilies[families.videoEncode.value()][4][0]);
+		}
+
+		if (families.videoDecode)
+		{
+			GetContext().Registry<IVideoDecodeThreadQueue>();
+			GetContext().Get<IVideoDecodeThreadQueue>()->Add(queueFamilies[families.videoDecode.value()][5][0]);
+		}
+
+		if (families.opticalFlow)
+		{
+			GetContext().Registry<IOpticalFlowThreadQueue>();
+			GetContext().Get<IOpticalFlowThreadQueue>()->Add(queueFamilies[families.opticalFlow.value()][6][0]);
+		}
     }
 
 }
@@ -39,9 +39,11 @@ namespace Neptune::Vulkan {
         GraphicImageSemaphore,               // @brief Main Thread Graphic ImageSemaphore.
         GraphicQueueSemaphore,               // @brief Main Thread Graphic QueueSemaphore.
         GraphicFence,                        // @brief Main Thread Graphic Fence.
+        GraphicTimelineSemaphore,            // @brief Main Thread Graphic Frame Timeline.
                                              
         ComputeQueueSemaphore,               // @brief Main Thread Compute QueueSemaphore.
         ComputeFence,                        // @brief Main Thread Compute Fence.
+        ComputeTimelineSemaphore,            // @brief Main Thread Compute Frame Timeline.
                                              
         GraphicCommandPool,                  // @brief Main Thread Graphic CommandPool.
         GraphicCommandBuffer,                // @brief Main Thread Graphic CommandBuffer.
@@ -56,7 +58,14 @@ namespace Neptune::Vulkan {
         VideoDecodeThreadCommandPool,        // @brief Sub Thread VideoDecode CommandPool.
         OpticalFlowThreadCommandPool,        // @brief Sub Thread OpticalFlow CommandPool.
 
+        DescriptorSetLayoutCache,            // @brief Shared DescriptorSetLayouts.
         DescriptorPool,                      // @brief DescriptorPool.
+        BindLessHeap,                        // @brief BindLess DescriptorSet.
+
+        GpuProfiler,                         // @brief GPU Timestamp Profiler.
+        UploadManager,                       // @brief Batched Transfer Queue Uploads.
+        Readback,                            // @brief Asynchronous Image Readback.
+        ReleaseQueue,                        // @brief Objects Destroyed After Frames In Flight.
 
         Count
     };
@@ -0,0 +1,328 @@
+/**
+* @file GpuProfiler.cpp.
+* @brief The GpuProfiler Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "GpuProfiler.h"
+#include "Device.h"
+#include "PhysicalDevice.h"
+#include "CommandBuffer.h"
+#include "ThreadCommandPool.h"
+#include "ThreadQueue.h"
+#include "DebugUtilsObject.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/CommandBuffer.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/Queue.h"
+
+namespace Neptune::Vulkan {
+
+    GpuProfiler::GpuProfiler(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        Create();
+    }
+
+    void GpuProfiler::BeginFrame(uint32_t frameIndex)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_Masks[m_GraphicFamily] == 0) return;
+
+        auto& frame = m_Frames[frameIndex];
+
+        if (!frame.names.empty())
+        {
+            std::vector<uint64_t> timestamps;
+
+            if (frame.pool.TryGetQueryPoolResult(0, static_cast<uint32_t>(frame.names.size()) * 2, timestamps))
+            {
+                for (size_t i = 0; i < frame.names.size(); ++i)
+                {
+                    Publish("GraphicQueue", frame.names[i], timestamps[2 * i], timestamps[2 * i + 1], m_GraphicFamily);
+                }
+
+                // Zone 0 is the frame zone, frames are resolved in submission order.
+                const uint64_t begin = timestamps[0];
+
+                if (m_LastFrameEnd != 0)
+                {
+                    const uint64_t idle = (begin - m_LastFrameEnd) & m_Masks[m_GraphicFamily];
+
+                    m_GpuIdleTime = idle > m_Masks[m_GraphicFamily] / 2 ? 0.0f : static_cast<float>(static_cast<double>(idle) * m_Period / 1000000.0);
+                }
+
+                m_LastFrameEnd = begin + ((timestamps[1] - begin) & m_Masks[m_GraphicFamily]);
+            }
+        }
+
+        frame.names.clear();
+        frame.open.clear();
+
+        GetContext().Get<IGraphicCommandBuffer>()->IHandle(frameIndex)->ResetQueryPool(frame.pool.GetHandle(), 2 * MaxGpuZones);
+
+        BeginZone(frameIndex, "Frame");
+    }
+
+    void GpuProfiler::EndFrame(uint32_t frameIndex)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        EndZone(frameIndex);
+    }
+
+    void GpuProfiler::BeginZone(uint32_t frameIndex, const char* name)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_Masks[m_GraphicFamily] == 0) return;
+
+        auto& frame = m_Frames[frameIndex];
+
+        if (frame.names.size() == MaxGpuZones)
+        {
+            NEPTUNE_CORE_WARN("GpuProfiler frame zones exhausted.")
+            return;
+        }
+
+        const auto zone = static_cast<uint32_t>(frame.names.size());
+
+        frame.names.emplace_back(name);
+        frame.open.push_back(zone);
+
+        GetContext().Get<IGraphicCommandBuffer>()->IHandle(frameIndex)->WriteTimeStamp(frame.pool.GetHandle(), 2 * zone, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    }
+
+    void GpuProfiler::EndZone(uint32_t frameIndex)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        auto& frame = m_Frames[frameIndex];
+
+        if (frame.open.empty()) return;
+
+        const uint32_t zone = frame.open.back();
+
+        frame.open.pop_back();
+
+        GetContext().Get<IGraphicCommandBuffer>()->IHandle(frameIndex)->WriteTimeStamp(frame.pool.GetHandle(), 2 * zone + 1, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    }
+
+    std::optional<uint32_t> GpuProfiler::BeginSubmitZone(const Unit::CommandBuffer& commandBuffer, uint32_t family)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (family >= m_Masks.size() || m_Masks[family] == 0) return std::nullopt;
+
+        uint32_t slot;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            if (m_FreeSubmitSlots.empty()) return std::nullopt;
+
+            slot = m_FreeSubmitSlots.back();
+
+            m_FreeSubmitSlots.pop_back();
+        }
+
+        commandBuffer.ResetQueryPool(m_SubmitPool.GetHandle(), 2, 2 * slot);
+
+        commandBuffer.WriteTimeStamp(m_SubmitPool.GetHandle(), 2 * slot, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+
+        return slot;
+    }
+
+    void GpuProfiler::EndSubmitZone(const Unit::CommandBuffer& commandBuffer, uint32_t slot) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        commandBuffer.WriteTimeStamp(m_SubmitPool.GetHandle(), 2 * slot + 1, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+    }
+
+    void GpuProfiler::ResolveSubmitZone(uint32_t slot, const std::string& name, uint32_t family)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::vector<uint64_t> timestamps;
+
+        if (m_SubmitPool.TryGetQueryPoolResult(2 * slot, 2, timestamps))
+        {
+            Publish(name, name, timestamps[0], timestamps[1], family);
+        }
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        m_FreeSubmitSlots.push_back(slot);
+    }
+
+    void GpuProfiler::Create()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const auto& physicalDevice = GetContext().Get<IPhysicalDevice>();
+
+        m_Period        = physicalDevice->GetProperties().limits.timestampPeriod;
+        m_GraphicFamily = physicalDevice->GetQueueFamilies().graphic.value();
+
+        {
+            uint32_t familyCount = 0;
+            vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice->Handle(), &familyCount, nullptr);
+
+            std::vector<VkQueueFamilyProperties> families(familyCount);
+            vkGetPhysicalDeviceQueueFamilyProperties(physicalDevice->Handle(), &familyCount, families.data());
+
+            for (const auto& family : families)
+            {
+                const uint32_t bits = family.timestampValidBits;
+
+                m_Masks.push_back(bits >= 64 ? ~0ull : (1ull << bits) - 1);
+            }
+        }
+
+        const auto& device = GetContext().Get<IDevice>()->Handle();
+
+        VkQueryPoolCreateInfo                   createInfo{};
+        createInfo.sType                      = VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO;
+        createInfo.queryType                  = VK_QUERY_TYPE_TIMESTAMP;
+        createInfo.queryCount                 = 2 * MaxGpuZones;
+
+        for (auto& frame : m_Frames)
+        {
+            frame.pool.CreateQueryPool(device, createInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(frame.pool, ToString())
+        }
+
+        createInfo.queryCount                 = 2 * MaxGpuSubmitZones;
+
+        m_SubmitPool.CreateQueryPool(device, createInfo);
+
+        DEBUGUTILS_SETOBJECTNAME(m_SubmitPool, ToString())
+
+        if (m_Masks[m_GraphicFamily] == 0)
+        {
+            NEPTUNE_CORE_WARN("Graphic queue does not support timestamps, GpuProfiler disabled.")
+            return;
+        }
+
+        Calibrate();
+
+        for (uint32_t i = 0; i < MaxGpuSubmitZones; ++i)
+        {
+            m_FreeSubmitSlots.push_back(MaxGpuSubmitZones - 1 - i);
+        }
+
+#ifdef NEPTUNE_DEBUG
+
+        m_Trace.BeginSession("GpuTrace.json");
+
+#endif
+    }
+
+    void GpuProfiler::Calibrate()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        VkCommandBufferAllocateInfo            allocInfo{};
+        allocInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool                = GetContext().Get<IGraphicThreadCommandPool>()->Handle();
+        allocInfo.level                      = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocInfo.commandBufferCount         = 1;
+
+        Unit::CommandBuffer commandBuffer;
+
+        commandBuffer.CreateCommandBuffer(GetContext().Get<IDevice>()->Handle(), allocInfo);
+
+        VkCommandBufferBeginInfo               beginInfo{};
+        beginInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+        beginInfo.flags                      = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+        commandBuffer.Begin(beginInfo);
+        commandBuffer.ResetQueryPool(m_SubmitPool.GetHandle(), 1);
+        commandBuffer.WriteTimeStamp(m_SubmitPool.GetHandle(), 0, VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+        commandBuffer.End();
+
+        VkSubmitInfo                           submitInfo{};
+        submitInfo.sType                     = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+        submitInfo.commandBufferCount        = 1;
+        submitInfo.pCommandBuffers           = &commandBuffer.GetHandle();
+
+        auto queue = GetContext().Get<IGraphicThreadQueue>()->Pop();
+
+        const int64_t begin = ChromeTrace::Now();
+
+        queue->Submit(submitInfo);
+
+        queue->Wait();
+
+        const int64_t end = ChromeTrace::Now();
+
+        GetContext().Get<IGraphicThreadQueue>()->Push(queue);
+
+        std::vector<uint64_t> timestamps;
+
+        if (!m_SubmitPool.TryGetQueryPoolResult(0, 1, timestamps))
+        {
+            NEPTUNE_CORE_WARN("GpuProfiler calibration failed.")
+            return;
+        }
+
+        // The timestamp lies between submit and wait return, take the midpoint.
+        m_CalibrationGpu = timestamps[0];
+        m_CalibrationCpu = (begin + end) / 2;
+    }
+
+    void GpuProfiler::Publish(const std::string& lane, const std::string& name, uint64_t begin, uint64_t end, uint32_t family)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        // Timestamps may wrap when valid bits are less than 64.
+        end = begin + ((end - begin) & m_Masks[family]);
+
+        uint32_t tid;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            auto it = m_Lanes.find(lane);
+
+            if (it == m_Lanes.end())
+            {
+                Lane info;
+                info.tid = static_cast<uint32_t>(m_Lanes.size());
+
+                const auto now = m_CalibrationGpu + static_cast<uint64_t>(static_cast<double>(ChromeTrace::Now() - m_CalibrationCpu) / m_Period);
+
+                NEPTUNE_PROFILE_GPU_CONTEXT(info.context, static_cast<int64_t>(now), m_Period, lane.c_str())
+
+                m_Trace.WriteThreadName(info.tid, "GPU " + lane);
+
+                it = m_Lanes.emplace(lane, info).first;
+            }
+
+            NEPTUNE_PROFILE_GPU_ZONE(it->second.context, name.c_str(), static_cast<int64_t>(begin), static_cast<int64_t>(end))
+
+            tid = it->second.tid;
+        }
+
+        m_Trace.WriteZone("GPU", name, tid, ToMicroseconds(begin), static_cast<double>(end - begin) * m_Period / 1000.0);
+    }
+
+    double GpuProfiler::ToMicroseconds(uint64_t timestamp) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const auto ticks = static_cast<double>(static_cast<int64_t>(timestamp - m_CalibrationGpu));
+
+        return (static_cast<double>(m_CalibrationCpu) + ticks * m_Period) / 1000.0;
+    }
+
+}
+
+#endif
@@ -0,0 +1,192 @@
+/**
+* @file GpuProfiler.h.
+* @brief The GpuProfiler Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/QueryPool.h"
+#include "Debugger/Profiler/ChromeTrace.h"
+
+#include <array>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::Vulkan {
+
+	namespace Unit {
+
+		class CommandBuffer;
+	}
+
+	using IGpuProfiler = IInfrastructure<class GpuProfiler, EInfrastructure::GpuProfiler>;
+
+	/**
+	* @brief Vulkan::GpuProfiler Class.
+	* This class defines the Vulkan::GpuProfiler behaves.
+	* Frame zones are written into a per frame in flight timestamp pool and read back
+	* once the submission of that frame completed, so resolving never stalls the GPU.
+	* Resolved zones are published to tracy GPU zones and a chrome trace file.
+	*/
+	class GpuProfiler : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		GpuProfiler(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~GpuProfiler() override = default;
+
+		/**
+		* @brief Resolve zones recorded last time by this frame, reset its queries and begin the frame zone.
+		* Call after the submission of this frame was waited and the graphic CommandBuffer began.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void BeginFrame(uint32_t frameIndex);
+
+		/**
+		* @brief End the frame zone.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void EndFrame(uint32_t frameIndex);
+
+		/**
+		* @brief Get graphic queue idle time between the last two resolved frames.
+		*
+		* @return Returns idle time in milliseconds.
+		*/
+		float GetGpuIdleTime() const { return m_GpuIdleTime; }
+
+		/**
+		* @brief Begin a zone in graphic CommandBuffer.
+		*
+		* @param[in] frameIndex Frame index.
+		* @param[in] name Zone name.
+		*/
+		void BeginZone(uint32_t frameIndex, const char* name);
+
+		/**
+		* @brief End the last begun zone in graphic CommandBuffer.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void EndZone(uint32_t frameIndex);
+
+		/**
+		* @brief Begin a zone covering a whole submission.
+		*
+		* @param[in] commandBuffer Unit::CommandBuffer.
+		* @param[in] family Queue family of the submission.
+		*
+		* @return Returns submit slot, nullopt if timestamps are not supported or slots are exhausted.
+		*/
+		std::optional<uint32_t> BeginSubmitZone(const Unit::CommandBuffer& commandBuffer, uint32_t family);
+
+		/**
+		* @brief End a zone covering a whole submission.
+		*
+		* @param[in] commandBuffer Unit::CommandBuffer.
+		* @param[in] slot Submit slot.
+		*/
+		void EndSubmitZone(const Unit::CommandBuffer& commandBuffer, uint32_t slot) const;
+
+		/**
+		* @brief Resolve a submission zone and release its slot.
+		* Call only after the submission was waited.
+		*
+		* @param[in] slot Submit slot.
+		* @param[in] name Zone name.
+		* @param[in] family Queue family of the submission.
+		*/
+		void ResolveSubmitZone(uint32_t slot, const std::string& name, uint32_t family);
+
+	private:
+
+		/**
+		* @brief Create GpuProfiler.
+		*/
+		void Create();
+
+		/**
+		* @brief Pair a GPU timestamp with CPU time.
+		*/
+		void Calibrate();
+
+		/**
+		* @brief Publish a resolved zone.
+		*
+		* @param[in] lane Lane name, one lane per queue.
+		* @param[in] name Zone name.
+		* @param[in] begin GPU begin timestamp.
+		* @param[in] end GPU end timestamp.
+		* @param[in] family Queue family of the zone.
+		*/
+		void Publish(const std::string& lane, const std::string& name, uint64_t begin, uint64_t end, uint32_t family);
+
+		/**
+		* @brief Convert GPU timestamp to CPU time.
+		*
+		* @param[in] timestamp GPU timestamp.
+		*
+		* @return Returns CPU time in microseconds.
+		*/
+		double ToMicroseconds(uint64_t timestamp) const;
+
+	private:
+
+		/**
+		* @brief Zones of one frame in flight.
+		*/
+		struct FrameZones
+		{
+			Unit::QueryPool                pool;              // @brief Timestamp pool, zone i uses query 2i and 2i+1.
+			std::vector<std::string>       names;             // @brief Zone names.
+			std::vector<uint32_t>          open;              // @brief Stack of begun zones.
+		};
+
+		/**
+		* @brief Trace lane of one queue.
+		*/
+		struct Lane
+		{
+			uint8_t                        context = 0;       // @brief Tracy GPU Context id.
+			uint32_t                       tid     = 0;       // @brief Chrome trace lane id.
+		};
+
+		std::array<FrameZones, MaxFrameInFlight>    m_Frames;                    // @brief Frame zones.
+		Unit::QueryPool                             m_SubmitPool;                // @brief Submission zone pool.
+		std::vector<uint32_t>                       m_FreeSubmitSlots;           // @brief Free submission slots.
+		std::vector<uint64_t>                       m_Masks;                     // @brief Timestamp valid bits mask per queue family.
+		uint32_t                                    m_GraphicFamily = 0;         // @brief Graphic queue family.
+		float                                       m_Period = 1.0f;             // @brief Nanoseconds per timestamp tick.
+		uint64_t                                    m_CalibrationGpu = 0;        // @brief GPU timestamp of calibration.
+		int64_t                                     m_CalibrationCpu = 0;        // @brief CPU time of calibration in nanoseconds.
+		uint64_t                                    m_LastFrameEnd = 0;          // @brief GPU end timestamp of last resolved frame.
+		float                                       m_GpuIdleTime = 0.0f;        // @brief Graphic queue idle time in milliseconds.
+		std::unordered_map<std::string, Lane>       m_Lanes;                     // @brief Trace lanes.
+		ChromeTrace                                 m_Trace;                     // @brief Chrome trace file.
+		std::mutex                                  m_Mutex;                     // @brief Mutex of submit slots and lanes.
+
+	};
+
+}
+
+#endif
@@ -46,9 +46,11 @@ namespace Neptune::Vulkan {
             case EInfrastructure::GraphicImageSemaphore:              return "GraphicImageSemaphore";
             case EInfrastructure::GraphicQueueSemaphore:              return "GraphicQueueSemaphore";
             case EInfrastructure::GraphicFence:                       return "GraphicFence";
+            case EInfrastructure::GraphicTimelineSemaphore:           return "GraphicTimelineSemaphore";
                                                                       
             case EInfrastructure::ComputeQueueSemaphore:              return "ComputeQueueSemaphore";
             case EInfrastructure::ComputeFence:                       return "ComputeFence";
+            case EInfrastructure::ComputeTimelineSemaphore:           return "ComputeTimelineSemaphore";
                                                                       
             case EInfrastructure::GraphicCommandPool:                 return "GraphicCommandPool";
             case EInfrastructure::GraphicCommandBuffer:               return "GraphicCommandBuffer";
@@ -63,7 +65,14 @@ namespace Neptune::Vulkan {
             case EInfrastructure::VideoDecodeThreadCommandPool:       return "VideoDecodeThreadCommandPool";
             case EInfrastructure::OpticalFlowThreadCommandPool:       return "OpticalFlowThreadCommandPool";
 
+            case EInfrastructure::DescriptorSetLayoutCache:           return "DescriptorSetLayoutCache";
             case EInfrastructure::DescriptorPool:                     return "DescriptorPool";
+            case EInfrastructure::BindLessHeap:                       return "BindLessHeap";
+
+            case EInfrastructure::GpuProfiler:                        return "GpuProfiler";
+            case EInfrastructure::UploadManager:                      return "UploadManager";
+            case EInfrastructure::Readback:                           return "Readback";
+            case EInfrastructure::ReleaseQueue:                       return "ReleaseQueue";
 
             default:                                                  return "NonNamed";
         }
@@ -17,12 +17,19 @@
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/ThreadQueue.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/SwapChain.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/Semaphore.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/TimelineSemaphore.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/Fence.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/DebugUtilsObject.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/CommandPool.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/CommandBuffer.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/DescriptorSetLayoutCache.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/DescriptorPool.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/BindLessHeap.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/ThreadCommandPool.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/Queue.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/GpuProfiler.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/UploadManager.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/Readback.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/ReleaseQueue.h"
 
 #endif
\ No newline at end of file
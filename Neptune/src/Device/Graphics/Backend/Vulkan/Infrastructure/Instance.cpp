@@ -121,8 +121,15 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		// Window extensions are empty in headless mode, no Surface is created.
+		const bool surface = !m_ExtensionProperties.empty();
+
 		m_ExtensionProperties.push_back(VK_KHR_GET_PHYSICAL_DEVICE_PROPERTIES_2_EXTENSION_NAME);
-		m_ExtensionProperties.push_back(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
+
+		if (surface)
+		{
+			m_ExtensionProperties.push_back(VK_KHR_GET_SURFACE_CAPABILITIES_2_EXTENSION_NAME);
+		}
 
 #ifdef NEPTUNE_DEBUG
 
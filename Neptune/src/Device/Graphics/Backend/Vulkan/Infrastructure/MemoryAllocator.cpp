@@ -14,9 +14,33 @@
 #include "Instance.h"
 #include "PhysicalDevice.h"
 #include "Device.h"
+#include "Core/Memory/AllocTracker.h"
 
 namespace Neptune::Vulkan {
 
+#ifdef NP_ALLOC_TRACKER
+
+	namespace {
+
+		/**
+		* @brief Record a vkAllocateMemory issued by VMA.
+		*/
+		void VKAPI_PTR OnDeviceMemoryAllocate(VmaAllocator, uint32_t, VkDeviceMemory memory, VkDeviceSize size, void*)
+		{
+			Memory::AllocTracker::OnDeviceAlloc(reinterpret_cast<const void*>(memory), size);
+		}
+
+		/**
+		* @brief Record a vkFreeMemory issued by VMA.
+		*/
+		void VKAPI_PTR OnDeviceMemoryFree(VmaAllocator, uint32_t, VkDeviceMemory memory, VkDeviceSize size, void*)
+		{
+			Memory::AllocTracker::OnDeviceFree(reinterpret_cast<const void*>(memory), size);
+		}
+	}
+
+#endif
+
 	MemoryAllocator::MemoryAllocator(Context& context, EInfrastructure e)
 		: Infrastructure(context, e)
 	{
@@ -50,9 +74,21 @@ namespace Neptune::Vulkan {
 												VMA_ALLOCATOR_CREATE_KHR_MAINTENANCE5_BIT              |
 												VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT             |
 												VMA_ALLOCATOR_CREATE_EXT_MEMORY_PRIORITY_BIT           |
+												VMA_ALLOCATOR_CREATE_BUFFER_DEVICE_ADDRESS_BIT         |
 												VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
 												VMA_ALLOCATION_CREATE_HOST_ACCESS_RANDOM_BIT           ;
 
+#ifdef NP_ALLOC_TRACKER
+
+		// VMA copies the callbacks during creation.
+		VmaDeviceMemoryCallbacks                callbacks {};
+		callbacks.pfnAllocate                 = OnDeviceMemoryAllocate;
+		callbacks.pfnFree                     = OnDeviceMemoryFree;
+
+		createInfo.pDeviceMemoryCallbacks     = &callbacks;
+
+#endif
+
 		VK_CHECK(vmaCreateAllocator(&createInfo, &m_Handle))
 	}
 }
@@ -16,6 +16,40 @@
 
 namespace Neptune::Vulkan {
 
+	namespace {
+
+		/**
+		* @brief Get video and ray tracing Extensions.
+		*
+		* @return Returns Extensions.
+		*/
+		const std::vector<const char*>& FeatureExtensions()
+		{
+			static std::vector<const char*> extensions;
+
+			if (extensions.empty())
+			{
+				// @brief Video Decode/Encode
+				extensions.push_back(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_VIDEO_MAINTENANCE_1_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_VIDEO_DECODE_H265_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME);
+
+				// @brief Optical Flow
+				//extensions.push_back(VK_NV_OPTICAL_FLOW_EXTENSION_NAME);
+
+				// @brief RayTracing
+				extensions.push_back(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_RAY_QUERY_EXTENSION_NAME);
+				extensions.push_back(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+			}
+
+			return extensions;
+		}
+	}
+
 	PhysicalDevice::PhysicalDevice(Context& context, EInfrastructure e)
         : Infrastructure(context, e)
     {
@@ -61,7 +95,7 @@ namespace Neptune::Vulkan {
 		NEPTUNE_CORE_ERROR("Failed to find GPU Physical Device that satisfied our needs.")
     }
 
-	bool PhysicalDevice::IsExtensionMeetDemand(const VkPhysicalDevice& device) const
+	bool PhysicalDevice::IsExtensionMeetDemand(const VkPhysicalDevice& device)
 	{
 		NEPTUNE_PROFILE_ZONE
 
@@ -74,13 +108,27 @@ namespace Neptune::Vulkan {
 		auto requiredList = GetExtensionRequirements();
 		std::set<std::string> requiredExtensions(requiredList.begin(), requiredList.end());
 
+		std::set<std::string> available;
+
 		for (const auto& extension : availableExtensions)
 		{
 			requiredExtensions.erase(extension.extensionName);
+
+			available.insert(extension.extensionName);
 		}
 
 		if (requiredExtensions.empty())
 		{
+			m_ExtensionProperties = requiredList;
+
+			for (const auto& extension : GetOptionalExtensions())
+			{
+				if (available.contains(extension))
+				{
+					m_ExtensionProperties.push_back(extension);
+				}
+			}
+
 			return true;
 		}
 		else
@@ -137,6 +185,8 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_QueueFamilies = {};
+
 		uint32_t queueFamilyCount = 0;
 		vkGetPhysicalDeviceQueueFamilyProperties2(device, &queueFamilyCount, nullptr);
 
@@ -204,7 +254,14 @@ namespace Neptune::Vulkan {
 			if (m_QueueFamilies.IsComplete()) return true;
 		}
 
-		return false;
+		// Headless devices may lack video and optical flow queues, those families stay unset.
+		if (!IsExtensionEnabled(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME))
+		{
+			m_QueueFamilies.videoEncode.reset();
+			m_QueueFamilies.videoDecode.reset();
+		}
+
+		return !surface && m_QueueFamilies.IsRenderComplete();
 	}
 
 	bool PhysicalDevice::IsOpticalFlowSessionSupport(VkFormat format, VkOpticalFlowUsageFlagsNV usage)
@@ -444,7 +501,13 @@ namespace Neptune::Vulkan {
 		if (m_ExtensionProperties.empty())
 		{
 			m_ExtensionProperties.push_back(VK_EXT_DEVICE_FAULT_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+
+			// @brief Headless rendering has no Surface to present.
+			if (GetContext().Has<ISurface>())
+			{
+				m_ExtensionProperties.push_back(VK_KHR_SWAPCHAIN_EXTENSION_NAME);
+			}
+
 			m_ExtensionProperties.push_back(VK_KHR_MAINTENANCE_1_EXTENSION_NAME);
 			m_ExtensionProperties.push_back(VK_KHR_DEFERRED_HOST_OPERATIONS_EXTENSION_NAME);
 			m_ExtensionProperties.push_back(VK_KHR_SHADER_CLOCK_EXTENSION_NAME);
@@ -456,26 +519,34 @@ namespace Neptune::Vulkan {
 			m_ExtensionProperties.push_back(VK_EXT_NESTED_COMMAND_BUFFER_EXTENSION_NAME);
 			m_ExtensionProperties.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
 
-			// @brief Video Decode/Encode
-			m_ExtensionProperties.push_back(VK_KHR_VIDEO_QUEUE_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_VIDEO_ENCODE_QUEUE_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_VIDEO_MAINTENANCE_1_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_VIDEO_DECODE_QUEUE_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_VIDEO_DECODE_H265_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_SAMPLER_YCBCR_CONVERSION_EXTENSION_NAME);
-
-			// @brief Optical Flow
-			//m_ExtensionProperties.push_back(VK_NV_OPTICAL_FLOW_EXTENSION_NAME);
-			 
-			// @brief RayTracing
-			m_ExtensionProperties.push_back(VK_KHR_RAY_TRACING_PIPELINE_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_RAY_QUERY_EXTENSION_NAME);
-			m_ExtensionProperties.push_back(VK_KHR_ACCELERATION_STRUCTURE_EXTENSION_NAME);
+			// @brief Video and RayTracing are optional in headless mode.
+			if (GetContext().Has<ISurface>())
+			{
+				const auto& features = FeatureExtensions();
+
+				m_ExtensionProperties.insert(m_ExtensionProperties.end(), features.begin(), features.end());
+			}
 		}
 
 		return m_ExtensionProperties;
 	}
 
+	const std::vector<const char*>& PhysicalDevice::GetOptionalExtensions() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		static const std::vector<const char*> none;
+
+		return GetContext().Has<ISurface>() ? none : FeatureExtensions();
+	}
+
+	bool PhysicalDevice::IsExtensionEnabled(const char* name) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		return std::ranges::any_of(m_ExtensionProperties, [&](const char* extension) { return strcmp(extension, name) == 0; });
+	}
+
 	std::vector<VkFormat> PhysicalDevice::GetVideoFormats(VkImageUsageFlags imageUsage, const std::vector<VkVideoProfileInfoKHR>& videoProfile)
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -39,6 +39,16 @@ namespace Neptune::Vulkan {
 		{
 			return graphic && present && transfer && compute && videoEncode && videoDecode && opticalFlow;
 		}
+
+		/**
+		* @brief Is families used by rendering found, video and optical flow are optional in headless mode.
+		*
+		* @return Returns true if found.
+		*/
+		bool IsRenderComplete() const
+		{
+			return graphic && present && transfer && compute;
+		}
 	};
 
 	/**
@@ -96,12 +106,28 @@ namespace Neptune::Vulkan {
 		const Unit::PhysicalDevice::Handle& Handle() const { return m_PhysicalDevice.GetHandle(); }
 
 		/**
-		* @brief Get Extensions.
+		* @brief Get required Extensions, video and ray tracing are optional in headless mode.
 		*
-		* @return Returns Extensions.
+		* @return Returns required Extensions.
 		*/
 		const std::vector<const char*>& GetExtensionRequirements() const;
 
+		/**
+		* @brief Get Extensions enabled on the selected device, required and available optional ones.
+		*
+		* @return Returns enabled Extensions.
+		*/
+		const std::vector<const char*>& GetExtensions() const { return m_ExtensionProperties; }
+
+		/**
+		* @brief Is an Extension enabled on the selected device.
+		*
+		* @param[in] name Extension name.
+		*
+		* @return Returns true if enabled.
+		*/
+		bool IsExtensionEnabled(const char* name) const;
+
 		/**
 		* @brief Get QueueFamilies.
 		*
@@ -155,13 +181,20 @@ namespace Neptune::Vulkan {
 		void Create();
 
 		/**
-		* @brief Is Extension Meet Demand.
+		* @brief Is Extension Meet Demand, collects enabled Extensions.
 		* 
 		* @param[in] device VkPhysicalDevice.
 		* 
 		* @return Returns true if meets.
 		*/
-		bool IsExtensionMeetDemand(const VkPhysicalDevice& device) const;
+		bool IsExtensionMeetDemand(const VkPhysicalDevice& device);
+
+		/**
+		* @brief Get optional Extensions, enabled only if available.
+		*
+		* @return Returns optional Extensions.
+		*/
+		const std::vector<const char*>& GetOptionalExtensions() const;
 
 		/**
 		* @brief Is Property Meet Demand.
@@ -214,7 +247,7 @@ namespace Neptune::Vulkan {
 	private:
 
 		Unit::PhysicalDevice m_PhysicalDevice;              // @brief This PhysicalDevice.
-		std::vector<const char*> m_ExtensionProperties;     // @brief Extensions.
+		std::vector<const char*> m_ExtensionProperties;     // @brief Enabled Extensions.
 		QueueFamilies m_QueueFamilies;                      // @brief QueueFamilies.
 		VkPhysicalDeviceProperties m_Properties;            // @brief VkPhysicalDeviceProperties.
 		SwapChainProperty m_SwapChainProperty;              // @brief SwapChainProperty.
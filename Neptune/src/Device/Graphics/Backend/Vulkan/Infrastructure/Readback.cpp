@@ -0,0 +1,128 @@
+/**
+* @file Readback.cpp.
+* @brief The Readback Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Readback.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/CommandBuffer.h"
+#include "Device/Graphics/Backend/Vulkan/Resource/Buffer.h"
+
+namespace Neptune::Vulkan {
+
+    Readback::Readback(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {}
+
+    void Readback::Record(const Unit::CommandBuffer& commandBuffer, uint32_t frameIndex, uint64_t frame, VkImage image, VkImageLayout layout, uint32_t width, uint32_t height, uint32_t texelSize)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        auto& slot = m_Slots[frameIndex];
+
+        const VkDeviceSize size = static_cast<VkDeviceSize>(width) * height * texelSize;
+
+        if (!slot.buffer || slot.buffer->Size() < size)
+        {
+            VkBufferCreateInfo                     bufferInfo{};
+            bufferInfo.sType                     = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size                      = size;
+            bufferInfo.usage                     = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+            bufferInfo.sharingMode               = VK_SHARING_MODE_EXCLUSIVE;
+
+            slot.buffer = CreateSP<Resource::Buffer>(GetContext());
+
+            slot.buffer->CreateBuffer(bufferInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+
+            slot.buffer->SetName("Readback");
+        }
+
+        {
+            VkImageMemoryBarrier2                  barrier{};
+            barrier.sType                        = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+            barrier.srcStageMask                 = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+            barrier.srcAccessMask                = VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
+            barrier.dstStageMask                 = VK_PIPELINE_STAGE_2_COPY_BIT;
+            barrier.dstAccessMask                = VK_ACCESS_2_TRANSFER_READ_BIT;
+            barrier.oldLayout                    = layout;
+            barrier.newLayout                    = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
+            barrier.srcQueueFamilyIndex          = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex          = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image                        = image;
+            barrier.subresourceRange             = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 1, 0, 1 };
+
+            VkDependencyInfo                       dependency{};
+            dependency.sType                     = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependency.imageMemoryBarrierCount   = 1;
+            dependency.pImageMemoryBarriers      = &barrier;
+
+            commandBuffer.PipelineBarrier2(dependency);
+        }
+
+        {
+            VkBufferImageCopy                      region{};
+            region.bufferOffset                  = 0;
+            region.bufferRowLength               = 0;
+            region.bufferImageHeight             = 0;
+            region.imageSubresource              = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+            region.imageOffset                   = { 0, 0, 0 };
+            region.imageExtent                   = { width, height, 1 };
+
+            commandBuffer.CopyImageToBuffer(image, slot.buffer->Handle(), region);
+        }
+
+        {
+            // Make the copy visible to the host once the timeline of this frame is waited.
+            VkBufferMemoryBarrier2                 barrier{};
+            barrier.sType                        = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+            barrier.srcStageMask                 = VK_PIPELINE_STAGE_2_COPY_BIT;
+            barrier.srcAccessMask                = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            barrier.dstStageMask                 = VK_PIPELINE_STAGE_2_HOST_BIT;
+            barrier.dstAccessMask                = VK_ACCESS_2_HOST_READ_BIT;
+            barrier.srcQueueFamilyIndex          = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex          = VK_QUEUE_FAMILY_IGNORED;
+            barrier.buffer                       = slot.buffer->Handle();
+            barrier.offset                       = 0;
+            barrier.size                         = size;
+
+            VkDependencyInfo                       dependency{};
+            dependency.sType                     = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependency.bufferMemoryBarrierCount  = 1;
+            dependency.pBufferMemoryBarriers     = &barrier;
+
+            commandBuffer.PipelineBarrier2(dependency);
+        }
+
+        slot.size    = size;
+        slot.width   = width;
+        slot.height  = height;
+        slot.frame   = frame;
+        slot.pending = true;
+    }
+
+    bool Readback::Resolve(uint32_t frameIndex, Result& result)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        auto& slot = m_Slots[frameIndex];
+
+        if (!slot.pending) return false;
+
+        slot.pending = false;
+
+        result.data   = slot.buffer->Data();
+        result.size   = slot.size;
+        result.width  = slot.width;
+        result.height = slot.height;
+        result.frame  = slot.frame;
+
+        return true;
+    }
+
+}
+
+#endif
@@ -0,0 +1,114 @@
+/**
+* @file Readback.h.
+* @brief The Readback Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+
+#include <array>
+
+namespace Neptune::Vulkan {
+
+	namespace Unit {
+
+		class CommandBuffer;
+	}
+
+	namespace Resource {
+
+		class Buffer;
+	}
+
+	using IReadback = IInfrastructure<class Readback, EInfrastructure::Readback>;
+
+	/**
+	* @brief Vulkan::Readback Class.
+	* This class defines the Vulkan::Readback behaves.
+	* An Image is copied into a host visible Buffer of the recording frame in flight and
+	* read once that frame index is waited again, so reading never stalls the GPU.
+	*/
+	class Readback : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Resolved readback of a frame.
+		*/
+		struct Result
+		{
+			const void*                    data   = nullptr;   // @brief Host data, valid until the frame index records again.
+			VkDeviceSize                   size   = 0;         // @brief Data bytes.
+			uint32_t                       width  = 0;         // @brief Image width.
+			uint32_t                       height = 0;         // @brief Image height.
+			uint64_t                       frame  = 0;         // @brief Frame number recorded.
+		};
+
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		Readback(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~Readback() override = default;
+
+		/**
+		* @brief Record an Image copy into the Buffer of a frame.
+		* Call only after the last submission of this frame index was waited.
+		*
+		* @param[in] commandBuffer Unit::CommandBuffer of the frame.
+		* @param[in] frameIndex Frame index.
+		* @param[in] frame Frame number.
+		* @param[in] image Source Image, left in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.
+		* @param[in] layout Layout of the Image when recorded.
+		* @param[in] width Copied width from origin, at most the Image width.
+		* @param[in] height Copied height from origin, at most the Image height.
+		* @param[in] texelSize Bytes per texel.
+		*/
+		void Record(const Unit::CommandBuffer& commandBuffer, uint32_t frameIndex, uint64_t frame, VkImage image, VkImageLayout layout, uint32_t width, uint32_t height, uint32_t texelSize);
+
+		/**
+		* @brief Take the readback recorded last time by this frame index.
+		* Call only after the last submission of this frame index was waited.
+		*
+		* @param[in] frameIndex Frame index.
+		* @param[out] result Result.
+		*
+		* @return Returns true if a readback was pending.
+		*/
+		bool Resolve(uint32_t frameIndex, Result& result);
+
+	private:
+
+		/**
+		* @brief Readback of one frame in flight.
+		*/
+		struct Slot
+		{
+			SP<Resource::Buffer>           buffer;            // @brief Host visible Buffer.
+			VkDeviceSize                   size    = 0;       // @brief Recorded bytes.
+			uint32_t                       width   = 0;       // @brief Recorded width.
+			uint32_t                       height  = 0;       // @brief Recorded height.
+			uint64_t                       frame   = 0;       // @brief Recorded frame number.
+			bool                           pending = false;   // @brief Recorded and not yet resolved.
+		};
+
+		std::array<Slot, MaxFrameInFlight>  m_Slots;          // @brief Readback Slots.
+
+	};
+
+}
+
+#endif
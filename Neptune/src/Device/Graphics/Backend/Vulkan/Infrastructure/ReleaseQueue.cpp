@@ -0,0 +1,52 @@
+/**
+* @file ReleaseQueue.cpp.
+* @brief The ReleaseQueue Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "ReleaseQueue.h"
+
+namespace Neptune::Vulkan {
+
+    ReleaseQueue::ReleaseQueue(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {
+        NEPTUNE_PROFILE_ZONE
+    }
+
+    void ReleaseQueue::Release(SP<void> object)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (!object) return;
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        m_Retired[m_FrameIndex].push_back(std::move(object));
+    }
+
+    void ReleaseQueue::Recycle(uint32_t frameIndex)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::vector<SP<void>> retired;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            retired.swap(m_Retired[frameIndex]);
+
+            m_FrameIndex = frameIndex;
+        }
+
+        // Destroyed outside the lock, destructors may release again.
+        retired.clear();
+    }
+
+}
+
+#endif
@@ -0,0 +1,70 @@
+/**
+* @file ReleaseQueue.h.
+* @brief The ReleaseQueue Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+namespace Neptune::Vulkan {
+
+	using IReleaseQueue = IInfrastructure<class ReleaseQueue, EInfrastructure::ReleaseQueue>;
+
+	/**
+	* @brief Vulkan::ReleaseQueue Class.
+	* This class defines the Vulkan::ReleaseQueue behaves.
+	* Objects released while a frame is recorded are kept alive until that frame index is recycled,
+	* so commands in flight never reference a destroyed handle.
+	*/
+	class ReleaseQueue : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		ReleaseQueue(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~ReleaseQueue() override = default;
+
+		/**
+		* @brief Release an object, it is destroyed after frames in flight retired.
+		*
+		* @param[in] object Object, last reference is dropped by Recycle.
+		*/
+		void Release(SP<void> object);
+
+		/**
+		* @brief Destroy objects released while frame was recorded last time.
+		* Call after the fence of this frame was waited.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void Recycle(uint32_t frameIndex);
+
+	private:
+
+		std::array<std::vector<SP<void>>, MaxFrameInFlight>   m_Retired;               // @brief Objects released per frame.
+		uint32_t                                              m_FrameIndex = 0;        // @brief Frame index released objects belong to.
+		std::mutex                                            m_Mutex;                 // @brief Mutex of objects.
+
+	};
+
+}
+
+#endif
@@ -16,12 +16,30 @@
 namespace Neptune::Vulkan {
 
 	namespace {
-	
+
+		std::atomic<uint64_t> s_Frame       = 0;        // @brief Frame arenas allocate for.
+		std::atomic<uint64_t> s_Allocations = 0;        // @brief CommandBuffers allocated since start.
+		std::atomic<uint64_t> s_Acquires    = 0;        // @brief CommandBuffers acquired since start.
+		std::atomic<uint64_t> s_LastFrame   = 0;        // @brief CommandBuffers allocated at last BeginFrame.
+
 		/**
 		* @brief Thread CommandPool Thread ID.
 		*/
 		class ThreadID
 		{
+		public:
+
+			/**
+			* @brief Arena of one ThreadCommandPool.
+			*/
+			struct Slot
+			{
+				std::optional<UUID>                 id;                    // @brief Arena id.
+				WP<ThreadCommandPool::Arena>        arena;                 // @brief Cached Arena.
+				const ThreadCommandPool*            owner = nullptr;       // @brief ThreadCommandPool owns Arena.
+				WP<ThreadCommandPool>               guard;                 // @brief ThreadCommandPool Guard.
+			};
+
 		public:
 
 			/**
@@ -34,82 +52,36 @@ namespace Neptune::Vulkan {
 			*/
 			virtual ~ThreadID()
 			{
-				auto commandPool = m_Guard.lock();
-
-				if (!commandPool)
+				for (auto& slot : m_Slots)
 				{
-					return;
-				}
+					auto commandPool = slot.guard.lock();
 
-				if (m_GraphicId.has_value())     commandPool->Release(m_GraphicId.value());
-				if (m_ComputeId.has_value())     commandPool->Release(m_ComputeId.value());
-				if (m_TransferId.has_value())    commandPool->Release(m_TransferId.value());
-				if (m_VideoEncodeId.has_value()) commandPool->Release(m_VideoEncodeId.value());
-				if (m_VideoDecodeId.has_value()) commandPool->Release(m_VideoDecodeId.value());
-				if (m_OpticalFlowId.has_value()) commandPool->Release(m_OpticalFlowId.value());
-			}
-
-			/**
-			* @brief Get Thread CommandPool id.
-			* 
-			* @param[in] e EInfrastructure.
-			* 
-			* @return Returns Thread CommandPool id.
-			*/
-			const std::optional<UUID>& Id(EInfrastructure e) const
-			{
-				switch (e)
-				{
-					case EInfrastructure::GraphicThreadCommandPool:     return m_GraphicId;
-					case EInfrastructure::ComputeThreadCommandPool:     return m_ComputeId;
-					case EInfrastructure::TransferThreadCommandPool:    return m_TransferId;
-					case EInfrastructure::VideoEncodeThreadCommandPool: return m_VideoEncodeId;
-					case EInfrastructure::VideoDecodeThreadCommandPool: return m_VideoDecodeId;
-					case EInfrastructure::OpticalFlowThreadCommandPool: return m_OpticalFlowId;
-					default: return std::nullopt;
+					if (commandPool && slot.id.has_value())
+					{
+						commandPool->Release(slot.id.value());
+					}
 				}
 			}
 
 			/**
-			* @brief Set Thread CommandPool id.
+			* @brief Get Thread CommandPool slot.
 			*
-			* @param[in] id Thread CommandPool id.
 			* @param[in] e EInfrastructure.
-			*/
-			void SetId(const UUID& id, EInfrastructure e)
-			{
-				switch (e)
-				{
-					case EInfrastructure::GraphicThreadCommandPool:     m_GraphicId     = id; return;
-					case EInfrastructure::ComputeThreadCommandPool:     m_ComputeId     = id; return;
-					case EInfrastructure::TransferThreadCommandPool:    m_TransferId    = id; return;
-					case EInfrastructure::VideoEncodeThreadCommandPool: m_VideoEncodeId = id; return;
-					case EInfrastructure::VideoDecodeThreadCommandPool: m_VideoDecodeId = id; return;
-					case EInfrastructure::OpticalFlowThreadCommandPool: m_OpticalFlowId = id; return;
-					default: return;
-				}
-			}
-
-			/**
-			* @brief Set CommandPool Guard.
 			*
-			* @param[in] guard Thread CommandPool.
+			* @return Returns Thread CommandPool slot.
 			*/
-			void SetGuard(const SP<ThreadCommandPool>& guard)
+			Slot& Get(EInfrastructure e)
 			{
-				m_Guard = guard;
+				const auto index = static_cast<size_t>(e) - static_cast<size_t>(EInfrastructure::GraphicThreadCommandPool);
+
+				assert(index < m_Slots.size());
+
+				return m_Slots[index];
 			}
 
 		public:
 
-			std::optional<UUID> m_GraphicId;            // @brief Graphic Sub Thread CommandPool id.
-			std::optional<UUID> m_ComputeId;            // @brief Compute Sub Thread CommandPool id.
-			std::optional<UUID> m_TransferId;           // @brief Transfer Sub Thread CommandPool id.
-			std::optional<UUID> m_VideoEncodeId;        // @brief VideoEncode Sub Thread CommandPool id.
-			std::optional<UUID> m_VideoDecodeId;        // @brief VideoDecode Sub Thread CommandPool id.
-			std::optional<UUID> m_OpticalFlowId;        // @brief OpticalFlow Sub Thread CommandPool id.
-
-			WP<ThreadCommandPool> m_Guard;              // @brief ThreadCommandPool Guard.
+			std::array<Slot, 6> m_Slots;                // @brief Graphic, Compute, Transfer, VideoEncode, VideoDecode, OpticalFlow slots.
 		};
 
 		thread_local ThreadID s_TLSThreadID;            // @brief Thread id instance.
@@ -124,26 +96,62 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		auto id = s_TLSThreadID.Id(GetEInfrastructure());
+		return GetArena()->pool->GetHandle();
+	}
 
-		if (id.has_value())
+	SP<Unit::CommandBuffer> ThreadCommandPool::Acquire()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto frame = s_Frame.load(std::memory_order_acquire);
+
+		const auto arena = GetArena();
+		auto& segment = arena->segments[frame % MaxFrameInFlight];
+
+		if (!segment.pool)
 		{
-			return m_CommandPools[id.value()]->GetHandle();
+			segment.pool = Create(VK_COMMAND_POOL_CREATE_TRANSIENT_BIT);
+			segment.frame = frame;
 		}
 
-		UUID uuid;
+		// Buffers handed out earlier are waited by their owner before they return,
+		// so the whole pool resets once none is outstanding.
+		if (segment.frame != frame && segment.outstanding.load(std::memory_order_acquire) == 0)
+		{
+			segment.pool->Reset();
+			segment.used = 0;
+			segment.frame = frame;
+		}
 
-		s_TLSThreadID.SetId(uuid, GetEInfrastructure());
+		if (segment.used == segment.buffers.size())
+		{
+			VkCommandBufferAllocateInfo            allocInfo{};
+			allocInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+			allocInfo.commandPool                = segment.pool->GetHandle();
+			allocInfo.level                      = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+			allocInfo.commandBufferCount         = 1;
 
-		s_TLSThreadID.SetGuard(shared_from_this());
+			auto commandBuffer = CreateSP<Unit::CommandBuffer>();
 
-		auto commandPool = Create();
+			commandBuffer->CreateCommandBuffer(GetContext().Get<IDevice>()->Handle(), allocInfo);
 
-		std::unique_lock lock(m_Mutex);
+			DEBUGUTILS_SETOBJECTNAME(*commandBuffer, ToString())
 
-		m_CommandPools[uuid] = commandPool;
+			segment.buffers.push_back(commandBuffer);
 
-		return commandPool->GetHandle();
+			s_Allocations.fetch_add(1, std::memory_order_relaxed);
+		}
+
+		s_Acquires.fetch_add(1, std::memory_order_relaxed);
+
+		segment.outstanding.fetch_add(1, std::memory_order_relaxed);
+
+		auto& commandBuffer = segment.buffers[segment.used++];
+
+		// Arena is shared by the deleter, a CommandBuffer outliving its thread keeps the pool alive.
+		return SP<Unit::CommandBuffer>(commandBuffer.get(), [arena, &segment](Unit::CommandBuffer*) {
+			segment.outstanding.fetch_sub(1, std::memory_order_release);
+		});
 	}
 
 	void ThreadCommandPool::Release(UUID id)
@@ -152,16 +160,72 @@ namespace Neptune::Vulkan {
 
 		std::unique_lock lock(m_Mutex);
 
-		m_CommandPools.erase(id);
+		m_Arenas.erase(id);
+	}
+
+	uint64_t ThreadCommandPool::BeginFrame(uint64_t frameNumber)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		s_Frame.store(frameNumber, std::memory_order_release);
+
+		const auto allocations = s_Allocations.load(std::memory_order_relaxed);
+
+		return allocations - s_LastFrame.exchange(allocations, std::memory_order_relaxed);
+	}
+
+	uint64_t ThreadCommandPool::GetAllocationCount()
+	{
+		return s_Allocations.load(std::memory_order_relaxed);
+	}
+
+	uint64_t ThreadCommandPool::GetAcquireCount()
+	{
+		return s_Acquires.load(std::memory_order_relaxed);
+	}
+
+	SP<ThreadCommandPool::Arena> ThreadCommandPool::GetArena()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		auto& slot = s_TLSThreadID.Get(GetEInfrastructure());
+
+		// Steady state, no lock and no lookup.
+		if (slot.owner == this && !slot.guard.expired())
+		{
+			if (auto arena = slot.arena.lock())
+			{
+				return arena;
+			}
+		}
+
+		auto arena = CreateSP<Arena>();
+
+		arena->pool = Create(VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT);
+
+		UUID uuid;
+
+		{
+			std::unique_lock lock(m_Mutex);
+
+			m_Arenas[uuid] = arena;
+		}
+
+		slot.id    = uuid;
+		slot.arena = arena;
+		slot.owner = this;
+		slot.guard = shared_from_this();
+
+		return arena;
 	}
 
-	SP<Unit::CommandPool> ThreadCommandPool::Create() const
+	SP<Unit::CommandPool> ThreadCommandPool::Create(VkCommandPoolCreateFlags flags) const
 	{
 		NEPTUNE_PROFILE_ZONE
 
 		VkCommandPoolCreateInfo                   poolInfo{};
 		poolInfo.sType                          = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
-		poolInfo.flags                          = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+		poolInfo.flags                          = flags;
 		poolInfo.queueFamilyIndex               = GetQueueFamily();
 
 		auto commandPool = CreateSP<Unit::CommandPool>();
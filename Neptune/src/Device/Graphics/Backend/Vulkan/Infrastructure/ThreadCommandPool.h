@@ -11,9 +11,13 @@
 #include "Core/Core.h"
 #include "Infrastructure.h"
 #include "Device/Graphics/Backend/Vulkan/Unit/CommandPool.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/CommandBuffer.h"
 #include "Core/UUID.h"
 
+#include <array>
+#include <atomic>
 #include <unordered_map>
+#include <vector>
 
 namespace Neptune::Vulkan {
 
@@ -27,9 +31,34 @@ namespace Neptune::Vulkan {
 	/**
 	* @brief Vulkan::ThreadCommandPool Class.
 	* This class defines the Vulkan::ThreadCommandPool behaves.
+	* Each thread owns an arena of one CommandPool per frame slot, CommandBuffers acquired from
+	* a slot are handed back by resetting the whole pool once all of them were submitted and waited.
 	*/
 	class ThreadCommandPool : public Infrastructure, public std::enable_shared_from_this<ThreadCommandPool>
 	{
+	public:
+
+		/**
+		* @brief CommandBuffers of one frame slot.
+		*/
+		struct Segment
+		{
+			SP<Unit::CommandPool>                       pool;               // @brief Transient CommandPool.
+			std::vector<SP<Unit::CommandBuffer>>        buffers;            // @brief Allocated CommandBuffers.
+			uint32_t                                    used        = 0;    // @brief CommandBuffers handed out since reset.
+			uint64_t                                    frame       = 0;    // @brief Frame of last reset.
+			std::atomic<uint32_t>                       outstanding = 0;    // @brief CommandBuffers not yet returned.
+		};
+
+		/**
+		* @brief CommandPools of one thread.
+		*/
+		struct Arena
+		{
+			SP<Unit::CommandPool>                       pool;               // @brief CommandPool of Handle().
+			std::array<Segment, MaxFrameInFlight>       segments;           // @brief Frame slots.
+		};
+
 	public:
 
 		/**
@@ -52,6 +81,15 @@ namespace Neptune::Vulkan {
 		*/
 		const Unit::CommandPool::Handle& Handle();
 
+		/**
+		* @brief Acquire a primary CommandBuffer from this thread's arena.
+		* The CommandBuffer returns to the arena when the last reference is dropped,
+		* drop it only after its submission completed.
+		*
+		* @return Returns CommandBuffer.
+		*/
+		SP<Unit::CommandBuffer> Acquire();
+
 		/**
 		* @brief Release CommandPool Unit..
 		*
@@ -59,14 +97,46 @@ namespace Neptune::Vulkan {
 		*/
 		void Release(UUID id);
 
+		/**
+		* @brief Advance arenas to a new frame, called after the frame's fences were waited.
+		*
+		* @param[in] frameNumber Frames begun.
+		*
+		* @return Returns CommandBuffers allocated since last call.
+		*/
+		static uint64_t BeginFrame(uint64_t frameNumber);
+
+		/**
+		* @brief Get CommandBuffers allocated by all arenas since start.
+		*
+		* @return Returns CommandBuffers allocated.
+		*/
+		static uint64_t GetAllocationCount();
+
+		/**
+		* @brief Get CommandBuffers acquired from all arenas since start.
+		*
+		* @return Returns CommandBuffers acquired.
+		*/
+		static uint64_t GetAcquireCount();
+
 	private:
 
+		/**
+		* @brief Get this thread's Arena, create it on first use.
+		*
+		* @return Returns Arena.
+		*/
+		SP<Arena> GetArena();
+
 		/**
 		* @brief Create CommandPool.
 		*
+		* @param[in] flags VkCommandPoolCreateFlags.
+		*
 		* @return Returns CommandPool.
 		*/
-		SP<Unit::CommandPool> Create() const;
+		SP<Unit::CommandPool> Create(VkCommandPoolCreateFlags flags) const;
 
 		/**
 		* @brief Get CommandPool QueueFamily.
@@ -77,8 +147,8 @@ namespace Neptune::Vulkan {
 
 	private:
 
-		std::unordered_map<UUID, SP<Unit::CommandPool>> m_CommandPools;    // @brief Container of CommandPool.
-		std::mutex m_Mutex;                                                // @brief CommandPool mutex.
+		std::unordered_map<UUID, SP<Arena>> m_Arenas;                      // @brief Container of thread Arena.
+		std::mutex m_Mutex;                                                // @brief Arena mutex.
 	};
 
 }
@@ -0,0 +1,54 @@
+/**
+* @file TimelineSemaphore.cpp.
+* @brief The TimelineSemaphore Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "TimelineSemaphore.h"
+#include "Device.h"
+#include "DebugUtilsObject.h"
+
+namespace Neptune::Vulkan {
+
+    TimelineSemaphore::TimelineSemaphore(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        Create();
+    }
+
+    void TimelineSemaphore::Wait(uint64_t value) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_Semaphore.GetCounterValue() >= value) return;
+
+        m_Semaphore.Wait(value);
+    }
+
+    void TimelineSemaphore::Create()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        VkSemaphoreTypeCreateInfo          typeInfo{};
+        typeInfo.sType                   = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+        typeInfo.semaphoreType           = VK_SEMAPHORE_TYPE_TIMELINE;
+        typeInfo.initialValue            = 0;
+
+        VkSemaphoreCreateInfo              semaphoreInfo{};
+        semaphoreInfo.sType              = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+        semaphoreInfo.pNext              = &typeInfo;
+
+        m_Semaphore.CreateSemaphore(GetContext().Get<IDevice>()->Handle(), semaphoreInfo);
+
+        DEBUGUTILS_SETOBJECTNAME(m_Semaphore, ToString())
+    }
+
+}
+
+#endif
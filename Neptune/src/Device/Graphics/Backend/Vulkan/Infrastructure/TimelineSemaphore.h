@@ -0,0 +1,78 @@
+/**
+* @file TimelineSemaphore.h.
+* @brief The TimelineSemaphore Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/Semaphore.h"
+
+namespace Neptune::Vulkan {
+
+	using IGraphicTimelineSemaphore  = IInfrastructure<class TimelineSemaphore, EInfrastructure::GraphicTimelineSemaphore>;
+	using IComputeTimelineSemaphore  = IInfrastructure<class TimelineSemaphore, EInfrastructure::ComputeTimelineSemaphore>;
+
+	/**
+	* @brief Vulkan::TimelineSemaphore Class.
+	* This class defines the Vulkan::TimelineSemaphore behaves.
+	* Submission of frame N signals value N.
+	*/
+	class TimelineSemaphore : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		TimelineSemaphore(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~TimelineSemaphore() override = default;
+
+		/**
+		* @brief Get Unit Handle.
+		*
+		* @return Returns Unit Handle.
+		*/
+		const Unit::Semaphore::Handle& Handle() const { return m_Semaphore.GetHandle(); }
+
+		/**
+		* @brief Get completed value.
+		*
+		* @return Returns completed value.
+		*/
+		uint64_t Value() const { return m_Semaphore.GetCounterValue(); }
+
+		/**
+		* @brief Wait until value completed.
+		*
+		* @param[in] value Timeline value.
+		*/
+		void Wait(uint64_t value) const;
+
+	private:
+
+		/**
+		* @brief Create TimelineSemaphore.
+		*/
+		void Create();
+
+	private:
+
+		Unit::Semaphore m_Semaphore;    // @brief This Semaphore.
+
+	};
+
+}
+
+#endif
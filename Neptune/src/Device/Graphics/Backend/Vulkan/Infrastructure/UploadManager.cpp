@@ -0,0 +1,524 @@
+/**
+* @file UploadManager.cpp.
+* @brief The UploadManager Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "UploadManager.h"
+#include "Device.h"
+#include "PhysicalDevice.h"
+#include "ThreadQueue.h"
+#include "DebugUtilsObject.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/CommandBuffer.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/Queue.h"
+#include "Device/Graphics/Backend/Vulkan/Resource/Buffer.h"
+
+namespace Neptune::Vulkan {
+
+    UploadManager::UploadManager(Context& context, EInfrastructure e)
+        : Infrastructure(context, e)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        Create();
+    }
+
+    UploadManager::~UploadManager()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_Value == 0) return;
+
+        m_Timeline.Wait(m_Value);
+    }
+
+    UploadTicket UploadManager::UploadBuffer(VkBuffer dst, const void* data, VkDeviceSize size, VkDeviceSize offset, uint32_t family, bool concurrent)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        const auto staging = Allocate(size);
+
+        if (!staging.has_value())
+        {
+            NEPTUNE_CORE_ERROR("Upload is larger than staging ring.")
+            return 0;
+        }
+
+        memcpy(static_cast<char*>(m_Ring->Data()) + staging.value(), data, size);
+
+        m_Ring->Flush(size, staging.value());
+
+        BufferCopy                             copy{};
+        copy.dst                             = dst;
+        copy.region.srcOffset                = staging.value();
+        copy.region.dstOffset                = offset;
+        copy.region.size                     = size;
+        copy.family                          = family;
+        copy.concurrent                      = concurrent;
+
+        m_BufferCopies.push_back(copy);
+
+        return m_Value + 1;
+    }
+
+    UploadTicket UploadManager::UploadImage(VkImage dst, const void* data, VkDeviceSize size, const VkBufferImageCopy& region, VkImageLayout layout, uint32_t family)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        const auto staging = Allocate(size);
+
+        if (!staging.has_value())
+        {
+            NEPTUNE_CORE_ERROR("Upload is larger than staging ring.")
+            return 0;
+        }
+
+        memcpy(static_cast<char*>(m_Ring->Data()) + staging.value(), data, size);
+
+        m_Ring->Flush(size, staging.value());
+
+        ImageCopy                              copy{};
+        copy.dst                             = dst;
+        copy.region                          = region;
+        copy.region.bufferOffset             = staging.value();
+        copy.layout                          = layout;
+        copy.family                          = family;
+
+        m_ImageCopies.push_back(copy);
+
+        return m_Value + 1;
+    }
+
+    void UploadManager::Flush()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        Reclaim();
+
+        Submit();
+    }
+
+    uint64_t UploadManager::Acquire(const Unit::CommandBuffer& commandBuffer, uint32_t family)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        Acquisition acquisition;
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            auto it = m_Acquisitions.find(family);
+
+            if (it == m_Acquisitions.end() || it->second.value == 0) return 0;
+
+            std::swap(acquisition, it->second);
+
+            m_Acquired[family] = std::max(m_Acquired[family], acquisition.value);
+        }
+
+        const auto& buffers = acquisition.buffers;
+        const auto& images  = acquisition.images;
+
+        // Same family uploads need no barrier, only the timeline wait.
+        if (!buffers.empty() || !images.empty())
+        {
+            VkDependencyInfo                          dependencyInfo{};
+            dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+            dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(buffers.size());
+            dependencyInfo.pBufferMemoryBarriers    = buffers.data();
+            dependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>(images.size());
+            dependencyInfo.pImageMemoryBarriers     = images.data();
+
+            commandBuffer.PipelineBarrier2(dependencyInfo);
+        }
+
+        return acquisition.value;
+    }
+
+    uint64_t UploadManager::TakeAcquired(uint32_t family)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::unique_lock<std::mutex> lock(m_Mutex);
+
+        auto it = m_Acquired.find(family);
+
+        if (it == m_Acquired.end()) return 0;
+
+        return std::exchange(it->second, 0);
+    }
+
+    bool UploadManager::IsComplete(UploadTicket ticket) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        return m_Timeline.GetCounterValue() >= ticket;
+    }
+
+    void UploadManager::Wait(UploadTicket ticket)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+
+            if (ticket > m_Value)
+            {
+                Submit();
+            }
+        }
+
+        if (IsComplete(ticket)) return;
+
+        m_Timeline.Wait(ticket);
+    }
+
+    void UploadManager::Create()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const auto& device = GetContext().Get<IDevice>()->Handle();
+
+        const auto& families = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies();
+
+        m_TransferFamily = families.transfer.value();
+
+        // Only these families are drained by Acquire, see RenderBackend::BeginFrame.
+        m_Acquisitions[families.graphic.value()];
+        m_Acquisitions[families.compute.value()];
+
+        {
+            VkBufferCreateInfo                     bufferInfo{};
+            bufferInfo.sType                     = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+            bufferInfo.size                      = StagingRingSize;
+            bufferInfo.usage                     = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+            bufferInfo.sharingMode               = VK_SHARING_MODE_EXCLUSIVE;
+
+            m_Ring = CreateSP<Resource::Buffer>(GetContext());
+
+            m_Ring->CreateBuffer(bufferInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+
+            m_Ring->SetName("StagingRing");
+        }
+
+        {
+            VkCommandPoolCreateInfo                poolInfo{};
+            poolInfo.sType                       = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+            poolInfo.flags                       = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+            poolInfo.queueFamilyIndex            = m_TransferFamily;
+
+            m_CommandPool.CreateCommandPool(device, poolInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(m_CommandPool, ToString())
+        }
+
+        {
+            VkSemaphoreTypeCreateInfo              typeInfo{};
+            typeInfo.sType                       = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+            typeInfo.semaphoreType               = VK_SEMAPHORE_TYPE_TIMELINE;
+            typeInfo.initialValue                = 0;
+
+            VkSemaphoreCreateInfo                  semaphoreInfo{};
+            semaphoreInfo.sType                  = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+            semaphoreInfo.pNext                  = &typeInfo;
+
+            m_Timeline.CreateSemaphore(device, semaphoreInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(m_Timeline, ToString())
+        }
+    }
+
+    std::optional<VkDeviceSize> UploadManager::Allocate(VkDeviceSize size)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (size > StagingRingSize) return std::nullopt;
+
+        while (true)
+        {
+            Reclaim();
+
+            VkDeviceSize begin = (m_Head + StagingAlignment - 1) & ~(StagingAlignment - 1);
+
+            // Allocations never straddle the end of the ring, skip to the next lap.
+            if (begin % StagingRingSize + size > StagingRingSize)
+            {
+                begin = (begin / StagingRingSize + 1) * StagingRingSize;
+            }
+
+            if (begin + size - m_Tail <= StagingRingSize)
+            {
+                m_Head = begin + size;
+
+                return begin % StagingRingSize;
+            }
+
+            if (!m_Batches.empty())
+            {
+                m_Timeline.Wait(m_Batches.front().value);
+            }
+            else
+            {
+                // Ring is held by queued uploads only, submit them to make progress.
+                Submit();
+            }
+        }
+    }
+
+    void UploadManager::Reclaim()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const uint64_t completed = m_Timeline.GetCounterValue();
+
+        while (!m_Batches.empty() && m_Batches.front().value <= completed)
+        {
+            m_Tail = m_Batches.front().end;
+
+            m_FreeCommandBuffers.push_back(m_Batches.front().commandBuffer);
+
+            m_Batches.pop_front();
+        }
+
+        if (m_Batches.empty() && m_BufferCopies.empty() && m_ImageCopies.empty())
+        {
+            m_Head = 0;
+            m_Tail = 0;
+        }
+    }
+
+    void UploadManager::Submit()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_BufferCopies.empty() && m_ImageCopies.empty()) return;
+
+        SP<Unit::CommandBuffer> commandBuffer;
+
+        if (m_FreeCommandBuffers.empty())
+        {
+            VkCommandBufferAllocateInfo            allocInfo{};
+            allocInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+            allocInfo.commandPool                = m_CommandPool.GetHandle();
+            allocInfo.level                      = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+            allocInfo.commandBufferCount         = 1;
+
+            commandBuffer = CreateSP<Unit::CommandBuffer>();
+
+            commandBuffer->CreateCommandBuffer(GetContext().Get<IDevice>()->Handle(), allocInfo);
+
+            DEBUGUTILS_SETOBJECTNAME(*commandBuffer, ToString())
+        }
+        else
+        {
+            commandBuffer = m_FreeCommandBuffers.back();
+
+            m_FreeCommandBuffers.pop_back();
+        }
+
+        const uint64_t value = m_Value + 1;
+
+        std::unordered_map<uint32_t, Acquisition> acquisitions;
+
+        std::vector<VkImageMemoryBarrier2>  transfers;
+        std::vector<VkBufferMemoryBarrier2> bufferReleases;
+        std::vector<VkImageMemoryBarrier2>  imageReleases;
+
+        for (const auto& copy : m_ImageCopies)
+        {
+            VkImageMemoryBarrier2                     barrier{};
+            barrier.sType                           = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+            barrier.srcStageMask                    = VK_PIPELINE_STAGE_2_NONE;
+            barrier.srcAccessMask                   = VK_ACCESS_2_NONE;
+            barrier.dstStageMask                    = VK_PIPELINE_STAGE_2_COPY_BIT;
+            barrier.dstAccessMask                   = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            barrier.oldLayout                       = VK_IMAGE_LAYOUT_UNDEFINED;
+            barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.srcQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.dstQueueFamilyIndex             = VK_QUEUE_FAMILY_IGNORED;
+            barrier.image                           = copy.dst;
+            barrier.subresourceRange.aspectMask     = copy.region.imageSubresource.aspectMask;
+            barrier.subresourceRange.baseMipLevel   = copy.region.imageSubresource.mipLevel;
+            barrier.subresourceRange.levelCount     = 1;
+            barrier.subresourceRange.baseArrayLayer = copy.region.imageSubresource.baseArrayLayer;
+            barrier.subresourceRange.layerCount     = copy.region.imageSubresource.layerCount;
+
+            transfers.push_back(barrier);
+
+            if (copy.family == VK_QUEUE_FAMILY_IGNORED)
+            {
+                barrier.srcStageMask                = VK_PIPELINE_STAGE_2_COPY_BIT;
+                barrier.srcAccessMask               = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+                barrier.dstStageMask                = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                barrier.dstAccessMask               = VK_ACCESS_2_NONE;
+                barrier.oldLayout                   = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+                barrier.newLayout                   = copy.layout;
+
+                imageReleases.push_back(barrier);
+                continue;
+            }
+
+            auto& acquisition = acquisitions[copy.family];
+
+            barrier.srcStageMask                    = VK_PIPELINE_STAGE_2_COPY_BIT;
+            barrier.srcAccessMask                   = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            barrier.oldLayout                       = VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL;
+            barrier.newLayout                       = copy.layout;
+
+            if (copy.family == m_TransferFamily)
+            {
+                // Same family, the timeline wait of the consumer makes writes visible.
+                barrier.dstStageMask                = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+                barrier.dstAccessMask               = VK_ACCESS_2_NONE;
+
+                imageReleases.push_back(barrier);
+                continue;
+            }
+
+            barrier.dstStageMask                    = VK_PIPELINE_STAGE_2_NONE;
+            barrier.dstAccessMask                   = VK_ACCESS_2_NONE;
+            barrier.srcQueueFamilyIndex             = m_TransferFamily;
+            barrier.dstQueueFamilyIndex             = copy.family;
+
+            imageReleases.push_back(barrier);
+
+            barrier.srcStageMask                    = VK_PIPELINE_STAGE_2_NONE;
+            barrier.srcAccessMask                   = VK_ACCESS_2_NONE;
+            barrier.dstStageMask                    = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            barrier.dstAccessMask                   = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+            acquisition.images.push_back(barrier);
+        }
+
+        for (const auto& copy : m_BufferCopies)
+        {
+            if (copy.family == VK_QUEUE_FAMILY_IGNORED) continue;
+
+            auto& acquisition = acquisitions[copy.family];
+
+            // Concurrent Buffers are never owned, the timeline wait of the consumer alone makes writes visible.
+            if (copy.family == m_TransferFamily || copy.concurrent) continue;
+
+            VkBufferMemoryBarrier2                 barrier{};
+            barrier.sType                        = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+            barrier.srcStageMask                 = VK_PIPELINE_STAGE_2_COPY_BIT;
+            barrier.srcAccessMask                = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+            barrier.dstStageMask                 = VK_PIPELINE_STAGE_2_NONE;
+            barrier.dstAccessMask                = VK_ACCESS_2_NONE;
+            barrier.srcQueueFamilyIndex          = m_TransferFamily;
+            barrier.dstQueueFamilyIndex          = copy.family;
+            barrier.buffer                       = copy.dst;
+            barrier.offset                       = copy.region.dstOffset;
+            barrier.size                         = copy.region.size;
+
+            bufferReleases.push_back(barrier);
+
+            barrier.srcStageMask                 = VK_PIPELINE_STAGE_2_NONE;
+            barrier.srcAccessMask                = VK_ACCESS_2_NONE;
+            barrier.dstStageMask                 = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+            barrier.dstAccessMask                = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+
+            acquisition.buffers.push_back(barrier);
+        }
+
+        {
+            VkCommandBufferBeginInfo               beginInfo{};
+            beginInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+            beginInfo.flags                      = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+
+            commandBuffer->Begin(beginInfo);
+
+            if (!transfers.empty())
+            {
+                VkDependencyInfo                         dependencyInfo{};
+                dependencyInfo.sType                   = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+                dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>(transfers.size());
+                dependencyInfo.pImageMemoryBarriers    = transfers.data();
+
+                commandBuffer->PipelineBarrier2(dependencyInfo);
+            }
+
+            for (const auto& copy : m_BufferCopies)
+            {
+                commandBuffer->CopyBuffer(m_Ring->Handle(), copy.dst, copy.region);
+            }
+
+            for (const auto& copy : m_ImageCopies)
+            {
+                commandBuffer->CopyBufferToImage(m_Ring->Handle(), copy.dst, copy.region);
+            }
+
+            if (!bufferReleases.empty() || !imageReleases.empty())
+            {
+                VkDependencyInfo                          dependencyInfo{};
+                dependencyInfo.sType                    = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+                dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>(bufferReleases.size());
+                dependencyInfo.pBufferMemoryBarriers    = bufferReleases.data();
+                dependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>(imageReleases.size());
+                dependencyInfo.pImageMemoryBarriers     = imageReleases.data();
+
+                commandBuffer->PipelineBarrier2(dependencyInfo);
+            }
+
+            commandBuffer->End();
+        }
+
+        {
+            VkTimelineSemaphoreSubmitInfo            timelineInfo{};
+            timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+            timelineInfo.signalSemaphoreValueCount = 1;
+            timelineInfo.pSignalSemaphoreValues    = &value;
+
+            VkSubmitInfo                           submitInfo{};
+            submitInfo.sType                     = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+            submitInfo.pNext                     = &timelineInfo;
+            submitInfo.commandBufferCount        = 1;
+            submitInfo.pCommandBuffers           = &commandBuffer->GetHandle();
+            submitInfo.signalSemaphoreCount      = 1;
+            submitInfo.pSignalSemaphores         = &m_Timeline.GetHandle();
+
+            auto queue = GetContext().Get<ITransferThreadQueue>()->Pop();
+
+            queue->Submit(submitInfo);
+
+            GetContext().Get<ITransferThreadQueue>()->Push(queue);
+        }
+
+        for (auto& [family, acquisition] : acquisitions)
+        {
+            auto it = m_Acquisitions.find(family);
+
+            // No consumer acquires this family, e.g. the transfer family itself, the timeline alone orders it.
+            if (it == m_Acquisitions.end()) continue;
+
+            // Pending barriers of a family are merged, so entries never outgrow the consumer families.
+            auto& pending = it->second;
+
+            pending.value = value;
+            pending.buffers.insert(pending.buffers.end(), acquisition.buffers.begin(), acquisition.buffers.end());
+            pending.images .insert(pending.images .end(), acquisition.images .begin(), acquisition.images .end());
+        }
+
+        assert(m_Acquisitions.size() <= 2);
+
+        m_Batches.push_back({ commandBuffer, value, m_Head });
+
+        m_Value = value;
+
+        m_BufferCopies.clear();
+        m_ImageCopies.clear();
+    }
+
+}
+
+#endif
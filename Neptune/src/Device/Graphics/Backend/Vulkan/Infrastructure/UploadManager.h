@@ -0,0 +1,230 @@
+/**
+* @file UploadManager.h.
+* @brief The UploadManager Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Infrastructure.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/CommandPool.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/Semaphore.h"
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::Vulkan {
+
+	namespace Unit {
+
+		class CommandBuffer;
+	}
+
+	namespace Resource {
+
+		class Buffer;
+	}
+
+	using IUploadManager = IInfrastructure<class UploadManager, EInfrastructure::UploadManager>;
+
+	/**
+	* @brief Completion ticket of an upload, the transfer timeline value signaled by its batch.
+	*/
+	using UploadTicket = uint64_t;
+
+	/**
+	* @brief Vulkan::UploadManager Class.
+	* This class defines the Vulkan::UploadManager behaves.
+	* Uploads are copied into a persistently mapped staging ring and coalesced into one
+	* transfer queue submission on Flush. Destinations owned by another queue family are
+	* released by the transfer queue and acquired by the destination queue with Acquire.
+	*/
+	class UploadManager : public Infrastructure
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] e EInfrastructure.
+		*/
+		UploadManager(Context& context, EInfrastructure e);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~UploadManager() override;
+
+		/**
+		* @brief Get transfer timeline Handle.
+		*
+		* @return Returns transfer timeline Handle.
+		*/
+		const Unit::Semaphore::Handle& Handle() const { return m_Timeline.GetHandle(); }
+
+		/**
+		* @brief Queue a Buffer upload.
+		*
+		* @param[in] dst Destination Buffer.
+		* @param[in] data Host data.
+		* @param[in] size Data bytes.
+		* @param[in] offset Destination offset.
+		* @param[in] family Queue family using the Buffer first, its submission waits the upload.
+		* @param[in] concurrent Buffer is created with VK_SHARING_MODE_CONCURRENT, ownership is not transferred.
+		*
+		* @return Returns UploadTicket, 0 if data is larger than the staging ring.
+		*/
+		UploadTicket UploadBuffer(VkBuffer dst, const void* data, VkDeviceSize size, VkDeviceSize offset, uint32_t family, bool concurrent = false);
+
+		/**
+		* @brief Queue an Image upload, bufferOffset of region is filled by the staging ring.
+		*
+		* @param[in] dst Destination Image, content is discarded.
+		* @param[in] data Host data.
+		* @param[in] size Data bytes.
+		* @param[in] region VkBufferImageCopy.
+		* @param[in] layout Layout of the Image after upload.
+		* @param[in] family Queue family using the Image.
+		*
+		* @return Returns UploadTicket, 0 if data is larger than the staging ring.
+		*/
+		UploadTicket UploadImage(VkImage dst, const void* data, VkDeviceSize size, const VkBufferImageCopy& region, VkImageLayout layout, uint32_t family);
+
+		/**
+		* @brief Submit queued uploads in one transfer submission.
+		*/
+		void Flush();
+
+		/**
+		* @brief Record acquire barriers of released uploads for a queue family.
+		*
+		* @param[in] commandBuffer Unit::CommandBuffer of the queue family.
+		* @param[in] family Queue family.
+		*
+		* @return Returns timeline value the submission must wait, 0 if nothing was acquired.
+		*/
+		uint64_t Acquire(const Unit::CommandBuffer& commandBuffer, uint32_t family);
+
+		/**
+		* @brief Take the highest timeline value acquired by a queue family since last call.
+		* Acquire may be called by several recorders of one submission, the submission waits this value.
+		*
+		* @param[in] family Queue family.
+		*
+		* @return Returns timeline value the submission must wait, 0 if nothing was acquired.
+		*/
+		uint64_t TakeAcquired(uint32_t family);
+
+		/**
+		* @brief Is an upload completed.
+		*
+		* @param[in] ticket UploadTicket.
+		*
+		* @return Returns true if completed.
+		*/
+		bool IsComplete(UploadTicket ticket) const;
+
+		/**
+		* @brief Wait an upload completed, flush it if still queued.
+		*
+		* @param[in] ticket UploadTicket.
+		*/
+		void Wait(UploadTicket ticket);
+
+	private:
+
+		/**
+		* @brief Create UploadManager.
+		*/
+		void Create();
+
+		/**
+		* @brief Allocate staging ring space, submit or wait batches if full.
+		*
+		* @param[in] size Bytes.
+		*
+		* @return Returns ring offset, nullopt if size is larger than the ring.
+		*/
+		std::optional<VkDeviceSize> Allocate(VkDeviceSize size);
+
+		/**
+		* @brief Release ring space and CommandBuffers of completed batches.
+		*/
+		void Reclaim();
+
+		/**
+		* @brief Record and submit queued uploads.
+		*/
+		void Submit();
+
+	private:
+
+		/**
+		* @brief Queued Buffer copy.
+		*/
+		struct BufferCopy
+		{
+			VkBuffer                       dst;               // @brief Destination Buffer.
+			VkBufferCopy                   region;            // @brief Copy region.
+			uint32_t                       family;            // @brief Destination queue family.
+			bool                           concurrent;        // @brief Destination is shared by queue families.
+		};
+
+		/**
+		* @brief Queued Image copy.
+		*/
+		struct ImageCopy
+		{
+			VkImage                        dst;               // @brief Destination Image.
+			VkBufferImageCopy              region;            // @brief Copy region.
+			VkImageLayout                  layout;            // @brief Final layout.
+			uint32_t                       family;            // @brief Destination queue family.
+		};
+
+		/**
+		* @brief Submitted batch.
+		*/
+		struct Batch
+		{
+			SP<Unit::CommandBuffer>        commandBuffer;     // @brief Recorded CommandBuffer.
+			uint64_t                       value;             // @brief Timeline value signaled.
+			VkDeviceSize                   end;               // @brief Ring head when submitted.
+		};
+
+		/**
+		* @brief Acquire barriers of batches not yet acquired.
+		*/
+		struct Acquisition
+		{
+			uint64_t                                value = 0;  // @brief Timeline value of the last batch, 0 if none.
+			std::vector<VkBufferMemoryBarrier2>     buffers;  // @brief Buffer acquire barriers.
+			std::vector<VkImageMemoryBarrier2>      images;   // @brief Image acquire barriers.
+		};
+
+		SP<Resource::Buffer>                                    m_Ring;                      // @brief Staging ring.
+		VkDeviceSize                                            m_Head = 0;                  // @brief Bytes ever allocated, ring offset is modulo size.
+		VkDeviceSize                                            m_Tail = 0;                  // @brief Bytes ever released.
+		Unit::CommandPool                                       m_CommandPool;               // @brief Transfer CommandPool.
+		std::vector<SP<Unit::CommandBuffer>>                    m_FreeCommandBuffers;        // @brief Reusable CommandBuffers.
+		Unit::Semaphore                                         m_Timeline;                  // @brief Transfer timeline.
+		uint64_t                                                m_Value = 0;                 // @brief Last submitted timeline value.
+		uint32_t                                                m_TransferFamily = 0;        // @brief Transfer queue family.
+		std::vector<BufferCopy>                                 m_BufferCopies;              // @brief Queued Buffer copies.
+		std::vector<ImageCopy>                                  m_ImageCopies;               // @brief Queued Image copies.
+		std::deque<Batch>                                       m_Batches;                   // @brief In flight batches.
+		std::unordered_map<uint32_t, Acquisition>               m_Acquisitions;              // @brief Pending acquires of graphic and compute families.
+		std::unordered_map<uint32_t, uint64_t>                  m_Acquired;                  // @brief Values acquired and not yet taken per family.
+		std::mutex                                              m_Mutex;                     // @brief Mutex of uploads.
+
+	};
+
+}
+
+#endif
@@ -10,12 +10,18 @@
 
 #include "CmdList.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/CommandBuffer.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/BindLessHeap.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/RenderPass.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/Pipeline.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/DescriptorList.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/GPUScene.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/RenderTarget.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/PhysicalDevice.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/UploadManager.h"
 #include "Device/Graphics/Backend/Vulkan/Resource/VideoSession.h"
 #include "Device/Graphics/Backend/Vulkan/Resource/QueryPool.h"
 #include "Device/Graphics/Frontend/RHI/RenderPass.h"
+#include "Render/Frontend/Visibility/Frustum.h"
 #include "Data/Clock.h"
 
 namespace Neptune::Vulkan {
@@ -24,6 +30,8 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Reset();
+
 		m_FrameIndex = clock.m_FrameIndex;
 		m_ImageIndex = clock.m_ImageIndex;
 
@@ -32,6 +40,20 @@ namespace Neptune::Vulkan {
 		m_BindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 	}
 
+	void CmdList::SetComputeCmdList(const Data::Clock& clock)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_StateTracker.Reset();
+
+		m_FrameIndex = clock.m_FrameIndex;
+		m_ImageIndex = clock.m_ImageIndex;
+
+		m_CommandBuffer = GetContext().Get<IComputeCommandBuffer>()->IHandle(m_FrameIndex);
+
+		m_BindPoint = VK_PIPELINE_BIND_POINT_COMPUTE;
+	}
+
 	void* CmdList::GetCommandList() const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -43,6 +65,8 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Flush(*m_CommandBuffer);
+
 		m_RenderPass->BeginRenderPass(m_CommandBuffer.get(), m_ImageIndex);
 	}
 
@@ -63,12 +87,17 @@ namespace Neptune::Vulkan {
 
 		for (const auto& [fst, snd] : sharedRhi->GetSets())
 		{
-			m_CommandBuffer->BindDescriptorSet(m_BindPoint, m_PipelineLayout, fst, snd->Handle());
+			m_CommandBuffer->BindDescriptorSet(m_BindPoint, m_PipelineLayout, fst, snd->FrameHandle());
 		}
 
 		for (const auto& [fst, snd] : rhi->GetSets())
 		{
-			m_CommandBuffer->BindDescriptorSet(m_BindPoint, m_PipelineLayout, fst, snd->Handle());
+			m_CommandBuffer->BindDescriptorSet(m_BindPoint, m_PipelineLayout, fst, snd->FrameHandle());
+		}
+
+		if (const auto& set = rhi->GetBindLessSet())
+		{
+			m_CommandBuffer->BindDescriptorSet(m_BindPoint, m_PipelineLayout, *set, GetContext().Get<IBindLessHeap>()->Handle());
 		}
 	}
 
@@ -89,9 +118,20 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Flush(*m_CommandBuffer);
+
 		m_CommandBuffer->Draw(3, 1, 0, 0);
 	}
 
+	void CmdList::CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_StateTracker.Flush(*m_CommandBuffer);
+
+		m_CommandBuffer->Draw(vertexCount, instanceCount, firstVertex, firstInstance);
+	}
+
 	void CmdList::CmdSetViewport(const glm::vec2& viewPortSize) const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -117,173 +157,186 @@ namespace Neptune::Vulkan {
 		m_CommandBuffer->SetScissor(scissor);
 	}
 
-	void CmdList::SetRenderPass(const SP<RHI::RenderPass>& renderPass)
+	void CmdList::CmdPushConstants(const void* data, uint32_t bytes) const
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		m_RenderPass = renderPass->GetRHIImpl<RenderPass>();
+		assert(bytes <= PushConstantSize);
+
+		m_CommandBuffer->PushConstants(m_PipelineLayout, VK_SHADER_STAGE_ALL, 0, bytes, data);
 	}
 
-	void CmdList::SetQueryPool(const SP<Resource::QueryPool>& queryPool)
+	void CmdList::CmdCullGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		m_QueryPool = queryPool.get();
-	}
+		auto rhi = scene->GetRHIImpl<GPUScene>();
 
-	void CmdList::CmdCopyImage(VkImage src, VkImage dst, const VkImageCopy& region) const
-	{
-		NEPTUNE_PROFILE_ZONE
+		if (!rhi->IsReady()) return;
 
-		m_CommandBuffer->CopyImage(src, dst, region);
+		rhi->Prepare(m_FrameIndex);
+
+		const auto& families = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies();
+
+		const bool compute = m_BindPoint == VK_PIPELINE_BIND_POINT_COMPUTE;
+
+		// Uploads are submitted in Prepare, UploadManager keeps the acquired value until the submission of this queue takes it in RenderBackend::EndFrame.
+		GetContext().Get<IUploadManager>()->Acquire(*m_CommandBuffer, compute ? families.compute.value() : families.graphic.value());
+
+		const auto& instances = rhi->GetInstances();
+		const auto& commands  = rhi->GetCommands(m_FrameIndex);
+		const auto& count     = rhi->GetCount(m_FrameIndex);
+
+		if (const auto regions = rhi->StageInstances(m_FrameIndex); !regions.empty())
+		{
+			// Instances are shared by frames in flight, the first access of this CommandBuffer waits their reads before overwrite.
+			m_StateTracker.AccessBuffer(instances.get(), VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+			m_StateTracker.Flush(*m_CommandBuffer);
+
+			for (const auto& region : regions)
+			{
+				m_CommandBuffer->CopyBuffer(rhi->GetStaging(m_FrameIndex)->Handle(), instances->Handle(), region);
+			}
+		}
+
+		m_StateTracker.AccessBuffer(count.get(), VK_PIPELINE_STAGE_2_CLEAR_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+		m_StateTracker.Flush(*m_CommandBuffer);
+
+		m_CommandBuffer->FillBuffer(count->Handle(), 0, sizeof(uint32_t), 0);
+
+		m_StateTracker.AccessBuffer(instances.get(), VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+		m_StateTracker.AccessBuffer(commands.get(),  VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT);
+		m_StateTracker.AccessBuffer(count.get(),     VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT | VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT);
+		m_StateTracker.Flush(*m_CommandBuffer);
+
+		const auto frustum = Render::Frustum::FromMatrix(viewProjection);
+
+		ShaderCommon::MeshCullConstant         push{};
+		push.descAddress                     = rhi->GetDescAddress(m_FrameIndex);
+		push.nInstances                      = rhi->GetInstanceCount();
+		push.viewPosition                    = glm::vec4(viewPosition, 1.0f);
+
+		std::copy(frustum.planes.begin(), frustum.planes.end(), push.planes);
+
+		m_CommandBuffer->BindPipeline(VK_PIPELINE_BIND_POINT_COMPUTE, rhi->GetCullPipeline());
+		m_CommandBuffer->PushConstants(rhi->GetCullPipelineLayout(), VK_SHADER_STAGE_ALL, 0, sizeof(push), &push);
+		m_CommandBuffer->Dispatch((push.nInstances + ShaderCommon::MESH_CULL_GROUP_SIZE - 1) / ShaderCommon::MESH_CULL_GROUP_SIZE, 1, 1);
+
+		// On the compute queue the graphic submission waits the compute timeline instead.
+		if (compute) return;
+
+		// Declared here so they flush before the next RenderPass begins, not inside it.
+		m_StateTracker.AccessBuffer(commands.get(),  VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT);
+		m_StateTracker.AccessBuffer(count.get(),     VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT);
+		m_StateTracker.AccessBuffer(instances.get(), VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
 	}
 
-	void CmdList::CmdPipelineBarrier(VkPipelineStageFlags srcMask, VkPipelineStageFlags dstMask, const VkImageMemoryBarrier& barrier) const
+	void CmdList::CmdDrawGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection) const
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		m_CommandBuffer->PipelineBarrier(srcMask, dstMask, barrier);
+		auto rhi = scene->GetRHIImpl<GPUScene>();
+
+		if (!rhi->IsReady()) return;
+
+		ShaderCommon::MeshDrawConstant         push{};
+		push.descAddress                     = rhi->GetDescAddress(m_FrameIndex);
+		push.viewProjection                  = viewProjection;
+
+		m_StateTracker.Flush(*m_CommandBuffer);
+
+		m_CommandBuffer->PushConstants(m_PipelineLayout, VK_SHADER_STAGE_ALL, 0, sizeof(push), &push);
+		m_CommandBuffer->BindIndexBuffer(rhi->GetIndices()->Handle(), 0, VK_INDEX_TYPE_UINT32);
+		m_CommandBuffer->DrawIndexedIndirectCount(
+			rhi->GetCommands(m_FrameIndex)->Handle(), 0, 
+			rhi->GetCount(m_FrameIndex)->Handle(), 0, 
+			rhi->GetInstanceCount(), 
+			sizeof(ShaderCommon::DrawIndexedCommand)
+		);
 	}
 
-	void CmdList::CmdTransitionLayout(SP<Resource::Image> image, VkImageLayout newLayout) const
+	void CmdList::CmdBlitRenderTarget(const SP<RHI::RenderTarget>& src, const SP<RHI::RenderTarget>& dst, const glm::vec2& extent) const
 	{
 		NEPTUNE_PROFILE_ZONE
-		
-		VkPipelineStageFlags sourceStage;
-		VkPipelineStageFlags destinationStage;
-
-		auto oldLayout = image->GetLayout();
-
-		VkImageMemoryBarrier                           barrier{};
-		barrier.sType                                = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER;
-		barrier.oldLayout                            = oldLayout;
-		barrier.newLayout                            = newLayout;
-		barrier.srcQueueFamilyIndex                  = VK_QUEUE_FAMILY_IGNORED;
-		barrier.dstQueueFamilyIndex                  = VK_QUEUE_FAMILY_IGNORED;
-		barrier.image                                = image->Handle();
-		barrier.subresourceRange.aspectMask          = VK_IMAGE_ASPECT_COLOR_BIT;
-		barrier.subresourceRange.baseMipLevel        = 0;
-		barrier.subresourceRange.levelCount          = 1;
-		barrier.subresourceRange.baseArrayLayer      = 0;
-		barrier.subresourceRange.layerCount          = image->GetLayerCount();
-		barrier.srcAccessMask                        = 0;
-		barrier.dstAccessMask                        = 0;
-
-		if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL) 
-		{
-			barrier.srcAccessMask = 0;
-			barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
 
-			// Don't care what stage the pipeline is in at the start.
-			sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		auto srcRhi = src->GetRHIImpl<RenderTarget>();
+		auto dstRhi = dst->GetRHIImpl<RenderTarget>();
 
-			// Used for copying
-			destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL)
-		{
-			barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-			barrier.dstAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
+		const auto width  = static_cast<int32_t>(std::min({ static_cast<uint32_t>(extent.x), srcRhi->GetWidth(),  dstRhi->GetWidth()  }));
+		const auto height = static_cast<int32_t>(std::min({ static_cast<uint32_t>(extent.y), srcRhi->GetHeight(), dstRhi->GetHeight() }));
 
-			// Don't care what stage the pipeline is in at the start.
-			sourceStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		if (width <= 0 || height <= 0) return;
 
-			// Used for copying
-			destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL)
-		{
-			barrier.srcAccessMask = VK_ACCESS_SHADER_READ_BIT;
-			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		// Passes leave RenderTargets in ColorAttachment layout, dst content is overwritten.
+		m_StateTracker.TransitionImage(srcRhi->Handle(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL);
+		m_StateTracker.TransitionImage(dstRhi->Handle(), VK_IMAGE_LAYOUT_UNDEFINED,                VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		m_StateTracker.Flush(*m_CommandBuffer);
 
-			// Don't care what stage the pipeline is in at the start.
-			sourceStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
+		VkImageBlit                            region{};
+		region.srcSubresource                = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+		region.srcOffsets[1]                 = { width, height, 1 };
+		region.dstSubresource                = { VK_IMAGE_ASPECT_COLOR_BIT, 0, 0, 1 };
+		region.dstOffsets[1]                 = { width, height, 1 };
 
-			// Used for copying
-			destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL) 
-		{
-			barrier.srcAccessMask = 0;
-			barrier.dstAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
+		// Same extent on both sides, nearest only converts the format.
+		m_CommandBuffer->BlitImage(srcRhi->Handle(), dstRhi->Handle(), region, VK_FILTER_NEAREST);
 
-			// Don't care what stage the pipeline is in at the start.
-			sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		m_StateTracker.TransitionImage(srcRhi->Handle(), VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+		m_StateTracker.TransitionImage(dstRhi->Handle(), VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+		m_StateTracker.Flush(*m_CommandBuffer);
+	}
 
-			// Used for copying
-			destinationStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL)
-		{
-			barrier.srcAccessMask = 0;
-			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+	void CmdList::SetRenderPass(const SP<RHI::RenderPass>& renderPass)
+	{
+		NEPTUNE_PROFILE_ZONE
 
-			// Don't care what stage the pipeline is in at the start.
-			sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+		m_RenderPass = renderPass->GetRHIImpl<RenderPass>();
+	}
 
-			// Used for sampling.
-			destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) 
-		{
-			barrier.srcAccessMask = VK_ACCESS_TRANSFER_WRITE_BIT;
-			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+	void CmdList::SetQueryPool(const SP<Resource::QueryPool>& queryPool)
+	{
+		NEPTUNE_PROFILE_ZONE
 
-			// From a copying stage to...
-			sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		m_QueryPool = queryPool.get();
+	}
 
-			// The fragment stage.
-			destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL && newLayout == VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL) 
-		{
-			barrier.srcAccessMask = VK_ACCESS_TRANSFER_READ_BIT;
-			barrier.dstAccessMask = VK_ACCESS_SHADER_READ_BIT;
+	void CmdList::CmdCopyImage(VkImage src, VkImage dst, const VkImageCopy& region) const
+	{
+		NEPTUNE_PROFILE_ZONE
 
-			// From a copying stage to...
-			sourceStage = VK_PIPELINE_STAGE_TRANSFER_BIT;
+		m_StateTracker.Flush(*m_CommandBuffer);
 
-			// The fragment stage.
-			destinationStage = VK_PIPELINE_STAGE_FRAGMENT_SHADER_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL) 
-		{
-			barrier.srcAccessMask = 0;
-			barrier.dstAccessMask = VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+		m_CommandBuffer->CopyImage(src, dst, region);
+	}
 
-			sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-			destinationStage = VK_PIPELINE_STAGE_EARLY_FRAGMENT_TESTS_BIT;
-		}
-		else if (oldLayout == VK_IMAGE_LAYOUT_UNDEFINED && newLayout == VK_IMAGE_LAYOUT_GENERAL)
-		{
-			barrier.srcAccessMask = 0;
-			barrier.dstAccessMask = VK_IMAGE_ASPECT_NONE;
+	void CmdList::CmdPipelineBarrier(VkPipelineStageFlags srcMask, VkPipelineStageFlags dstMask, const VkImageMemoryBarrier& barrier) const
+	{
+		NEPTUNE_PROFILE_ZONE
 
-			sourceStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-			destinationStage = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
-		}
-		else 
-		{
-			NEPTUNE_CORE_WARN("Unsupported Vulkan Image Layout Transition!");
-			return;
-		}
-		if (newLayout == VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL) 
-		{
-			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_DEPTH_BIT;
+		m_StateTracker.Flush(*m_CommandBuffer);
 
-			if (image->GetFormat() == VK_FORMAT_D32_SFLOAT_S8_UINT || image->GetFormat() == VK_FORMAT_D24_UNORM_S8_UINT)
-			{
-				barrier.subresourceRange.aspectMask |= VK_IMAGE_ASPECT_STENCIL_BIT;
-			}
-		}
-		else 
-		{
-			barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
-		}
+		m_CommandBuffer->PipelineBarrier(srcMask, dstMask, barrier);
+	}
+
+	void CmdList::CmdTransitionLayout(SP<Resource::Image> image, VkImageLayout newLayout) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_StateTracker.TransitionImage(image.get(), newLayout);
+	}
 
-		CmdPipelineBarrier(sourceStage, destinationStage, barrier);
+	void CmdList::CmdAccessBuffer(const SP<Resource::Buffer>& buffer, VkPipelineStageFlags2 stage, VkAccessFlags2 access) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_StateTracker.AccessBuffer(buffer.get(), stage, access);
+	}
+
+	void CmdList::CmdFlushBarriers() const
+	{
+		NEPTUNE_PROFILE_ZONE
 
-		image->SetLayout(newLayout);
+		m_StateTracker.Flush(*m_CommandBuffer);
 	}
 
 	void CmdList::CmdBeginQuery(uint32_t index) const
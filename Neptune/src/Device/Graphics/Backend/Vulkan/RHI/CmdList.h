@@ -11,6 +11,8 @@
 #include "Core/Core.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/Infrastructure.h"
 #include "Device/Graphics/Backend/Vulkan/Unit/CommandBuffer.h"
+#include "ResourceStateTracker.h"
+#include "Core/Memory/FrameArena.h"
 #include "Device/Graphics/Frontend/RHI/CmdList.h"
 
 namespace Neptune::RHI {
@@ -18,6 +20,8 @@ namespace Neptune::RHI {
 	class RenderPass;
 	class Pipeline;
 	class DescriptorList;
+	class GPUScene;
+	class RenderTarget;
 }
 
 namespace Neptune::Vulkan {
@@ -26,6 +30,7 @@ namespace Neptune::Vulkan {
 
 		class VideoSession;
 		class Image;
+		class Buffer;
 		class QueryPool;
 	}
 
@@ -41,10 +46,19 @@ namespace Neptune::Vulkan {
 
 		/**
 		* @brief Constructor Function.
+		* Passes create a CmdList per frame, barriers live on the FrameArena of the recording thread.
 		*
 		* @param[in] context Context.
 		*/
-		explicit CmdList(Context& context) : ContextAccessor(context) {}
+		explicit CmdList(Context& context) : CmdList(context, &Memory::FrameArena::Get()) {}
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		* @param[in] resource Memory of deferred barriers.
+		*/
+		CmdList(Context& context, std::pmr::memory_resource* resource) : ContextAccessor(context), m_StateTracker(resource) {}
 
 		/**
 		* @brief Destructor Function.
@@ -60,6 +74,13 @@ namespace Neptune::Vulkan {
 		*/
 		void SetGraphicCmdList(const Data::Clock& clock) override;
 
+		/**
+		* @brief Interface of Set Compute CommandList Context.
+		*
+		* @param[in] clock Clock.
+		*/
+		void SetComputeCmdList(const Data::Clock& clock) override;
+
 		/**
 		* @brief Interface of Get Current CommandList.
 		* 
@@ -103,6 +124,16 @@ namespace Neptune::Vulkan {
 		*/
 		void CmdDrawFullScreenTriangle() const override;
 
+		/**
+		* @brief Interface of Draw.
+		*
+		* @param[in] vertexCount Vertex count.
+		* @param[in] instanceCount Instance count.
+		* @param[in] firstVertex First vertex.
+		* @param[in] firstInstance First instance.
+		*/
+		void CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const override;
+
 		/**
 		* @brief Interface of SetViewport.
 		*
@@ -110,6 +141,40 @@ namespace Neptune::Vulkan {
 		*/
 		void CmdSetViewport(const glm::vec2& viewPortSize) const override;
 
+		/**
+		* @brief Interface of PushConstants.
+		*
+		* @param[in] data PushConstants data.
+		* @param[in] bytes PushConstants bytes.
+		*/
+		void CmdPushConstants(const void* data, uint32_t bytes) const override;
+
+		/**
+		* @brief Interface of Cull GPUScene instances into indirect commands.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		* @param[in] viewPosition Camera world position.
+		*/
+		void CmdCullGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const override;
+
+		/**
+		* @brief Interface of Draw GPUScene indirect commands of last cull.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		*/
+		void CmdDrawGPUScene(const SP<RHI::GPUScene>& scene, const glm::mat4& viewProjection) const override;
+
+		/**
+		* @brief Interface of Blit a RenderTarget into another.
+		*
+		* @param[in] src Source RenderTarget.
+		* @param[in] dst Destination RenderTarget.
+		* @param[in] extent Blitted extent from origin.
+		*/
+		void CmdBlitRenderTarget(const SP<RHI::RenderTarget>& src, const SP<RHI::RenderTarget>& dst, const glm::vec2& extent) const override;
+
 	public:
 
 		/**
@@ -138,13 +203,34 @@ namespace Neptune::Vulkan {
 		void CmdPipelineBarrier(VkPipelineStageFlags srcMask, VkPipelineStageFlags dstMask, const VkImageMemoryBarrier& barrier) const;
 
 		/**
-		* @brief Transition Layout.
+		* @brief Transition Layout, deferred until the next action command.
 		*
 		* @param[in] image Image.
 		* @param[in] newLayout VkImageLayout.
 		*/
 		void CmdTransitionLayout(SP<Resource::Image> image, VkImageLayout newLayout) const;
 
+		/**
+		* @brief Declare a Buffer access, deferred until the next action command.
+		*
+		* @param[in] buffer Buffer.
+		* @param[in] stage Stages using the Buffer.
+		* @param[in] access Accesses of the Buffer.
+		*/
+		void CmdAccessBuffer(const SP<Resource::Buffer>& buffer, VkPipelineStageFlags2 stage, VkAccessFlags2 access) const;
+
+		/**
+		* @brief Record deferred barriers now.
+		*/
+		void CmdFlushBarriers() const;
+
+		/**
+		* @brief Get barrier counters of this CmdList.
+		*
+		* @return Returns BarrierStats.
+		*/
+		const BarrierStats& GetBarrierStats() const { return m_StateTracker.GetStats(); }
+
 		/**
 		* @brief Begin Query.
 		*
@@ -181,6 +267,7 @@ namespace Neptune::Vulkan {
 		const Resource::QueryPool*    m_QueryPool      = nullptr;                               // @brief QueryPool reference.
 		VkPipelineBindPoint           m_BindPoint      = VK_PIPELINE_BIND_POINT_MAX_ENUM;       // @brief VkPipelineBindPoint.
 		VkPipelineLayout              m_PipelineLayout = VK_NULL_HANDLE;                        // @brief VkPipelineLayout.
+		mutable ResourceStateTracker  m_StateTracker;                                           // @brief Deferred barriers of CommandBuffer.
 	};
 }
 
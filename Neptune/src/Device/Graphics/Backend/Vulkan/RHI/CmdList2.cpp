@@ -14,6 +14,8 @@
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/Device.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/ThreadQueue.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/DebugUtilsObject.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/PhysicalDevice.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/GpuProfiler.h"
 #include "Device/Graphics/Backend/Vulkan/Resource/VideoSession.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/OpticalFlowSession.h"
 
@@ -29,12 +31,24 @@ namespace Neptune::Vulkan {
 		beginInfo.pInheritanceInfo           = nullptr;
 
 		m_CommandBuffer->Begin(beginInfo);
+
+		if (GetContext().Has<IGpuProfiler>())
+		{
+			m_TimeStampSlot = GetContext().Get<IGpuProfiler>()->BeginSubmitZone(*m_CommandBuffer, m_QueueFamily);
+		}
 	}
 
 	void CmdList2::End() const
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Flush(*m_CommandBuffer);
+
+		if (m_TimeStampSlot.has_value())
+		{
+			GetContext().Get<IGpuProfiler>()->EndSubmitZone(*m_CommandBuffer, m_TimeStampSlot.value());
+		}
+
 		m_CommandBuffer->End();
 	}
 
@@ -59,6 +73,14 @@ namespace Neptune::Vulkan {
 
 		m_ThreadQueue->Push(queue);
 
+		if (m_TimeStampSlot.has_value())
+		{
+			GetContext().Get<IGpuProfiler>()->ResolveSubmitZone(m_TimeStampSlot.value(), m_ThreadQueue->ToString(), m_QueueFamily);
+
+			m_TimeStampSlot.reset();
+		}
+
+		// Submission is complete, CommandBuffer returns to the thread arena.
 		m_CommandBuffer.reset();
 	}
 
@@ -66,18 +88,14 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		VkCommandBufferAllocateInfo            allocInfo{};
-		allocInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		allocInfo.commandPool                = GetContext().Get<IGraphicThreadCommandPool>()->Handle();
-		allocInfo.level                      = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		allocInfo.commandBufferCount         = 1;
-
-		m_CommandBuffer = CreateSP<Unit::CommandBuffer>();
+		m_StateTracker.Reset();
 
-		m_CommandBuffer->CreateCommandBuffer(GetContext().Get<IDevice>()->Handle(), allocInfo);
+		m_CommandBuffer = GetContext().Get<IGraphicThreadCommandPool>()->Acquire();
 
 		m_ThreadQueue = GetContext().Get<IGraphicThreadQueue>();
 
+		m_QueueFamily = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies().graphic.value();
+
 		m_BindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
 	}
 
@@ -85,34 +103,26 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		VkCommandBufferAllocateInfo            allocInfo{};
-		allocInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		allocInfo.commandPool                = GetContext().Get<IVideoDecodeThreadCommandPool>()->Handle();
-		allocInfo.level                      = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		allocInfo.commandBufferCount         = 1;
+		m_StateTracker.Reset();
 
-		m_CommandBuffer = CreateSP<Unit::CommandBuffer>();
-
-		m_CommandBuffer->CreateCommandBuffer(GetContext().Get<IDevice>()->Handle(), allocInfo);
+		m_CommandBuffer = GetContext().Get<IVideoDecodeThreadCommandPool>()->Acquire();
 
 		m_ThreadQueue = GetContext().Get<IVideoDecodeThreadQueue>();
+
+		m_QueueFamily = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies().videoDecode.value();
 	}
 
 	void CmdList2::SetOpticalFlowCmdList()
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		VkCommandBufferAllocateInfo            allocInfo{};
-		allocInfo.sType                      = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
-		allocInfo.commandPool                = GetContext().Get<IOpticalFlowThreadCommandPool>()->Handle();
-		allocInfo.level                      = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-		allocInfo.commandBufferCount         = 1;
+		m_StateTracker.Reset();
 
-		m_CommandBuffer = CreateSP<Unit::CommandBuffer>();
-
-		m_CommandBuffer->CreateCommandBuffer(GetContext().Get<IDevice>()->Handle(), allocInfo);
+		m_CommandBuffer = GetContext().Get<IOpticalFlowThreadCommandPool>()->Acquire();
 
 		m_ThreadQueue = GetContext().Get<IOpticalFlowThreadQueue>();
+
+		m_QueueFamily = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies().opticalFlow.value();
 	}
 
 	void CmdList2::SetVideoSession(const WP<Resource::VideoSession>& videoSession)
@@ -140,6 +150,8 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Flush(*m_CommandBuffer);
+
 		m_CommandBuffer->BeginVideoCoding(GetContext().Get<IFunctions>()->vkCmdBeginVideoCodingKHR, info);
 	}
 
@@ -159,6 +171,8 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Flush(*m_CommandBuffer);
+
 		m_CommandBuffer->DecodeVideo(GetContext().Get<IFunctions>()->vkCmdDecodeVideoKHR, info);
 	}
 
@@ -176,6 +190,8 @@ namespace Neptune::Vulkan {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		m_StateTracker.Flush(*m_CommandBuffer);
+
 		VkOpticalFlowExecuteInfoNV                   info{};
 		info.sType                                 = VK_STRUCTURE_TYPE_OPTICAL_FLOW_EXECUTE_INFO_NV;
 		info.flags                                 = 0;
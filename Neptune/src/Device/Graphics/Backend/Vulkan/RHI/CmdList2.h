@@ -32,10 +32,11 @@ namespace Neptune::Vulkan {
 
 		/**
 		* @brief Constructor Function.
+		* CmdList2 may be kept across frames, its barriers stay on the heap.
 		* 
 		* @param[in] context Context.
 		*/
-		explicit CmdList2(Context& context) : CmdList(context) {}
+		explicit CmdList2(Context& context) : CmdList(context, std::pmr::get_default_resource()) {}
 
 		/**
 		* @brief Destructor Function.
@@ -129,6 +130,8 @@ namespace Neptune::Vulkan {
 	private:
 
 		ThreadQueue*                 m_ThreadQueue;               // @brief ThreadQueue
+		uint32_t                     m_QueueFamily = 0;           // @brief Queue family of ThreadQueue
+		mutable std::optional<uint32_t> m_TimeStampSlot;          // @brief GpuProfiler submit slot
 		WP<Resource::VideoSession>   m_VideoSession;              // @brief VideoSession
 		const OpticalFlowSession*    m_OpticalFlowSession;        // @brief OpticalFlowSession
 	};
@@ -10,6 +10,7 @@
 
 #include "DescriptorList.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/RenderTarget.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/BindLessHeap.h"
 #include "Device/Graphics/Frontend/RHI/RenderTarget.h"
 
 namespace Neptune::Vulkan {
@@ -90,10 +91,35 @@ namespace Neptune::Vulkan {
 			pair.second->UpdateDescriptorSet();
 		});
 
+		std::map<uint32_t, VkDescriptorSetLayout> layouts;
+
 		std::ranges::for_each(m_DescriptorSets.begin(), m_DescriptorSets.end(), [&](const auto& pair) {
 
-			m_DescriptorSetLayouts.emplace_back(pair.second->GetDescriptorSetLayout());
+			layouts[pair.first] = pair.second->GetDescriptorSetLayout();
 		});
+
+		if (m_BindLessSet)
+		{
+			layouts[*m_BindLessSet] = GetContext().Get<IBindLessHeap>()->GetLayout();
+		}
+
+		for (const auto& layout : layouts | std::views::values)
+		{
+			m_DescriptorSetLayouts.emplace_back(layout);
+		}
+	}
+
+	void DescriptorList::AddBindLessHeap(uint32_t set)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (m_DescriptorSets.contains(set))
+		{
+			NEPTUNE_CORE_ERROR("BindLess Heap set is already used by DescriptorList.")
+			return;
+		}
+
+		m_BindLessSet = set;
 	}
 
 	SP<Resource::DescriptorSet> DescriptorList::AccessSet(uint32_t set)
@@ -14,6 +14,7 @@
 #include "Device/Graphics/Frontend/RHI/DescriptorList.h"
 
 #include <map>
+#include <optional>
 
 namespace Neptune::RHI {
 
@@ -87,6 +88,13 @@ namespace Neptune::Vulkan {
 		*/
 		void CombineSharedLayout(const RHI::RHIDescriptorList::Impl* shared) override;
 
+		/**
+		* @brief Interface of Add BindLess Heap as a set.
+		*
+		* @param[in] set .
+		*/
+		void AddBindLessHeap(uint32_t set) override;
+
 		/**
 		* @brief Interface of Build DescriptorList.
 		*/
@@ -108,6 +116,13 @@ namespace Neptune::Vulkan {
 		*/
 		const std::map<uint32_t, SP<Resource::DescriptorSet>>& GetSets() const { return m_DescriptorSets; }
 
+		/**
+		* @brief Get BindLess Heap set.
+		*
+		* @return Returns BindLess Heap set, empty if not used.
+		*/
+		const std::optional<uint32_t>& GetBindLessSet() const { return m_BindLessSet; }
+
 	private:
 		
 		/**
@@ -123,6 +138,7 @@ namespace Neptune::Vulkan {
 
 		std::map<uint32_t, SP<Resource::DescriptorSet>> m_DescriptorSets;         // @brief Container of DescriptorSet.
 		std::vector<VkDescriptorSetLayout> m_DescriptorSetLayouts;                // @brief Container of VkDescriptorSetLayout.
+		std::optional<uint32_t> m_BindLessSet;                                    // @brief Set BindLess Heap bound to.
 
 	};
 }
@@ -0,0 +1,331 @@
+/**
+* @file GPUScene.cpp.
+* @brief The GPUScene Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "GPUScene.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/DebugUtilsObject.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/Device.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/PhysicalDevice.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/Shader.h"
+
+namespace Neptune::Vulkan {
+
+	void GPUScene::SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Retire(std::move(m_Vertices));
+		Retire(std::move(m_Indices));
+
+		m_Vertices = CreateBuffer(vertices.size() * sizeof(ShaderCommon::Vertex), 0, "GPUSceneVertices");
+		m_Indices  = CreateBuffer(indices.size() * sizeof(uint32_t), VK_BUFFER_USAGE_INDEX_BUFFER_BIT, "GPUSceneIndices");
+
+		Upload(m_Vertices, vertices.data(), vertices.size() * sizeof(ShaderCommon::Vertex));
+		Upload(m_Indices, indices.data(), indices.size() * sizeof(uint32_t));
+	}
+
+	void GPUScene::SetMeshes(const std::vector<ShaderCommon::MeshBounds>& meshes, const std::vector<ShaderCommon::MeshLod>& lods)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Retire(std::move(m_Meshes));
+		Retire(std::move(m_Lods));
+
+		m_Meshes = CreateBuffer(meshes.size() * sizeof(ShaderCommon::MeshBounds), 0, "GPUSceneMeshes");
+		m_Lods   = CreateBuffer(lods.size() * sizeof(ShaderCommon::MeshLod), 0, "GPUSceneLods");
+
+		Upload(m_Meshes, meshes.data(), meshes.size() * sizeof(ShaderCommon::MeshBounds));
+		Upload(m_Lods, lods.data(), lods.size() * sizeof(ShaderCommon::MeshLod));
+	}
+
+	void GPUScene::SetInstances(const std::vector<ShaderCommon::MeshInstance>& instances)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_HostInstances = instances;
+
+		const auto count = static_cast<uint32_t>(instances.size());
+
+		if (count > m_InstanceCapacity)
+		{
+			CreateInstanceBuffers(std::max(count, m_InstanceCapacity * 2));
+
+			Upload(m_Instances, instances.data(), instances.size() * sizeof(ShaderCommon::MeshInstance));
+
+			return;
+		}
+
+		// Instances buffer may be read by frames in flight, go through per frame staging.
+		for (auto& frame : m_Frames)
+		{
+			frame.dirtyBegin = 0;
+			frame.dirtyEnd   = count;
+		}
+	}
+
+	void GPUScene::UpdateInstances(uint32_t first, const ShaderCommon::MeshInstance* instances, uint32_t count)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (count == 0) return;
+
+		assert(first + count <= m_HostInstances.size());
+
+		std::copy_n(instances, count, m_HostInstances.begin() + first);
+
+		for (auto& frame : m_Frames)
+		{
+			if (frame.dirtyBegin == frame.dirtyEnd)
+			{
+				frame.dirtyBegin = first;
+				frame.dirtyEnd   = first + count;
+			}
+			else
+			{
+				frame.dirtyBegin = std::min(frame.dirtyBegin, first);
+				frame.dirtyEnd   = std::max(frame.dirtyEnd, first + count);
+			}
+		}
+	}
+
+	void GPUScene::SetCullShader(SP<RHI::Shader> shader)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (m_CullPipeline.GetHandle())
+		{
+			NEPTUNE_CORE_WARN("GPUScene Cull Shader is already set.")
+			return;
+		}
+
+		VkPushConstantRange                             range{};
+		range.stageFlags                              = VK_SHADER_STAGE_ALL;
+		range.offset                                  = 0;
+		range.size                                    = PushConstantSize;
+
+		VkPipelineLayoutCreateInfo                      layoutInfo{};
+		layoutInfo.sType                              = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+		layoutInfo.setLayoutCount                     = 0;
+		layoutInfo.pSetLayouts                        = nullptr;
+		layoutInfo.pushConstantRangeCount             = 1;
+		layoutInfo.pPushConstantRanges                = &range;
+
+		m_CullPipelineLayout.CreatePipelineLayout(GetContext().Get<IDevice>()->Handle(), layoutInfo);
+
+		DEBUGUTILS_SETOBJECTNAME(m_CullPipelineLayout, "GPUSceneCullPipelineLayout");
+
+		VkPipelineShaderStageCreateInfo                 stageInfo{};
+		stageInfo.sType                               = VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_CREATE_INFO;
+		stageInfo.stage                               = VK_SHADER_STAGE_COMPUTE_BIT;
+		stageInfo.module                              = shader->GetRHIImpl<Shader>()->Handle();
+		stageInfo.pName                               = "main";
+
+		VkComputePipelineCreateInfo                     info{};
+		info.sType                                    = VK_STRUCTURE_TYPE_COMPUTE_PIPELINE_CREATE_INFO;
+		info.stage                                    = stageInfo;
+		info.layout                                   = m_CullPipelineLayout.GetHandle();
+		info.basePipelineIndex                        = -1;
+		info.basePipelineHandle                       = VK_NULL_HANDLE;
+
+		m_CullPipeline.CreateComputePipeline(GetContext().Get<IDevice>()->Handle(), info);
+
+		DEBUGUTILS_SETOBJECTNAME(m_CullPipeline, "GPUSceneCullPipeline");
+	}
+
+	bool GPUScene::IsReady() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		return m_Vertices && m_Meshes && m_Instances && !m_HostInstances.empty() && m_CullPipeline.GetHandle();
+	}
+
+	void GPUScene::Prepare(uint32_t frameIndex)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		++m_FrameCount;
+
+		while (!m_Retired.empty() && m_FrameCount - m_Retired.front().frame > MaxFrameInFlight)
+		{
+			m_Retired.pop_front();
+		}
+
+		// Submit queued uploads without waiting, the graphic submission waits them on the upload timeline.
+		if (m_Ticket != 0)
+		{
+			GetContext().Get<IUploadManager>()->Flush();
+
+			m_Ticket = 0;
+		}
+
+		auto& frame = m_Frames[frameIndex];
+
+		ShaderCommon::GPUSceneDesc             desc{};
+		desc.verticesAddress                 = m_Vertices->Address();
+		desc.lodsAddress                     = m_Lods->Address();
+		desc.meshesAddress                   = m_Meshes->Address();
+		desc.instancesAddress                = m_Instances->Address();
+		desc.commandsAddress                 = frame.commands->Address();
+		desc.countAddress                    = frame.count->Address();
+
+		frame.desc->WriteToBuffer(&desc, sizeof(desc));
+		frame.desc->Flush();
+	}
+
+	std::vector<VkBufferCopy> GPUScene::StageInstances(uint32_t frameIndex)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		auto& frame = m_Frames[frameIndex];
+
+		if (frame.dirtyBegin == frame.dirtyEnd) return {};
+
+		const VkDeviceSize offset = frame.dirtyBegin * sizeof(ShaderCommon::MeshInstance);
+		const VkDeviceSize size   = (frame.dirtyEnd - frame.dirtyBegin) * sizeof(ShaderCommon::MeshInstance);
+
+		frame.staging->WriteToBuffer(m_HostInstances.data() + frame.dirtyBegin, size, offset);
+		frame.staging->Flush(size, offset);
+
+		frame.dirtyBegin = frame.dirtyEnd = 0;
+
+		VkBufferCopy                           region{};
+		region.srcOffset                     = offset;
+		region.dstOffset                     = offset;
+		region.size                          = size;
+
+		return { region };
+	}
+
+	SP<Resource::Buffer> GPUScene::CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const std::string& name)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		VkBufferCreateInfo                     info{};
+		info.sType                           = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+		info.size                            = std::max<VkDeviceSize>(size, sizeof(uint32_t));
+		info.usage                           = usage | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+		SetSharing(info);
+
+		auto buffer = CreateSP<Resource::Buffer>(GetContext());
+
+		buffer->CreateBuffer(info, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+		buffer->SetName(name);
+
+		return buffer;
+	}
+
+	void GPUScene::SetSharing(VkBufferCreateInfo& info)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (m_Families.empty())
+		{
+			const auto& families = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies();
+
+			m_Families = { families.compute.value(), families.graphic.value(), families.transfer.value() };
+
+			std::ranges::sort(m_Families);
+
+			m_Families.erase(std::ranges::unique(m_Families).begin(), m_Families.end());
+		}
+
+		if (m_Families.size() == 1)
+		{
+			info.sharingMode                 = VK_SHARING_MODE_EXCLUSIVE;
+			return;
+		}
+
+		info.sharingMode                     = VK_SHARING_MODE_CONCURRENT;
+		info.queueFamilyIndexCount           = static_cast<uint32_t>(m_Families.size());
+		info.pQueueFamilyIndices             = m_Families.data();
+	}
+
+	void GPUScene::Upload(const SP<Resource::Buffer>& buffer, const void* data, VkDeviceSize size)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		// CullPass reads GPUScene first on the compute queue, BasePass waits it.
+		const auto family  = GetContext().Get<IPhysicalDevice>()->GetQueueFamilies().compute.value();
+		const auto manager = GetContext().Get<IUploadManager>();
+
+		// Chunks of half ring, a single upload larger than the ring is rejected.
+		constexpr VkDeviceSize chunk = StagingRingSize / 2;
+
+		for (VkDeviceSize offset = 0; offset < size; offset += chunk)
+		{
+			const auto bytes  = std::min(chunk, size - offset);
+			const auto ticket = manager->UploadBuffer(buffer->Handle(), static_cast<const uint8_t*>(data) + offset, bytes, offset, family, m_Families.size() > 1);
+
+			m_Ticket = std::max(m_Ticket, ticket);
+		}
+	}
+
+	void GPUScene::Retire(SP<Resource::Buffer> buffer)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (!buffer) return;
+
+		m_Retired.push_back({ std::move(buffer), m_FrameCount });
+	}
+
+	void GPUScene::CreateInstanceBuffers(uint32_t capacity)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Retire(std::move(m_Instances));
+
+		m_InstanceCapacity = capacity;
+
+		m_Instances = CreateBuffer(capacity * sizeof(ShaderCommon::MeshInstance), 0, "GPUSceneInstances");
+
+		for (uint32_t i = 0; i < MaxFrameInFlight; i++)
+		{
+			auto& frame = m_Frames[i];
+
+			Retire(std::move(frame.commands));
+			Retire(std::move(frame.count));
+			Retire(std::move(frame.staging));
+
+			frame.commands   = CreateBuffer(capacity * sizeof(ShaderCommon::DrawIndexedCommand), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, "GPUSceneCommands");
+			frame.count      = CreateBuffer(sizeof(uint32_t), VK_BUFFER_USAGE_INDIRECT_BUFFER_BIT, "GPUSceneCount");
+			frame.dirtyBegin = frame.dirtyEnd = 0;
+
+			{
+				VkBufferCreateInfo                     info{};
+				info.sType                           = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+				info.size                            = capacity * sizeof(ShaderCommon::MeshInstance);
+				info.usage                           = VK_BUFFER_USAGE_TRANSFER_SRC_BIT;
+
+				SetSharing(info);
+
+				frame.staging = CreateSP<Resource::Buffer>(GetContext());
+				frame.staging->CreateBuffer(info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+				frame.staging->SetName("GPUSceneInstancesStaging");
+			}
+
+			if (!frame.desc)
+			{
+				VkBufferCreateInfo                     info{};
+				info.sType                           = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+				info.size                            = sizeof(ShaderCommon::GPUSceneDesc);
+				info.usage                           = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT;
+
+				SetSharing(info);
+
+				frame.desc = CreateSP<Resource::Buffer>(GetContext());
+				frame.desc->CreateBuffer(info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT);
+				frame.desc->SetName("GPUSceneDesc");
+			}
+		}
+	}
+}
+
+#endif
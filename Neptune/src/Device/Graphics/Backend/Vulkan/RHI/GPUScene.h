@@ -0,0 +1,275 @@
+/**
+* @file GPUScene.h.
+* @brief The GPUScene Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/Infrastructure.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/UploadManager.h"
+#include "Device/Graphics/Backend/Vulkan/Resource/Buffer.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/Pipeline.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/PipelineLayout.h"
+#include "Device/Graphics/Frontend/RHI/GPUScene.h"
+
+#include <array>
+#include <deque>
+
+namespace Neptune::RHI {
+
+	class Shader;
+}
+
+namespace Neptune::Vulkan {
+
+	/**
+	* @brief Vulkan::GPUScene Class.
+	* This class defines the Vulkan::GPUScene behaves.
+	* Geometry, meshes and instances are device local buffers read by device address.
+	* Each frame in flight owns its GPUSceneDesc, indirect commands, draw count and instance staging,
+	* so a cull never writes buffers an earlier frame may still draw.
+	* Buffers are shared by the compute queue culling and the graphic queue drawing,
+	* uploads are waited by the compute submission and graphic waits compute.
+	*/
+	class GPUScene : public ContextAccessor, public RHI::RHIGPUScene::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] context Context.
+		*/
+		explicit GPUScene(Context& context) : ContextAccessor(context) {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~GPUScene() override = default;
+
+	public:
+
+		/**
+		* @brief Interface of Set Geometry shared by all Meshes.
+		*
+		* @param[in] vertices Vertices.
+		* @param[in] indices Indices, relative to MeshLod vertexOffset.
+		*/
+		void SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices) override;
+
+		/**
+		* @brief Interface of Set Meshes.
+		*
+		* @param[in] meshes MeshBounds.
+		* @param[in] lods MeshLods.
+		*/
+		void SetMeshes(const std::vector<ShaderCommon::MeshBounds>& meshes, const std::vector<ShaderCommon::MeshLod>& lods) override;
+
+		/**
+		* @brief Interface of Set Instances, instance count may change.
+		*
+		* @param[in] instances MeshInstances.
+		*/
+		void SetInstances(const std::vector<ShaderCommon::MeshInstance>& instances) override;
+
+		/**
+		* @brief Interface of Update a range of Instances.
+		*
+		* @param[in] first First MeshInstance.
+		* @param[in] instances MeshInstances.
+		* @param[in] count MeshInstance count.
+		*/
+		void UpdateInstances(uint32_t first, const ShaderCommon::MeshInstance* instances, uint32_t count) override;
+
+		/**
+		* @brief Interface of Set Cull Compute Shader.
+		*
+		* @param[in] shader Shader of MeshCull.comp.
+		*/
+		void SetCullShader(SP<RHI::Shader> shader) override;
+
+	public:
+
+		/**
+		* @brief Is GPUScene able to cull and draw.
+		*
+		* @return Returns true if geometry, meshes, instances and cull pipeline are set.
+		*/
+		bool IsReady() const;
+
+		/**
+		* @brief Prepare a frame for cull, wait pending uploads and write GPUSceneDesc of the frame.
+		*
+		* @param[in] frameIndex Frame index.
+		*/
+		void Prepare(uint32_t frameIndex);
+
+		/**
+		* @brief Copy dirty instances into staging of a frame.
+		*
+		* @param[in] frameIndex Frame index.
+		*
+		* @return Returns copy regions from staging to instances buffer, empty if not dirty.
+		*/
+		std::vector<VkBufferCopy> StageInstances(uint32_t frameIndex);
+
+		/**
+		* @brief Get Indices Buffer.
+		*
+		* @return Returns Indices Buffer.
+		*/
+		const SP<Resource::Buffer>& GetIndices() const { return m_Indices; }
+
+		/**
+		* @brief Get Instances Buffer.
+		*
+		* @return Returns Instances Buffer.
+		*/
+		const SP<Resource::Buffer>& GetInstances() const { return m_Instances; }
+
+		/**
+		* @brief Get Instances staging Buffer of a frame.
+		*
+		* @param[in] frameIndex Frame index.
+		*
+		* @return Returns Instances staging Buffer.
+		*/
+		const SP<Resource::Buffer>& GetStaging(uint32_t frameIndex) const { return m_Frames[frameIndex].staging; }
+
+		/**
+		* @brief Get DrawIndexedCommands Buffer of a frame.
+		*
+		* @param[in] frameIndex Frame index.
+		*
+		* @return Returns DrawIndexedCommands Buffer.
+		*/
+		const SP<Resource::Buffer>& GetCommands(uint32_t frameIndex) const { return m_Frames[frameIndex].commands; }
+
+		/**
+		* @brief Get Draw Count Buffer of a frame.
+		*
+		* @param[in] frameIndex Frame index.
+		*
+		* @return Returns Draw Count Buffer.
+		*/
+		const SP<Resource::Buffer>& GetCount(uint32_t frameIndex) const { return m_Frames[frameIndex].count; }
+
+		/**
+		* @brief Get GPUSceneDesc address of a frame.
+		*
+		* @param[in] frameIndex Frame index.
+		*
+		* @return Returns GPUSceneDesc address.
+		*/
+		VkDeviceAddress GetDescAddress(uint32_t frameIndex) const { return m_Frames[frameIndex].desc->Address(); }
+
+		/**
+		* @brief Get MeshInstance count.
+		*
+		* @return Returns MeshInstance count.
+		*/
+		uint32_t GetInstanceCount() const { return static_cast<uint32_t>(m_HostInstances.size()); }
+
+		/**
+		* @brief Get Cull Pipeline Unit Handle.
+		*
+		* @return Returns Cull Pipeline Unit Handle.
+		*/
+		const Unit::Pipeline::Handle& GetCullPipeline() const { return m_CullPipeline.GetHandle(); }
+
+		/**
+		* @brief Get Cull PipelineLayout Unit Handle.
+		*
+		* @return Returns Cull PipelineLayout Unit Handle.
+		*/
+		const Unit::PipelineLayout::Handle& GetCullPipelineLayout() const { return m_CullPipelineLayout.GetHandle(); }
+
+	private:
+
+		/**
+		* @brief Create a device local Buffer read by address.
+		*
+		* @param[in] size Buffer bytes.
+		* @param[in] usage Extra VkBufferUsageFlags.
+		* @param[in] name Buffer name.
+		*
+		* @return Returns Buffer.
+		*/
+		SP<Resource::Buffer> CreateBuffer(VkDeviceSize size, VkBufferUsageFlags usage, const std::string& name);
+
+		/**
+		* @brief Share a Buffer by graphic, compute and transfer queue families if they differ.
+		*
+		* @param[in,out] info VkBufferCreateInfo.
+		*/
+		void SetSharing(VkBufferCreateInfo& info);
+
+		/**
+		* @brief Upload host data to a device local Buffer, split by staging ring size.
+		*
+		* @param[in] buffer Buffer.
+		* @param[in] data Host data.
+		* @param[in] size Data bytes.
+		*/
+		void Upload(const SP<Resource::Buffer>& buffer, const void* data, VkDeviceSize size);
+
+		/**
+		* @brief Keep a replaced Buffer alive until frames in flight using it are done.
+		*
+		* @param[in] buffer Buffer.
+		*/
+		void Retire(SP<Resource::Buffer> buffer);
+
+		/**
+		* @brief Create instances and per frame Buffers for a capacity.
+		*
+		* @param[in] capacity MeshInstance capacity.
+		*/
+		void CreateInstanceBuffers(uint32_t capacity);
+
+	private:
+
+		/**
+		* @brief Buffers owned by one frame in flight.
+		*/
+		struct Frame
+		{
+			SP<Resource::Buffer>                      desc;                  // @brief GPUSceneDesc, host visible.
+			SP<Resource::Buffer>                      commands;              // @brief DrawIndexedCommands.
+			SP<Resource::Buffer>                      count;                 // @brief Draw Count.
+			SP<Resource::Buffer>                      staging;               // @brief Instances staging, host visible.
+			uint32_t                                  dirtyBegin = 0;        // @brief First dirty MeshInstance.
+			uint32_t                                  dirtyEnd   = 0;        // @brief End of dirty MeshInstances.
+		};
+
+		/**
+		* @brief Replaced Buffer.
+		*/
+		struct Retired
+		{
+			SP<Resource::Buffer>                      buffer;                // @brief Buffer.
+			uint64_t                                  frame;                 // @brief Frame count when retired.
+		};
+
+		SP<Resource::Buffer>                          m_Vertices;            // @brief Vertices.
+		SP<Resource::Buffer>                          m_Indices;             // @brief Indices.
+		SP<Resource::Buffer>                          m_Lods;                // @brief MeshLods.
+		SP<Resource::Buffer>                          m_Meshes;              // @brief MeshBounds.
+		SP<Resource::Buffer>                          m_Instances;           // @brief MeshInstances.
+		uint32_t                                      m_InstanceCapacity = 0;// @brief MeshInstance capacity of Buffers.
+		std::vector<ShaderCommon::MeshInstance>       m_HostInstances;       // @brief Host copy of MeshInstances.
+		std::array<Frame, MaxFrameInFlight>           m_Frames;              // @brief Per frame Buffers.
+		std::deque<Retired>                           m_Retired;             // @brief Replaced Buffers.
+		uint64_t                                      m_FrameCount = 0;      // @brief Prepared frames.
+		UploadTicket                                  m_Ticket = 0;          // @brief Last upload ticket.
+		std::vector<uint32_t>                         m_Families;            // @brief Queue families sharing Buffers, one if exclusive.
+		Unit::PipelineLayout                          m_CullPipelineLayout;  // @brief Cull PipelineLayout.
+		Unit::Pipeline                                m_CullPipeline;        // @brief Cull Pipeline.
+	};
+}
+
+#endif
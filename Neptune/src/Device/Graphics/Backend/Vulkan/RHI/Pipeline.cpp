@@ -143,12 +143,17 @@ namespace Neptune::Vulkan {
 
 		auto& layouts = descriptorList->GetRHIImpl<DescriptorList>()->GetLayouts();
 
+		VkPushConstantRange                             range{};
+		range.stageFlags                              = VK_SHADER_STAGE_ALL;
+		range.offset                                  = 0;
+		range.size                                    = PushConstantSize;
+
 		VkPipelineLayoutCreateInfo                      info{};
 		info.sType                                    = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
 		info.setLayoutCount                           = layouts.size();
 		info.pSetLayouts                              = layouts.data();
-		info.pushConstantRangeCount                   = 0;
-		info.pPushConstantRanges                      = nullptr;
+		info.pushConstantRangeCount                   = 1;
+		info.pPushConstantRanges                      = &range;
 
 		m_PipelineLayout.CreatePipelineLayout(GetContext().Get<IDevice>()->Handle(), info);
 
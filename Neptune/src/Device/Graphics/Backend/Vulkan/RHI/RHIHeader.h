@@ -19,5 +19,6 @@
 #include "Device/Graphics/Backend/Vulkan/RHI/CmdList2.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/Video/Decode/Decoder.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/OpticalFlowSession.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/GPUScene.h"
 
 #endif
\ No newline at end of file
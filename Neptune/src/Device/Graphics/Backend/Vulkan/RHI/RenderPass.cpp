@@ -12,6 +12,7 @@
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/DebugUtilsObject.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/Device.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/PhysicalDevice.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/ReleaseQueue.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/SwapChain.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/RenderTarget.h"
 #include "Device/Graphics/Backend/Vulkan/Converter.h"
@@ -140,6 +141,39 @@ namespace Neptune::Vulkan {
 			DEBUGUTILS_SETOBJECTNAME(m_RenderPass, "RenderPass")
 		}
 
+		CreateFrameBuffers(count);
+	}
+
+	void RenderPass::SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		assert(index < m_ImageViews.size());
+		assert(ToVkFormat(renderTarget->GetFormat()) == m_AttachmentDescriptions[m_AttachmentDescriptions.size() - m_ImageViews.size() + index].format);
+
+		m_ImageViews[index] = renderTarget->GetRHIImpl<RenderTarget>()->GetView();
+
+		m_Extent.reset();
+
+		StoreExtent({ renderTarget->GetWidth(), renderTarget->GetHeight() });
+
+		const auto count = static_cast<uint32_t>(m_FrameBuffers.size());
+
+		// Frames in flight may still use the old FrameBuffers, however often rebinds happen in a frame.
+		for (auto& frameBuffer : m_FrameBuffers)
+		{
+			GetContext().Get<IReleaseQueue>()->Release(std::move(frameBuffer));
+		}
+
+		m_FrameBuffers = {};
+
+		CreateFrameBuffers(count);
+	}
+
+	void RenderPass::CreateFrameBuffers(uint32_t count)
+	{
+		NEPTUNE_PROFILE_ZONE
+
 		const bool swapChianInUsed = m_ImageViews.size() < m_AttachmentDescriptions.size();
 
 		for (size_t i = 0; i < count; i++)
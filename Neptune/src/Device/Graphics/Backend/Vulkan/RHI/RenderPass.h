@@ -67,6 +67,15 @@ namespace Neptune::Vulkan {
 		*/
 		void Build(uint32_t count = MaxFrameInFlight) override;
 
+		/**
+		* @brief Interface of Rebind a Color Attachment of a built RenderPass.
+		* VkRenderPass is kept, only FrameBuffers are recreated.
+		*
+		* @param[in] index Color Attachment index.
+		* @param[in] renderTarget RenderTarget, same format as the replaced one.
+		*/
+		void SetColorAttachment(uint32_t index, SP<RHI::RenderTarget> renderTarget) override;
+
 	public:
 
 		/**
@@ -100,6 +109,13 @@ namespace Neptune::Vulkan {
 		*/
 		void StoreExtent(const VkExtent2D& extent);
 
+		/**
+		* @brief Create FrameBuffers.
+		*
+		* @param[in] count Flight Frames.
+		*/
+		void CreateFrameBuffers(uint32_t count);
+
 	private:
 
 		Unit::RenderPass                                  m_RenderPass;                      // @brief This RenderPass.
@@ -10,11 +10,22 @@
 
 #include "RenderTarget.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/PhysicalDevice.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/BindLessHeap.h"
 #include "Device/Graphics/Backend/Vulkan/Converter.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/CmdList2.h"
 
 namespace Neptune::Vulkan {
 
+	RenderTarget::~RenderTarget()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (GetContext().Has<IBindLessHeap>())
+		{
+			GetContext().Get<IBindLessHeap>()->ReleaseTexture(m_BindLessIndex);
+		}
+	}
+
 	void RenderTarget::CreateRenderTarget(const RenderTargetCreateInfo& info)
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -152,6 +163,7 @@ namespace Neptune::Vulkan {
 			createInfo.tiling                                = VK_IMAGE_TILING_OPTIMAL;
 			createInfo.initialLayout                         = VK_IMAGE_LAYOUT_UNDEFINED;
 			createInfo.usage                                 = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | 
+															   VK_IMAGE_USAGE_TRANSFER_SRC_BIT |
 															   VK_IMAGE_USAGE_TRANSFER_DST_BIT |
 														       VK_IMAGE_USAGE_SAMPLED_BIT;
 			createInfo.sharingMode                           = VK_SHARING_MODE_EXCLUSIVE;
@@ -211,6 +223,8 @@ namespace Neptune::Vulkan {
 		}
 
 		m_Image->SetName("RenderTarget");
+
+		m_BindLessIndex = GetContext().Get<IBindLessHeap>()->AcquireTexture(m_Image->GetView(), m_Image->GetSampler());
 	}
 
 	void RenderTarget::CreateDepthRenderTarget(const RenderTargetCreateInfo& info)
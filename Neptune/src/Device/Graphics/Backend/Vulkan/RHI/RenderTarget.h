@@ -34,7 +34,7 @@ namespace Neptune::Vulkan {
 		/**
 		* @brief Destructor Function.
 		*/
-		~RenderTarget() override = default;
+		~RenderTarget() override;
 
 	public:
 
@@ -82,6 +82,13 @@ namespace Neptune::Vulkan {
 		*/
 		uint32_t GetHeight() const override { return m_Image->Height(); }
 
+		/**
+		* @brief Interface of Get BindLess Index.
+		*
+		* @return Returns stable index in BindLess texture heap.
+		*/
+		uint32_t GetBindLessIndex() const override { return m_BindLessIndex; }
+
 	public:
 
 		/**
@@ -146,6 +153,7 @@ namespace Neptune::Vulkan {
 
 		SP<Resource::Image> m_Image;                      // @brief This Image.
 		Resource::DescriptorSet m_DescriptorSet;          // @brief This DescriptorSet.
+		uint32_t m_BindLessIndex = BindLessTextureSize;   // @brief Index in BindLess texture heap.
 	};
 }
 
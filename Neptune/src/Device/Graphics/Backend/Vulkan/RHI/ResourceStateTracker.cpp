@@ -0,0 +1,335 @@
+/**
+* @file ResourceStateTracker.cpp.
+* @brief The ResourceStateTracker Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "ResourceStateTracker.h"
+#include "Device/Graphics/Backend/Vulkan/Unit/CommandBuffer.h"
+#include "Device/Graphics/Backend/Vulkan/Resource/Image.h"
+#include "Device/Graphics/Backend/Vulkan/Resource/Buffer.h"
+
+#include <atomic>
+
+namespace Neptune::Vulkan {
+
+	namespace {
+
+		/**
+		* @brief Accesses which make memory unavailable to later accesses.
+		*/
+		constexpr VkAccessFlags2 WriteAccess = VK_ACCESS_2_SHADER_WRITE_BIT                   |
+		                                       VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT           |
+		                                       VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT         |
+		                                       VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT |
+		                                       VK_ACCESS_2_TRANSFER_WRITE_BIT                 |
+		                                       VK_ACCESS_2_HOST_WRITE_BIT                     |
+		                                       VK_ACCESS_2_MEMORY_WRITE_BIT                   |
+		                                       VK_ACCESS_2_VIDEO_DECODE_WRITE_BIT_KHR         |
+		                                       VK_ACCESS_2_OPTICAL_FLOW_WRITE_BIT_NV;
+
+		std::atomic<uint64_t> s_Requested = 0;    // @brief Requested of all trackers.
+		std::atomic<uint64_t> s_Issued    = 0;    // @brief Issued of all trackers.
+		std::atomic<uint64_t> s_Batches   = 0;    // @brief Batches of all trackers.
+
+		/**
+		* @brief Get stages and accesses an Image in a layout is used with.
+		*
+		* @param[in] layout VkImageLayout.
+		* @param[out] stage VkPipelineStageFlags2.
+		* @param[out] access VkAccessFlags2.
+		*/
+		void LayoutUsage(VkImageLayout layout, VkPipelineStageFlags2& stage, VkAccessFlags2& access)
+		{
+			switch (layout)
+			{
+				case VK_IMAGE_LAYOUT_UNDEFINED:
+				case VK_IMAGE_LAYOUT_PRESENT_SRC_KHR:
+					stage  = VK_PIPELINE_STAGE_2_NONE;
+					access = VK_ACCESS_2_NONE;
+					break;
+				case VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL:
+					stage  = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+					access = VK_ACCESS_2_TRANSFER_READ_BIT;
+					break;
+				case VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL:
+					stage  = VK_PIPELINE_STAGE_2_TRANSFER_BIT;
+					access = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+					break;
+				case VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL:
+					stage  = VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT;
+					access = VK_ACCESS_2_SHADER_SAMPLED_READ_BIT;
+					break;
+				case VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL:
+					stage  = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+					access = VK_ACCESS_2_COLOR_ATTACHMENT_READ_BIT | VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT;
+					break;
+				case VK_IMAGE_LAYOUT_DEPTH_STENCIL_ATTACHMENT_OPTIMAL:
+					stage  = VK_PIPELINE_STAGE_2_EARLY_FRAGMENT_TESTS_BIT | VK_PIPELINE_STAGE_2_LATE_FRAGMENT_TESTS_BIT;
+					access = VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_READ_BIT | VK_ACCESS_2_DEPTH_STENCIL_ATTACHMENT_WRITE_BIT;
+					break;
+				case VK_IMAGE_LAYOUT_VIDEO_DECODE_DST_KHR:
+					stage  = VK_PIPELINE_STAGE_2_VIDEO_DECODE_BIT_KHR;
+					access = VK_ACCESS_2_VIDEO_DECODE_WRITE_BIT_KHR;
+					break;
+				case VK_IMAGE_LAYOUT_VIDEO_DECODE_DPB_KHR:
+					stage  = VK_PIPELINE_STAGE_2_VIDEO_DECODE_BIT_KHR;
+					access = VK_ACCESS_2_VIDEO_DECODE_READ_BIT_KHR | VK_ACCESS_2_VIDEO_DECODE_WRITE_BIT_KHR;
+					break;
+				default:
+					stage  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+					access = VK_ACCESS_2_MEMORY_READ_BIT | VK_ACCESS_2_MEMORY_WRITE_BIT;
+					break;
+			}
+		}
+
+		/**
+		* @brief Get aspect of an Image format.
+		*
+		* @param[in] format VkFormat.
+		*
+		* @return Returns VkImageAspectFlags.
+		*/
+		VkImageAspectFlags FormatAspect(VkFormat format)
+		{
+			switch (format)
+			{
+				case VK_FORMAT_D16_UNORM:
+				case VK_FORMAT_X8_D24_UNORM_PACK32:
+				case VK_FORMAT_D32_SFLOAT:            return VK_IMAGE_ASPECT_DEPTH_BIT;
+				case VK_FORMAT_D16_UNORM_S8_UINT:
+				case VK_FORMAT_D24_UNORM_S8_UINT:
+				case VK_FORMAT_D32_SFLOAT_S8_UINT:    return VK_IMAGE_ASPECT_DEPTH_BIT | VK_IMAGE_ASPECT_STENCIL_BIT;
+				default:                              return VK_IMAGE_ASPECT_COLOR_BIT;
+			}
+		}
+	}
+
+	ResourceStateTracker::ResourceStateTracker(std::pmr::memory_resource* resource)
+		: m_Images(resource)
+		, m_Buffers(resource)
+		, m_ImageBarriers(resource)
+		, m_BufferBarriers(resource)
+	{
+		NEPTUNE_PROFILE_ZONE
+	}
+
+	void ResourceStateTracker::Reset()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_Images.clear();
+		m_Buffers.clear();
+		m_ImageBarriers.clear();
+		m_BufferBarriers.clear();
+	}
+
+	void ResourceStateTracker::TransitionImage(Resource::Image* image, VkImageLayout newLayout, VkPipelineStageFlags2 stage, VkAccessFlags2 access)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		TransitionImage(image->Handle(), image->GetLayout(), FormatAspect(image->GetFormat()), image->GetLayerCount(), newLayout, stage, access);
+
+		image->SetLayout(newLayout);
+	}
+
+	void ResourceStateTracker::TransitionImage(VkImage image, VkImageLayout layout, VkImageAspectFlags aspect, uint32_t layerCount, VkImageLayout newLayout, VkPipelineStageFlags2 stage, VkAccessFlags2 access)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		++m_Stats.requested;
+		++s_Requested;
+
+		if (stage == 0 && access == 0)
+		{
+			LayoutUsage(newLayout, stage, access);
+		}
+
+		auto [it, inserted] = m_Images.try_emplace(image);
+
+		auto& state = it->second;
+
+		if (inserted)
+		{
+			state.layout = layout;
+
+			LayoutUsage(state.layout, state.stage, state.access);
+		}
+
+		// No action command used the Image since its last request, retarget that barrier.
+		if (state.pending >= 0)
+		{
+			auto& barrier            = m_ImageBarriers[state.pending];
+			barrier.newLayout        = newLayout;
+			barrier.dstStageMask     = stage;
+			barrier.dstAccessMask    = access;
+
+			state.layout             = newLayout;
+			state.stage              = stage;
+			state.access             = access;
+
+			return;
+		}
+
+		// Read after read in the same layout needs no barrier.
+		if (state.layout == newLayout && (state.access & WriteAccess) == 0 && (access & WriteAccess) == 0)
+		{
+			state.stage  |= stage;
+			state.access |= access;
+
+			return;
+		}
+
+		VkImageMemoryBarrier2                         barrier{};
+		barrier.sType                               = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+		barrier.srcStageMask                        = state.stage;
+		barrier.srcAccessMask                       = state.access & WriteAccess;
+		barrier.dstStageMask                        = stage;
+		barrier.dstAccessMask                       = access;
+		barrier.oldLayout                           = state.layout;
+		barrier.newLayout                           = newLayout;
+		barrier.srcQueueFamilyIndex                 = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex                 = VK_QUEUE_FAMILY_IGNORED;
+		barrier.image                               = image;
+		barrier.subresourceRange.aspectMask         = aspect;
+		barrier.subresourceRange.baseMipLevel       = 0;
+		barrier.subresourceRange.levelCount         = VK_REMAINING_MIP_LEVELS;
+		barrier.subresourceRange.baseArrayLayer     = 0;
+		barrier.subresourceRange.layerCount         = layerCount;
+
+		state.pending = static_cast<int64_t>(m_ImageBarriers.size());
+		state.layout  = newLayout;
+		state.stage   = stage;
+		state.access  = access;
+
+		m_ImageBarriers.push_back(barrier);
+	}
+
+	void ResourceStateTracker::AccessBuffer(const Resource::Buffer* buffer, VkPipelineStageFlags2 stage, VkAccessFlags2 access)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		AccessBuffer(buffer->Handle(), stage, access);
+	}
+
+	void ResourceStateTracker::AccessBuffer(VkBuffer buffer, VkPipelineStageFlags2 stage, VkAccessFlags2 access)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		++m_Stats.requested;
+		++s_Requested;
+
+		auto [it, inserted] = m_Buffers.try_emplace(buffer);
+
+		auto& state = it->second;
+
+		if (inserted)
+		{
+			// Last use before this CommandBuffer is unknown, it may be a write of any stage
+			// still in flight (a copy in an earlier submit, another queue), so the first
+			// access always waits on it.
+			state.stage  = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+			state.access = VK_ACCESS_2_MEMORY_WRITE_BIT;
+		}
+
+		if (state.pending >= 0)
+		{
+			auto& barrier            = m_BufferBarriers[state.pending];
+			barrier.dstStageMask    |= stage;
+			barrier.dstAccessMask   |= access;
+
+			state.stage             |= stage;
+			state.access            |= access;
+
+			return;
+		}
+
+		if ((state.access & WriteAccess) == 0 && (access & WriteAccess) == 0)
+		{
+			state.stage  |= stage;
+			state.access |= access;
+
+			return;
+		}
+
+		VkBufferMemoryBarrier2                        barrier{};
+		barrier.sType                               = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+		barrier.srcStageMask                        = state.stage;
+		barrier.srcAccessMask                       = state.access & WriteAccess;
+		barrier.dstStageMask                        = stage;
+		barrier.dstAccessMask                       = access;
+		barrier.srcQueueFamilyIndex                 = VK_QUEUE_FAMILY_IGNORED;
+		barrier.dstQueueFamilyIndex                 = VK_QUEUE_FAMILY_IGNORED;
+		barrier.buffer                              = buffer;
+		barrier.offset                              = 0;
+		barrier.size                                = VK_WHOLE_SIZE;
+
+		state.pending = static_cast<int64_t>(m_BufferBarriers.size());
+		state.stage   = stage;
+		state.access  = access;
+
+		m_BufferBarriers.push_back(barrier);
+	}
+
+	void ResourceStateTracker::Flush(const Unit::CommandBuffer& commandBuffer)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Flush([&](const VkDependencyInfo& dependencyInfo) { commandBuffer.PipelineBarrier2(dependencyInfo); });
+	}
+
+	void ResourceStateTracker::Flush(const std::function<void(const VkDependencyInfo&)>& record)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (m_ImageBarriers.empty() && m_BufferBarriers.empty()) return;
+
+		VkDependencyInfo                              dependencyInfo{};
+		dependencyInfo.sType                        = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+		dependencyInfo.bufferMemoryBarrierCount     = static_cast<uint32_t>(m_BufferBarriers.size());
+		dependencyInfo.pBufferMemoryBarriers        = m_BufferBarriers.data();
+		dependencyInfo.imageMemoryBarrierCount      = static_cast<uint32_t>(m_ImageBarriers.size());
+		dependencyInfo.pImageMemoryBarriers         = m_ImageBarriers.data();
+
+		record(dependencyInfo);
+
+		const auto issued = m_ImageBarriers.size() + m_BufferBarriers.size();
+
+		m_Stats.issued  += issued;
+		m_Stats.batches += 1;
+
+		s_Issued  += issued;
+		s_Batches += 1;
+
+		for (const auto& barrier : m_ImageBarriers)
+		{
+			m_Images[barrier.image].pending = -1;
+		}
+
+		for (const auto& barrier : m_BufferBarriers)
+		{
+			m_Buffers[barrier.buffer].pending = -1;
+		}
+
+		m_ImageBarriers.clear();
+		m_BufferBarriers.clear();
+	}
+
+	BarrierStats ResourceStateTracker::GetTotalStats()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		BarrierStats stats;
+		stats.requested = s_Requested.load();
+		stats.issued    = s_Issued.load();
+		stats.batches   = s_Batches.load();
+
+		return stats;
+	}
+}
+
+#endif
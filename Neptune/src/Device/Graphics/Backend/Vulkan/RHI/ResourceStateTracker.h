@@ -0,0 +1,158 @@
+/**
+* @file ResourceStateTracker.h.
+* @brief The ResourceStateTracker Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Core/Core.h"
+#include "Device/Graphics/Backend/Vulkan/Core.h"
+
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::Vulkan {
+
+	namespace Unit {
+
+		class CommandBuffer;
+	}
+
+	namespace Resource {
+
+		class Image;
+		class Buffer;
+	}
+
+	/**
+	* @brief Barrier counters.
+	*/
+	struct BarrierStats
+	{
+		uint64_t                       requested = 0;     // @brief Transitions and accesses requested.
+		uint64_t                       issued    = 0;     // @brief Barriers recorded.
+		uint64_t                       batches   = 0;     // @brief vkCmdPipelineBarrier2 calls.
+	};
+
+	/**
+	* @brief Vulkan::ResourceStateTracker Class.
+	* This class tracks layout, access and stage of Images and Buffers used by one CommandBuffer.
+	* Requested transitions are deferred and flushed as one vkCmdPipelineBarrier2 before the
+	* next action command. Read after read is dropped, chained transitions of one Image collapse.
+	*/
+	class ResourceStateTracker
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] resource Memory of tracked states and barriers, must outlive this tracker.
+		*/
+		explicit ResourceStateTracker(std::pmr::memory_resource* resource = std::pmr::get_default_resource());
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~ResourceStateTracker() = default;
+
+		/**
+		* @brief Forget tracked states and pending barriers, call when a new CommandBuffer begins.
+		*/
+		void Reset();
+
+		/**
+		* @brief Request an Image transition, the Image layout is updated immediately.
+		*
+		* @param[in] image Image.
+		* @param[in] newLayout VkImageLayout.
+		* @param[in] stage Stages using the Image next, 0 derives from layout.
+		* @param[in] access Accesses of the Image next, 0 derives from layout.
+		*/
+		void TransitionImage(Resource::Image* image, VkImageLayout newLayout, VkPipelineStageFlags2 stage = 0, VkAccessFlags2 access = 0);
+
+		/**
+		* @brief Request an Image transition by handle.
+		*
+		* @param[in] image VkImage.
+		* @param[in] layout VkImageLayout of the Image before this CommandBuffer, used on first request only.
+		* @param[in] aspect VkImageAspectFlags.
+		* @param[in] layerCount Layer count.
+		* @param[in] newLayout VkImageLayout.
+		* @param[in] stage Stages using the Image next, 0 derives from layout.
+		* @param[in] access Accesses of the Image next, 0 derives from layout.
+		*/
+		void TransitionImage(VkImage image, VkImageLayout layout, VkImageAspectFlags aspect, uint32_t layerCount, VkImageLayout newLayout, VkPipelineStageFlags2 stage = 0, VkAccessFlags2 access = 0);
+
+		/**
+		* @brief Request a Buffer access.
+		*
+		* @param[in] buffer Buffer.
+		* @param[in] stage Stages using the Buffer next.
+		* @param[in] access Accesses of the Buffer next.
+		*/
+		void AccessBuffer(const Resource::Buffer* buffer, VkPipelineStageFlags2 stage, VkAccessFlags2 access);
+
+		/**
+		* @brief Request a Buffer access by handle.
+		*
+		* @param[in] buffer VkBuffer.
+		* @param[in] stage Stages using the Buffer next.
+		* @param[in] access Accesses of the Buffer next.
+		*/
+		void AccessBuffer(VkBuffer buffer, VkPipelineStageFlags2 stage, VkAccessFlags2 access);
+
+		/**
+		* @brief Record pending barriers in one vkCmdPipelineBarrier2.
+		*
+		* @param[in] commandBuffer Unit::CommandBuffer.
+		*/
+		void Flush(const Unit::CommandBuffer& commandBuffer);
+
+		/**
+		* @brief Hand pending barriers to a recorder as one VkDependencyInfo.
+		*
+		* @param[in] record Recorder, called only if barriers are pending.
+		*/
+		void Flush(const std::function<void(const VkDependencyInfo&)>& record);
+
+		/**
+		* @brief Get barrier counters of this tracker.
+		*
+		* @return Returns BarrierStats.
+		*/
+		const BarrierStats& GetStats() const { return m_Stats; }
+
+		/**
+		* @brief Get barrier counters of all trackers since start.
+		*
+		* @return Returns BarrierStats.
+		*/
+		static BarrierStats GetTotalStats();
+
+	private:
+
+		/**
+		* @brief Tracked state of a resource.
+		*/
+		struct State
+		{
+			VkImageLayout              layout  = VK_IMAGE_LAYOUT_UNDEFINED;    // @brief Current layout.
+			VkPipelineStageFlags2      stage   = VK_PIPELINE_STAGE_2_NONE;     // @brief Stages of last use.
+			VkAccessFlags2             access  = VK_ACCESS_2_NONE;             // @brief Accesses of last use.
+			int64_t                    pending = -1;                           // @brief Index of pending barrier, -1 if none.
+		};
+
+		std::pmr::unordered_map<VkImage, State>       m_Images;                // @brief Tracked Images.
+		std::pmr::unordered_map<VkBuffer, State>      m_Buffers;               // @brief Tracked Buffers.
+		std::pmr::vector<VkImageMemoryBarrier2>       m_ImageBarriers;         // @brief Pending Image barriers.
+		std::pmr::vector<VkBufferMemoryBarrier2>      m_BufferBarriers;        // @brief Pending Buffer barriers.
+		BarrierStats                                  m_Stats;                 // @brief Barrier counters.
+	};
+}
+
+#endif
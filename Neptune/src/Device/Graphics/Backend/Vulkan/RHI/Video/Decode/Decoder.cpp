@@ -15,6 +15,7 @@
 #include "Device/Graphics/Frontend/RHI/RenderTarget.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/RenderTarget.h"
 #include "Device/Graphics/Backend/Vulkan/Resource/QueryPool.h"
+#include "Core/Memory/AllocTracker.h"
 
 #include <bitset>
 
@@ -428,6 +429,9 @@ namespace Neptune::Vulkan {
 
     void Decoder::ParserDataChunk(uint8_t* data, uint64_t size)
 	{
+        // Parser and decode callbacks run inside, all their allocations are Video.
+        NEPTUNE_ALLOC_TAG(Video)
+
         size_t consumed = 0;
         bool requiresPartialParsing = false;
 
@@ -48,6 +48,13 @@ namespace Neptune::Vulkan::Resource {
 		*/
 		const VkDeviceSize& Size() const { return m_Buffer.Size(); }
 
+		/**
+		* @brief Get Buffer Device Address.
+		*
+		* @return Returns Buffer Device Address.
+		*/
+		VkDeviceAddress Address() const { return m_Buffer.Address(); }
+
 		/**
 		* @brief Get Buffer Host Data.
 		*
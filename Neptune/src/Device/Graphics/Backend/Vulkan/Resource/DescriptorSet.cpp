@@ -14,8 +14,10 @@
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/MemoryAllocator.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/PhysicalDevice.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/DescriptorPool.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/DescriptorSetLayoutCache.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/RenderTarget.h"
 #include "Buffer.h"
+#include "Core/Memory/ScopedArena.h"
 
 namespace Neptune::Vulkan::Resource {
 
@@ -23,9 +25,16 @@ namespace Neptune::Vulkan::Resource {
 	{
 		NEPTUNE_PROFILE_ZONE
 
+		// One copy per frame in flight, a frame never writes a copy an earlier frame still reads.
+		const auto alignment = GetContext().Get<IPhysicalDevice>()->GetProperties().limits.minUniformBufferOffsetAlignment;
+		const auto stride    = (info.size + alignment - 1) / alignment * alignment;
+
+		auto frameInfo = info;
+		frameInfo.size = stride * MaxFrameInFlight;
+
 		auto buffer = CreateSP<Buffer>(GetContext());
 		
-		buffer->CreateBuffer(info, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
+		buffer->CreateBuffer(frameInfo, VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT);
 
 		buffer->SetName("UniformBuffer");
 
@@ -34,8 +43,11 @@ namespace Neptune::Vulkan::Resource {
 		data.bufferInfo.buffer          = buffer->Handle();
 		data.bufferInfo.offset          = 0;
 		data.bufferInfo.range           = info.size;
+		data.stride                     = stride;
 
 		m_Bindings.emplace(binding.binding, BindingData{ binding, data });
+
+		m_HasBuffers = true;
 	}
 
 	void DescriptorSet::AddBinding(const VkDescriptorImageInfo& info, const VkDescriptorSetLayoutBinding& binding)
@@ -52,11 +64,13 @@ namespace Neptune::Vulkan::Resource {
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		auto buffer = std::get<BufferBindingData>(m_Bindings[binding].data).buffer;
+		const auto& bufferData = std::get<BufferBindingData>(m_Bindings[binding].data);
 
-		buffer->WriteToBuffer(data);
+		const auto offset = bufferData.stride * GetContext().Get<IDescriptorPool>()->GetFrameIndex();
 
-		buffer->Flush();
+		bufferData.buffer->WriteToBuffer(data, bufferData.bufferInfo.range, offset);
+
+		bufferData.buffer->Flush(bufferData.bufferInfo.range, offset);
 	}
 
 	void DescriptorSet::UpdateTexture(uint32_t binding, const Vulkan::RenderTarget* renderTarget)
@@ -78,6 +92,11 @@ namespace Neptune::Vulkan::Resource {
 		write.descriptorCount           = imageInfos.size();
 
 		m_DescriptorSet.UpdateDescriptorSet(write);
+
+		// The transient set of this frame was written with the old image.
+		std::unique_lock lock(m_Mutex);
+
+		m_FrameSetRecycles = UINT64_MAX;
 	}
 
 	void DescriptorSet::BuildDescriptorSet()
@@ -86,13 +105,16 @@ namespace Neptune::Vulkan::Resource {
 
 		CreateDescriptorSetLayout();
 
-		VkDescriptorSetAllocateInfo        allocInfo{};
-		allocInfo.sType                  = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
-		allocInfo.descriptorPool         = GetContext().Get<IDescriptorPool>()->Handle();
-		allocInfo.pSetLayouts            = &m_Layout.GetHandle();
-		allocInfo.descriptorSetCount     = 1;
+		Memory::ScopedArena<> arena;
+
+		auto setBindings = arena.Vector<VkDescriptorSetLayoutBinding>(m_Bindings.size());
+
+		for (auto& data : m_Bindings | std::views::values)
+		{
+			setBindings.emplace_back(data.binding);
+		}
 
-		m_DescriptorSet.AllocateDescriptorSet(GetContext().Get<IDevice>()->Handle(), allocInfo);
+		GetContext().Get<IDescriptorPool>()->Allocate(m_DescriptorSet, m_Layout->GetHandle(), setBindings);
 
 		DEBUGUTILS_SETOBJECTNAME(m_DescriptorSet, "DescriptorSet");
 	}
@@ -101,14 +123,52 @@ namespace Neptune::Vulkan::Resource {
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		for (int i = 0; i < m_Bindings.size(); ++i)
+		WriteBindings(m_DescriptorSet.GetHandle(), 0);
+	}
+
+	VkDescriptorSet DescriptorSet::FrameHandle()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (!m_HasBuffers) return m_DescriptorSet.GetHandle();
+
+		const auto& pool = GetContext().Get<IDescriptorPool>();
+
+		std::unique_lock lock(m_Mutex);
+
+		// Allocated once per frame, the pool drops it when this frame index is recycled.
+		if (m_FrameSetRecycles != pool->GetRecycles())
+		{
+			Memory::ScopedArena<> arena;
+
+			auto setBindings = arena.Vector<VkDescriptorSetLayoutBinding>(m_Bindings.size());
+
+			for (auto& data : m_Bindings | std::views::values)
+			{
+				setBindings.emplace_back(data.binding);
+			}
+
+			m_FrameSet         = pool->AllocateTransient(m_Layout->GetHandle(), setBindings);
+			m_FrameSetRecycles = pool->GetRecycles();
+
+			WriteBindings(m_FrameSet, pool->GetFrameIndex());
+		}
+
+		return m_FrameSet;
+	}
+
+	void DescriptorSet::WriteBindings(VkDescriptorSet set, uint32_t frameIndex)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		for (auto& [index, binding] : m_Bindings)
 		{
-			const auto& binding = m_Bindings[i];
+			VkDescriptorBufferInfo            bufferInfo{};
 
 			VkWriteDescriptorSet              write{};
 			write.sType                     = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
-			write.dstBinding                = i;
-			write.dstSet                    = m_DescriptorSet.GetHandle();
+			write.dstBinding                = index;
+			write.dstSet                    = set;
 			write.descriptorType            = binding.binding.descriptorType;
 
 			switch (write.descriptorType)
@@ -124,12 +184,17 @@ namespace Neptune::Vulkan::Resource {
 				}
 				case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
 				case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
-					write.pBufferInfo           = &std::get<BufferBindingData>(binding.data).bufferInfo;
+				{
+					const auto& bufferData      = std::get<BufferBindingData>(binding.data);
+					bufferInfo                  = bufferData.bufferInfo;
+					bufferInfo.offset          += bufferData.stride * frameIndex;
+					write.pBufferInfo           = &bufferInfo;
 					write.descriptorCount       = 1;
 					break;
+				}
 				default:
 				{
-					NEPTUNE_CORE_WARN("Invalid VkDescriptorType in UpdateDescriptorSet.")
+					NEPTUNE_CORE_WARN("Invalid VkDescriptorType in WriteBindings.")
 					break;
 				}
 			}
@@ -142,8 +207,10 @@ namespace Neptune::Vulkan::Resource {
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		std::vector<VkDescriptorSetLayoutBinding> setBindings{};
-		std::vector<VkDescriptorBindingFlags> setBindingFlags{};
+		Memory::ScopedArena<> arena;
+
+		auto setBindings     = arena.Vector<VkDescriptorSetLayoutBinding>(m_Bindings.size());
+		auto setBindingFlags = arena.Vector<VkDescriptorBindingFlags>(m_Bindings.size());
 
 		for (auto& data : m_Bindings | std::views::values)
 		{
@@ -163,22 +230,7 @@ namespace Neptune::Vulkan::Resource {
 			}
 		}
 
-		VkDescriptorSetLayoutBindingFlagsCreateInfo         bindingFlags{};
-		bindingFlags.sType                                = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
-		bindingFlags.pNext                                = nullptr;
-		bindingFlags.pBindingFlags                        = setBindingFlags.data();
-		bindingFlags.bindingCount                         = setBindingFlags.size();
-
-		VkDescriptorSetLayoutCreateInfo                     layoutCreateInfo{};
-		layoutCreateInfo.sType                            = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
-		layoutCreateInfo.bindingCount                     = setBindings.size();
-		layoutCreateInfo.pBindings                        = setBindings.data();
-		layoutCreateInfo.flags                            = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
-		layoutCreateInfo.pNext                            = &bindingFlags;
-
-		m_Layout.CreateDescriptorSetLayout(GetContext().Get<IDevice>()->Handle(), layoutCreateInfo);
-
-		DEBUGUTILS_SETOBJECTNAME(m_Layout, "DescriptorSetLayout")
+		m_Layout = GetContext().Get<IDescriptorSetLayoutCache>()->Get(setBindings, setBindingFlags);
 	}
 }
 
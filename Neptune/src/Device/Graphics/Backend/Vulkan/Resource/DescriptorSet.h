@@ -14,6 +14,7 @@
 #include "Device/Graphics/Backend/Vulkan/Unit/DescriptorSetLayout.h"
 
 #include <map>
+#include <mutex>
 #include <vector>
 #include <variant>
 
@@ -27,6 +28,8 @@ namespace Neptune::Vulkan::Resource {
 	/**
 	* @brief Vulkan::DescriptorSet Class.
 	* This class defines the Vulkan::DescriptorSet behaves.
+	* UniformBuffers hold one copy per frame in flight, a set with UniformBuffers is bound through
+	* a transient set per frame which points at that frame's copy.
 	*/
 	class DescriptorSet : public ContextAccessor
 	{
@@ -51,6 +54,13 @@ namespace Neptune::Vulkan::Resource {
 		*/
 		const Unit::DescriptorSet::Handle& Handle() const { return m_DescriptorSet.GetHandle(); }
 
+		/**
+		* @brief Get the set to bind for the current frame.
+		*
+		* @return Returns a transient set of this frame if UniformBuffers are bound, else Handle().
+		*/
+		VkDescriptorSet FrameHandle();
+
 		/**
 		* @brief Add DescriptorSet Binding.
 		*
@@ -68,7 +78,7 @@ namespace Neptune::Vulkan::Resource {
 		void AddBinding(const VkDescriptorImageInfo& info, const VkDescriptorSetLayoutBinding& binding);
 
 		/**
-		* @brief Update Buffer Binding.
+		* @brief Update Buffer Binding, only the copy of the current frame is written.
 		*
 		* @param[in] binding .
 		* @param[in] data Buffer Data.
@@ -98,7 +108,7 @@ namespace Neptune::Vulkan::Resource {
 		*
 		* @return Returns DescriptorSetLayout Unit Handle.
 		*/
-		const Unit::DescriptorSetLayout::Handle& GetDescriptorSetLayout() const { return m_Layout.GetHandle(); }
+		const Unit::DescriptorSetLayout::Handle& GetDescriptorSetLayout() const { return m_Layout->GetHandle(); }
 
 	private:
 
@@ -107,6 +117,14 @@ namespace Neptune::Vulkan::Resource {
 		*/
 		void CreateDescriptorSetLayout();
 
+		/**
+		* @brief Write all bindings to a set.
+		*
+		* @param[in] set VkDescriptorSet.
+		* @param[in] frameIndex Frame whose UniformBuffer copies are written.
+		*/
+		void WriteBindings(VkDescriptorSet set, uint32_t frameIndex);
+
 	private:
 
 		/**
@@ -115,7 +133,8 @@ namespace Neptune::Vulkan::Resource {
 		struct BufferBindingData 
 		{
 			SP<class Buffer> buffer;                                    // @brief Buffer Reference.
-			VkDescriptorBufferInfo bufferInfo;                          // @brief VkDescriptorBufferInfo.
+			VkDescriptorBufferInfo bufferInfo;                          // @brief VkDescriptorBufferInfo of frame 0.
+			VkDeviceSize stride;                                        // @brief Bytes between frame copies.
 		};										                       
 
 		/**
@@ -135,9 +154,13 @@ namespace Neptune::Vulkan::Resource {
 			std::variant<BufferBindingData, ImageBindingData> data;     // @brief Specific Binding.
 		};
 
-		Unit::DescriptorSet                       m_DescriptorSet;      // @brief This DescriptorSet.
-		Unit::DescriptorSetLayout                 m_Layout;             // @brief This DescriptorSetLayout.
-		std::map<uint32_t, BindingData>           m_Bindings;           // @brief This Binding.
+		Unit::DescriptorSet                       m_DescriptorSet;                  // @brief This DescriptorSet.
+		SP<Unit::DescriptorSetLayout>             m_Layout;                         // @brief This DescriptorSetLayout, shared by equivalent sets.
+		std::map<uint32_t, BindingData>           m_Bindings;                       // @brief This Binding.
+		bool                                      m_HasBuffers = false;             // @brief Has UniformBuffers, bound through FrameHandle.
+		VkDescriptorSet                           m_FrameSet = VK_NULL_HANDLE;      // @brief Transient set of current frame.
+		uint64_t                                  m_FrameSetRecycles = UINT64_MAX;  // @brief DescriptorPool Recycles when m_FrameSet was allocated.
+		std::mutex                                m_Mutex;                          // @brief Mutex of m_FrameSet.
 	};
 }
 
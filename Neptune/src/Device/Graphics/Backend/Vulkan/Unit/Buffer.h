@@ -45,6 +45,13 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		const VkDeviceSize& Size() const { return m_Size; }
 
+		/**
+		* @brief Get Buffer Device Address.
+		*
+		* @return Returns Buffer Device Address, 0 without VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT.
+		*/
+		VkDeviceAddress Address() const { return m_Address; }
+
 		/**
 		* @brief Get Buffer Host data.
 		*
@@ -110,7 +117,7 @@ namespace Neptune::Vulkan::Unit {
 		};
 
 		std::variant<std::monostate, vkAlloc, vmaAlloc> m_Alloc{ std::monostate{} };   // @brief Alloc data.
-		VkDeviceAddress  m_Address;                                                    // @brief Buffer Device Address.
+		VkDeviceAddress  m_Address = 0;                                                // @brief Buffer Device Address.
 		VkDeviceSize     m_Size;                                                       // @brief Buffer Size.
 	};
 }
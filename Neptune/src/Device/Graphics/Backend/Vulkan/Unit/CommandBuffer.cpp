@@ -76,6 +76,13 @@ namespace Neptune::Vulkan::Unit {
 		vkCmdBindDescriptorSets(m_Handle, bindPoint, layout, set, 1, &descriptorSet, 0, nullptr);
 	}
 
+	void CommandBuffer::PushConstants(VkPipelineLayout layout, VkShaderStageFlags stages, uint32_t offset, uint32_t size, const void* data) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdPushConstants(m_Handle, layout, stages, offset, size, data);
+	}
+
 	void CommandBuffer::SetViewport(const VkViewport& viewport) const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -97,6 +104,27 @@ namespace Neptune::Vulkan::Unit {
 		vkCmdDraw(m_Handle, vertexCount, instanceCount, firstVertex, firstInstance);
 	}
 
+	void CommandBuffer::BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdBindIndexBuffer(m_Handle, buffer, offset, type);
+	}
+
+	void CommandBuffer::DrawIndexedIndirectCount(VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countOffset, uint32_t maxDrawCount, uint32_t stride) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdDrawIndexedIndirectCount(m_Handle, buffer, offset, countBuffer, countOffset, maxDrawCount, stride);
+	}
+
+	void CommandBuffer::Dispatch(uint32_t x, uint32_t y, uint32_t z) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdDispatch(m_Handle, x, y, z);
+	}
+
 	void CommandBuffer::BeginVideoCoding(const PFN_vkCmdBeginVideoCodingKHR& fn, const VkVideoBeginCodingInfoKHR& info) const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -139,6 +167,13 @@ namespace Neptune::Vulkan::Unit {
 		vkCmdCopyImage(m_Handle, src, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
 	}
 
+	void CommandBuffer::BlitImage(VkImage src, VkImage dst, const VkImageBlit& region, VkFilter filter) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdBlitImage(m_Handle, src, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region, filter);
+	}
+
 	void CommandBuffer::PipelineBarrier(VkPipelineStageFlags srcMask, VkPipelineStageFlags dstMask, const VkImageMemoryBarrier& barrier) const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -146,6 +181,41 @@ namespace Neptune::Vulkan::Unit {
 		vkCmdPipelineBarrier(m_Handle, srcMask, dstMask, 0, 0, nullptr, 0, nullptr, 1, &barrier);
 	}
 
+	void CommandBuffer::PipelineBarrier2(const VkDependencyInfo& info) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdPipelineBarrier2(m_Handle, &info);
+	}
+
+	void CommandBuffer::CopyBuffer(VkBuffer src, VkBuffer dst, const VkBufferCopy& region) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdCopyBuffer(m_Handle, src, dst, 1, &region);
+	}
+
+	void CommandBuffer::FillBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, uint32_t data) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdFillBuffer(m_Handle, buffer, offset, size, data);
+	}
+
+	void CommandBuffer::CopyBufferToImage(VkBuffer src, VkImage dst, const VkBufferImageCopy& region) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdCopyBufferToImage(m_Handle, src, dst, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL, 1, &region);
+	}
+
+	void CommandBuffer::CopyImageToBuffer(VkImage src, VkBuffer dst, const VkBufferImageCopy& region) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		vkCmdCopyImageToBuffer(m_Handle, src, VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, dst, 1, &region);
+	}
+
 	void CommandBuffer::BeginQuery(VkQueryPool pool, uint32_t index, VkQueryControlFlags flag) const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -160,18 +230,18 @@ namespace Neptune::Vulkan::Unit {
 		vkCmdEndQuery(m_Handle, pool, index);
 	}
 
-	void CommandBuffer::WriteTimeStamp(VkQueryPool pool, uint32_t index) const
+	void CommandBuffer::WriteTimeStamp(VkQueryPool pool, uint32_t index, VkPipelineStageFlags2 stage) const
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		vkCmdWriteTimestamp2(m_Handle, VK_PIPELINE_STAGE_2_NONE, pool, index);
+		vkCmdWriteTimestamp2(m_Handle, stage, pool, index);
 	}
 
-	void CommandBuffer::ResetQueryPool(VkQueryPool pool, uint32_t count) const
+	void CommandBuffer::ResetQueryPool(VkQueryPool pool, uint32_t count, uint32_t first) const
 	{
 		NEPTUNE_PROFILE_ZONE
 
-		vkCmdResetQueryPool(m_Handle, pool, 0, count);
+		vkCmdResetQueryPool(m_Handle, pool, first, count);
 	}
 }
 
@@ -86,6 +86,17 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void BindDescriptorSet(VkPipelineBindPoint bindPoint, VkPipelineLayout layout, uint32_t set, VkDescriptorSet descriptorSet) const;
 
+		/**
+		* @brief Push Constants.
+		*
+		* @param[in] layout VkPipelineLayout.
+		* @param[in] stages VkShaderStageFlags.
+		* @param[in] offset .
+		* @param[in] size .
+		* @param[in] data PushConstants data.
+		*/
+		void PushConstants(VkPipelineLayout layout, VkShaderStageFlags stages, uint32_t offset, uint32_t size, const void* data) const;
+
 		/**
 		* @brief Set Viewport.
 		*
@@ -110,6 +121,36 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void Draw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const;
 
+		/**
+		* @brief Bind IndexBuffer.
+		*
+		* @param[in] buffer VkBuffer.
+		* @param[in] offset VkDeviceSize.
+		* @param[in] type VkIndexType.
+		*/
+		void BindIndexBuffer(VkBuffer buffer, VkDeviceSize offset, VkIndexType type) const;
+
+		/**
+		* @brief Draw Indexed Indirect with draw count read from a Buffer.
+		*
+		* @param[in] buffer VkBuffer of VkDrawIndexedIndirectCommand.
+		* @param[in] offset VkDeviceSize.
+		* @param[in] countBuffer VkBuffer of draw count.
+		* @param[in] countOffset VkDeviceSize.
+		* @param[in] maxDrawCount Upper bound of draw count.
+		* @param[in] stride Bytes between commands.
+		*/
+		void DrawIndexedIndirectCount(VkBuffer buffer, VkDeviceSize offset, VkBuffer countBuffer, VkDeviceSize countOffset, uint32_t maxDrawCount, uint32_t stride) const;
+
+		/**
+		* @brief Dispatch compute work.
+		*
+		* @param[in] x Group count x.
+		* @param[in] y Group count y.
+		* @param[in] z Group count z.
+		*/
+		void Dispatch(uint32_t x, uint32_t y, uint32_t z) const;
+
 		/**
 		* @brief Begin VideoCoding.
 		*
@@ -160,6 +201,16 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void CopyImage(VkImage src, VkImage dst, const VkImageCopy& region) const;
 
+		/**
+		* @brief Blit Image, converts format.
+		*
+		* @param[in] src VkImage, in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.
+		* @param[in] dst VkImage, in VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL.
+		* @param[in] region VkImageBlit.
+		* @param[in] filter VkFilter.
+		*/
+		void BlitImage(VkImage src, VkImage dst, const VkImageBlit& region, VkFilter filter) const;
+
 		/**
 		* @brief Pipeline Barrier.
 		*
@@ -169,6 +220,50 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void PipelineBarrier(VkPipelineStageFlags srcMask, VkPipelineStageFlags dstMask, const VkImageMemoryBarrier& barrier) const;
 
+		/**
+		* @brief Pipeline Barrier, synchronization2.
+		*
+		* @param[in] info VkDependencyInfo.
+		*/
+		void PipelineBarrier2(const VkDependencyInfo& info) const;
+
+		/**
+		* @brief Copy Buffer.
+		*
+		* @param[in] src VkBuffer.
+		* @param[in] dst VkBuffer.
+		* @param[in] region VkBufferCopy.
+		*/
+		void CopyBuffer(VkBuffer src, VkBuffer dst, const VkBufferCopy& region) const;
+
+		/**
+		* @brief Fill Buffer with a value.
+		*
+		* @param[in] buffer VkBuffer.
+		* @param[in] offset VkDeviceSize, multiple of 4.
+		* @param[in] size VkDeviceSize, multiple of 4 or VK_WHOLE_SIZE.
+		* @param[in] data Value of every 4 bytes.
+		*/
+		void FillBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize size, uint32_t data) const;
+
+		/**
+		* @brief Copy Buffer to Image, Image must be in transfer dst layout.
+		*
+		* @param[in] src VkBuffer.
+		* @param[in] dst VkImage.
+		* @param[in] region VkBufferImageCopy.
+		*/
+		void CopyBufferToImage(VkBuffer src, VkImage dst, const VkBufferImageCopy& region) const;
+
+		/**
+		* @brief Copy Image to Buffer.
+		*
+		* @param[in] src VkImage, in VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL.
+		* @param[in] dst VkBuffer.
+		* @param[in] region VkBufferImageCopy.
+		*/
+		void CopyImageToBuffer(VkImage src, VkBuffer dst, const VkBufferImageCopy& region) const;
+
 		/**
 		* @brief Begin Query.
 		*
@@ -191,16 +286,18 @@ namespace Neptune::Vulkan::Unit {
 		*
 		* @param[in] pool VkQueryPool.
 		* @param[in] index .
+		* @param[in] stage VkPipelineStageFlags2.
 		*/
-		void WriteTimeStamp(VkQueryPool pool, uint32_t index) const;
+		void WriteTimeStamp(VkQueryPool pool, uint32_t index, VkPipelineStageFlags2 stage = VK_PIPELINE_STAGE_2_NONE) const;
 
 		/**
 		* @brief Reset TimeStamp.
 		*
 		* @param[in] pool VkQueryPool.
 		* @param[in] count .
+		* @param[in] first First query.
 		*/
-		void ResetQueryPool(VkQueryPool pool, uint32_t count) const;
+		void ResetQueryPool(VkQueryPool pool, uint32_t count, uint32_t first = 0) const;
 
 	private:
 
@@ -31,6 +31,13 @@ namespace Neptune::Vulkan::Unit {
 
 		VK_CHECK(vkCreateCommandPool(device, &info, nullptr, &m_Handle))
 	}
+
+	void CommandPool::Reset(VkCommandPoolResetFlags flags) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		VK_CHECK(vkResetCommandPool(m_Device, m_Handle, flags))
+	}
 }
 
 #endif
\ No newline at end of file
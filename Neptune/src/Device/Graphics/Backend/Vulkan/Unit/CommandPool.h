@@ -43,6 +43,13 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void CreateCommandPool(VkDevice device, const VkCommandPoolCreateInfo& info);
 
+		/**
+		* @brief Reset CommandPool, all CommandBuffers allocated from it return to initial state.
+		*
+		* @param[in] flags VkCommandPoolResetFlags.
+		*/
+		void Reset(VkCommandPoolResetFlags flags = 0) const;
+
 	private:
 
 		VkDevice m_Device = VK_NULL_HANDLE;       // @brief VkDevice.
@@ -31,6 +31,22 @@ namespace Neptune::Vulkan::Unit {
 
 		VK_CHECK(vkCreateDescriptorPool(device, &info, nullptr, &m_Handle))
 	}
+
+	VkResult DescriptorPool::AllocateDescriptorSets(const VkDescriptorSetAllocateInfo& info, VkDescriptorSet* sets) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		assert(info.descriptorPool == m_Handle);
+
+		return vkAllocateDescriptorSets(m_Device, &info, sets);
+	}
+
+	void DescriptorPool::Reset() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		VK_CHECK(vkResetDescriptorPool(m_Device, m_Handle, 0))
+	}
 }
 
 #endif
\ No newline at end of file
@@ -43,6 +43,21 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void CreateDescriptorPool(VkDevice device, const VkDescriptorPoolCreateInfo& info);
 
+		/**
+		* @brief Allocate DescriptorSets owned by this pool, they are released by Reset.
+		*
+		* @param[in] info VkDescriptorSetAllocateInfo.
+		* @param[out] sets Allocated VkDescriptorSet.
+		*
+		* @return Returns VkResult, VK_ERROR_OUT_OF_POOL_MEMORY if pool is exhausted.
+		*/
+		VkResult AllocateDescriptorSets(const VkDescriptorSetAllocateInfo& info, VkDescriptorSet* sets) const;
+
+		/**
+		* @brief Reset DescriptorPool, all DescriptorSets allocated from it are released.
+		*/
+		void Reset() const;
+
 	private:
 
 		VkDevice m_Device = VK_NULL_HANDLE;         // @brief VkDevice.
@@ -33,6 +33,28 @@ namespace Neptune::Vulkan::Unit {
 		VK_CHECK(vkAllocateDescriptorSets(device, &info, &m_Handle))
 	}
 
+	bool DescriptorSet::TryAllocateDescriptorSet(VkDevice device, const VkDescriptorSetAllocateInfo& info)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		assert(device && info.descriptorPool);
+
+		const auto result = vkAllocateDescriptorSets(device, &info, &m_Handle);
+
+		if (result == VK_ERROR_OUT_OF_POOL_MEMORY || result == VK_ERROR_FRAGMENTED_POOL)
+		{
+			m_Handle = VK_NULL_HANDLE;
+			return false;
+		}
+
+		VK_CHECK(result)
+
+		m_Device = device;
+		m_DescriptorPool = info.descriptorPool;
+
+		return true;
+	}
+
 	void DescriptorSet::UpdateDescriptorSet(const VkWriteDescriptorSet& write) const
 	{
 		NEPTUNE_PROFILE_ZONE
@@ -43,6 +43,16 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void AllocateDescriptorSet(VkDevice device, const VkDescriptorSetAllocateInfo& info);
 
+		/**
+		* @brief Try allocate DescriptorSet, pool exhaustion is not an error.
+		*
+		* @param[in] device VkDevice.
+		* @param[in] info VkDescriptorSetAllocateInfo.
+		*
+		* @return Returns true if allocated, false if pool is out of memory or fragmented.
+		*/
+		bool TryAllocateDescriptorSet(VkDevice device, const VkDescriptorSetAllocateInfo& info);
+
 		/**
 		* @brief Update DescriptorSet.
 		*
@@ -42,6 +42,21 @@ namespace Neptune::Vulkan::Unit {
 
 		return result;
 	}
+
+	bool QueryPool::TryGetQueryPoolResult(uint32_t first, uint32_t count, std::vector<uint64_t>& result) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		result.resize(count);
+
+		const VkResult state = vkGetQueryPoolResults(m_Device, m_Handle, first, count, count * sizeof(uint64_t), result.data(), sizeof(uint64_t), VK_QUERY_RESULT_64_BIT);
+
+		if (state == VK_NOT_READY) return false;
+
+		VK_CHECK(state)
+
+		return true;
+	}
 }
 
 #endif
\ No newline at end of file
@@ -55,6 +55,17 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		std::vector<uint64_t> GetQueryPoolResult(uint32_t first, uint32_t count, uint32_t stride) const;
 
+		/**
+		* @brief Get 64 bit QueryPool Result without waiting.
+		*
+		* @param[in] first First query.
+		* @param[in] count Query count.
+		* @param[out] result Query results.
+		*
+		* @return Returns true if all results are available.
+		*/
+		bool TryGetQueryPoolResult(uint32_t first, uint32_t count, std::vector<uint64_t>& result) const;
+
 	private:
 
 		VkDevice m_Device = VK_NULL_HANDLE;     // @brief VkDevice.
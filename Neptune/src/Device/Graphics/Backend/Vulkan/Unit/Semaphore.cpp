@@ -31,6 +31,30 @@ namespace Neptune::Vulkan::Unit {
 
 		VK_CHECK(vkCreateSemaphore(device, &info, nullptr, &m_Handle))
 	}
+
+	uint64_t Semaphore::GetCounterValue() const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		uint64_t value = 0;
+
+		VK_CHECK(vkGetSemaphoreCounterValue(m_Device, m_Handle, &value))
+
+		return value;
+	}
+
+	void Semaphore::Wait(uint64_t value) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		VkSemaphoreWaitInfo                waitInfo{};
+		waitInfo.sType                   = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+		waitInfo.semaphoreCount          = 1;
+		waitInfo.pSemaphores             = &m_Handle;
+		waitInfo.pValues                 = &value;
+
+		VK_CHECK(vkWaitSemaphores(m_Device, &waitInfo, UINT64_MAX))
+	}
 }
 
 #endif
\ No newline at end of file
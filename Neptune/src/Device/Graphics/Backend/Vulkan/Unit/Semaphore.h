@@ -43,6 +43,20 @@ namespace Neptune::Vulkan::Unit {
 		*/
 		void CreateSemaphore(VkDevice device, const VkSemaphoreCreateInfo& info);
 
+		/**
+		* @brief Get Timeline Semaphore counter value.
+		*
+		* @return Returns completed value.
+		*/
+		uint64_t GetCounterValue() const;
+
+		/**
+		* @brief Wait Timeline Semaphore reaches value.
+		*
+		* @param[in] value Timeline value.
+		*/
+		void Wait(uint64_t value) const;
+
 	private:
 
 		VkDevice m_Device = VK_NULL_HANDLE;           // @brief VkDevice.
@@ -32,6 +32,7 @@ namespace Neptune {
         GDK,                  // @brief Xbox
         GDKX,                 // @brief Xbox
         NVN,                  // @brief Nintendo Switch
+        Null,                 // @brief No device, records RHI calls
 
         Count
     };
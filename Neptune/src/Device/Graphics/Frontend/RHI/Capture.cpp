@@ -0,0 +1,208 @@
+/**
+* @file Capture.cpp.
+* @brief The Capture Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "Capture.h"
+
+#include <atomic>
+#include <fstream>
+#include <mutex>
+#include <unordered_map>
+
+namespace Neptune::RHI {
+
+	namespace {
+
+		/**
+		* @brief Capture state, one capture at a time.
+		*/
+		struct CaptureState
+		{
+			std::atomic_bool                              active = false;    // @brief Is capture active.
+			std::ofstream                                 file;              // @brief Capture file.
+			std::vector<uint8_t>                          buffer;            // @brief Records not yet written.
+			std::unordered_map<const void*, uint32_t>     ids;               // @brief Ids of living objects.
+			uint32_t                                      nextId = 1;        // @brief Next object id, 0 is null.
+			std::unordered_map<uint64_t, uint32_t>        uniformBytes;      // @brief Uniform buffer bytes by object, set and binding.
+			std::mutex                                    mutex;             // @brief Mutex of state.
+		};
+
+		CaptureState s_State;    // @brief Capture state instance.
+
+		/**
+		* @brief Pack object id, set and binding into a key.
+		*
+		* @param[in] id Object id.
+		* @param[in] set Descriptor set.
+		* @param[in] binding Descriptor binding.
+		*
+		* @return Returns key.
+		*/
+		uint64_t UniformKey(uint32_t id, uint32_t set, uint32_t binding)
+		{
+			return (static_cast<uint64_t>(id) << 32) | (static_cast<uint64_t>(set & 0xFFFF) << 16) | (binding & 0xFFFF);
+		}
+
+		/**
+		* @brief Append bytes to the buffer.
+		*
+		* @param[in] data Data.
+		* @param[in] bytes Data bytes.
+		*/
+		void Append(const void* data, size_t bytes)
+		{
+			if (bytes == 0) return;
+
+			const auto offset = s_State.buffer.size();
+			s_State.buffer.resize(offset + bytes);
+
+			memcpy(s_State.buffer.data() + offset, data, bytes);
+		}
+
+		/**
+		* @brief Write buffered records to the file.
+		*/
+		void Flush()
+		{
+			s_State.file.write(reinterpret_cast<const char*>(s_State.buffer.data()), static_cast<std::streamsize>(s_State.buffer.size()));
+
+			s_State.buffer.clear();
+		}
+	}
+
+	bool Capture::Begin(const std::string& path)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		std::unique_lock<std::mutex> lock(s_State.mutex);
+
+		s_State.file.open(path, std::ios::binary | std::ios::trunc);
+
+		if (!s_State.file.is_open())
+		{
+			NEPTUNE_CORE_ERROR("Failed to open capture file.")
+			return false;
+		}
+
+		constexpr CaptureHeader header{};
+
+		Append(&header, sizeof(header));
+
+		s_State.active = true;
+
+		return true;
+	}
+
+	void Capture::End()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		std::unique_lock<std::mutex> lock(s_State.mutex);
+
+		if (!s_State.active) return;
+
+		s_State.active = false;
+
+		Flush();
+
+		s_State.file.close();
+		s_State.ids.clear();
+		s_State.uniformBytes.clear();
+		s_State.nextId = 1;
+	}
+
+	bool Capture::IsActive()
+	{
+		return s_State.active.load(std::memory_order_relaxed);
+	}
+
+	void Capture::OnCreate(ERHI e, const void* object)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		// Decoder and OpticalFlow are created from a payload which is not captured.
+		if (e == ERHI::Decoder || e == ERHI::OpticalFlow) return;
+
+		{
+			std::unique_lock<std::mutex> lock(s_State.mutex);
+
+			s_State.ids[object] = s_State.nextId++;
+		}
+
+		Record(ECaptureOp::Create, object, e);
+	}
+
+	void Capture::OnDestroy(const void* object)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (GetId(object) == 0) return;
+
+		Record(ECaptureOp::Destroy, object);
+
+		std::unique_lock<std::mutex> lock(s_State.mutex);
+
+		s_State.ids.erase(object);
+	}
+
+	uint32_t Capture::GetUniformBytes(const void* object, uint32_t set, uint32_t binding)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto id = GetId(object);
+
+		std::unique_lock<std::mutex> lock(s_State.mutex);
+
+		const auto it = s_State.uniformBytes.find(UniformKey(id, set, binding));
+
+		return it != s_State.uniformBytes.end() ? it->second : 0;
+	}
+
+	void Capture::Commit(ECaptureOp op, const void* object, const std::vector<uint8_t>& payload)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		std::unique_lock<std::mutex> lock(s_State.mutex);
+
+		if (!s_State.active) return;
+
+		const auto it = s_State.ids.find(object);
+
+		CaptureRecord                  record{};
+		record.op                    = op;
+		record.object                = it != s_State.ids.end() ? it->second : 0;
+		record.bytes                 = static_cast<uint32_t>(payload.size());
+
+		Append(&record, sizeof(record));
+		Append(payload.data(), payload.size());
+
+		if (op == ECaptureOp::AddUniformBuffer)
+		{
+			uint32_t args[3];
+			memcpy(args, payload.data(), sizeof(args));
+
+			s_State.uniformBytes[UniformKey(record.object, args[0], args[1])] = args[2];
+		}
+
+		if (op == ECaptureOp::EndFrame)
+		{
+			Flush();
+		}
+	}
+
+	uint32_t Capture::GetId(const void* object)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (!object) return 0;
+
+		std::unique_lock<std::mutex> lock(s_State.mutex);
+
+		const auto it = s_State.ids.find(object);
+
+		return it != s_State.ids.end() ? it->second : 0;
+	}
+}
@@ -0,0 +1,275 @@
+/**
+* @file Capture.h.
+* @brief The Capture Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Enum.h"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+* @brief Record a frontend RHI call if Capture is active, arguments are evaluated only then.
+*/
+#define NEPTUNE_RHI_CAPTURE(...)   { if (::Neptune::RHI::Capture::IsActive()) { ::Neptune::RHI::Capture::Record(__VA_ARGS__); } }
+
+namespace Neptune::RHI {
+
+	/**
+	* @brief Enum of captured frontend RHI operations.
+	*/
+	enum class ECaptureOp : uint8_t
+	{
+		Create = 0,
+		Destroy,
+		BeginFrame,
+		EndFrame,
+
+		SetGraphicCmdList,
+		SetComputeCmdList,
+		SetCmdListRenderPass,
+		CmdBeginRenderPass,
+		CmdEndRenderPass,
+		CmdBindDescriptor,
+		CmdBindPipeline,
+		CmdDrawFullScreenTriangle,
+		CmdDraw,
+		CmdSetViewport,
+		CmdPushConstants,
+		CmdCullGPUScene,
+		CmdDrawGPUScene,
+		CmdBlitRenderTarget,
+
+		BeginCmdList2,
+		EndCmdList2,
+		SubmitWait,
+		SetGraphicCmdList2,
+		SetVideoDecodeCmdList,
+		SetOpticalFlowCmdList,
+
+		AddUniformBuffer,
+		AddUniformTexture,
+		UpdateUniformBuffer,
+		UpdateUniformTexture,
+		SetSharedLayout,
+		CombineSharedLayout,
+		AddBindLessHeap,
+		BuildDescriptorList,
+
+		SetDefault,
+		SetPipelineRenderPass,
+		SetDescriptorList,
+		SetVertexAttributeLayout,
+		SetCullMode,
+		AddShader,
+		BuildGraphicPipeline,
+
+		AddSwapChainAttachment,
+		AddColorAttachment,
+		BuildRenderPass,
+		SetColorAttachment,
+
+		SetShaderSource,
+		SetShaderName,
+
+		CreateRenderTarget,
+		CreateBindingID,
+		CopyToRenderTarget,
+
+		SetGeometry,
+		SetMeshes,
+		SetInstances,
+		UpdateInstances,
+		SetCullShader,
+
+		Count
+	};
+
+	/**
+	* @brief Host memory captured by copy.
+	*/
+	struct CaptureBlob
+	{
+		const void*           data  = nullptr;      // @brief Host data.
+		uint32_t              bytes = 0;            // @brief Data bytes.
+	};
+
+	/**
+	* @brief Capture file header.
+	*/
+	struct CaptureHeader
+	{
+		char                  magic[4] = { 'N', 'P', 'R', 'C' };    // @brief File magic.
+		uint32_t              version  = 4;                         // @brief File version.
+	};
+
+	/**
+	* @brief Capture record header, followed by bytes of payload.
+	*/
+	struct CaptureRecord
+	{
+		ECaptureOp            op;                   // @brief Operation.
+		uint32_t              object;               // @brief Object id, 0 for frame markers.
+		uint32_t              bytes;                // @brief Payload bytes.
+	};
+
+	/**
+	* @brief Capture Class.
+	* This class records frontend RHI objects and calls into a binary capture file.
+	* Objects are referenced by ids assigned on creation, host memory passed to calls is copied,
+	* so a Replayer can feed the same workload into any backend.
+	*/
+	class Capture
+	{
+	public:
+
+		/**
+		* @brief Begin capture into a file.
+		*
+		* @param[in] path Capture file path.
+		*
+		* @return Returns true if file opened.
+		*/
+		static bool Begin(const std::string& path);
+
+		/**
+		* @brief End capture and close the file.
+		*/
+		static void End();
+
+		/**
+		* @brief Is capture active.
+		*
+		* @return Returns true if active.
+		*/
+		static bool IsActive();
+
+		/**
+		* @brief Record an object creation and assign its id.
+		*
+		* @param[in] e ERHI.
+		* @param[in] object Frontend RHI object.
+		*/
+		static void OnCreate(ERHI e, const void* object);
+
+		/**
+		* @brief Record an object destruction.
+		*
+		* @param[in] object Frontend RHI object.
+		*/
+		static void OnDestroy(const void* object);
+
+		/**
+		* @brief Get bytes of a uniform buffer added by AddUniformBuffer.
+		*
+		* @param[in] object Frontend DescriptorList.
+		* @param[in] set Descriptor set.
+		* @param[in] binding Descriptor binding.
+		*
+		* @return Returns uniform buffer bytes.
+		*/
+		static uint32_t GetUniformBytes(const void* object, uint32_t set, uint32_t binding);
+
+		/**
+		* @brief Record a call.
+		*
+		* @tparam Args Call arguments.
+		* @param[in] op ECaptureOp.
+		* @param[in] object Frontend RHI object, nullptr for frame markers.
+		* @param[in] args Call arguments.
+		*/
+		template<typename... Args>
+		static void Record(ECaptureOp op, const void* object, const Args&... args);
+
+	private:
+
+		/**
+		* @brief Append a record to the capture.
+		*
+		* @param[in] op ECaptureOp.
+		* @param[in] object Frontend RHI object.
+		* @param[in] payload Serialized arguments.
+		*/
+		static void Commit(ECaptureOp op, const void* object, const std::vector<uint8_t>& payload);
+
+		/**
+		* @brief Get id of a frontend RHI object.
+		*
+		* @param[in] object Frontend RHI object.
+		*
+		* @return Returns id, 0 if not captured.
+		*/
+		static uint32_t GetId(const void* object);
+
+		/**
+		* @brief Serialize an argument.
+		*
+		* @tparam T Argument type.
+		* @param[in] payload Serialized arguments.
+		* @param[in] value Argument.
+		*/
+		template<typename T>
+		static void Write(std::vector<uint8_t>& payload, const T& value);
+	};
+
+	namespace CaptureDetail {
+
+		template<typename T>
+		struct IsShared : std::false_type {};
+
+		template<typename T>
+		struct IsShared<SP<T>> : std::true_type {};
+	}
+
+	template<typename ...Args>
+	void Capture::Record(ECaptureOp op, const void* object, const Args & ...args)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		std::vector<uint8_t> payload;
+
+		(Write(payload, args), ...);
+
+		Commit(op, object, payload);
+	}
+
+	template<typename T>
+	void Capture::Write(std::vector<uint8_t>& payload, const T& value)
+	{
+		if constexpr (std::is_same_v<T, CaptureBlob>)
+		{
+			Write(payload, value.bytes);
+
+			const auto offset = payload.size();
+			payload.resize(offset + value.bytes);
+
+			if (value.bytes > 0) memcpy(payload.data() + offset, value.data, value.bytes);
+		}
+		else if constexpr (std::is_same_v<T, std::string> || std::is_same_v<T, std::vector<uint8_t>>)
+		{
+			Write(payload, CaptureBlob{ value.data(), static_cast<uint32_t>(value.size()) });
+		}
+		else if constexpr (CaptureDetail::IsShared<T>::value)
+		{
+			Write(payload, GetId(value.get()));
+		}
+		else if constexpr (std::is_pointer_v<T>)
+		{
+			Write(payload, GetId(value));
+		}
+		else
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Captured argument must be trivially copyable.");
+
+			const auto offset = payload.size();
+			payload.resize(offset + sizeof(T));
+
+			memcpy(payload.data() + offset, &value, sizeof(T));
+		}
+	}
+}
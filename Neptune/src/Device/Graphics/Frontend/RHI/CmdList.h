@@ -48,6 +48,13 @@ namespace Neptune::RHI {
 		*/
 		virtual void SetGraphicCmdList(const Data::Clock& clock) = 0;
 
+		/**
+		* @brief Interface of Set Compute CommandList Context.
+		* 
+		* @param[in] clock Clock.
+		*/
+		virtual void SetComputeCmdList(const Data::Clock& clock) = 0;
+
 		/**
 		* @brief Interface of Get Current CommandList.
 		* 
@@ -99,6 +106,16 @@ namespace Neptune::RHI {
 		*/
 		virtual void CmdDrawFullScreenTriangle() const = 0;
 
+		/**
+		* @brief Interface of Draw, vertices are pulled in shader by index.
+		*
+		* @param[in] vertexCount Vertex count.
+		* @param[in] instanceCount Instance count.
+		* @param[in] firstVertex First vertex.
+		* @param[in] firstInstance First instance.
+		*/
+		virtual void CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const = 0;
+
 		/**
 		* @brief Interface of SetViewport.
 		* 
@@ -106,6 +123,41 @@ namespace Neptune::RHI {
 		*/
 		virtual void CmdSetViewport(const glm::vec2& viewPortSize) const = 0;
 
+		/**
+		* @brief Interface of PushConstants.
+		* 
+		* @param[in] data PushConstants data.
+		* @param[in] bytes PushConstants bytes.
+		*/
+		virtual void CmdPushConstants(const void* data, uint32_t bytes) const = 0;
+
+		/**
+		* @brief Interface of Cull GPUScene instances into indirect commands, outside of RenderPass.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		* @param[in] viewPosition Camera world position, selects lods.
+		*/
+		virtual void CmdCullGPUScene(const SP<class GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const = 0;
+
+		/**
+		* @brief Interface of Draw GPUScene indirect commands of last cull, in one call.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		*/
+		virtual void CmdDrawGPUScene(const SP<class GPUScene>& scene, const glm::mat4& viewProjection) const = 0;
+
+		/**
+		* @brief Interface of Blit a RenderTarget into another, outside of RenderPass.
+		* Both are expected and left in ColorAttachment layout, dst content is overwritten.
+		*
+		* @param[in] src Source RenderTarget.
+		* @param[in] dst Destination RenderTarget, may differ in format.
+		* @param[in] extent Blitted extent from origin, clamped to both RenderTargets.
+		*/
+		virtual void CmdBlitRenderTarget(const SP<class RenderTarget>& src, const SP<class RenderTarget>& dst, const glm::vec2& extent) const = 0;
+
 		/***********************************************************************************/
 	};
 
@@ -131,7 +183,14 @@ namespace Neptune::RHI {
 		*
 		* @param[in] clock Clock.
 		*/
-		void SetGraphicCmdList(const Data::Clock& clock) const { RHICmdList::m_Impl->SetGraphicCmdList(clock); }
+		void SetGraphicCmdList(const Data::Clock& clock) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetGraphicCmdList, this) RHICmdList::m_Impl->SetGraphicCmdList(clock); }
+
+		/**
+		* @brief Interface of Set Compute CommandList Context.
+		*
+		* @param[in] clock Clock.
+		*/
+		void SetComputeCmdList(const Data::Clock& clock) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetComputeCmdList, this) RHICmdList::m_Impl->SetComputeCmdList(clock); }
 
 		/**
 		* @brief Interface of Get Current CommandList.
@@ -145,42 +204,86 @@ namespace Neptune::RHI {
 		*
 		* @param[in] renderPass RenderPass.
 		*/
-		void SetRenderPass(const SP<class RenderPass>& renderPass) const { RHICmdList::m_Impl->SetRenderPass(renderPass); }
+		void SetRenderPass(const SP<class RenderPass>& renderPass) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetCmdListRenderPass, this, renderPass) RHICmdList::m_Impl->SetRenderPass(renderPass); }
 
 		/**
 		* @brief Interface of BeginRenderPass.
 		*/
-		void CmdBeginRenderPass() const { RHICmdList::m_Impl->CmdBeginRenderPass(); }
+		void CmdBeginRenderPass() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdBeginRenderPass, this) RHICmdList::m_Impl->CmdBeginRenderPass(); }
 
 		/**
 		* @brief Interface of EndRenderPass.
 		*/
-		void CmdEndRenderPass() const { RHICmdList::m_Impl->CmdEndRenderPass(); }
+		void CmdEndRenderPass() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdEndRenderPass, this) RHICmdList::m_Impl->CmdEndRenderPass(); }
 
 		/**
 		* @brief Interface of BindDescriptor.
 		*
 		* @param[in] descriptorList DescriptorList.
 		*/
-		void CmdBindDescriptor(const SP<class DescriptorList>& descriptorList) const { RHICmdList::m_Impl->CmdBindDescriptor(descriptorList); }
+		void CmdBindDescriptor(const SP<class DescriptorList>& descriptorList) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdBindDescriptor, this, descriptorList) RHICmdList::m_Impl->CmdBindDescriptor(descriptorList); }
 
 		/**
 		* @brief Interface of BindPipeline.
 		*
 		* @param[in] pipeline Pipeline.
 		*/
-		void CmdBindPipeline(const SP<class Pipeline>& pipeline) const { RHICmdList::m_Impl->CmdBindPipeline(pipeline); }
+		void CmdBindPipeline(const SP<class Pipeline>& pipeline) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdBindPipeline, this, pipeline) RHICmdList::m_Impl->CmdBindPipeline(pipeline); }
 
 		/**
 		* @brief Interface of DrawFullScreenTriangle.
 		*/
-		void CmdDrawFullScreenTriangle() const { RHICmdList::m_Impl->CmdDrawFullScreenTriangle(); }
+		void CmdDrawFullScreenTriangle() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdDrawFullScreenTriangle, this) RHICmdList::m_Impl->CmdDrawFullScreenTriangle(); }
+
+		/**
+		* @brief Interface of Draw, vertices are pulled in shader by index.
+		*
+		* @param[in] vertexCount Vertex count.
+		* @param[in] instanceCount Instance count.
+		* @param[in] firstVertex First vertex.
+		* @param[in] firstInstance First instance.
+		*/
+		void CmdDraw(uint32_t vertexCount, uint32_t instanceCount, uint32_t firstVertex, uint32_t firstInstance) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdDraw, this, vertexCount, instanceCount, firstVertex, firstInstance) RHICmdList::m_Impl->CmdDraw(vertexCount, instanceCount, firstVertex, firstInstance); }
 
 		/**
 		* @brief Interface of SetViewport.
 		*
 		* @param[in] viewPortSize .
 		*/
-		void CmdSetViewport(const glm::vec2& viewPortSize) const { RHICmdList::m_Impl->CmdSetViewport(viewPortSize); }
+		void CmdSetViewport(const glm::vec2& viewPortSize) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdSetViewport, this, viewPortSize) RHICmdList::m_Impl->CmdSetViewport(viewPortSize); }
+
+		/**
+		* @brief Interface of PushConstants.
+		*
+		* @param[in] data PushConstants data.
+		* @param[in] bytes PushConstants bytes.
+		*/
+		void CmdPushConstants(const void* data, uint32_t bytes) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdPushConstants, this, CaptureBlob{ data, bytes }) RHICmdList::m_Impl->CmdPushConstants(data, bytes); }
+
+		/**
+		* @brief Interface of Cull GPUScene instances into indirect commands, outside of RenderPass.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		* @param[in] viewPosition Camera world position, selects lods.
+		*/
+		void CmdCullGPUScene(const SP<class GPUScene>& scene, const glm::mat4& viewProjection, const glm::vec3& viewPosition) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdCullGPUScene, this, scene, viewProjection, viewPosition) RHICmdList::m_Impl->CmdCullGPUScene(scene, viewProjection, viewPosition); }
+
+		/**
+		* @brief Interface of Draw GPUScene indirect commands of last cull, in one call.
+		*
+		* @param[in] scene GPUScene.
+		* @param[in] viewProjection View projection matrix.
+		*/
+		void CmdDrawGPUScene(const SP<class GPUScene>& scene, const glm::mat4& viewProjection) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdDrawGPUScene, this, scene, viewProjection) RHICmdList::m_Impl->CmdDrawGPUScene(scene, viewProjection); }
+
+		/**
+		* @brief Interface of Blit a RenderTarget into another, outside of RenderPass.
+		*
+		* @param[in] src Source RenderTarget.
+		* @param[in] dst Destination RenderTarget.
+		* @param[in] extent Blitted extent from origin.
+		*/
+		void CmdBlitRenderTarget(const SP<class RenderTarget>& src, const SP<class RenderTarget>& dst, const glm::vec2& extent) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CmdBlitRenderTarget, this, src, dst, extent) RHICmdList::m_Impl->CmdBlitRenderTarget(src, dst, extent); }
 	};
 }
\ No newline at end of file
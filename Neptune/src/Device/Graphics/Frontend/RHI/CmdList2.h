@@ -92,31 +92,31 @@ namespace Neptune::RHI {
 		/**
 		* @brief Interface of Begin CommandList.
 		*/
-		void Begin() const { RHICmdList2::m_Impl->Begin(); }
+		void Begin() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::BeginCmdList2, this) RHICmdList2::m_Impl->Begin(); }
 
 		/**
 		* @brief Interface of End CommandList.
 		*/
-		void End() const { RHICmdList2::m_Impl->End(); }
+		void End() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::EndCmdList2, this) RHICmdList2::m_Impl->End(); }
 
 		/**
 		* @brief Interface of Submit CommandList and Wait.
 		*/
-		void SubmitWait() const { RHICmdList2::m_Impl->SubmitWait(); }
+		void SubmitWait() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SubmitWait, this) RHICmdList2::m_Impl->SubmitWait(); }
 
 		/**
 		* @brief Interface of Set Graphic CommandList Context.
 		*/
-		void SetGraphicCmdList() const { RHICmdList2::m_Impl->SetGraphicCmdList(); }
+		void SetGraphicCmdList() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetGraphicCmdList2, this) RHICmdList2::m_Impl->SetGraphicCmdList(); }
 
 		/**
 		* @brief Interface of Set VideoDecode CommandList Context.
 		*/
-		void SetVideoDecodeCmdList() const { RHICmdList2::m_Impl->SetVideoDecodeCmdList(); }
+		void SetVideoDecodeCmdList() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetVideoDecodeCmdList, this) RHICmdList2::m_Impl->SetVideoDecodeCmdList(); }
 
 		/**
 		* @brief Interface of Set OpticalFlow CommandList Context.
 		*/
-		void SetOpticalFlowCmdList() const { RHICmdList2::m_Impl->SetOpticalFlowCmdList(); }
+		void SetOpticalFlowCmdList() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetOpticalFlowCmdList, this) RHICmdList2::m_Impl->SetOpticalFlowCmdList(); }
 	};
 }
\ No newline at end of file
@@ -16,6 +16,8 @@ namespace Neptune::RHI {
 	
 	void DescriptorList::SetSharedLayout() const
 	{
+		NEPTUNE_RHI_CAPTURE(ECaptureOp::SetSharedLayout, this)
+
 		s_SharedDescriptorList = m_Impl.get();
 	}
 
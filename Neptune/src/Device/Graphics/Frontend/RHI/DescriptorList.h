@@ -73,6 +73,13 @@ namespace Neptune::RHI {
 		*/
 		virtual void CombineSharedLayout(const Impl* shared) = 0;
 
+		/**
+		* @brief Interface of Add BindLess Heap as a set.
+		*
+		* @param[in] set .
+		*/
+		virtual void AddBindLessHeap(uint32_t set) = 0;
+
 		/**
 		* @brief Interface of Build DescriptorList.
 		*/
@@ -117,7 +124,7 @@ namespace Neptune::RHI {
 		* @param[in] binding .
 		* @param[in] bytes UniformBuffer bytes.
 		*/
-		void AddUniformBuffer(uint32_t set, uint32_t binding, uint32_t bytes) const { m_Impl->AddUniformBuffer(set, binding, bytes); }
+		void AddUniformBuffer(uint32_t set, uint32_t binding, uint32_t bytes) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::AddUniformBuffer, this, set, binding, bytes) m_Impl->AddUniformBuffer(set, binding, bytes); }
 
 		/**
 		* @brief Interface of Add UniformTexture.
@@ -126,7 +133,7 @@ namespace Neptune::RHI {
 		* @param[in] binding .
 		* @param[in] renderTarget RenderTarget.
 		*/
-		void AddUniformTexture(uint32_t set, uint32_t binding, SP<class RenderTarget> renderTarget) const { m_Impl->AddUniformTexture(set, binding, renderTarget); }
+		void AddUniformTexture(uint32_t set, uint32_t binding, SP<class RenderTarget> renderTarget) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::AddUniformTexture, this, set, binding, renderTarget) m_Impl->AddUniformTexture(set, binding, renderTarget); }
 
 		/**
 		* @brief Interface of Update UniformBuffer.
@@ -135,7 +142,7 @@ namespace Neptune::RHI {
 		* @param[in] binding .
 		* @param[in] data UniformBuffer data.
 		*/
-		void UpdateUniformBuffer(uint32_t set, uint32_t binding, void* data) const { m_Impl->UpdateUniformBuffer(set, binding, data); }
+		void UpdateUniformBuffer(uint32_t set, uint32_t binding, void* data) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::UpdateUniformBuffer, this, set, binding, CaptureBlob{ data, Capture::GetUniformBytes(this, set, binding) }) m_Impl->UpdateUniformBuffer(set, binding, data); }
 
 		/**
 		* @brief Interface of Update UniformTexture.
@@ -144,17 +151,24 @@ namespace Neptune::RHI {
 		* @param[in] binding .
 		* @param[in] renderTarget RenderTarget.
 		*/
-		void UpdateUniformTexture(uint32_t set, uint32_t binding, SP<class RenderTarget> renderTarget) const { m_Impl->UpdateUniformTexture(set, binding, renderTarget); }
+		void UpdateUniformTexture(uint32_t set, uint32_t binding, SP<class RenderTarget> renderTarget) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::UpdateUniformTexture, this, set, binding, renderTarget) m_Impl->UpdateUniformTexture(set, binding, renderTarget); }
 
 		/**
 		* @brief Interface of Combine Shared DescriptorList.
 		*/
-		void CombineSharedLayout() const { m_Impl->CombineSharedLayout(GetSharedImpl()); }
+		void CombineSharedLayout() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CombineSharedLayout, this) m_Impl->CombineSharedLayout(GetSharedImpl()); }
+
+		/**
+		* @brief Interface of Add BindLess Heap as a set.
+		*
+		* @param[in] set .
+		*/
+		void AddBindLessHeap(uint32_t set) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::AddBindLessHeap, this, set) m_Impl->AddBindLessHeap(set); }
 
 		/**
 		* @brief Interface of Build DescriptorList.
 		*/
-		void Build() const { m_Impl->Build(); }
+		void Build() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::BuildDescriptorList, this) m_Impl->Build(); }
 
 	};
 }
\ No newline at end of file
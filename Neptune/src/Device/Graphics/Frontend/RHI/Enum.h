@@ -25,6 +25,7 @@ namespace Neptune::RHI {
         CmdList2,
         Decoder,
         OpticalFlow,
+        GPUScene,
 
         Count
     };
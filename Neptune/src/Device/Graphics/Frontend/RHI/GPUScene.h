@@ -0,0 +1,148 @@
+/**
+* @file GPUScene.h.
+* @brief The GPUScene Class Definitions and Implementation.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "RHI.h"
+#include "Header/ShaderCommon.h"
+
+#include <vector>
+
+namespace Neptune::RHI {
+
+	class Shader;
+
+	using RHIGPUScene = RHI<ERHI::GPUScene>;
+
+	/**
+	* @brief Specialization of RHIGPUScene::Impl
+	*/
+	template<>
+	class RHIGPUScene::Impl
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		Impl() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		virtual ~Impl() = default;
+
+		/**
+		* @brief Interface of Set Geometry shared by all Meshes.
+		*
+		* @param[in] vertices Vertices.
+		* @param[in] indices Indices, relative to MeshLod vertexOffset.
+		*/
+		virtual void SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices) = 0;
+
+		/**
+		* @brief Interface of Set Meshes.
+		*
+		* @param[in] meshes MeshBounds.
+		* @param[in] lods MeshLods.
+		*/
+		virtual void SetMeshes(const std::vector<ShaderCommon::MeshBounds>& meshes, const std::vector<ShaderCommon::MeshLod>& lods) = 0;
+
+		/**
+		* @brief Interface of Set Instances, instance count may change.
+		*
+		* @param[in] instances MeshInstances.
+		*/
+		virtual void SetInstances(const std::vector<ShaderCommon::MeshInstance>& instances) = 0;
+
+		/**
+		* @brief Interface of Update a range of Instances.
+		*
+		* @param[in] first First MeshInstance.
+		* @param[in] instances MeshInstances.
+		* @param[in] count MeshInstance count.
+		*/
+		virtual void UpdateInstances(uint32_t first, const ShaderCommon::MeshInstance* instances, uint32_t count) = 0;
+
+		/**
+		* @brief Interface of Set Cull Compute Shader.
+		*
+		* @param[in] shader Shader of MeshCull.comp.
+		*/
+		virtual void SetCullShader(SP<Shader> shader) = 0;
+	};
+
+	/**
+	* @brief RHI of ERHI::GPUScene
+	* Geometry, meshes and instances live in GPU buffers, CmdList::CmdCullGPUScene writes
+	* one indexed indirect command per visible instance and CmdList::CmdDrawGPUScene draws them.
+	*/
+	class GPUScene : public RHIGPUScene
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		GPUScene() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~GPUScene() override = default;
+
+		/**
+		* @brief Interface of Set Geometry shared by all Meshes.
+		*
+		* @param[in] vertices Vertices.
+		* @param[in] indices Indices, relative to MeshLod vertexOffset.
+		*/
+		void SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetGeometry, this, Blob(vertices), Blob(indices)) m_Impl->SetGeometry(vertices, indices); }
+
+		/**
+		* @brief Interface of Set Meshes.
+		*
+		* @param[in] meshes MeshBounds.
+		* @param[in] lods MeshLods.
+		*/
+		void SetMeshes(const std::vector<ShaderCommon::MeshBounds>& meshes, const std::vector<ShaderCommon::MeshLod>& lods) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetMeshes, this, Blob(meshes), Blob(lods)) m_Impl->SetMeshes(meshes, lods); }
+
+		/**
+		* @brief Interface of Set Instances, instance count may change.
+		*
+		* @param[in] instances MeshInstances.
+		*/
+		void SetInstances(const std::vector<ShaderCommon::MeshInstance>& instances) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetInstances, this, Blob(instances)) m_Impl->SetInstances(instances); }
+
+		/**
+		* @brief Interface of Update a range of Instances.
+		*
+		* @param[in] first First MeshInstance.
+		* @param[in] instances MeshInstances.
+		* @param[in] count MeshInstance count.
+		*/
+		void UpdateInstances(uint32_t first, const ShaderCommon::MeshInstance* instances, uint32_t count) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::UpdateInstances, this, first, CaptureBlob{ instances, static_cast<uint32_t>(count * sizeof(ShaderCommon::MeshInstance)) }) m_Impl->UpdateInstances(first, instances, count); }
+
+		/**
+		* @brief Interface of Set Cull Compute Shader.
+		*
+		* @param[in] shader Shader of MeshCull.comp.
+		*/
+		void SetCullShader(SP<Shader> shader) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetCullShader, this, shader) m_Impl->SetCullShader(shader); }
+
+	private:
+
+		/**
+		* @brief Wrap a vector as CaptureBlob.
+		*
+		* @param[in] data Vector.
+		*
+		* @return Returns CaptureBlob.
+		*/
+		template<typename T>
+		static CaptureBlob Blob(const std::vector<T>& data) { return { data.data(), static_cast<uint32_t>(data.size() * sizeof(T)) }; }
+	};
+}
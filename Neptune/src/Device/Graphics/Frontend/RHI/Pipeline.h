@@ -97,33 +97,33 @@ namespace Neptune::RHI {
 		/**
 		* @brief Interface of Set Default Pipeline.
 		*/
-		void SetDefault() const { RHIPipeline::m_Impl->SetDefault(); }
+		void SetDefault() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetDefault, this) RHIPipeline::m_Impl->SetDefault(); }
 
 		/**
 		* @brief Interface of Set RenderPass.
 		*
 		* @param[in] renderPass RenderPass.
 		*/
-		void SetRenderPass(SP<class RenderPass> renderPass) const { m_Impl->SetRenderPass(renderPass); }
+		void SetRenderPass(SP<class RenderPass> renderPass) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetPipelineRenderPass, this, renderPass) m_Impl->SetRenderPass(renderPass); }
 
 		/**
 		* @brief Interface of Set DescriptorList.
 		*
 		* @param[in] descriptorList DescriptorList.
 		*/
-		void SetDescriptorList(SP<class DescriptorList> descriptorList) const { m_Impl->SetDescriptorList(descriptorList); }
+		void SetDescriptorList(SP<class DescriptorList> descriptorList) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetDescriptorList, this, descriptorList) m_Impl->SetDescriptorList(descriptorList); }
 
 		/**
 		* @brief Interface of Set VertexAttributeLayout.
 		*/
-		void SetVertexAttributeLayout() const { m_Impl->SetVertexAttributeLayout(); }
+		void SetVertexAttributeLayout() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetVertexAttributeLayout, this) m_Impl->SetVertexAttributeLayout(); }
 
 		/**
 		* @brief Interface of Set CullMode.
 		*
 		* @param[in] mode CullMode.
 		*/
-		void SetCullMode(CullMode mode) const { m_Impl->SetCullMode(mode); }
+		void SetCullMode(CullMode mode) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetCullMode, this, mode) m_Impl->SetCullMode(mode); }
 
 		/**
 		* @brief Interface of Add Shader.
@@ -131,12 +131,12 @@ namespace Neptune::RHI {
 		* @param[in] stage ShaderStage.
 		* @param[in] shader Shader.
 		*/
-		void AddShader(ShaderStage stage, SP<class Shader> shader) const { m_Impl->AddShader(stage, shader); }
+		void AddShader(ShaderStage stage, SP<class Shader> shader) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::AddShader, this, stage, shader) m_Impl->AddShader(stage, shader); }
 
 		/**
 		* @brief Interface of Build GraphicPipeline.
 		*/
-		void BuildGraphicPipeline() const { m_Impl->BuildGraphicPipeline(); }
+		void BuildGraphicPipeline() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::BuildGraphicPipeline, this) m_Impl->BuildGraphicPipeline(); }
 
 	};
 
@@ -7,6 +7,7 @@
 #pragma once
 #include "Core/Core.h"
 #include "Enum.h"
+#include "Capture.h"
 
 #include <functional>
 #include <any>
@@ -81,6 +82,11 @@ namespace Neptune::RHI {
 			if (auto p = std::any_cast<SP<Impl>>(std::invoke(RHIDelegate::GetCreator(), E, payload)))
 			{
 				m_Impl = p;
+
+				if (Capture::IsActive())
+				{
+					Capture::OnCreate(E, this);
+				}
 			}
 			else
 			{
@@ -91,7 +97,13 @@ namespace Neptune::RHI {
 		/**
 		* @brief Destructor Function.
 		*/
-		virtual ~RHI() = default;
+		virtual ~RHI()
+		{
+			if (m_Impl && Capture::IsActive())
+			{
+				Capture::OnDestroy(this);
+			}
+		}
 
 		/**
 		* @brief Get RHI Implement.
@@ -51,6 +51,14 @@ namespace Neptune::RHI {
 		* @param[in] count Flight Frames.
 		*/
 		virtual void Build(uint32_t count) = 0;
+
+		/**
+		* @brief Interface of Rebind a Color Attachment of a built RenderPass.
+		*
+		* @param[in] index Color Attachment index.
+		* @param[in] renderTarget RenderTarget, same format as the replaced one.
+		*/
+		virtual void SetColorAttachment(uint32_t index, SP<class RenderTarget> renderTarget) = 0;
 	};
 
 	/**
@@ -73,7 +81,7 @@ namespace Neptune::RHI {
 		/**
 		* @brief Interface of Add SwapChain Attachment.
 		*/
-		void AddSwapChainAttachment() const { m_Impl->AddSwapChainAttachment(); }
+		void AddSwapChainAttachment() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::AddSwapChainAttachment, this) m_Impl->AddSwapChainAttachment(); }
 
 		/**
 		* @brief Interface of Add Color Attachment.
@@ -81,14 +89,22 @@ namespace Neptune::RHI {
 		* @param[in] renderTarget RenderTarget.
 		* @param[in] info RenderTargetAttachmentInfo.
 		*/
-		void AddColorAttachment(SP<class RenderTarget> renderTarget, const RenderTargetAttachmentInfo& info) const { m_Impl->AddColorAttachment(renderTarget, info); }
+		void AddColorAttachment(SP<class RenderTarget> renderTarget, const RenderTargetAttachmentInfo& info) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::AddColorAttachment, this, renderTarget, info) m_Impl->AddColorAttachment(renderTarget, info); }
 
 		/**
 		* @brief Interface of Build RenderPass.
 		*
 		* @param[in] count Flight Frames.
 		*/
-		void Build(uint32_t count = MaxFrameInFlight) const { m_Impl->Build(count); }
+		void Build(uint32_t count = MaxFrameInFlight) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::BuildRenderPass, this, count) m_Impl->Build(count); }
+
+		/**
+		* @brief Interface of Rebind a Color Attachment of a built RenderPass.
+		*
+		* @param[in] index Color Attachment index.
+		* @param[in] renderTarget RenderTarget, same format as the replaced one.
+		*/
+		void SetColorAttachment(uint32_t index, SP<class RenderTarget> renderTarget) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::SetColorAttachment, this, index, renderTarget) m_Impl->SetColorAttachment(index, renderTarget); }
 
 	};
 }
\ No newline at end of file
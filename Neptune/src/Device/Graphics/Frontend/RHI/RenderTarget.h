@@ -8,11 +8,7 @@
 #include "Core/Core.h"
 #include "RHI.h"
 #include "Resource/Texture/Texture.h"
-
-namespace Neptune {
-
-	struct RenderTargetCreateInfo;
-}
+#include "Resource/Texture/RenderTarget.h"
 
 namespace Neptune::RHI {
 	
@@ -79,6 +75,13 @@ namespace Neptune::RHI {
 		* @return Returns height.
 		*/
 		virtual uint32_t GetHeight() const = 0;
+
+		/**
+		* @brief Interface of Get BindLess Index.
+		*
+		* @return Returns stable index in BindLess texture heap.
+		*/
+		virtual uint32_t GetBindLessIndex() const = 0;
 	};
 
 	/**
@@ -103,14 +106,14 @@ namespace Neptune::RHI {
 		*
 		* @param[in] info RenderTargetCreateInfo.
 		*/
-		void CreateRenderTarget(const RenderTargetCreateInfo& info) const { m_Impl->CreateRenderTarget(info); }
+		void CreateRenderTarget(const RenderTargetCreateInfo& info) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CreateRenderTarget, this, info) m_Impl->CreateRenderTarget(info); }
 
 		/**
 		* @brief Interface of Create BindingID.
 		*
 		* @return Returns BindingID.
 		*/
-		void* CreateBindingID() const { return m_Impl->CreateBindingID(); }
+		void* CreateBindingID() const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CreateBindingID, this) return m_Impl->CreateBindingID(); }
 
 		/**
 		* @brief Interface of Copy To RenderTarget.
@@ -119,7 +122,7 @@ namespace Neptune::RHI {
 		*
 		* @return Returns true if succeeded.
 		*/
-		bool CopyToRenderTarget(const RenderTarget* target) const { return m_Impl->CopyToRenderTarget(target); }
+		bool CopyToRenderTarget(const RenderTarget* target) const { NEPTUNE_RHI_CAPTURE(ECaptureOp::CopyToRenderTarget, this, target) return m_Impl->CopyToRenderTarget(target); }
 
 		/**
 		* @brief Interface of Get Format.
@@ -142,5 +145,12 @@ namespace Neptune::RHI {
 		*/
 		uint32_t GetHeight() const { return m_Impl->GetHeight(); }
 
+		/**
+		* @brief Interface of Get BindLess Index.
+		*
+		* @return Returns stable index in BindLess texture heap.
+		*/
+		uint32_t GetBindLessIndex() const { return m_Impl->GetBindLessIndex(); }
+
 	};
 }
\ No newline at end of file
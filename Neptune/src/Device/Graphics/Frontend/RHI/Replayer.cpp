@@ -0,0 +1,449 @@
+/**
+* @file Replayer.cpp.
+* @brief The Replayer Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "Replayer.h"
+#include "RenderPass.h"
+#include "DescriptorList.h"
+#include "Pipeline.h"
+#include "Shader.h"
+#include "RenderTarget.h"
+#include "VertexBuffer.h"
+#include "IndexBuffer.h"
+#include "CmdList.h"
+#include "CmdList2.h"
+#include "GPUScene.h"
+#include "Data/Clock.h"
+
+#include <chrono>
+#include <fstream>
+
+namespace Neptune::RHI {
+
+	namespace {
+
+		/**
+		* @brief Sequential reader of a record payload.
+		*/
+		struct PayloadReader
+		{
+			uint8_t*                 data;              // @brief Payload data.
+			uint32_t                 bytes;             // @brief Payload bytes.
+			uint32_t                 offset = 0;        // @brief Read offset.
+
+			/**
+			* @brief Read a trivially copyable argument.
+			*
+			* @tparam T Argument type.
+			*
+			* @return Returns argument, value initialized if payload is exhausted.
+			*/
+			template<typename T>
+			T Read()
+			{
+				T value{};
+
+				if (offset + sizeof(T) > bytes) return value;
+
+				memcpy(&value, data + offset, sizeof(T));
+				offset += sizeof(T);
+
+				return value;
+			}
+
+			/**
+			* @brief Read a blob argument.
+			*
+			* @param[out] size Blob bytes.
+			*
+			* @return Returns blob data, nullptr if payload is exhausted.
+			*/
+			uint8_t* ReadBlob(uint32_t& size)
+			{
+				size = Read<uint32_t>();
+
+				if (offset + size > bytes)
+				{
+					size = 0;
+					return nullptr;
+				}
+
+				auto p = data + offset;
+				offset += size;
+
+				return p;
+			}
+		};
+
+		/**
+		* @brief Read a blob argument as a vector, blob may be unaligned.
+		*
+		* @tparam T Element type.
+		* @param[in] reader PayloadReader.
+		*
+		* @return Returns elements.
+		*/
+		template<typename T>
+		std::vector<T> ReadVector(PayloadReader& reader)
+		{
+			uint32_t bytes;
+			const auto data = reader.ReadBlob(bytes);
+
+			std::vector<T> values(bytes / sizeof(T));
+
+			if (!values.empty()) memcpy(values.data(), data, values.size() * sizeof(T));
+
+			return values;
+		}
+	}
+
+	Replayer::Replayer(const std::string& path)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Load(path);
+	}
+
+	Replayer::~Replayer()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (m_Frames == 0) return;
+
+		std::stringstream ss;
+		ss << "Replay: " << m_Frames << " frames, " << m_Time / static_cast<double>(m_Frames) << " ms CPU per frame.";
+
+		NEPTUNE_CORE_INFO(ss.str())
+	}
+
+	void Replayer::ReplayFrame(const Data::Clock& clock)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (!IsValid()) return;
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		while (m_Cursor < m_Records.size())
+		{
+			const auto index = m_Cursor++;
+
+			Execute(index, clock);
+
+			if (index == m_LastEnd)
+			{
+				m_Cursor = m_LastBegin;
+				break;
+			}
+
+			if (m_Records[index].op == ECaptureOp::EndFrame) break;
+		}
+
+		m_Time += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - begin).count();
+		++m_Frames;
+	}
+
+	void Replayer::Load(const std::string& path)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		std::ifstream file(path, std::ios::binary | std::ios::ate);
+
+		if (!file.is_open())
+		{
+			NEPTUNE_CORE_ERROR("Failed to open capture file.")
+			return;
+		}
+
+		m_Data.resize(static_cast<size_t>(file.tellg()));
+
+		file.seekg(0);
+		file.read(reinterpret_cast<char*>(m_Data.data()), static_cast<std::streamsize>(m_Data.size()));
+
+		constexpr CaptureHeader expect{};
+
+		CaptureHeader header;
+
+		if (m_Data.size() < sizeof(header))
+		{
+			NEPTUNE_CORE_ERROR("Capture file is truncated.")
+			return;
+		}
+
+		memcpy(&header, m_Data.data(), sizeof(header));
+
+		if (memcmp(header.magic, expect.magic, sizeof(header.magic)) != 0 || header.version != expect.version)
+		{
+			NEPTUNE_CORE_ERROR("Capture file version is not supported.")
+			return;
+		}
+
+		size_t offset = sizeof(header);
+		size_t begin  = 0;
+		bool   opened = false;
+
+		while (offset + sizeof(CaptureRecord) <= m_Data.size())
+		{
+			CaptureRecord record;
+			memcpy(&record, m_Data.data() + offset, sizeof(record));
+
+			offset += sizeof(record);
+
+			if (offset + record.bytes > m_Data.size() || record.op >= ECaptureOp::Count)
+			{
+				NEPTUNE_CORE_WARN("Capture file is truncated, records after the last complete frame are ignored.")
+				break;
+			}
+
+			if (record.op == ECaptureOp::BeginFrame)
+			{
+				begin  = m_Records.size();
+				opened = true;
+			}
+
+			if (record.op == ECaptureOp::EndFrame && opened)
+			{
+				m_LastBegin = begin;
+				m_LastEnd   = m_Records.size();
+			}
+
+			m_Records.push_back({ record.op, record.object, offset, record.bytes });
+
+			offset += record.bytes;
+		}
+
+		if (!IsValid())
+		{
+			NEPTUNE_CORE_ERROR("Capture file contains no frame.")
+		}
+	}
+
+	void Replayer::Execute(size_t index, const Data::Clock& clock)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto& record = m_Records[index];
+
+		PayloadReader reader{ m_Data.data() + record.offset, record.bytes };
+
+		const auto id = record.object;
+
+		switch (record.op)
+		{
+			case ECaptureOp::Create:                      Create(id, reader.Read<ERHI>());                                                                                       break;
+			case ECaptureOp::Destroy:                     if (id < m_Objects.size()) m_Objects[id].reset();                                                                       break;
+			case ECaptureOp::BeginFrame:                                                                                                                                        break;
+			case ECaptureOp::EndFrame:                                                                                                                                          break;
+
+			case ECaptureOp::SetGraphicCmdList:           Get<CmdList>(id)->SetGraphicCmdList(clock);                                                                            break;
+			case ECaptureOp::SetComputeCmdList:           Get<CmdList>(id)->SetComputeCmdList(clock);                                                                            break;
+			case ECaptureOp::SetCmdListRenderPass:        Get<CmdList>(id)->SetRenderPass(Get<RenderPass>(reader.Read<uint32_t>()));                                             break;
+			case ECaptureOp::CmdBeginRenderPass:          Get<CmdList>(id)->CmdBeginRenderPass();                                                                                break;
+			case ECaptureOp::CmdEndRenderPass:            Get<CmdList>(id)->CmdEndRenderPass();                                                                                  break;
+			case ECaptureOp::CmdBindDescriptor:           Get<CmdList>(id)->CmdBindDescriptor(Get<DescriptorList>(reader.Read<uint32_t>()));                                     break;
+			case ECaptureOp::CmdBindPipeline:             Get<CmdList>(id)->CmdBindPipeline(Get<Pipeline>(reader.Read<uint32_t>()));                                             break;
+			case ECaptureOp::CmdDrawFullScreenTriangle:   Get<CmdList>(id)->CmdDrawFullScreenTriangle();                                                                         break;
+			case ECaptureOp::CmdDraw:
+			{
+				const auto vertexCount   = reader.Read<uint32_t>();
+				const auto instanceCount = reader.Read<uint32_t>();
+				const auto firstVertex   = reader.Read<uint32_t>();
+				const auto firstInstance = reader.Read<uint32_t>();
+
+				Get<CmdList>(id)->CmdDraw(vertexCount, instanceCount, firstVertex, firstInstance);
+				break;
+			}
+			case ECaptureOp::CmdSetViewport:              Get<CmdList>(id)->CmdSetViewport(reader.Read<glm::vec2>());                                                            break;
+			case ECaptureOp::CmdPushConstants:
+			{
+				uint32_t bytes;
+				const auto data = reader.ReadBlob(bytes);
+
+				Get<CmdList>(id)->CmdPushConstants(data, bytes);
+				break;
+			}
+			case ECaptureOp::CmdCullGPUScene:
+			{
+				const auto scene          = Get<GPUScene>(reader.Read<uint32_t>());
+				const auto viewProjection = reader.Read<glm::mat4>();
+				const auto viewPosition   = reader.Read<glm::vec3>();
+
+				Get<CmdList>(id)->CmdCullGPUScene(scene, viewProjection, viewPosition);
+				break;
+			}
+			case ECaptureOp::CmdDrawGPUScene:
+			{
+				const auto scene          = Get<GPUScene>(reader.Read<uint32_t>());
+				const auto viewProjection = reader.Read<glm::mat4>();
+
+				Get<CmdList>(id)->CmdDrawGPUScene(scene, viewProjection);
+				break;
+			}
+			case ECaptureOp::CmdBlitRenderTarget:
+			{
+				const auto src            = Get<RenderTarget>(reader.Read<uint32_t>());
+				const auto dst            = Get<RenderTarget>(reader.Read<uint32_t>());
+				const auto extent         = reader.Read<glm::vec2>();
+
+				Get<CmdList>(id)->CmdBlitRenderTarget(src, dst, extent);
+				break;
+			}
+
+			case ECaptureOp::BeginCmdList2:               Get<CmdList2>(id)->Begin();                                                                                            break;
+			case ECaptureOp::EndCmdList2:                 Get<CmdList2>(id)->End();                                                                                              break;
+			case ECaptureOp::SubmitWait:                  Get<CmdList2>(id)->SubmitWait();                                                                                      break;
+			case ECaptureOp::SetGraphicCmdList2:          Get<CmdList2>(id)->SetGraphicCmdList();                                                                                break;
+			case ECaptureOp::SetVideoDecodeCmdList:       Get<CmdList2>(id)->SetVideoDecodeCmdList();                                                                            break;
+			case ECaptureOp::SetOpticalFlowCmdList:       Get<CmdList2>(id)->SetOpticalFlowCmdList();                                                                            break;
+
+			case ECaptureOp::AddUniformBuffer:
+			{
+				const auto set     = reader.Read<uint32_t>();
+				const auto binding = reader.Read<uint32_t>();
+
+				Get<DescriptorList>(id)->AddUniformBuffer(set, binding, reader.Read<uint32_t>());
+				break;
+			}
+			case ECaptureOp::AddUniformTexture:
+			{
+				const auto set     = reader.Read<uint32_t>();
+				const auto binding = reader.Read<uint32_t>();
+
+				Get<DescriptorList>(id)->AddUniformTexture(set, binding, Get<RenderTarget>(reader.Read<uint32_t>()));
+				break;
+			}
+			case ECaptureOp::UpdateUniformBuffer:
+			{
+				const auto set     = reader.Read<uint32_t>();
+				const auto binding = reader.Read<uint32_t>();
+
+				uint32_t bytes;
+				const auto data = reader.ReadBlob(bytes);
+
+				Get<DescriptorList>(id)->UpdateUniformBuffer(set, binding, data);
+				break;
+			}
+			case ECaptureOp::UpdateUniformTexture:
+			{
+				const auto set     = reader.Read<uint32_t>();
+				const auto binding = reader.Read<uint32_t>();
+
+				Get<DescriptorList>(id)->UpdateUniformTexture(set, binding, Get<RenderTarget>(reader.Read<uint32_t>()));
+				break;
+			}
+			case ECaptureOp::SetSharedLayout:             Get<DescriptorList>(id)->SetSharedLayout();                                                                            break;
+			case ECaptureOp::CombineSharedLayout:         Get<DescriptorList>(id)->CombineSharedLayout();                                                                        break;
+			case ECaptureOp::AddBindLessHeap:             Get<DescriptorList>(id)->AddBindLessHeap(reader.Read<uint32_t>());                                                     break;
+			case ECaptureOp::BuildDescriptorList:         Get<DescriptorList>(id)->Build();                                                                                      break;
+
+			case ECaptureOp::SetDefault:                  Get<Pipeline>(id)->SetDefault();                                                                                       break;
+			case ECaptureOp::SetPipelineRenderPass:       Get<Pipeline>(id)->SetRenderPass(Get<RenderPass>(reader.Read<uint32_t>()));                                            break;
+			case ECaptureOp::SetDescriptorList:           Get<Pipeline>(id)->SetDescriptorList(Get<DescriptorList>(reader.Read<uint32_t>()));                                    break;
+			case ECaptureOp::SetVertexAttributeLayout:    Get<Pipeline>(id)->SetVertexAttributeLayout();                                                                         break;
+			case ECaptureOp::SetCullMode:                 Get<Pipeline>(id)->SetCullMode(reader.Read<CullMode>());                                                               break;
+			case ECaptureOp::AddShader:
+			{
+				const auto stage = reader.Read<ShaderStage>();
+
+				Get<Pipeline>(id)->AddShader(stage, Get<Shader>(reader.Read<uint32_t>()));
+				break;
+			}
+			case ECaptureOp::BuildGraphicPipeline:        Get<Pipeline>(id)->BuildGraphicPipeline();                                                                             break;
+
+			case ECaptureOp::AddSwapChainAttachment:      Get<RenderPass>(id)->AddSwapChainAttachment();                                                                         break;
+			case ECaptureOp::AddColorAttachment:
+			{
+				const auto renderTarget = Get<RenderTarget>(reader.Read<uint32_t>());
+
+				Get<RenderPass>(id)->AddColorAttachment(renderTarget, reader.Read<RenderTargetAttachmentInfo>());
+				break;
+			}
+			case ECaptureOp::BuildRenderPass:             Get<RenderPass>(id)->Build(reader.Read<uint32_t>());                                                                   break;
+			case ECaptureOp::SetColorAttachment:
+			{
+				const auto attachment = reader.Read<uint32_t>();
+
+				Get<RenderPass>(id)->SetColorAttachment(attachment, Get<RenderTarget>(reader.Read<uint32_t>()));
+				break;
+			}
+
+			case ECaptureOp::SetShaderSource:
+			{
+				uint32_t bytes;
+				const auto data = reader.ReadBlob(bytes);
+
+				Get<Shader>(id)->SetSource(std::vector<uint8_t>(data, data + bytes));
+				break;
+			}
+			case ECaptureOp::SetShaderName:
+			{
+				uint32_t bytes;
+				const auto data = reader.ReadBlob(bytes);
+
+				Get<Shader>(id)->SetName(std::string(reinterpret_cast<const char*>(data), bytes));
+				break;
+			}
+
+			case ECaptureOp::CreateRenderTarget:          Get<RenderTarget>(id)->CreateRenderTarget(reader.Read<RenderTargetCreateInfo>());                                      break;
+			case ECaptureOp::CreateBindingID:             Get<RenderTarget>(id)->CreateBindingID();                                                                              break;
+			case ECaptureOp::CopyToRenderTarget:          Get<RenderTarget>(id)->CopyToRenderTarget(Get<RenderTarget>(reader.Read<uint32_t>()).get());                           break;
+
+			case ECaptureOp::SetGeometry:
+			{
+				const auto vertices = ReadVector<ShaderCommon::Vertex>(reader);
+				const auto indices  = ReadVector<uint32_t>(reader);
+
+				Get<GPUScene>(id)->SetGeometry(vertices, indices);
+				break;
+			}
+			case ECaptureOp::SetMeshes:
+			{
+				const auto meshes = ReadVector<ShaderCommon::MeshBounds>(reader);
+				const auto lods   = ReadVector<ShaderCommon::MeshLod>(reader);
+
+				Get<GPUScene>(id)->SetMeshes(meshes, lods);
+				break;
+			}
+			case ECaptureOp::SetInstances:                Get<GPUScene>(id)->SetInstances(ReadVector<ShaderCommon::MeshInstance>(reader));                                       break;
+			case ECaptureOp::UpdateInstances:
+			{
+				const auto first     = reader.Read<uint32_t>();
+				const auto instances = ReadVector<ShaderCommon::MeshInstance>(reader);
+
+				Get<GPUScene>(id)->UpdateInstances(first, instances.data(), static_cast<uint32_t>(instances.size()));
+				break;
+			}
+			case ECaptureOp::SetCullShader:               Get<GPUScene>(id)->SetCullShader(Get<Shader>(reader.Read<uint32_t>()));                                                break;
+
+			default:                                      NEPTUNE_CORE_WARN("Unknown capture record.")                                                                           break;
+		}
+	}
+
+	void Replayer::Create(uint32_t id, ERHI e)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (id >= m_Objects.size())
+		{
+			m_Objects.resize(static_cast<size_t>(id) + 1);
+		}
+
+		switch (e)
+		{
+			case ERHI::RenderPass:       m_Objects[id] = CreateSP<RenderPass>();        break;
+			case ERHI::DescriptorList:   m_Objects[id] = CreateSP<DescriptorList>();    break;
+			case ERHI::Pipeline:         m_Objects[id] = CreateSP<Pipeline>();          break;
+			case ERHI::Shader:           m_Objects[id] = CreateSP<Shader>();            break;
+			case ERHI::RenderTarget:     m_Objects[id] = CreateSP<RenderTarget>();      break;
+			case ERHI::VertexBuffer:     m_Objects[id] = CreateSP<VertexBuffer>();      break;
+			case ERHI::IndexBuffer:      m_Objects[id] = CreateSP<IndexBuffer>();       break;
+			case ERHI::CmdList:          m_Objects[id] = CreateSP<CmdList>();           break;
+			case ERHI::CmdList2:         m_Objects[id] = CreateSP<CmdList2>();          break;
+			case ERHI::GPUScene:         m_Objects[id] = CreateSP<GPUScene>();          break;
+			default:                     NEPTUNE_CORE_WARN("Capture record creates a not captured RHI.")    break;
+		}
+	}
+}
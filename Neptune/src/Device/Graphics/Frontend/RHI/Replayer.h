@@ -0,0 +1,121 @@
+/**
+* @file Replayer.h.
+* @brief The Replayer Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Capture.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Neptune::Data {
+
+	struct Clock;
+}
+
+namespace Neptune::RHI {
+
+	/**
+	* @brief Replayer Class.
+	* This class feeds a capture file back into the current RHI backend.
+	* Records between frames are replayed before the next frame, once captured frames
+	* are exhausted the last frame is replayed again, so the workload stays steady.
+	* Replay is exercised on the Null backend only (NullGraphicsBackendTest.CaptureReplay),
+	* replay on Vulkan, lavapipe included, has not been run yet.
+	*/
+	class Replayer
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*
+		* @param[in] path Capture file path.
+		*/
+		explicit Replayer(const std::string& path);
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~Replayer();
+
+		/**
+		* @brief Is capture file loaded and contains a frame.
+		*
+		* @return Returns true if valid.
+		*/
+		bool IsValid() const { return m_LastEnd != 0; }
+
+		/**
+		* @brief Replay records until the end of next frame.
+		*
+		* @param[in] clock Clock of this frame, used instead of captured clock.
+		*/
+		void ReplayFrame(const Data::Clock& clock);
+
+	private:
+
+		/**
+		* @brief Load capture file.
+		*
+		* @param[in] path Capture file path.
+		*/
+		void Load(const std::string& path);
+
+		/**
+		* @brief Replay a record.
+		*
+		* @param[in] index Record index.
+		* @param[in] clock Clock of this frame.
+		*/
+		void Execute(size_t index, const Data::Clock& clock);
+
+		/**
+		* @brief Create a frontend RHI object.
+		*
+		* @param[in] id Object id.
+		* @param[in] e ERHI.
+		*/
+		void Create(uint32_t id, ERHI e);
+
+		/**
+		* @brief Get a replayed object.
+		*
+		* @tparam T Frontend RHI class.
+		* @param[in] id Object id.
+		*
+		* @return Returns object, nullptr if not alive.
+		*/
+		template<typename T>
+		SP<T> Get(uint32_t id) const
+		{
+			return id < m_Objects.size() ? std::static_pointer_cast<T>(m_Objects[id]) : nullptr;
+		}
+
+	private:
+
+		/**
+		* @brief Loaded record.
+		*/
+		struct Record
+		{
+			ECaptureOp                        op;                // @brief Operation.
+			uint32_t                          object;            // @brief Object id.
+			size_t                            offset;            // @brief Payload offset in data.
+			uint32_t                          bytes;             // @brief Payload bytes.
+		};
+
+		std::vector<uint8_t>                  m_Data;            // @brief Capture file data.
+		std::vector<Record>                   m_Records;         // @brief Records.
+		std::vector<std::shared_ptr<void>>    m_Objects;         // @brief Replayed objects by id.
+		size_t                                m_Cursor = 0;      // @brief Next record.
+		size_t                                m_LastBegin = 0;   // @brief Record of last captured BeginFrame.
+		size_t                                m_LastEnd = 0;     // @brief Record of last captured EndFrame.
+		uint64_t                              m_Frames = 0;      // @brief Replayed frames.
+		double                                m_Time = 0.0;      // @brief Replay CPU time in milliseconds.
+	};
+}
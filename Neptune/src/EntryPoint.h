@@ -7,10 +7,75 @@
 #include "Core/Core.h"
 #include "Core/Application.h"
 
+#include <string_view>
+#include <string>
+#include <charconv>
+#include <type_traits>
+#include <cstdlib>
+#include <iostream>
+
 /**
 * @brief Main Function.
+* 
+* @param[in] argc Arguments count.
+* @param[in] argv Arguments: --headless, --width=N, --height=N, --frames=N, --fps=N, --null, --capture=File, --replay=File, --dump=Folder.
 */
-int main() {
+int main(int argc, char** argv) {
+
+    Neptune::ApplicationInfo info{};
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const std::string_view arg = argv[i];
+
+        const auto value = [&](std::string_view key) { return std::string(arg.substr(key.size())); };
+
+        // Parse a whole numeric value, false on garbage, trailing characters or overflow.
+        const auto parse = [&]<typename T>(std::string_view key, T& out) {
+
+            const auto text = arg.substr(key.size());
+
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                const std::string str(text);
+
+                char* end = nullptr;
+                const auto v = std::strtof(str.c_str(), &end);
+
+                if (str.empty() || end != str.c_str() + str.size()) return false;
+
+                out = v;
+                return true;
+            }
+            else
+            {
+                const auto [end, ec] = std::from_chars(text.data(), text.data() + text.size(), out);
+
+                return !text.empty() && ec == std::errc() && end == text.data() + text.size();
+            }
+        };
+
+        bool valid = true;
+
+        if      (arg == "--headless")           info.headless  = true;
+        else if (arg.starts_with("--width="))   valid = parse("--width=",  info.width)     && info.width  > 0;
+        else if (arg.starts_with("--height="))  valid = parse("--height=", info.height)    && info.height > 0;
+        else if (arg.starts_with("--frames="))  valid = parse("--frames=", info.frames);
+        else if (arg.starts_with("--fps="))     valid = parse("--fps=",    info.frameRate) && info.frameRate >= 0.0f;
+        else if (arg == "--null")               { info.backend = Neptune::RenderBackendEnum::Null; info.headless = true; }
+        else if (arg.starts_with("--capture=")) info.capture   = value("--capture=");
+        else if (arg.starts_with("--replay="))  info.replay    = value("--replay=");
+        else if (arg.starts_with("--dump="))    info.dump      = value("--dump=");
+
+        // Log is not initialized yet.
+        if (!valid)
+        {
+            std::cerr << "Invalid argument: " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    Neptune::Application::Configure(info);
 
     auto& engine = Neptune::Application::Instance();
     
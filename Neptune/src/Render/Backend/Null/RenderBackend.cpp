@@ -0,0 +1,86 @@
+/**
+* @file RenderBackend.cpp.
+* @brief The RenderBackend Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "RenderBackend.h"
+#include "Device/Graphics/Backend/Null/Infrastructure/InfrastructureHeader.h"
+#include "World/Scene/Scene.h"
+
+namespace Neptune::Null {
+
+    RenderBackend::RenderBackend()
+        : RenderFrontend(RenderBackendEnum::Null)
+        , m_GraphicsBackend(CreateUP<GraphicsBackend>())
+    {}
+
+    void RenderBackend::OnInitialize()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        m_GraphicsBackend->OnInitialize(nullptr);
+        
+        RenderFrontend::OnInitialize();
+    }
+
+    void RenderBackend::OnShutDown()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        RenderFrontend::OnShutDown();
+
+        NEPTUNE_CORE_INFO(GetContext().Get<ICommandLog>()->Report())
+
+        m_GraphicsBackend->OnShutDown();
+    }
+
+    void RenderBackend::BeginFrame(Scene* scene) const
+    {
+        NEPTUNE_PROFILE_ZONE
+        
+        GetContext().Get<ICommandLog>()->BeginFrame();
+    }
+
+    void RenderBackend::EndFrame(Scene* scene) const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        GetContext().Get<ICommandLog>()->Record(ECommand::EndFrame);
+    }
+
+    void RenderBackend::Wait() const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        m_GraphicsBackend->Wait();
+    }
+
+    GraphicsBackend::Context& RenderBackend::GetContext() const
+    {
+        NEPTUNE_PROFILE_ZONE
+        
+        return m_GraphicsBackend->GetContext();
+    }
+    
+    std::any RenderBackend::CreateRHI(RHI::ERHI e, void* payload) const
+	{
+        NEPTUNE_PROFILE_ZONE
+
+        return m_GraphicsBackend->CreateRHI(e, payload);
+	}
+
+    std::unordered_map<std::string, std::any> RenderBackend::AccessInfrastructure() const
+	{
+        NEPTUNE_PROFILE_ZONE
+
+		return m_GraphicsBackend->AccessInfrastructure();
+	}
+    
+}
+
+#endif
@@ -12,7 +12,11 @@
 #include "Device/Graphics/Frontend/RHI/RenderPass.h"
 #include "Device/Graphics/Backend/Vulkan/Infrastructure/InfrastructureHeader.h"
 #include "Device/Graphics/Backend/Vulkan/RHI/RenderPass.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/RenderTarget.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/ResourceStateTracker.h"
 #include "Render/Frontend/Pass/SlatePass.h"
+#include "Render/Frontend/Pass/OffscreenPass.h"
+#include "Resource/Texture/RenderTarget.h"
 #include "Window/Window.h"
 #include "World/Scene/Scene.h"
 #include "World/Component/Component.h"
@@ -31,11 +35,17 @@ namespace Neptune::Vulkan {
     	
 		const auto& window = Window::Instance();
 
-    	m_GraphicsBackend->OnInitialize(&window);
-		
-		GetContext().Registry<ISwapChain>(MaxFrameInFlight);
+		m_Headless = IsHeadless();
+
+		// Headless rendering creates no Surface, swapchain or image semaphores.
+    	m_GraphicsBackend->OnInitialize(m_Headless ? nullptr : &window);
 
-		GetContext().Registry<IGraphicImageSemaphore>(MaxFrameInFlight);
+		if (!m_Headless)
+		{
+			GetContext().Registry<ISwapChain>(MaxFrameInFlight);
+
+			GetContext().Registry<IGraphicImageSemaphore>(MaxFrameInFlight);
+		}
 
 		RenderFrontend::OnInitialize();
 	}
@@ -46,6 +56,31 @@ namespace Neptune::Vulkan {
 
 		RenderFrontend::OnShutDown();
 
+		{
+			const auto stats = ResourceStateTracker::GetTotalStats();
+
+			std::stringstream ss;
+			ss << "Barriers: " << stats.requested << " requested, " << stats.issued << " issued in " << stats.batches << " batches.";
+
+			NEPTUNE_CORE_INFO(ss.str())
+		}
+
+		{
+			std::stringstream ss;
+			ss << "Thread CommandBuffers: " << ThreadCommandPool::GetAcquireCount() << " acquired, " << ThreadCommandPool::GetAllocationCount() << " allocated.";
+
+			NEPTUNE_CORE_INFO(ss.str())
+		}
+
+		{
+			auto& context = GetContext();
+
+			std::stringstream ss;
+			ss << "Descriptors: " << context.Get<IDescriptorPool>()->GetPoolCount() << " pools, " << context.Get<IDescriptorPool>()->GetTransientCount() << " transient sets, " << context.Get<IDescriptorSetLayoutCache>()->GetCount() << " layouts, " << context.Get<IDescriptorSetLayoutCache>()->GetHits() << " layout cache hits.";
+
+			NEPTUNE_CORE_INFO(ss.str())
+		}
+
     	m_GraphicsBackend->OnShutDown();
 	}
 	
@@ -58,11 +93,62 @@ namespace Neptune::Vulkan {
     	auto& context = m_GraphicsBackend->GetContext();
     	
 		{
-			context.Get<IComputeFence>()->Wait(clock.m_FrameIndex);
+			const auto begin = std::chrono::steady_clock::now();
+
+			if (clock.m_FramesInFlight != m_FramesInFlight)
+			{
+				// Frame indices are remapped, nothing recorded with the old ones may be in flight.
+				m_GraphicsBackend->Wait();
+
+				for (uint32_t i = 0; i < MaxFrameInFlight; ++i)
+				{
+					context.Get<IBindLessHeap>()->Recycle(i);
+					context.Get<IReleaseQueue>()->Recycle(i);
+					context.Get<IDescriptorPool>()->Recycle(i);
+				}
+
+				m_FramesInFlight = clock.m_FramesInFlight;
+			}
+
+			++m_FrameNumber;
 
-			context.Get<IGraphicFence>()->Wait(clock.m_FrameIndex);
+			const uint64_t depth = clock.m_LowLatency ? 1 : m_FramesInFlight;
+
+			if (m_FrameNumber > depth)
+			{
+				// Queues overlap, CommandBuffers of this frame index are free once both timelines passed it.
+				context.Get<IComputeTimelineSemaphore>()->Wait(m_FrameNumber - depth);
+
+				context.Get<IGraphicTimelineSemaphore>()->Wait(m_FrameNumber - depth);
+			}
+
+			context.Get<IBindLessHeap>()->Recycle(clock.m_FrameIndex);
+			context.Get<IReleaseQueue>()->Recycle(clock.m_FrameIndex);
+			context.Get<IDescriptorPool>()->Recycle(clock.m_FrameIndex);
+
+			clock.m_CmdAllocations = static_cast<uint32_t>(ThreadCommandPool::BeginFrame(m_FrameNumber));
+
+			clock.m_CpuWaitTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
 		}
 
+		if (m_Headless)
+		{
+			// The copy recorded last time by this frame index is complete, the timeline was waited above.
+			Readback::Result result;
+
+			if (context.Get<IReadback>()->Resolve(clock.m_FrameIndex, result))
+			{
+				ReadbackData            data{};
+				data.data             = result.data;
+				data.size             = result.size;
+				data.width            = result.width;
+				data.height           = result.height;
+				data.frame            = result.frame;
+
+				m_RenderDelegate.onReadback.Broadcast(data);
+			}
+		}
+		else
 		{
 			if (!context.Get<ISwapChain>()->GetNextImage(context.Get<IGraphicImageSemaphore>()->Handle(clock.m_FrameIndex), clock.m_ImageIndex))
 			{
@@ -81,6 +167,25 @@ namespace Neptune::Vulkan {
             beginInfo.flags |= VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
             context.Get<IGraphicCommandBuffer>()->Begin(beginInfo, clock.m_FrameIndex);
 		}
+
+		{
+			const auto& families = context.Get<IPhysicalDevice>()->GetQueueFamilies();
+
+			auto upload = context.Get<IUploadManager>();
+
+			upload->Flush();
+
+			// Acquired values are taken by the submissions in EndFrame, with those of Passes acquiring mid frame.
+			upload->Acquire(*context.Get<IComputeCommandBuffer>()->IHandle(clock.m_FrameIndex), families.compute.value());
+
+			upload->Acquire(*context.Get<IGraphicCommandBuffer>()->IHandle(clock.m_FrameIndex), families.graphic.value());
+		}
+
+		{
+			context.Get<IGpuProfiler>()->BeginFrame(clock.m_FrameIndex);
+
+			clock.m_GpuIdleTime = context.Get<IGpuProfiler>()->GetGpuIdleTime();
+		}
     }
 
     void RenderBackend::EndFrame(Scene* scene) const
@@ -94,19 +199,66 @@ namespace Neptune::Vulkan {
 		{
 			context.Get<IComputeCommandBuffer>()->End(clock.m_FrameIndex);
 
+			if (m_Headless && !m_ReadbackPass)
+			{
+				NEPTUNE_CORE_ERROR("Headless frame has no OffscreenPass to read back.")
+			}
+			else if (m_Headless)
+			{
+				auto rt = m_ReadbackPass->GetRenderTarget()->GetRHIResource()->GetRHIImpl<RenderTarget>();
+
+				// RenderTargets are bucketed, read back the requested extent only.
+				const auto width  = std::min(static_cast<uint32_t>(m_ReadbackPass->GetRTSize().x), rt->GetWidth());
+				const auto height = std::min(static_cast<uint32_t>(m_ReadbackPass->GetRTSize().y), rt->GetHeight());
+
+				// OffscreenPass leaves its RGBA8 RenderTarget in ColorAttachment layout.
+				context.Get<IReadback>()->Record(*context.Get<IGraphicCommandBuffer>()->IHandle(clock.m_FrameIndex), clock.m_FrameIndex, m_FrameNumber, rt->Handle(), VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, width, height, 4);
+			}
+
+			context.Get<IGpuProfiler>()->EndFrame(clock.m_FrameIndex);
+
 			context.Get<IGraphicCommandBuffer>()->End(clock.m_FrameIndex);
 		}
 
-		{
+		const auto submitCompute = [&]() {
 			DEBUGUTILS_BEGINQUEUELABEL(context.Get<IComputeQueue>()->Handle(), "MainComputeQueue")
 
-			VkSemaphore waitSemaphores[]         = { context.Get<IGraphicImageSemaphore>()->Handle(clock.m_FrameIndex) };
-			VkSemaphore signalSemaphores[]       = { context.Get<IComputeQueueSemaphore>()->Handle(clock.m_FrameIndex) };
-			VkPipelineStageFlags waitStages[]    = { VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT };
+			VkSemaphore waitSemaphores[2]        = {};
+			VkPipelineStageFlags waitStages[2]   = {};
+			uint64_t waitValues[2]               = {};
+			uint32_t waitCount                   = 0;
+
+			// Async compute runs alongside graphic, it only waits if a compute Pass reads graphic results of this frame.
+			if (m_QueueSync.computeWaitGraphic)
+			{
+				waitSemaphores[waitCount]        = context.Get<IGraphicTimelineSemaphore>()->Handle();
+				waitStages[waitCount]            = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				waitValues[waitCount]            = m_FrameNumber;
+				++waitCount;
+			}
+
+			if (const uint64_t uploadValue = context.Get<IUploadManager>()->TakeAcquired(context.Get<IPhysicalDevice>()->GetQueueFamilies().compute.value()); uploadValue != 0)
+			{
+				waitSemaphores[waitCount]        = context.Get<IUploadManager>()->Handle();
+				waitStages[waitCount]            = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				waitValues[waitCount]            = uploadValue;
+				++waitCount;
+			}
+
+			VkSemaphore signalSemaphores[]       = { context.Get<IComputeTimelineSemaphore>()->Handle() };
+			uint64_t signalValues[]              = { m_FrameNumber };
+
+			VkTimelineSemaphoreSubmitInfo           timelineInfo{};
+			timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+			timelineInfo.waitSemaphoreValueCount   = waitCount;
+			timelineInfo.pWaitSemaphoreValues      = waitValues;
+			timelineInfo.signalSemaphoreValueCount = 1;
+			timelineInfo.pSignalSemaphoreValues    = signalValues;
 
 			VkSubmitInfo                           submitInfo{};
 			submitInfo.sType                     = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-			submitInfo.waitSemaphoreCount        = 1;
+			submitInfo.pNext                     = &timelineInfo;
+			submitInfo.waitSemaphoreCount        = waitCount;
 			submitInfo.pWaitSemaphores           = waitSemaphores;
 			submitInfo.pWaitDstStageMask         = waitStages;
 			submitInfo.commandBufferCount        = 1;
@@ -114,33 +266,85 @@ namespace Neptune::Vulkan {
 			submitInfo.signalSemaphoreCount      = 1;
 			submitInfo.pSignalSemaphores         = signalSemaphores;
 
-			context.Get<IComputeQueue>()->Submit(submitInfo, context.Get<IComputeFence>()->Handle(clock.m_FrameIndex));
+			context.Get<IComputeQueue>()->Submit(submitInfo);
 
 			DEBUGUTILS_ENDQUEUELABEL(context.Get<IComputeQueue>()->Handle())
-		}
+		};
 
-		{
+		const auto submitGraphic = [&]() {
 			DEBUGUTILS_BEGINQUEUELABEL(context.Get<IGraphicQueue>()->Handle(), "MainGraphicQueue")
 
-			VkSemaphore waitSemaphores[]         = { context.Get<IComputeQueueSemaphore>()->Handle(clock.m_FrameIndex) };
-			VkSemaphore signalSemaphores[]       = { context.Get<IGraphicQueueSemaphore>()->Handle(clock.m_FrameIndex) };
-			VkPipelineStageFlags waitStages[]    = { VK_PIPELINE_STAGE_COMPUTE_SHADER_BIT, VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
+			VkSemaphore waitSemaphores[3]        = {};
+			VkPipelineStageFlags waitStages[3]   = {};
+			uint64_t waitValues[3]               = {};
+			uint32_t waitCount                   = 0;
+
+			// Swapchain image is only touched by graphic.
+			if (!m_Headless)
+			{
+				waitSemaphores[waitCount]        = context.Get<IGraphicImageSemaphore>()->Handle(clock.m_FrameIndex);
+				waitStages[waitCount]            = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+				waitValues[waitCount]            = 0;
+				++waitCount;
+			}
+
+			// Compute of this frame is waited only if a graphic Pass reads it.
+			if (m_QueueSync.graphicWaitCompute)
+			{
+				waitSemaphores[waitCount]        = context.Get<IComputeTimelineSemaphore>()->Handle();
+				waitStages[waitCount]            = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				waitValues[waitCount]            = m_FrameNumber;
+				++waitCount;
+			}
+
+			if (const uint64_t uploadValue = context.Get<IUploadManager>()->TakeAcquired(context.Get<IPhysicalDevice>()->GetQueueFamilies().graphic.value()); uploadValue != 0)
+			{
+				waitSemaphores[waitCount]        = context.Get<IUploadManager>()->Handle();
+				waitStages[waitCount]            = VK_PIPELINE_STAGE_ALL_COMMANDS_BIT;
+				waitValues[waitCount]            = uploadValue;
+				++waitCount;
+			}
+
+			VkSemaphore signalSemaphores[]       = { context.Get<IGraphicTimelineSemaphore>()->Handle(), context.Get<IGraphicQueueSemaphore>()->Handle(clock.m_FrameIndex) };
+			uint64_t signalValues[]              = { m_FrameNumber, 0 };
+
+			VkTimelineSemaphoreSubmitInfo           timelineInfo{};
+			timelineInfo.sType                     = VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO;
+			timelineInfo.waitSemaphoreValueCount   = waitCount;
+			timelineInfo.pWaitSemaphoreValues      = waitValues;
+			timelineInfo.signalSemaphoreValueCount = m_Headless ? 1 : 2;
+			timelineInfo.pSignalSemaphoreValues    = signalValues;
 
 			VkSubmitInfo                           submitInfo{};
 			submitInfo.sType                     = VK_STRUCTURE_TYPE_SUBMIT_INFO;
-			submitInfo.waitSemaphoreCount        = 1;
+			submitInfo.pNext                     = &timelineInfo;
+			submitInfo.waitSemaphoreCount        = waitCount;
 			submitInfo.pWaitSemaphores           = waitSemaphores;
 			submitInfo.pWaitDstStageMask         = waitStages;
 			submitInfo.commandBufferCount        = 1;
 			submitInfo.pCommandBuffers           = &context.Get<IGraphicCommandBuffer>()->Handle(clock.m_FrameIndex);
-			submitInfo.signalSemaphoreCount      = 1;
+			submitInfo.signalSemaphoreCount      = m_Headless ? 1 : 2;
 			submitInfo.pSignalSemaphores         = signalSemaphores;
 
-			context.Get<IGraphicQueue>()->Submit(submitInfo, context.Get<IGraphicFence>()->Handle(clock.m_FrameIndex));
+			context.Get<IGraphicQueue>()->Submit(submitInfo);
 
 			DEBUGUTILS_ENDQUEUELABEL(context.Get<IGraphicQueue>()->Handle())
+		};
+
+		// Compute is submitted first unless it reads graphic results of this frame.
+		if (m_QueueSync.computeWaitGraphic)
+		{
+			submitGraphic();
+			submitCompute();
+		}
+		else
+		{
+			submitCompute();
+			submitGraphic();
 		}
 
+		// Offscreen frames are paced by the graphic timeline only.
+		if (!m_Headless)
 		{
 			DEBUGUTILS_BEGINQUEUELABEL(context.Get<IPresentQueue>()->Handle(), "PresentQueue")
 
@@ -189,12 +393,32 @@ namespace Neptune::Vulkan {
 		auto infrastructure = m_GraphicsBackend->AccessInfrastructure();
 
 		auto pass = std::dynamic_pointer_cast<Render::SlatePass>(m_RenderPasses.back());
+
+		if (!pass) return infrastructure;
     	
 		infrastructure["RenderPass"] = pass->GetRenderPass()->GetRHIImpl<RenderPass>()->Handle();
 
 		return infrastructure;
 	}
 
+	void RenderBackend::BeginPassZone(Scene* scene, const char* name) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto& clock = scene->GetComponent<Component<Data::Clock>>(scene->GetRoot()).GetModel();
+
+		GetContext().Get<IGpuProfiler>()->BeginZone(clock.m_FrameIndex, name);
+	}
+
+	void RenderBackend::EndPassZone(Scene* scene) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto& clock = scene->GetComponent<Component<Data::Clock>>(scene->GetRoot()).GetModel();
+
+		GetContext().Get<IGpuProfiler>()->EndZone(clock.m_FrameIndex);
+	}
+
 	void RenderBackend::RecreateSwapChain() const
 	{
 		NEPTUNE_PROFILE_ZONE
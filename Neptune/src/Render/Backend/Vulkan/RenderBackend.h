@@ -10,6 +10,7 @@
 
 #include "Core/Core.h"
 #include "Render/Frontend/RenderFrontend.h"
+#include "Render/Frontend/Core.h"
 #include "Device/Graphics/Backend/Vulkan/GraphicsBackend.h"
 
 namespace Neptune {
@@ -97,9 +98,27 @@ namespace Neptune::Vulkan {
         */
         void RecreateSwapChain() const override;
 
+        /**
+        * @brief Begin GPU zone of a Pass.
+        *
+        * @param[in] scene Scene.
+        * @param[in] name Pass name.
+        */
+        void BeginPassZone(Scene* scene, const char* name) const override;
+
+        /**
+        * @brief End GPU zone of a Pass.
+        *
+        * @param[in] scene Scene.
+        */
+        void EndPassZone(Scene* scene) const override;
+
     private:
 
-        UP<GraphicsBackend> m_GraphicsBackend; // @brief This GraphicsBackend.
+        UP<GraphicsBackend> m_GraphicsBackend;                           // @brief This GraphicsBackend.
+        mutable uint64_t    m_FrameNumber = 0;                           // @brief Frames begun, timeline value signaled by the current frame.
+        mutable uint32_t    m_FramesInFlight = DefaultFrameInFlight;     // @brief Frames In Flight applied to per frame resources.
+        bool                m_Headless = false;                          // @brief Render offscreen without swapchain.
     };
 }
 
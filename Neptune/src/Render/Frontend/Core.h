@@ -9,5 +9,7 @@
 
 namespace Neptune {
 
-	constexpr uint32_t MaxFrameInFlight = 2;
+	constexpr uint32_t MaxFrameInFlight = 4;                   // @brief Upper bound of Frames In Flight, per frame resources are sized by it.
+
+	constexpr uint32_t DefaultFrameInFlight = 2;               // @brief Frames In Flight used unless changed at runtime.
 }
\ No newline at end of file
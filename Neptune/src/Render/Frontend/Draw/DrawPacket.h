@@ -0,0 +1,143 @@
+/**
+* @file DrawPacket.h.
+* @brief The DrawPacket Class Definitions and Implementation.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace Neptune::Render {
+
+	/**
+	* @brief Order of draws inside a pass.
+	*/
+	enum class DrawOrder : uint8_t
+	{
+		State = 0,          // @brief Group by pipeline, descriptor, mesh, then front to back. Opaque.
+		BackToFront,        // @brief Back to front, then by state. Translucent.
+	};
+
+	/**
+	* @brief 64 bit draw sort key.
+	* Ascending keys give the submission order of a frame:
+	*
+	* State:       | pass 6 | 0 | pipeline 10 | descriptor 12 | mesh 12 | depth 23 |
+	* BackToFront: | pass 6 | 1 | ~depth 23 | pipeline 10 | descriptor 12 | mesh 12 |
+	*
+	* Ids wider than their field are masked, which only costs sort quality,
+	* batching compares the full ids kept in DrawPacket.
+	*/
+	struct DrawKey
+	{
+		static constexpr uint32_t PassBits       = 6;     // @brief Bits of pass.
+		static constexpr uint32_t PipelineBits   = 10;    // @brief Bits of pipeline id.
+		static constexpr uint32_t DescriptorBits = 12;    // @brief Bits of descriptor id.
+		static constexpr uint32_t MeshBits       = 12;    // @brief Bits of mesh id.
+		static constexpr uint32_t DepthBits      = 23;    // @brief Bits of depth.
+
+		static constexpr uint32_t PassShift      = 64 - PassBits;    // @brief Shift of pass.
+		static constexpr uint32_t OrderShift     = PassShift - 1;    // @brief Shift of DrawOrder.
+
+		static_assert(PassBits + 1 + PipelineBits + DescriptorBits + MeshBits + DepthBits == 64);
+
+		/**
+		* @brief Mask lower bits of a value.
+		*
+		* @param[in] value Value.
+		* @param[in] bits Bits kept.
+		*
+		* @return Returns masked value.
+		*/
+		static constexpr uint64_t Field(uint64_t value, uint32_t bits) { return value & ((1ull << bits) - 1); }
+
+		/**
+		* @brief Quantize a non negative view depth, float bits of positive numbers sort as integers.
+		*
+		* @param[in] depth View depth.
+		*
+		* @return Returns DepthBits wide depth.
+		*/
+		static constexpr uint64_t Depth(float depth) { return std::bit_cast<uint32_t>(std::max(depth, 0.0f)) >> (31 - DepthBits); }
+
+		/**
+		* @brief Encode a sort key.
+		*
+		* @param[in] pass Pass index.
+		* @param[in] order DrawOrder.
+		* @param[in] pipeline Pipeline id.
+		* @param[in] descriptor Descriptor id.
+		* @param[in] mesh Mesh id.
+		* @param[in] depth View depth.
+		*
+		* @return Returns sort key.
+		*/
+		static constexpr uint64_t Encode(uint32_t pass, DrawOrder order, uint32_t pipeline, uint32_t descriptor, uint32_t mesh, float depth)
+		{
+			const uint64_t state = Field(pipeline, PipelineBits) << (DescriptorBits + MeshBits) |
+			                       Field(descriptor, DescriptorBits) << MeshBits |
+			                       Field(mesh, MeshBits);
+
+			const uint64_t key = Field(pass, PassBits) << PassShift;
+
+			if (order == DrawOrder::State)
+			{
+				return key | state << DepthBits | Depth(depth);
+			}
+
+			return key | 1ull << OrderShift | Field(~Depth(depth), DepthBits) << (PipelineBits + DescriptorBits + MeshBits) | state;
+		}
+
+		/**
+		* @brief Decode pass of a sort key.
+		*
+		* @param[in] key Sort key.
+		*
+		* @return Returns pass index.
+		*/
+		static constexpr uint32_t Pass(uint64_t key) { return static_cast<uint32_t>(key >> PassShift); }
+	};
+
+	/**
+	* @brief A draw recorded by DrawQueue::Submit.
+	*/
+	struct DrawPacket
+	{
+		uint32_t    pass          = 0;     // @brief Pass index.
+		uint32_t    pipeline      = 0;     // @brief Pipeline id.
+		uint32_t    descriptor    = 0;     // @brief Descriptor id.
+		uint32_t    mesh          = 0;     // @brief Mesh id.
+		uint32_t    instance      = 0;     // @brief Instance data index.
+	};
+
+	/**
+	* @brief A merged instanced draw built by DrawQueue::Build.
+	*/
+	struct DrawBatch
+	{
+		uint32_t    pass          = 0;     // @brief Pass index.
+		uint32_t    pipeline      = 0;     // @brief Pipeline id.
+		uint32_t    descriptor    = 0;     // @brief Descriptor id.
+		uint32_t    vertexCount   = 0;     // @brief Vertex count.
+		uint32_t    firstVertex   = 0;     // @brief First vertex.
+		uint32_t    firstInstance = 0;     // @brief First entry in DrawQueue::GetInstances.
+		uint32_t    instanceCount = 0;     // @brief Instance count.
+	};
+
+	/**
+	* @brief Counters of last DrawQueue::Build.
+	*/
+	struct DrawStats
+	{
+		uint32_t    packets             = 0;        // @brief Packets submitted.
+		uint32_t    batches             = 0;        // @brief Draws after merge.
+		uint32_t    pipelineBinds       = 0;        // @brief Pipeline binds in sorted order.
+		uint32_t    descriptorBinds     = 0;        // @brief Descriptor binds in sorted order.
+		uint32_t    unsortedPipelines   = 0;        // @brief Pipeline binds in submission order.
+		uint32_t    unsortedDescriptors = 0;        // @brief Descriptor binds in submission order.
+		float       time                = 0.0f;     // @brief Sort and merge CPU time(ms).
+	};
+}
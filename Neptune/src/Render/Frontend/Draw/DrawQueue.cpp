@@ -0,0 +1,189 @@
+/**
+* @file DrawQueue.cpp.
+* @brief The DrawQueue Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "DrawQueue.h"
+#include "Device/Graphics/Frontend/RHI/CmdList.h"
+#include "Device/Graphics/Frontend/RHI/Pipeline.h"
+#include "Device/Graphics/Frontend/RHI/DescriptorList.h"
+
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+namespace Neptune::Render {
+
+	void DrawQueue::Clear()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_Packets.clear();
+		m_Keys.clear();
+		m_Order.clear();
+		m_Batches.clear();
+		m_Instances.clear();
+	}
+
+	void DrawQueue::Reset()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Clear();
+
+		m_Pipelines.clear();
+		m_PipelineIds.clear();
+		m_Descriptors.clear();
+		m_DescriptorIds.clear();
+		m_Meshes.clear();
+		m_MeshIds.clear();
+
+		m_Stats = {};
+	}
+
+	void DrawQueue::Reserve(size_t count)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_Packets.reserve(count);
+		m_Keys.reserve(count);
+		m_Order.reserve(count);
+		m_Instances.reserve(count);
+	}
+
+	void DrawQueue::Submit(
+		uint32_t                          pass,
+		const SP<RHI::Pipeline>&          pipeline,
+		const SP<RHI::DescriptorList>&    descriptorList,
+		uint32_t                          vertexCount,
+		uint32_t                          firstVertex,
+		uint32_t                          instance,
+		float                             depth,
+		DrawOrder                         order
+	)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		// Pass is the top field of DrawKey, batches of a pass must stay contiguous.
+		assert(pass < 1u << DrawKey::PassBits);
+
+		DrawPacket                  packet;
+		packet.pass               = pass;
+		packet.pipeline           = Intern(pipeline, m_PipelineIds, m_Pipelines);
+		packet.descriptor         = Intern(descriptorList, m_DescriptorIds, m_Descriptors);
+		packet.instance           = instance;
+
+		{
+			const uint64_t meshKey = static_cast<uint64_t>(firstVertex) << 32 | vertexCount;
+
+			const auto [it, inserted] = m_MeshIds.try_emplace(meshKey, static_cast<uint32_t>(m_Meshes.size()));
+
+			if (inserted)
+			{
+				m_Meshes.push_back({ vertexCount, firstVertex });
+			}
+
+			packet.mesh = it->second;
+		}
+
+		m_Keys.push_back(DrawKey::Encode(pass, order, packet.pipeline, packet.descriptor, packet.mesh, depth));
+		m_Packets.push_back(packet);
+	}
+
+	void DrawQueue::Build()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		const size_t count = m_Packets.size();
+
+		m_Order.resize(count);
+		std::iota(m_Order.begin(), m_Order.end(), 0u);
+
+		// Keys are sorted in place, Submit appends again after next Clear.
+		m_Sort.Sort(m_Keys, m_Order);
+
+		m_Batches.clear();
+		m_Instances.clear();
+		m_Instances.reserve(count);
+
+		const DrawPacket* last = nullptr;
+
+		for (const auto index : m_Order)
+		{
+			const auto& packet = m_Packets[index];
+
+			const bool merge = last                                &&
+			                   last->pass       == packet.pass       &&
+			                   last->pipeline   == packet.pipeline   &&
+			                   last->descriptor == packet.descriptor &&
+			                   last->mesh       == packet.mesh;
+
+			if (merge)
+			{
+				++m_Batches.back().instanceCount;
+			}
+			else
+			{
+				const auto& mesh = m_Meshes[packet.mesh];
+
+				DrawBatch                   batch;
+				batch.pass                = packet.pass;
+				batch.pipeline            = packet.pipeline;
+				batch.descriptor          = packet.descriptor;
+				batch.vertexCount         = mesh.vertexCount;
+				batch.firstVertex         = mesh.firstVertex;
+				batch.firstInstance       = static_cast<uint32_t>(m_Instances.size());
+				batch.instanceCount       = 1;
+
+				m_Batches.push_back(batch);
+			}
+
+			m_Instances.push_back(packet.instance);
+
+			last = &packet;
+		}
+
+		m_Stats = {};
+
+		m_Stats.packets = static_cast<uint32_t>(count);
+		m_Stats.batches = static_cast<uint32_t>(m_Batches.size());
+
+		CountBinds(count, [&](size_t i) -> const DrawPacket& { return m_Packets[i];           }, m_Stats.unsortedPipelines, m_Stats.unsortedDescriptors);
+		CountBinds(count, [&](size_t i) -> const DrawPacket& { return m_Packets[m_Order[i]];  }, m_Stats.pipelineBinds,     m_Stats.descriptorBinds);
+
+		m_Stats.time = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	void DrawQueue::Execute(const RHI::CmdList& cmdList, uint32_t pass) const
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto first = std::lower_bound(m_Batches.begin(), m_Batches.end(), pass, [](const DrawBatch& batch, uint32_t value) { return batch.pass < value; });
+		const auto last  = std::upper_bound(first, m_Batches.end(), pass, [](uint32_t value, const DrawBatch& batch) { return value < batch.pass; });
+
+		const DrawBatch* bound = nullptr;
+
+		for (auto it = first; it != last; ++it)
+		{
+			const bool pipeline = !bound || bound->pipeline != it->pipeline;
+
+			if (pipeline)
+			{
+				cmdList.CmdBindPipeline(m_Pipelines[it->pipeline]);
+			}
+
+			if (pipeline || bound->descriptor != it->descriptor)
+			{
+				cmdList.CmdBindDescriptor(m_Descriptors[it->descriptor]);
+			}
+
+			cmdList.CmdDraw(it->vertexCount, it->instanceCount, it->firstVertex, it->firstInstance);
+
+			bound = &*it;
+		}
+	}
+}
@@ -0,0 +1,217 @@
+/**
+* @file DrawQueue.h.
+* @brief The DrawQueue Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "DrawPacket.h"
+#include "RadixSort.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::RHI {
+
+	class CmdList;
+	class Pipeline;
+	class DescriptorList;
+}
+
+namespace Neptune::Render {
+
+	/**
+	* @brief DrawQueue Class.
+	* This class collects the draws of a frame as DrawPackets with 64 bit DrawKeys, radix sorts them
+	* and merges neighbours sharing pass, pipeline, descriptor and mesh into one instanced DrawBatch.
+	* Instance data indices of merged draws are laid out contiguously in GetInstances, a batch reads
+	* its instances from firstInstance on, so the pass uploads GetInstances once per frame.
+	* Pipelines, descriptors and meshes are given ids on first submit and kept until Reset.
+	*/
+	class DrawQueue
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		DrawQueue() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~DrawQueue() = default;
+
+		/**
+		* @brief Remove packets of last frame, keep ids.
+		*/
+		void Clear();
+
+		/**
+		* @brief Remove packets and ids, release held pipelines and descriptors.
+		*/
+		void Reset();
+
+		/**
+		* @brief Reserve packets.
+		*
+		* @param[in] count Packet count.
+		*/
+		void Reserve(size_t count);
+
+		/**
+		* @brief Submit a draw.
+		*
+		* @param[in] pass Pass index, passes execute their own range.
+		* @param[in] pipeline Pipeline.
+		* @param[in] descriptorList DescriptorList.
+		* @param[in] vertexCount Vertex count.
+		* @param[in] firstVertex First vertex.
+		* @param[in] instance Instance data index.
+		* @param[in] depth View depth.
+		* @param[in] order DrawOrder.
+		*/
+		void Submit(
+			uint32_t                          pass,
+			const SP<RHI::Pipeline>&          pipeline,
+			const SP<RHI::DescriptorList>&    descriptorList,
+			uint32_t                          vertexCount,
+			uint32_t                          firstVertex,
+			uint32_t                          instance,
+			float                             depth,
+			DrawOrder                         order = DrawOrder::State
+		);
+
+		/**
+		* @brief Sort packets and merge them into batches.
+		*/
+		void Build();
+
+		/**
+		* @brief Record batches of a pass, binding only state that changed.
+		*
+		* @param[in] cmdList CmdList inside the pass RenderPass.
+		* @param[in] pass Pass index.
+		*/
+		void Execute(const RHI::CmdList& cmdList, uint32_t pass) const;
+
+		/**
+		* @brief Set sort worker count, 0 uses hardware concurrency.
+		*
+		* @param[in] threads Worker count.
+		*/
+		void SetThreads(uint32_t threads) { m_Sort.SetThreads(threads); }
+
+		/**
+		* @brief Get batches of last Build, ordered by pass.
+		*
+		* @return Returns DrawBatches.
+		*/
+		const std::vector<DrawBatch>& GetBatches() const { return m_Batches; }
+
+		/**
+		* @brief Get instance data indices of last Build, in batch order.
+		*
+		* @return Returns instance data indices.
+		*/
+		const std::vector<uint32_t>& GetInstances() const { return m_Instances; }
+
+		/**
+		* @brief Get counters of last Build.
+		*
+		* @return Returns DrawStats.
+		*/
+		const DrawStats& GetStats() const { return m_Stats; }
+
+	private:
+
+		/**
+		* @brief Get or assign id of an object.
+		*
+		* @param[in] object Object.
+		* @param[in,out] ids Assigned ids.
+		* @param[in,out] objects Objects by id.
+		*
+		* @return Returns id.
+		*/
+		template<typename T>
+		static uint32_t Intern(const SP<T>& object, std::unordered_map<const T*, uint32_t>& ids, std::vector<SP<T>>& objects);
+
+		/**
+		* @brief Count binds issued by recording packets in an order.
+		*
+		* @param[in] count Packet count.
+		* @param[in] at Packet by position.
+		* @param[out] pipelines Pipeline binds.
+		* @param[out] descriptors Descriptor binds.
+		*/
+		template<typename F>
+		static void CountBinds(size_t count, const F& at, uint32_t& pipelines, uint32_t& descriptors);
+
+	private:
+
+		/**
+		* @brief Mesh range of vertex pulling draws.
+		*/
+		struct Mesh
+		{
+			uint32_t                 vertexCount = 0;    // @brief Vertex count.
+			uint32_t                 firstVertex = 0;    // @brief First vertex.
+		};
+
+		std::vector<DrawPacket>                                     m_Packets;          // @brief Packets in submission order.
+		std::vector<uint64_t>                                       m_Keys;             // @brief Sort keys of packets.
+		std::vector<uint32_t>                                       m_Order;            // @brief Packet indices in sorted order.
+		std::vector<DrawBatch>                                      m_Batches;          // @brief Merged draws.
+		std::vector<uint32_t>                                       m_Instances;        // @brief Instance data indices in batch order.
+		std::vector<SP<RHI::Pipeline>>                              m_Pipelines;        // @brief Pipelines by id.
+		std::unordered_map<const RHI::Pipeline*, uint32_t>          m_PipelineIds;      // @brief Ids of Pipelines.
+		std::vector<SP<RHI::DescriptorList>>                        m_Descriptors;      // @brief DescriptorLists by id.
+		std::unordered_map<const RHI::DescriptorList*, uint32_t>    m_DescriptorIds;    // @brief Ids of DescriptorLists.
+		std::vector<Mesh>                                           m_Meshes;           // @brief Meshes by id.
+		std::unordered_map<uint64_t, uint32_t>                      m_MeshIds;          // @brief Ids of Meshes.
+		RadixSort                                                   m_Sort;             // @brief Key sorter.
+		DrawStats                                                   m_Stats;            // @brief Counters of last Build.
+	};
+
+	template<typename T>
+	uint32_t DrawQueue::Intern(const SP<T>& object, std::unordered_map<const T*, uint32_t>& ids, std::vector<SP<T>>& objects)
+	{
+		const auto [it, inserted] = ids.try_emplace(object.get(), static_cast<uint32_t>(objects.size()));
+
+		if (inserted)
+		{
+			objects.push_back(object);
+		}
+
+		return it->second;
+	}
+
+	template<typename F>
+	void DrawQueue::CountBinds(size_t count, const F& at, uint32_t& pipelines, uint32_t& descriptors)
+	{
+		pipelines   = 0;
+		descriptors = 0;
+
+		const DrawPacket* last = nullptr;
+
+		for (size_t i = 0; i < count; ++i)
+		{
+			const DrawPacket& packet = at(i);
+
+			// A new pass begins a new RenderPass, nothing stays bound.
+			const bool newPass = !last || last->pass != packet.pass;
+
+			const bool pipeline = newPass || last->pipeline != packet.pipeline;
+
+			// Descriptors are bound against the layout of the bound pipeline.
+			const bool descriptor = pipeline || last->descriptor != packet.descriptor;
+
+			pipelines   += pipeline;
+			descriptors += descriptor;
+
+			last = &packet;
+		}
+	}
+}
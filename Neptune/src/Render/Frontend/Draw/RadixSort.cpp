@@ -0,0 +1,144 @@
+/**
+* @file RadixSort.cpp.
+* @brief The RadixSort Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "RadixSort.h"
+#include "Core/Memory/FrameArena.h"
+
+#include <array>
+#include <future>
+#include <thread>
+
+namespace Neptune::Render {
+
+	namespace {
+
+		constexpr size_t MinBatch = 16384;      // @brief Fewest keys worth a worker.
+		constexpr size_t Radix    = 256;        // @brief Buckets per pass.
+		constexpr size_t Digits   = 8;          // @brief 8 bit digits of a key.
+
+		/**
+		* @brief Run work on every part, part 0 on the calling thread.
+		*
+		* @param[in] parts Part count.
+		* @param[in] work Work of a part.
+		*/
+		template<typename F>
+		void ForEachPart(size_t parts, const F& work)
+		{
+			std::vector<std::future<void>> futures;
+			futures.reserve(parts - 1);
+
+			for (size_t part = 1; part < parts; ++part)
+			{
+				futures.emplace_back(std::async(std::launch::async, work, part));
+			}
+
+			work(0);
+
+			for (auto& future : futures)
+			{
+				future.get();
+			}
+		}
+	}
+
+	void RadixSort::Sort(std::vector<uint64_t>& keys, std::vector<uint32_t>& values)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		assert(keys.size() == values.size());
+
+		m_Passes = 0;
+
+		const size_t count = keys.size();
+
+		if (count < 2) return;
+
+		const size_t threads = m_Threads ? m_Threads : std::max(1u, std::thread::hardware_concurrency());
+		const size_t parts = std::clamp<size_t>(count / MinBatch, 1, threads);
+		const size_t step = (count + parts - 1) / parts;
+
+		// Histograms of all digits in one read, enough to skip digits and to sort on a single part.
+		std::array<std::array<uint32_t, Radix>, Digits> histograms{};
+
+		for (const auto key : keys)
+		{
+			for (size_t digit = 0; digit < Digits; ++digit)
+			{
+				++histograms[digit][(key >> (digit * 8)) & 0xFF];
+			}
+		}
+
+		m_Keys.resize(count);
+		m_Values.resize(count);
+
+		// Scratch lives on the frame arena and is rewound on return, workers only touch elements.
+		auto& arena = Memory::FrameArena::Get();
+		Memory::ArenaScope scope(arena);
+
+		Memory::FrameVector<std::array<uint32_t, Radix>> counts(parts, &arena);
+		Memory::FrameVector<std::array<size_t, Radix>> offsets(parts, &arena);
+
+		for (size_t digit = 0; digit < Digits; ++digit)
+		{
+			const uint32_t shift = static_cast<uint32_t>(digit * 8);
+
+			// A digit shared by every key leaves the order unchanged.
+			if (histograms[digit][(keys[0] >> shift) & 0xFF] == count) continue;
+
+			// Parts hold different keys after every scatter, count them again.
+			if (parts == 1)
+			{
+				counts[0] = histograms[digit];
+			}
+			else
+			{
+				ForEachPart(parts, [&](size_t part) {
+					auto& histogram = counts[part];
+					histogram.fill(0);
+
+					const size_t last = std::min((part + 1) * step, count);
+
+					for (size_t i = part * step; i < last; ++i)
+					{
+						++histogram[(keys[i] >> shift) & 0xFF];
+					}
+				});
+			}
+
+			// Digit major, part minor: equal digits keep part order, the sort stays stable.
+			size_t sum = 0;
+			for (size_t bucket = 0; bucket < Radix; ++bucket)
+			{
+				for (size_t part = 0; part < parts; ++part)
+				{
+					offsets[part][bucket] = sum;
+					sum += counts[part][bucket];
+				}
+			}
+
+			ForEachPart(parts, [&](size_t part) {
+				auto& offset = offsets[part];
+
+				const size_t last = std::min((part + 1) * step, count);
+
+				for (size_t i = part * step; i < last; ++i)
+				{
+					const size_t dst = offset[(keys[i] >> shift) & 0xFF]++;
+
+					m_Keys[dst]   = keys[i];
+					m_Values[dst] = values[i];
+				}
+			});
+
+			keys.swap(m_Keys);
+			values.swap(m_Values);
+
+			++m_Passes;
+		}
+	}
+}
@@ -0,0 +1,64 @@
+/**
+* @file RadixSort.h.
+* @brief The RadixSort Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+#include <vector>
+
+namespace Neptune::Render {
+
+	/**
+	* @brief RadixSort Class.
+	* Stable LSD radix sort of 64 bit keys with a 32 bit payload, 8 bits per pass.
+	* Digits every key agrees on are skipped, so keys only using a few fields cost a few passes.
+	* Large inputs are split across threads: each part builds a histogram, the prefix over
+	* parts keeps the scatter stable, then each part scatters into its own output ranges.
+	*/
+	class RadixSort
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		RadixSort() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~RadixSort() = default;
+
+		/**
+		* @brief Sort keys ascending and move values along.
+		*
+		* @param[in,out] keys Keys.
+		* @param[in,out] values Values, same size as keys.
+		*/
+		void Sort(std::vector<uint64_t>& keys, std::vector<uint32_t>& values);
+
+		/**
+		* @brief Set worker count, 0 uses hardware concurrency.
+		*
+		* @param[in] threads Worker count.
+		*/
+		void SetThreads(uint32_t threads) { m_Threads = threads; }
+
+		/**
+		* @brief Get passes run by last Sort.
+		*
+		* @return Returns pass count.
+		*/
+		uint32_t GetPassCount() const { return m_Passes; }
+
+	private:
+
+		std::vector<uint64_t>        m_Keys;             // @brief Scratch keys, capacity kept across sorts.
+		std::vector<uint32_t>        m_Values;           // @brief Scratch values, capacity kept across sorts.
+		uint32_t                     m_Threads = 0;      // @brief Worker count, 0 uses hardware concurrency.
+		uint32_t                     m_Passes  = 0;      // @brief Passes run by last Sort.
+	};
+}
@@ -31,6 +31,18 @@ namespace Neptune {
         GNMX,                 // @brief PlayStation
         GDKX,                 // @brief Xbox
         NVN,                  // @brief Nintendo Switch
+        Null,                 // @brief No device, records RHI calls
+
+        Count
+    };
+
+    /**
+    * @brief Enum of Queue a Pass is recorded to.
+    */
+    enum class PassQueue : uint8_t
+    {
+        Graphic = 0,          // @brief Graphic Queue, ordered with present.
+        Compute,              // @brief Async Compute Queue, overlaps graphic work.
 
         Count
     };
@@ -5,29 +5,65 @@
 #include "Device/Graphics/Frontend/RHI/DescriptorList.h"
 #include "Device/Graphics/Frontend/RHI/CmdList.h"
 #include "Device/Graphics/Frontend/RHI/RenderTarget.h"
+#include "Device/Graphics/Frontend/RHI/GPUScene.h"
 #include "Resource/Shader/Shader.h"
 #include "Resource/Texture/RenderTarget.h"
 #include "Resource/Shader/Shader.h"
 #include "Resource/ResourcePool.h"
+#include "Resource/Texture/RenderTargetPool.h"
 #include "Resource/Mesh/Mesh.h"
+#include "Resource/Mesh/MeshScene.h"
+#include "Header/ShaderCommon.h"
 #include "World/Scene/Scene.h"
 #include "Data/Clock.h"
 #include "World/Component/Component.h"
 
 namespace Neptune::Render {
 
+	namespace {
+
+		/**
+		* @brief Get a Shader from ResourcePool, load it on first use.
+		*
+		* @param[in] name Shader name.
+		* @param[in] stage Shader stage.
+		* @param[in] path Shader source path.
+		*
+		* @return Returns RHI Shader, nullptr if the source is not compiled.
+		*/
+		SP<RHI::Shader> LoadShader(const std::string& name, ShaderStage stage, const std::filesystem::path& path)
+		{
+			auto& resourcePool = ResourcePool<Shader>::Instance();
+
+			if (!resourcePool.HasResource(name))
+			{
+				auto s = resourcePool.CreateResource(name);
+
+				s->SetStage(stage);
+				s->SetSource(path);
+			}
+
+			return resourcePool.GetResource(name)->GetRHIResource();
+		}
+	}
+
+	BasePass::~BasePass()
+	{
+		RenderTargetPool::Instance().Release(m_SceneRT);
+	}
+
 	void BasePass::OnConstruct()
 	{
 		{
-			auto& resourcePool = ResourcePool<RenderTarget>::Instance();
-
 			RenderTargetCreateInfo    info{};
 			info.format             = TextureFormat::RGBA16_SFLOAT;
 			info.domain             = TextureDomain::Texture2D;
 			info.width              = m_RTSize.x;
 			info.height             = m_RTSize.y;
 
-			resourcePool.CreateResource("Scene", info);
+			m_SceneRT = RenderTargetPool::Instance().Acquire("Scene", info);
+
+			ResourcePool<RenderTarget>::Instance().SetResource("Scene", m_SceneRT);
 		}
 
 		RenderTargetAttachmentInfo                  info{};
@@ -37,59 +73,73 @@ namespace Neptune::Render {
 		info.outLayout                            = AttachmentLayout::ColorAttachment;
 
 		m_RenderPass = CreateSP<RHI::RenderPass>();
-		m_RenderPass->AddColorAttachment(ResourcePool<RenderTarget>::Instance().GetResource("Scene")->GetRHIResource(), info);
+		m_RenderPass->AddColorAttachment(m_SceneRT->GetRHIResource(), info);
 		m_RenderPass->Build();
 		
 		m_DescriptorList = CreateSP<RHI::DescriptorList>();
+		m_DescriptorList->CombineSharedLayout();
+		m_DescriptorList->AddBindLessHeap(ShaderCommon::BINDLESS_TEXTURE_SET);
 		m_DescriptorList->Build();
 
-		m_Pipeline = CreateSP<RHI::Pipeline>();
-		m_Pipeline->SetDefault();
-		m_Pipeline->SetRenderPass(m_RenderPass);
-		m_Pipeline->SetDescriptorList(m_DescriptorList);
-		m_Pipeline->SetCullMode(CullMode::None);
-		
-		{
-			auto& resourcePool = ResourcePool<Shader>::Instance();
+		const auto vert     = LoadShader("BasePassVert",     ShaderStage::Vertex,   "src/Assets/Shader/BasePass.vert");
+		const auto frag     = LoadShader("BasePassFrag",     ShaderStage::Fragment, "assets/Shaders/BasePass.frag");
+		const auto meshVert = LoadShader("BasePassMeshVert", ShaderStage::Vertex,   "assets/Shaders/src/BasePassMesh.vert");
+		const auto meshFrag = LoadShader("BasePassMeshFrag", ShaderStage::Fragment, "assets/Shaders/src/BasePassMesh.frag");
 
-			if (!resourcePool.HasResource("BasePassVert"))
-			{
-				auto s = resourcePool.CreateResource("BasePassVert");
-
-				s->SetStage(ShaderStage::Vertex);
-				s->SetSource("src/Assets/Shader/BasePass.vert");
-			}
-
-            auto shader = resourcePool.GetResource("BasePassVert");
+		if (vert && frag)
+		{
+			m_Pipeline = CreateSP<RHI::Pipeline>();
+			m_Pipeline->SetDefault();
+			m_Pipeline->SetRenderPass(m_RenderPass);
+			m_Pipeline->SetDescriptorList(m_DescriptorList);
+			m_Pipeline->SetCullMode(CullMode::None);
+			m_Pipeline->AddShader(ShaderStage::Vertex, vert);
+			m_Pipeline->AddShader(ShaderStage::Fragment, frag);
+			m_Pipeline->BuildGraphicPipeline();
+		}
 
-			m_Pipeline->AddShader(shader->GetStage(), shader->GetRHIResource());
+		if (meshVert && meshFrag)
+		{
+			m_MeshPipeline = CreateSP<RHI::Pipeline>();
+			m_MeshPipeline->SetDefault();
+			m_MeshPipeline->SetRenderPass(m_RenderPass);
+			m_MeshPipeline->SetDescriptorList(m_DescriptorList);
+			m_MeshPipeline->SetCullMode(CullMode::Back);
+			m_MeshPipeline->AddShader(ShaderStage::Vertex, meshVert);
+			m_MeshPipeline->AddShader(ShaderStage::Fragment, meshFrag);
+			m_MeshPipeline->BuildGraphicPipeline();
 		}
+	}
 
+	void BasePass::OnResize(const glm::vec2& rtSize)
+	{
+		m_RTSize = rtSize;
+
+		if (m_SceneRT->GetRHIResource()->GetWidth()  == RenderTargetPool::BucketSize(rtSize.x) &&
+		    m_SceneRT->GetRHIResource()->GetHeight() == RenderTargetPool::BucketSize(rtSize.y))
 		{
-			auto& resourcePool = ResourcePool<Shader>::Instance();
+			return;
+		}
 
-			if (!resourcePool.HasResource("BasePassFrag"))
-			{
-				auto s = resourcePool.CreateResource("BasePassFrag");
+		RenderTargetCreateInfo    info{};
+		info.format             = TextureFormat::RGBA16_SFLOAT;
+		info.domain             = TextureDomain::Texture2D;
+		info.width              = m_RTSize.x;
+		info.height             = m_RTSize.y;
 
-				s->SetStage(ShaderStage::Fragment);
-				s->SetSource("assets/Shaders/BasePass.frag");
-			}
+		RenderTargetPool::Instance().Release(m_SceneRT);
 
-            auto shader = resourcePool.GetResource("BasePassFrag");
+		m_SceneRT = RenderTargetPool::Instance().Acquire("Scene", info);
 
-			m_Pipeline->AddShader(shader->GetStage(), shader->GetRHIResource());
-		}
+		ResourcePool<RenderTarget>::Instance().SetResource("Scene", m_SceneRT);
 
-		m_Pipeline->BuildGraphicPipeline();
+		m_RenderPass->SetColorAttachment(0, m_SceneRT->GetRHIResource());
 	}
 
 	void BasePass::OnRender(Scene* scene)
 	{
 		const auto& clock = scene->GetComponent<Component<Data::Clock>>(scene->GetRoot()).GetModel();
 
-		m_DescriptorList->UpdateUniformTexture(1, 0, ResourcePool<RenderTarget>::Instance().GetResource("CurrDecodeRT")->GetRHIResource());
-
 		RHI::CmdList cmdList;
 
 		cmdList.SetGraphicCmdList(clock);
@@ -100,11 +150,34 @@ namespace Neptune::Render {
 
 		cmdList.CmdSetViewport(m_RTSize);
 
-		cmdList.CmdBindPipeline(m_Pipeline);
+		// The decoded video is drawn only when a decoder publishes CurrDecodeRT.
+		if (auto& rtPool = ResourcePool<RenderTarget>::Instance(); m_Pipeline && rtPool.HasResource("CurrDecodeRT"))
+		{
+			ShaderCommon::BindLessIndex    index{};
+			index.textures[0]            = rtPool.GetResource("CurrDecodeRT")->GetRHIResource()->GetBindLessIndex();
 
-		cmdList.CmdBindDescriptor(m_DescriptorList);
+			cmdList.CmdBindPipeline(m_Pipeline);
 
-		cmdList.CmdDrawFullScreenTriangle();
+			cmdList.CmdBindDescriptor(m_DescriptorList);
+
+			cmdList.CmdPushConstants(&index, sizeof(index));
+
+			cmdList.CmdDrawFullScreenTriangle();
+		}
+
+		if (auto& meshPool = ResourcePool<MeshScene>::Instance(); m_MeshPipeline && meshPool.HasResource("Scene"))
+		{
+			auto meshScene = meshPool.GetResource("Scene");
+
+			if (meshScene->GetInstanceCount() > 0)
+			{
+				cmdList.CmdBindPipeline(m_MeshPipeline);
+
+				cmdList.CmdBindDescriptor(m_DescriptorList);
+
+				cmdList.CmdDrawGPUScene(meshScene->GetRHIResource(), meshScene->GetViewProjection());
+			}
+		}
 
 		cmdList.CmdEndRenderPass();
 	}
@@ -3,6 +3,11 @@
 #include "Pass.h"
 #include <glm/glm.hpp>
 
+namespace Neptune {
+
+	class RenderTarget;
+}
+
 namespace Neptune::RHI {
 
 	class RenderPass;
@@ -17,12 +22,18 @@ namespace Neptune::Render {
 	public:
 
 		BasePass() : Pass() {}
-		~BasePass() override = default;
+		~BasePass() override;
 
 		void OnConstruct() override;
 
+		const char* GetName() const override { return "BasePass"; }
+
+		std::vector<std::string> GetDependencies() const override { return { "CullPass" }; }
+
 		void OnRender(Scene* scene) override;
 
+		void OnResize(const glm::vec2& rtSize) override;
+
 		void SetRTSize(const glm::vec2& rtSize) { m_RTSize = rtSize; }
 
 	private:
@@ -30,6 +41,8 @@ namespace Neptune::Render {
 		SP<RHI::RenderPass>      m_RenderPass;
 		SP<RHI::DescriptorList>  m_DescriptorList;
 		SP<RHI::Pipeline>        m_Pipeline;
+		SP<RHI::Pipeline>        m_MeshPipeline;
+		SP<RenderTarget>         m_SceneRT;
 		
 		glm::vec2                m_RTSize{ 100.0f, 100.0f };
 	};
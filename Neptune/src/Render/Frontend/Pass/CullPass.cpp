@@ -0,0 +1,35 @@
+#include "Pchheader.h"
+#include "CullPass.h"
+#include "Device/Graphics/Frontend/RHI/CmdList.h"
+#include "Device/Graphics/Frontend/RHI/GPUScene.h"
+#include "Resource/ResourcePool.h"
+#include "Resource/Mesh/MeshScene.h"
+#include "World/Scene/Scene.h"
+#include "World/Component/Component.h"
+#include "Data/Clock.h"
+
+namespace Neptune::Render {
+
+	void CullPass::OnRender(Scene* scene)
+	{
+		auto& resourcePool = ResourcePool<MeshScene>::Instance();
+
+		if (!resourcePool.HasResource("Scene")) return;
+
+		auto meshScene = resourcePool.GetResource("Scene");
+
+		meshScene->Flush();
+
+		if (meshScene->GetInstanceCount() == 0) return;
+
+		const auto& clock = scene->GetComponent<Component<Data::Clock>>(scene->GetRoot()).GetModel();
+
+		RHI::CmdList cmdList;
+
+		// Culls on async compute, BasePass waits it through its dependency.
+		cmdList.SetComputeCmdList(clock);
+
+		cmdList.CmdCullGPUScene(meshScene->GetRHIResource(), meshScene->GetViewProjection(), meshScene->GetViewPosition());
+	}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "Core/Core.h"
+#include "Pass.h"
+
+namespace Neptune::Render {
+
+	class CullPass : public Pass
+	{
+	public:
+
+		CullPass() : Pass() {}
+		~CullPass() override = default;
+
+		void OnConstruct() override {}
+
+		const char* GetName() const override { return "CullPass"; }
+
+		PassQueue GetQueue() const override { return PassQueue::Compute; }
+
+		void OnRender(Scene* scene) override;
+	};
+}
@@ -0,0 +1,105 @@
+/**
+* @file OffscreenPass.cpp.
+* @brief The OffscreenPass Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "OffscreenPass.h"
+#include "Device/Graphics/Frontend/RHI/RenderPass.h"
+#include "Device/Graphics/Frontend/RHI/CmdList.h"
+#include "Device/Graphics/Frontend/RHI/RenderTarget.h"
+#include "Resource/Texture/RenderTarget.h"
+#include "Resource/Texture/RenderTargetPool.h"
+#include "Resource/ResourcePool.h"
+#include "World/Scene/Scene.h"
+#include "World/Component/Component.h"
+#include "Data/Clock.h"
+
+namespace Neptune::Render {
+
+	OffscreenPass::~OffscreenPass()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		RenderTargetPool::Instance().Release(m_OffscreenRT);
+	}
+
+	void OffscreenPass::OnConstruct()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		AcquireRenderTarget();
+
+		RenderTargetAttachmentInfo                  info{};
+		info.loadOp                               = AttachmentOP::Clear;
+		info.enableBlend                          = false;
+		info.inLayout                             = AttachmentLayout::Undefined;
+		info.outLayout                            = AttachmentLayout::ColorAttachment;
+
+		m_RenderPass = CreateSP<RHI::RenderPass>();
+		m_RenderPass->AddColorAttachment(m_OffscreenRT->GetRHIResource(), info);
+		m_RenderPass->Build();
+	}
+
+	void OffscreenPass::OnRender(Scene* scene)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto& clock = scene->GetComponent<Component<Data::Clock>>(scene->GetRoot()).GetModel();
+
+		RHI::CmdList cmdList;
+
+		cmdList.SetGraphicCmdList(clock);
+
+		// Scene is written by BasePass, without it the offscreen RT is only cleared.
+		if (auto& rtPool = ResourcePool<RenderTarget>::Instance(); rtPool.HasResource("Scene"))
+		{
+			cmdList.CmdBlitRenderTarget(rtPool.GetResource("Scene")->GetRHIResource(), m_OffscreenRT->GetRHIResource(), m_RTSize);
+
+			return;
+		}
+
+		cmdList.SetRenderPass(m_RenderPass);
+
+		cmdList.CmdBeginRenderPass();
+
+		cmdList.CmdSetViewport(m_RTSize);
+
+		cmdList.CmdEndRenderPass();
+	}
+
+	void OffscreenPass::OnResize(const glm::vec2& rtSize)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_RTSize = rtSize;
+
+		if (m_OffscreenRT->GetRHIResource()->GetWidth()  == RenderTargetPool::BucketSize(rtSize.x) &&
+		    m_OffscreenRT->GetRHIResource()->GetHeight() == RenderTargetPool::BucketSize(rtSize.y))
+		{
+			return;
+		}
+
+		RenderTargetPool::Instance().Release(m_OffscreenRT);
+
+		AcquireRenderTarget();
+
+		m_RenderPass->SetColorAttachment(0, m_OffscreenRT->GetRHIResource());
+	}
+
+	void OffscreenPass::AcquireRenderTarget()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		RenderTargetCreateInfo    info{};
+		info.format             = TextureFormat::RGBA8_UNORM;
+		info.domain             = TextureDomain::Texture2D;
+		info.width              = m_RTSize.x;
+		info.height             = m_RTSize.y;
+
+		m_OffscreenRT = RenderTargetPool::Instance().Acquire("Offscreen", info);
+
+		ResourcePool<RenderTarget>::Instance().SetResource("Offscreen", m_OffscreenRT);
+	}
+}
@@ -0,0 +1,102 @@
+/**
+* @file OffscreenPass.h.
+* @brief The OffscreenPass Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Pass.h"
+#include <glm/glm.hpp>
+
+namespace Neptune {
+
+	class RenderTarget;
+}
+
+namespace Neptune::RHI {
+
+	class RenderPass;
+}
+
+namespace Neptune::Render {
+
+	/**
+	* @brief Offscreen Pass.
+	* Last Pass of headless rendering, it replaces SlatePass and copies Scene into a RenderTarget instead of the swapchain.
+	*/
+	class OffscreenPass : public Pass
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		OffscreenPass() : Pass() {}
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~OffscreenPass() override;
+
+		/**
+		* @brief Interface of Construct.
+		*/
+		void OnConstruct() override;
+
+		/**
+		* @brief Interface of Get Pass name.
+		*
+		* @return Returns Pass name.
+		*/
+		const char* GetName() const override { return "OffscreenPass"; }
+
+		/**
+		* @brief Interface of Render.
+		* 
+		* @param[in] scene Scene.
+		*/
+		void OnRender(Scene* scene) override;
+
+		/**
+		* @brief Interface of Resize, rebind attachments but keep pipelines.
+		*
+		* @param[in] rtSize Pass RT Size.
+		*/
+		void OnResize(const glm::vec2& rtSize) override;
+
+		/**
+		* @brief Set RT Size.
+		*
+		* @param[in] rtSize Pass RT Size.
+		*/
+		void SetRTSize(const glm::vec2& rtSize) { m_RTSize = rtSize; }
+
+		/**
+		* @brief Get RT Size, the rendered extent of the bucketed RenderTarget.
+		*
+		* @return Returns RT Size.
+		*/
+		const glm::vec2& GetRTSize() const { return m_RTSize; }
+
+		/**
+		* @brief Get RenderTarget, RGBA8_UNORM and left in ColorAttachment layout.
+		*
+		* @return Returns RenderTarget.
+		*/
+		SP<RenderTarget> GetRenderTarget() const { return m_OffscreenRT; }
+
+	private:
+
+		/**
+		* @brief Acquire RenderTarget of m_RTSize.
+		*/
+		void AcquireRenderTarget();
+
+	private:
+
+		SP<RHI::RenderPass> m_RenderPass;             // @brief This RenderPass.
+		SP<RenderTarget> m_OffscreenRT;               // @brief Offscreen RenderTarget.
+		glm::vec2 m_RTSize{ 100.0f, 100.0f };         // @brief RT Size.
+	};
+}
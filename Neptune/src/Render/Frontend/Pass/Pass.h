@@ -6,6 +6,10 @@
 
 #pragma once
 #include "Core/Core.h"
+#include "Render/Frontend/Enum.h"
+#include <glm/glm.hpp>
+#include <string>
+#include <vector>
 
 namespace Neptune {
 
@@ -36,11 +40,41 @@ namespace Neptune::Render {
 		*/
 		virtual void OnConstruct() = 0;
 
+		/**
+		* @brief Interface of Get Pass name.
+		*
+		* @return Returns Pass name.
+		*/
+		virtual const char* GetName() const = 0;
+
+		/**
+		* @brief Interface of Get Queue this Pass records to.
+		* A Compute Pass must record with SetComputeCmdList.
+		*
+		* @return Returns PassQueue.
+		*/
+		virtual PassQueue GetQueue() const { return PassQueue::Graphic; }
+
+		/**
+		* @brief Interface of Get Passes whose results this Pass reads.
+		* Only dependencies across queues turn into semaphore waits.
+		*
+		* @return Returns names of Passes.
+		*/
+		virtual std::vector<std::string> GetDependencies() const { return {}; }
+
 		/**
 		* @brief Interface of Render.
 		*
 		* @param[in] scene Scene.
 		*/
 		virtual void OnRender(Scene* scene) = 0;
+
+		/**
+		* @brief Interface of Resize, rebind attachments but keep pipelines.
+		*
+		* @param[in] rtSize Pass RT Size.
+		*/
+		virtual void OnResize(const glm::vec2& rtSize) {}
 	};
 }
\ No newline at end of file
@@ -19,8 +19,12 @@ namespace Neptune::Render {
 
 		void OnConstruct() override;
 
+		const char* GetName() const override { return "PrePass"; }
+
 		void OnRender(Scene* scene) override;
 
+		void OnResize(const glm::vec2& rtSize) override { m_RTSize = rtSize; }
+
 		void SetRTSize(const glm::vec2& rtSize) { m_RTSize = rtSize; }
 
 	private:
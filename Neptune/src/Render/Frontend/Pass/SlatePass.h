@@ -40,6 +40,13 @@ namespace Neptune::Render {
 		*/
 		void OnConstruct() override;
 
+		/**
+		* @brief Interface of Get Pass name.
+		*
+		* @return Returns Pass name.
+		*/
+		const char* GetName() const override { return "SlatePass"; }
+
 		/**
 		* @brief Interface of Render.
 		* 
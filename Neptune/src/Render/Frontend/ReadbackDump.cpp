@@ -0,0 +1,75 @@
+/**
+* @file ReadbackDump.cpp.
+* @brief The ReadbackDump Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "ReadbackDump.h"
+
+#include <fstream>
+#include <iomanip>
+
+namespace Neptune {
+
+    ReadbackDump::ReadbackDump(const std::filesystem::path& folder)
+        : m_Folder(folder)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        std::error_code ec;
+        std::filesystem::create_directories(m_Folder, ec);
+
+        if (ec)
+        {
+            std::stringstream ss;
+            ss << "ReadbackDump: [ " << m_Folder << " ] can not be created: " << ec.message();
+
+            NEPTUNE_CORE_ERROR(ss.str())
+        }
+    }
+
+    void ReadbackDump::Write(const ReadbackData& data)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        const uint64_t texels = static_cast<uint64_t>(data.width) * data.height;
+
+        if (!data.data || texels == 0 || data.size < texels * 4) return;
+
+        std::stringstream name;
+        name << "frame_" << std::setw(6) << std::setfill('0') << data.frame << ".ppm";
+
+        std::ofstream stream(m_Folder / name.str(), std::ios::binary);
+
+        if (!stream.is_open())
+        {
+            std::stringstream ss;
+            ss << "ReadbackDump: [ " << (m_Folder / name.str()) << " ] can not be opened";
+
+            NEPTUNE_CORE_ERROR(ss.str())
+            return;
+        }
+
+        stream << "P6\n" << data.width << " " << data.height << "\n255\n";
+
+        // PPM has no alpha, drop it row by row.
+        m_Rgb.resize(static_cast<size_t>(data.width) * 3);
+
+        const auto* src = static_cast<const uint8_t*>(data.data);
+
+        for (uint32_t y = 0; y < data.height; ++y)
+        {
+            for (uint32_t x = 0; x < data.width; ++x, src += 4)
+            {
+                m_Rgb[x * 3 + 0] = src[0];
+                m_Rgb[x * 3 + 1] = src[1];
+                m_Rgb[x * 3 + 2] = src[2];
+            }
+
+            stream.write(reinterpret_cast<const char*>(m_Rgb.data()), static_cast<std::streamsize>(m_Rgb.size()));
+        }
+
+        ++m_Count;
+    }
+}
@@ -0,0 +1,56 @@
+/**
+* @file ReadbackDump.h.
+* @brief The ReadbackDump Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "RenderDelegate.h"
+
+#include <filesystem>
+#include <vector>
+
+namespace Neptune {
+
+    /**
+    * @brief ReadbackDump Class.
+    * This class writes headless readbacks to a folder, one binary PPM per frame.
+    */
+    class ReadbackDump
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        *
+        * @param[in] folder Output folder, created if missing.
+        */
+        explicit ReadbackDump(const std::filesystem::path& folder);
+
+        /**
+        * @brief Destructor Function.
+        */
+        virtual ~ReadbackDump() = default;
+
+        /**
+        * @brief Write a readback, bound to RenderDelegate::onReadback.
+        *
+        * @param[in] data ReadbackData.
+        */
+        void Write(const ReadbackData& data);
+
+        /**
+        * @brief Get written frames count.
+        *
+        * @return Returns written frames count.
+        */
+        uint64_t GetCount() const { return m_Count; }
+
+    private:
+
+        std::filesystem::path m_Folder;         // @brief Output folder.
+        std::vector<uint8_t>  m_Rgb;            // @brief RGB row buffer, reused by frames.
+        uint64_t              m_Count = 0;      // @brief Written frames count.
+    };
+}
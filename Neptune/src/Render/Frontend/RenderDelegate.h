@@ -10,14 +10,29 @@
 
 namespace Neptune {
 
+    /**
+    * @brief Offscreen RenderTarget read back in headless mode.
+    */
+    struct ReadbackData
+    {
+        const void* data   = nullptr;       // @brief RGBA8 texels, valid during the Broadcast only.
+        uint64_t    size   = 0;             // @brief Data bytes.
+        uint32_t    width  = 0;             // @brief Requested width, rows are tightly packed.
+        uint32_t    height = 0;             // @brief Requested height.
+        uint64_t    frame  = 0;             // @brief Frame number the data was rendered in.
+    };
+
     DELEGATE(DrawSlate, void*)
 
+    DELEGATE(Readback, const ReadbackData&)
+
     /**
     * @brief Delegate for RenderFrontend.
     */
     struct RenderDelegate
     {
         DelegateDrawSlate onDrawSlate;      // @brief Delegate of DrawSlate.
+        DelegateReadback  onReadback;       // @brief Delegate of Readback, broadcast frames in flight later in headless mode.
     };
     
 }
\ No newline at end of file
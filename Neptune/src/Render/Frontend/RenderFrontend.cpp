@@ -35,13 +35,25 @@
 #include "Render/Backend/Vulkan/RenderBackend.h"
 #endif
 
+#ifdef NP_GRAPHICS_NULL
+#include "Render/Backend/Null/RenderBackend.h"
+#endif
+
+#include "Render/Frontend/Pass/CullPass.h"
 #include "Render/Frontend/Pass/BasePass.h"
 #include "Render/Frontend/Pass/SlatePass.h"
 #include "Render/Frontend/Pass/PrePass.h"
+#include "Render/Frontend/Pass/OffscreenPass.h"
 #include "Render/Frontend/Pass/Pass.h"
 #include "Device/Graphics/Frontend/RHI/RHI.h"
+#include "Resource/Texture/RenderTargetPool.h"
 #include "Window/Window.h"
+#include "Core/Event/EventBus.h"
 #include "Core/Event/WindowEvent.h"
+#include "Core/Application.h"
+#include "World/Scene/Scene.h"
+#include "World/Component/Component.h"
+#include "Data/Clock.h"
 
 namespace Neptune {
 
@@ -81,6 +93,10 @@ namespace Neptune {
             case RenderBackendEnum::Vulkan: sp = CreateSP<Vulkan::RenderBackend>(); break;
 #endif
             
+#ifdef NP_GRAPHICS_NULL
+            case RenderBackendEnum::Null:   sp = CreateSP<Null::RenderBackend>();   break;
+#endif
+            
             default:
             {
                 NEPTUNE_CORE_CRITICAL("Not Supported Render Backend.")
@@ -90,8 +106,20 @@ namespace Neptune {
 
         RHI::RHIDelegate::SetCreator([p = sp.get()](RHI::ERHI e, void* payload) { return p->CreateRHI(e, payload); });
 
+        const auto& info = Application::GetInfo();
+
+        if (!info.capture.empty())
+        {
+            RHI::Capture::Begin(info.capture);
+        }
+
         sp->OnInitialize();
 
+        if (!info.replay.empty())
+        {
+            sp->m_Replayer = CreateUP<RHI::Replayer>(info.replay);
+        }
+
         return sp;
     }
 
@@ -99,6 +127,13 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
+        // No Slate reports a viewport size in headless mode, render at Window extent.
+        if (IsHeadless())
+        {
+            ConstructDefaultPasses(Window::Instance().Extent());
+            return;
+        }
+
         ConstructDefaultPasses();
     }
 
@@ -108,16 +143,46 @@ namespace Neptune {
 
         RHI::RHIDelegate::SetCreator(nullptr);
 
+        m_Replayer.reset();
+
         m_RenderPasses.clear();
+
+        m_ReadbackPass.reset();
+
+        RenderTargetPool::Instance().Reset();
+
+        RHI::Capture::End();
     }
 
     void RenderFrontend::RenderFrame(Scene* scene)
     {
         NEPTUNE_PROFILE_ZONE
 
+        RenderTargetPool::Instance().Tick();
+
+        if (m_Replayer)
+        {
+            m_Replayer->ReplayFrame(scene->GetComponent<Component<Data::Clock>>(scene->GetRoot()).GetModel());
+            return;
+        }
+
+        NEPTUNE_RHI_CAPTURE(RHI::ECaptureOp::BeginFrame, nullptr)
+
         std::ranges::for_each(m_RenderPasses, [&](const auto& renderPass) {
+
+            // GPU zones are recorded in graphic CommandBuffer.
+            if (renderPass->GetQueue() != PassQueue::Graphic)
+            {
+                renderPass->OnRender(scene);
+                return;
+            }
+
+            BeginPassZone(scene, renderPass->GetName());
             renderPass->OnRender(scene);
+            EndPassZone(scene);
         });
+
+        NEPTUNE_RHI_CAPTURE(RHI::ECaptureOp::EndFrame, nullptr)
     }
 
     void RenderFrontend::RecreateSwapChain() const
@@ -128,7 +193,7 @@ namespace Neptune {
 
         WindowResizeOverEvent event(extent.x, extent.y);
 
-        Event::GetEventCallbackFn()(event);
+        EventBus::Instance().Publish(event);
     }
 
     void RenderFrontend::ConstructDefaultPasses(const glm::vec2& rtSize)
@@ -136,6 +201,7 @@ namespace Neptune {
         NEPTUNE_PROFILE_ZONE
 
         m_RenderPasses = {};
+        m_ReadbackPass.reset();
 
         {
             auto pass = CreateSP<Render::PrePass>();
@@ -144,13 +210,34 @@ namespace Neptune {
             AddPass(pass);
         }
 
+#ifdef NP_GPU_DRIVEN
+
+        // CullPass writes the indirect draws BasePass consumes.
+        {
+            auto pass = CreateSP<Render::CullPass>();
+
+            AddPass(pass);
+        }
+
         {
             auto pass = CreateSP<Render::BasePass>();
             pass->SetRTSize(rtSize);
 
-            //AddPass(pass);
+            AddPass(pass);
         }
 
+#endif
+
+        if (IsHeadless())
+        {
+            auto pass = CreateSP<Render::OffscreenPass>();
+            pass->SetRTSize(rtSize);
+
+            AddPass(pass);
+
+            m_ReadbackPass = pass;
+        }
+        else
         {
             auto pass = CreateSP<Render::SlatePass>();
 
@@ -160,10 +247,27 @@ namespace Neptune {
         }
     }
 
+    void RenderFrontend::ResizeDefaultPasses(const glm::vec2& rtSize)
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        if (m_RenderPasses.empty())
+        {
+            ConstructDefaultPasses(rtSize);
+            return;
+        }
+
+        std::ranges::for_each(m_RenderPasses, [&](const auto& renderPass) {
+            renderPass->OnResize(rtSize);
+        });
+    }
+
     void RenderFrontend::ConstructSlatePass()
     {
         NEPTUNE_PROFILE_ZONE
 
+        if (m_RenderPasses.back() == m_ReadbackPass) m_ReadbackPass.reset();
+
         m_RenderPasses.pop_back();
 
         auto pass = CreateSP<Render::SlatePass>();
@@ -173,6 +277,13 @@ namespace Neptune {
         AddPass(pass);
     }
 
+    bool RenderFrontend::IsHeadless() const
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        return Window::Instance().Implement() == WindowImplement::Headless;
+    }
+
     void RenderFrontend::AddPass(SP<Render::Pass> pass)
     {
         NEPTUNE_PROFILE_ZONE
@@ -180,5 +291,66 @@ namespace Neptune {
         pass->OnConstruct();
 
         m_RenderPasses.emplace_back(pass);
+
+        SchedulePasses();
+    }
+
+    void RenderFrontend::SchedulePasses()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        m_QueueSync = {};
+
+        std::unordered_map<std::string, size_t> indices;
+
+        for (size_t i = 0; i < m_RenderPasses.size(); ++i)
+        {
+            indices[m_RenderPasses[i]->GetName()] = i;
+        }
+
+        for (size_t i = 0; i < m_RenderPasses.size(); ++i)
+        {
+            const auto& pass = m_RenderPasses[i];
+
+            for (const auto& name : pass->GetDependencies())
+            {
+                auto it = indices.find(name);
+
+                if (it == indices.end())
+                {
+                    NEPTUNE_CORE_WARN("Pass dependency not found.")
+                    continue;
+                }
+
+                const auto& dependency = m_RenderPasses[it->second];
+
+                if (dependency->GetQueue() == pass->GetQueue())
+                {
+                    // Passes of one queue are recorded in order, barriers inside the Pass are enough.
+                    if (it->second > i)
+                    {
+                        NEPTUNE_CORE_WARN("Pass depends on a later Pass of the same queue.")
+                    }
+
+                    continue;
+                }
+
+                // The waiting queue is submitted after the queue it reads.
+                switch (pass->GetQueue())
+                {
+                    case PassQueue::Graphic: m_QueueSync.graphicWaitCompute = true; break;
+                    case PassQueue::Compute: m_QueueSync.computeWaitGraphic = true; break;
+                    default: break;
+                }
+            }
+        }
+
+        // Each queue has one submission per frame, waits in both directions would deadlock.
+        if (m_QueueSync.graphicWaitCompute && m_QueueSync.computeWaitGraphic)
+        {
+            NEPTUNE_CORE_ERROR("Graphic and compute Passes read each other in one frame, compute will not wait graphic.")
+
+            m_QueueSync.computeWaitGraphic = false;
+        }
     }
 }
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "RenderDelegate.h"
 #include "Core/Event/Event.h"
 #include "Device/Graphics/Frontend/RHI/RHI.h"
+#include "Device/Graphics/Frontend/RHI/Replayer.h"
 #include "Enum.h"
 
 #include <vector>
@@ -21,8 +22,8 @@ namespace Neptune {
     namespace Render {
 
         class Pass;
+        class OffscreenPass;
     }
-
     /**
     * @brief RenderFrontend Class.
     * This class defines the RenderFrontEnd behaves.
@@ -109,11 +110,25 @@ namespace Neptune {
         */
         void ConstructDefaultPasses(const glm::vec2& rtSize = { 100.0f, 100.0f });
 
+        /**
+        * @brief Resize Default Passes, construct them if not yet.
+        *
+        * @param[in] rtSize Passes RT Size.
+        */
+        void ResizeDefaultPasses(const glm::vec2& rtSize);
+
         /**
         * @brief Construct Slate Pass.
         */
         void ConstructSlatePass();
 
+        /**
+        * @brief Is rendering offscreen without a swapchain.
+        *
+        * @return Returns true if headless.
+        */
+        bool IsHeadless() const;
+
         /**
         * @brief Get RenderDelegate.
         * 
@@ -135,6 +150,21 @@ namespace Neptune {
         */
         virtual void RecreateSwapChain() const;
 
+        /**
+        * @brief Interface of Begin GPU zone of a Pass.
+        *
+        * @param[in] scene Scene.
+        * @param[in] name Pass name.
+        */
+        virtual void BeginPassZone(class Scene* scene, const char* name) const {}
+
+        /**
+        * @brief Interface of End GPU zone of a Pass.
+        *
+        * @param[in] scene Scene.
+        */
+        virtual void EndPassZone(class Scene* scene) const {}
+
     private:
 
         /**
@@ -144,10 +174,27 @@ namespace Neptune {
         */
         void AddPass(SP<Render::Pass> pass);
 
+        /**
+        * @brief Resolve queue synchronization from Pass queues and dependencies.
+        */
+        void SchedulePasses();
+
     protected:
 
+        /**
+        * @brief Synchronization between graphic and compute submissions of a frame.
+        */
+        struct QueueSync
+        {
+            bool graphicWaitCompute = false;                   // @brief A graphic Pass reads results of a compute Pass in the same frame.
+            bool computeWaitGraphic = false;                   // @brief A compute Pass reads results of a graphic Pass in the same frame, graphic is submitted first.
+        };
+
         RenderBackendEnum m_RenderBackendEnum;                 // @brief RenderBackendEnum.
         std::vector<SP<Render::Pass>> m_RenderPasses;          // @brief Container of Passes.
-        RenderDelegate m_RenderDelegate;                       // @brief RenderDelegate.
+        SP<Render::OffscreenPass> m_ReadbackPass;              // @brief Pass read back in headless mode, null otherwise.
+        mutable RenderDelegate m_RenderDelegate;               // @brief RenderDelegate.
+        QueueSync m_QueueSync;                                 // @brief Queue synchronization of Passes.
+        UP<RHI::Replayer> m_Replayer;                          // @brief Replayer of a capture file, replaces Passes if set.
     };
 }
\ No newline at end of file
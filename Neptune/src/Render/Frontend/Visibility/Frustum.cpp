@@ -0,0 +1,76 @@
+/**
+* @file Frustum.cpp.
+* @brief The Frustum Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "Frustum.h"
+#include "GamePlay/Camera/Camera.h"
+
+namespace Neptune::Render {
+
+	namespace {
+
+		/**
+		* @brief Normalize a plane, degenerated plane never rejects.
+		*
+		* @param[in] plane Plane.
+		*
+		* @return Returns normalized plane.
+		*/
+		glm::vec4 Normalize(const glm::vec4& plane)
+		{
+			const float length = glm::length(glm::vec3(plane));
+
+			// Infinite far plane of reverse z projection has no normal.
+			if (length < 1e-6f) return { 0.0f, 0.0f, 0.0f, 1.0f };
+
+			return plane / length;
+		}
+	}
+
+	Frustum Frustum::FromMatrix(const glm::mat4& viewProjection)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto row = [&](int i) {
+			return glm::vec4(viewProjection[0][i], viewProjection[1][i], viewProjection[2][i], viewProjection[3][i]);
+		};
+
+		const glm::vec4 r0 = row(0);
+		const glm::vec4 r1 = row(1);
+		const glm::vec4 r2 = row(2);
+		const glm::vec4 r3 = row(3);
+
+		Frustum frustum{};
+		frustum.planes[Left]       = Normalize(r3 + r0);
+		frustum.planes[Right]      = Normalize(r3 - r0);
+		frustum.planes[Bottom]     = Normalize(r3 + r1);
+		frustum.planes[Top]        = Normalize(r3 - r1);
+		frustum.planes[Near]       = Normalize(r2);
+		frustum.planes[Far]        = Normalize(r3 - r2);
+
+		return frustum;
+	}
+
+	Frustum Frustum::FromCamera(Camera& camera, const glm::mat4& view)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		return FromMatrix(camera.GetPMatrixReverseZ() * view);
+	}
+
+	bool Frustum::Intersect(const glm::vec3& center, const glm::vec3& extent) const
+	{
+		for (const auto& plane : planes)
+		{
+			const float d = glm::dot(glm::vec3(plane), center) + plane.w;
+			const float r = glm::dot(glm::abs(glm::vec3(plane)), extent);
+
+			if (d + r < 0.0f) return false;
+		}
+
+		return true;
+	}
+}
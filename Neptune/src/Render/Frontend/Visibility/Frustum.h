@@ -0,0 +1,70 @@
+/**
+* @file Frustum.h.
+* @brief The Frustum Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+#include <array>
+
+namespace Neptune {
+
+	class Camera;
+}
+
+namespace Neptune::Render {
+
+	/**
+	* @brief Frustum Class.
+	* Six planes extracted from a view projection matrix, normals point inside.
+	* Clip depth in [0, w] is assumed, reverse z and forward z share the same planes.
+	*/
+	struct Frustum
+	{
+		enum Plane : uint8_t
+		{
+			Left = 0,
+			Right,
+			Bottom,
+			Top,
+			Near,
+			Far,
+
+			Count
+		};
+
+		std::array<glm::vec4, Count> planes;    // @brief xyz normal, w distance, point is inside if dot(n, p) + w >= 0.
+
+		/**
+		* @brief Extract planes from a view projection matrix.
+		*
+		* @param[in] viewProjection View projection matrix.
+		*
+		* @return Returns Frustum.
+		*/
+		static Frustum FromMatrix(const glm::mat4& viewProjection);
+
+		/**
+		* @brief Extract planes from a camera and its view matrix.
+		*
+		* @param[in] camera Perspective or Orthographic Camera.
+		* @param[in] view View matrix, inverse of camera transform.
+		*
+		* @return Returns Frustum.
+		*/
+		static Frustum FromCamera(Camera& camera, const glm::mat4& view);
+
+		/**
+		* @brief Test an axis aligned box.
+		*
+		* @param[in] center Box center.
+		* @param[in] extent Box half size.
+		*
+		* @return Returns true if box intersects or is inside frustum.
+		*/
+		bool Intersect(const glm::vec3& center, const glm::vec3& extent) const;
+	};
+}
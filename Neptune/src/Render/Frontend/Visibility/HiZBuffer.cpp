@@ -0,0 +1,131 @@
+/**
+* @file HiZBuffer.cpp.
+* @brief The HiZBuffer Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "HiZBuffer.h"
+
+#include <bit>
+#include <limits>
+
+namespace Neptune::Render {
+
+	void HiZBuffer::Build(const float* depth, uint32_t width, uint32_t height, const glm::mat4& viewProjection, bool reverseZ)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_Levels.clear();
+		m_ViewProjection = viewProjection;
+		m_ReverseZ = reverseZ;
+
+		if (!depth || width == 0 || height == 0) return;
+
+		{
+			Level level;
+			level.width  = width;
+			level.height = height;
+			level.depth.assign(depth, depth + static_cast<size_t>(width) * height);
+
+			m_Levels.emplace_back(std::move(level));
+		}
+
+		while (m_Levels.back().width > 1 || m_Levels.back().height > 1)
+		{
+			const auto& src = m_Levels.back();
+
+			Level dst;
+			dst.width  = std::max(1u, src.width  / 2);
+			dst.height = std::max(1u, src.height / 2);
+			dst.depth.resize(static_cast<size_t>(dst.width) * dst.height);
+
+			for (uint32_t y = 0; y < dst.height; ++y)
+			{
+				// Last texel of an odd level also covers the remaining row and column.
+				const uint32_t y0 = y * 2;
+				const uint32_t y1 = y == dst.height - 1 ? src.height : std::min(y0 + 2, src.height);
+
+				for (uint32_t x = 0; x < dst.width; ++x)
+				{
+					const uint32_t x0 = x * 2;
+					const uint32_t x1 = x == dst.width - 1 ? src.width : std::min(x0 + 2, src.width);
+
+					float farthest = src.depth[static_cast<size_t>(y0) * src.width + x0];
+
+					for (uint32_t sy = y0; sy < y1; ++sy)
+					{
+						for (uint32_t sx = x0; sx < x1; ++sx)
+						{
+							farthest = Farther(farthest, src.depth[static_cast<size_t>(sy) * src.width + sx]);
+						}
+					}
+
+					dst.depth[static_cast<size_t>(y) * dst.width + x] = farthest;
+				}
+			}
+
+			m_Levels.emplace_back(std::move(dst));
+		}
+	}
+
+	bool HiZBuffer::IsOccluded(const glm::vec3& center, const glm::vec3& extent) const
+	{
+		if (m_Levels.empty()) return false;
+
+		glm::vec2 ndcMin(std::numeric_limits<float>::max());
+		glm::vec2 ndcMax(std::numeric_limits<float>::lowest());
+		float nearest = m_ReverseZ ? 0.0f : 1.0f;
+
+		for (int i = 0; i < 8; ++i)
+		{
+			const glm::vec3 corner = center + extent * glm::vec3(i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f);
+			const glm::vec4 clip = m_ViewProjection * glm::vec4(corner, 1.0f);
+
+			// Box crosses the near plane, projected bounds are meaningless.
+			if (clip.w <= 1e-5f) return false;
+
+			const glm::vec3 ndc = glm::vec3(clip) / clip.w;
+
+			ndcMin = glm::min(ndcMin, glm::vec2(ndc));
+			ndcMax = glm::max(ndcMax, glm::vec2(ndc));
+			nearest = m_ReverseZ ? std::max(nearest, ndc.z) : std::min(nearest, ndc.z);
+		}
+
+		if (ndcMax.x < -1.0f || ndcMax.y < -1.0f || ndcMin.x > 1.0f || ndcMin.y > 1.0f) return false;
+
+		const auto& base = m_Levels.front();
+
+		const auto toPixel = [](float ndc, uint32_t size) {
+			return static_cast<uint32_t>(std::clamp((ndc * 0.5f + 0.5f) * static_cast<float>(size), 0.0f, static_cast<float>(size - 1)));
+		};
+
+		const uint32_t x0 = toPixel(ndcMin.x, base.width);
+		const uint32_t x1 = toPixel(ndcMax.x, base.width);
+		const uint32_t y0 = toPixel(ndcMin.y, base.height);
+		const uint32_t y1 = toPixel(ndcMax.y, base.height);
+
+		// Level where the rect spans at most 3x3 texels.
+		const uint32_t size = std::max(x1 - x0, y1 - y0) + 1;
+		const uint32_t levelIndex = std::min<uint32_t>(std::max(static_cast<int>(std::bit_width(size - 1)) - 1, 0), GetLevelCount() - 1);
+
+		const auto& level = m_Levels[levelIndex];
+
+		const uint32_t lx0 = std::min(x0 >> levelIndex, level.width  - 1);
+		const uint32_t lx1 = std::min(x1 >> levelIndex, level.width  - 1);
+		const uint32_t ly0 = std::min(y0 >> levelIndex, level.height - 1);
+		const uint32_t ly1 = std::min(y1 >> levelIndex, level.height - 1);
+
+		float farthest = level.depth[static_cast<size_t>(ly0) * level.width + lx0];
+
+		for (uint32_t y = ly0; y <= ly1; ++y)
+		{
+			for (uint32_t x = lx0; x <= lx1; ++x)
+			{
+				farthest = Farther(farthest, level.depth[static_cast<size_t>(y) * level.width + x]);
+			}
+		}
+
+		return m_ReverseZ ? nearest < farthest : nearest > farthest;
+	}
+}
@@ -0,0 +1,98 @@
+/**
+* @file HiZBuffer.h.
+* @brief The HiZBuffer Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Neptune::Render {
+
+	/**
+	* @brief HiZBuffer Class.
+	* CPU depth pyramid, each texel keeps the farthest depth below it.
+	* Built from a depth buffer, e.g. last frame's depth read back, and used to reject boxes
+	* whose nearest point is behind everything the pyramid covers.
+	*/
+	class HiZBuffer
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		HiZBuffer() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~HiZBuffer() = default;
+
+		/**
+		* @brief Build pyramid from a depth buffer.
+		*
+		* @param[in] depth Depth values, row 0 is ndc y -1.
+		* @param[in] width Depth buffer width.
+		* @param[in] height Depth buffer height.
+		* @param[in] viewProjection View projection matrix depth was rendered with.
+		* @param[in] reverseZ Is depth 1 near and 0 far.
+		*/
+		void Build(const float* depth, uint32_t width, uint32_t height, const glm::mat4& viewProjection, bool reverseZ = true);
+
+		/**
+		* @brief Test an axis aligned box against the pyramid.
+		*
+		* @param[in] center Box center.
+		* @param[in] extent Box half size.
+		*
+		* @return Returns true if box is hidden, false if visible or undecidable.
+		*/
+		bool IsOccluded(const glm::vec3& center, const glm::vec3& extent) const;
+
+		/**
+		* @brief Is pyramid built.
+		*
+		* @return Returns true if built.
+		*/
+		bool IsValid() const { return !m_Levels.empty(); }
+
+		/**
+		* @brief Get pyramid level count.
+		*
+		* @return Returns level count.
+		*/
+		uint32_t GetLevelCount() const { return static_cast<uint32_t>(m_Levels.size()); }
+
+	private:
+
+		/**
+		* @brief Select farther depth.
+		*
+		* @param[in] a Depth.
+		* @param[in] b Depth.
+		*
+		* @return Returns farther depth.
+		*/
+		float Farther(float a, float b) const { return m_ReverseZ ? std::min(a, b) : std::max(a, b); }
+
+	private:
+
+		/**
+		* @brief Pyramid level.
+		*/
+		struct Level
+		{
+			uint32_t                 width  = 0;        // @brief Level width.
+			uint32_t                 height = 0;        // @brief Level height.
+			std::vector<float>       depth;             // @brief Farthest depth per texel.
+		};
+
+		std::vector<Level>           m_Levels;                            // @brief Pyramid levels, 0 is full size.
+		glm::mat4                    m_ViewProjection = glm::mat4(1.0f);  // @brief View projection matrix of depth.
+		bool                         m_ReverseZ = true;                   // @brief Is depth 1 near and 0 far.
+	};
+}
@@ -0,0 +1,517 @@
+/**
+* @file Visibility.cpp.
+* @brief The Visibility Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "Visibility.h"
+#include "HiZBuffer.h"
+#include "World/Scene/Scene.h"
+#include "World/Component/TransformComponent.h"
+
+#include <bit>
+#include <chrono>
+#include <future>
+#include <thread>
+
+#if defined(__x86_64__) || defined(_M_X64)
+	#include <immintrin.h>
+	#define NEPTUNE_VISIBILITY_SSE
+	#define NEPTUNE_VISIBILITY_AVX2
+	#if defined(_MSC_VER) && !defined(__clang__)
+		#include <intrin.h>
+		#define NEPTUNE_TARGET_AVX2
+	#else
+		#define NEPTUNE_TARGET_AVX2 __attribute__((target("avx2")))
+	#endif
+#elif defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+	#include <emmintrin.h>
+	#define NEPTUNE_VISIBILITY_SSE
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+	#include <arm_neon.h>
+	#define NEPTUNE_VISIBILITY_NEON
+#endif
+
+namespace Neptune::Render {
+
+	namespace {
+
+		constexpr size_t MinBatch = 16384;      // @brief Fewest instances worth a worker.
+
+		/**
+		* @brief Push indices of set bits.
+		*
+		* @param[in] base Index of bit 0.
+		* @param[in] mask Visible lanes.
+		* @param[out] visible Visible instance indices.
+		*/
+		void PushLanes(size_t base, uint32_t mask, std::vector<uint32_t>& visible)
+		{
+			while (mask)
+			{
+				visible.push_back(static_cast<uint32_t>(base + std::countr_zero(mask)));
+
+				mask &= mask - 1;
+			}
+		}
+
+		/**
+		* @brief SoA world bounds a kernel reads.
+		*/
+		struct Bounds
+		{
+			const float* cx;     // @brief Center x.
+			const float* cy;     // @brief Center y.
+			const float* cz;     // @brief Center z.
+			const float* ex;     // @brief Half size x.
+			const float* ey;     // @brief Half size y.
+			const float* ez;     // @brief Half size z.
+			const float* rd;     // @brief Sphere radius.
+		};
+
+		/**
+		* @brief SIMD frustum test of a range, tests whole lanes only.
+		*/
+		using Kernel = size_t(*)(const Bounds&, const Frustum&, bool, size_t, size_t, std::vector<uint32_t>&);
+
+#if defined(NEPTUNE_VISIBILITY_AVX2)
+
+		/**
+		* @brief Frustum test 8 instances per step with AVX2.
+		* Only this function is built for AVX2, the rest of the library keeps the baseline instruction set.
+		*
+		* @param[in] bounds Bounds.
+		* @param[in] frustum Frustum.
+		* @param[in] sphere Test spheres instead of AABBs.
+		* @param[in] begin First instance.
+		* @param[in] end Last instance, exclusive.
+		* @param[out] visible Visible instance indices.
+		*
+		* @return Returns first instance left for the scalar loop.
+		*/
+		NEPTUNE_TARGET_AVX2 size_t CullAVX2(const Bounds& bounds, const Frustum& frustum, bool sphere, size_t begin, size_t end, std::vector<uint32_t>& visible)
+		{
+			const float* cx = bounds.cx;
+			const float* cy = bounds.cy;
+			const float* cz = bounds.cz;
+			const float* ex = bounds.ex;
+			const float* ey = bounds.ey;
+			const float* ez = bounds.ez;
+			const float* rd = bounds.rd;
+
+			const auto& planes = frustum.planes;
+
+			size_t i = begin;
+
+			for (; i + 8 <= end; i += 8)
+			{
+				const __m256 x = _mm256_loadu_ps(cx + i);
+				const __m256 y = _mm256_loadu_ps(cy + i);
+				const __m256 z = _mm256_loadu_ps(cz + i);
+
+				const __m256 sx = sphere ? _mm256_setzero_ps() : _mm256_loadu_ps(ex + i);
+				const __m256 sy = sphere ? _mm256_setzero_ps() : _mm256_loadu_ps(ey + i);
+				const __m256 sz = sphere ? _mm256_setzero_ps() : _mm256_loadu_ps(ez + i);
+				const __m256 r  = sphere ? _mm256_loadu_ps(rd + i) : _mm256_setzero_ps();
+
+				__m256 outside = _mm256_setzero_ps();
+
+				for (const auto& plane : planes)
+				{
+					__m256 d = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(plane.x), x), _mm256_set1_ps(plane.w));
+					d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_set1_ps(plane.y), y));
+					d = _mm256_add_ps(d, _mm256_mul_ps(_mm256_set1_ps(plane.z), z));
+
+					__m256 s = r;
+					s = _mm256_add_ps(s, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane.x)), sx));
+					s = _mm256_add_ps(s, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane.y)), sy));
+					s = _mm256_add_ps(s, _mm256_mul_ps(_mm256_set1_ps(std::abs(plane.z)), sz));
+
+					outside = _mm256_or_ps(outside, _mm256_cmp_ps(_mm256_add_ps(d, s), _mm256_setzero_ps(), _CMP_LT_OQ));
+				}
+
+				PushLanes(i, ~static_cast<uint32_t>(_mm256_movemask_ps(outside)) & 0xFFu, visible);
+			}
+
+			return i;
+		}
+
+		/**
+		* @brief Check the CPU and OS support AVX2.
+		*
+		* @return Returns true if AVX2 kernels may run.
+		*/
+		bool HasAVX2()
+		{
+#if defined(_MSC_VER) && !defined(__clang__)
+
+			int info[4];
+
+			__cpuid(info, 0);
+
+			if (info[0] < 7) return false;
+
+			__cpuid(info, 1);
+
+			// OSXSAVE and AVX, then the OS saves YMM registers.
+			if ((info[2] & (1 << 27)) == 0 || (info[2] & (1 << 28)) == 0) return false;
+
+			if ((_xgetbv(0) & 0x6) != 0x6) return false;
+
+			__cpuidex(info, 7, 0);
+
+			return (info[1] & (1 << 5)) != 0;
+
+#else
+
+			return __builtin_cpu_supports("avx2");
+
+#endif
+		}
+
+#endif
+
+#if defined(NEPTUNE_VISIBILITY_SSE)
+
+		/**
+		* @brief Frustum test 4 instances per step with SSE.
+		*
+		* @param[in] bounds Bounds.
+		* @param[in] frustum Frustum.
+		* @param[in] sphere Test spheres instead of AABBs.
+		* @param[in] begin First instance.
+		* @param[in] end Last instance, exclusive.
+		* @param[out] visible Visible instance indices.
+		*
+		* @return Returns first instance left for the scalar loop.
+		*/
+		size_t CullSSE(const Bounds& bounds, const Frustum& frustum, bool sphere, size_t begin, size_t end, std::vector<uint32_t>& visible)
+		{
+			const float* cx = bounds.cx;
+			const float* cy = bounds.cy;
+			const float* cz = bounds.cz;
+			const float* ex = bounds.ex;
+			const float* ey = bounds.ey;
+			const float* ez = bounds.ez;
+			const float* rd = bounds.rd;
+
+			const auto& planes = frustum.planes;
+
+			size_t i = begin;
+
+			for (; i + 4 <= end; i += 4)
+			{
+				const __m128 x = _mm_loadu_ps(cx + i);
+				const __m128 y = _mm_loadu_ps(cy + i);
+				const __m128 z = _mm_loadu_ps(cz + i);
+
+				const __m128 sx = sphere ? _mm_setzero_ps() : _mm_loadu_ps(ex + i);
+				const __m128 sy = sphere ? _mm_setzero_ps() : _mm_loadu_ps(ey + i);
+				const __m128 sz = sphere ? _mm_setzero_ps() : _mm_loadu_ps(ez + i);
+				const __m128 r  = sphere ? _mm_loadu_ps(rd + i) : _mm_setzero_ps();
+
+				__m128 outside = _mm_setzero_ps();
+
+				for (const auto& plane : planes)
+				{
+					__m128 d = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(plane.x), x), _mm_set1_ps(plane.w));
+					d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(plane.y), y));
+					d = _mm_add_ps(d, _mm_mul_ps(_mm_set1_ps(plane.z), z));
+
+					__m128 s = r;
+					s = _mm_add_ps(s, _mm_mul_ps(_mm_set1_ps(std::abs(plane.x)), sx));
+					s = _mm_add_ps(s, _mm_mul_ps(_mm_set1_ps(std::abs(plane.y)), sy));
+					s = _mm_add_ps(s, _mm_mul_ps(_mm_set1_ps(std::abs(plane.z)), sz));
+
+					outside = _mm_or_ps(outside, _mm_cmplt_ps(_mm_add_ps(d, s), _mm_setzero_ps()));
+				}
+
+				PushLanes(i, ~static_cast<uint32_t>(_mm_movemask_ps(outside)) & 0xFu, visible);
+			}
+
+			return i;
+		}
+
+#elif defined(NEPTUNE_VISIBILITY_NEON)
+
+		/**
+		* @brief Frustum test 4 instances per step with NEON.
+		*
+		* @param[in] bounds Bounds.
+		* @param[in] frustum Frustum.
+		* @param[in] sphere Test spheres instead of AABBs.
+		* @param[in] begin First instance.
+		* @param[in] end Last instance, exclusive.
+		* @param[out] visible Visible instance indices.
+		*
+		* @return Returns first instance left for the scalar loop.
+		*/
+		size_t CullNEON(const Bounds& bounds, const Frustum& frustum, bool sphere, size_t begin, size_t end, std::vector<uint32_t>& visible)
+		{
+			const float* cx = bounds.cx;
+			const float* cy = bounds.cy;
+			const float* cz = bounds.cz;
+			const float* ex = bounds.ex;
+			const float* ey = bounds.ey;
+			const float* ez = bounds.ez;
+			const float* rd = bounds.rd;
+
+			const auto& planes = frustum.planes;
+
+			size_t i = begin;
+
+			const uint32x4_t lanes = { 1, 2, 4, 8 };
+
+			for (; i + 4 <= end; i += 4)
+			{
+				const float32x4_t x = vld1q_f32(cx + i);
+				const float32x4_t y = vld1q_f32(cy + i);
+				const float32x4_t z = vld1q_f32(cz + i);
+
+				const float32x4_t sx = sphere ? vdupq_n_f32(0.0f) : vld1q_f32(ex + i);
+				const float32x4_t sy = sphere ? vdupq_n_f32(0.0f) : vld1q_f32(ey + i);
+				const float32x4_t sz = sphere ? vdupq_n_f32(0.0f) : vld1q_f32(ez + i);
+				const float32x4_t r  = sphere ? vld1q_f32(rd + i) : vdupq_n_f32(0.0f);
+
+				uint32x4_t outside = vdupq_n_u32(0);
+
+				for (const auto& plane : planes)
+				{
+					float32x4_t d = vmlaq_n_f32(vdupq_n_f32(plane.w), x, plane.x);
+					d = vmlaq_n_f32(d, y, plane.y);
+					d = vmlaq_n_f32(d, z, plane.z);
+
+					float32x4_t s = r;
+					s = vmlaq_n_f32(s, sx, std::abs(plane.x));
+					s = vmlaq_n_f32(s, sy, std::abs(plane.y));
+					s = vmlaq_n_f32(s, sz, std::abs(plane.z));
+
+					outside = vorrq_u32(outside, vcltq_f32(vaddq_f32(d, s), vdupq_n_f32(0.0f)));
+				}
+
+				PushLanes(i, ~vaddvq_u32(vandq_u32(outside, lanes)) & 0xFu, visible);
+			}
+
+			return i;
+		}
+
+#endif
+
+		/**
+		* @brief Pick the widest kernel the CPU runs.
+		*
+		* @return Returns Kernel, nullptr if only the scalar loop is available.
+		*/
+		Kernel SelectKernel()
+		{
+#if defined(NEPTUNE_VISIBILITY_AVX2)
+
+			if (HasAVX2()) return &CullAVX2;
+
+#endif
+
+#if defined(NEPTUNE_VISIBILITY_SSE)
+
+			return &CullSSE;
+
+#elif defined(NEPTUNE_VISIBILITY_NEON)
+
+			return &CullNEON;
+
+#else
+
+			return nullptr;
+
+#endif
+		}
+
+		const Kernel s_Kernel = SelectKernel();    // @brief Chosen once at startup.
+	}
+
+	void Visibility::Clear()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_CenterX.clear();
+		m_CenterY.clear();
+		m_CenterZ.clear();
+		m_ExtentX.clear();
+		m_ExtentY.clear();
+		m_ExtentZ.clear();
+		m_Radius.clear();
+		m_Entities.clear();
+	}
+
+	void Visibility::Reserve(size_t count)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_CenterX.reserve(count);
+		m_CenterY.reserve(count);
+		m_CenterZ.reserve(count);
+		m_ExtentX.reserve(count);
+		m_ExtentY.reserve(count);
+		m_ExtentZ.reserve(count);
+		m_Radius.reserve(count);
+		m_Entities.reserve(count);
+	}
+
+	uint32_t Visibility::Add(const glm::mat4& model, const glm::vec3& localMin, const glm::vec3& localMax, uint32_t entity)
+	{
+		const glm::vec3 localCenter = (localMin + localMax) * 0.5f;
+		const glm::vec3 localExtent = (localMax - localMin) * 0.5f;
+
+		// Arvo: world extent of a transformed box is |M| * extent.
+		const glm::vec3 center = glm::vec3(model * glm::vec4(localCenter, 1.0f));
+		const glm::mat3 linear = glm::mat3(model);
+
+		const glm::vec3 extent =
+			glm::abs(linear[0]) * localExtent.x +
+			glm::abs(linear[1]) * localExtent.y +
+			glm::abs(linear[2]) * localExtent.z;
+
+		m_CenterX.push_back(center.x);
+		m_CenterY.push_back(center.y);
+		m_CenterZ.push_back(center.z);
+		m_ExtentX.push_back(extent.x);
+		m_ExtentY.push_back(extent.y);
+		m_ExtentZ.push_back(extent.z);
+		m_Radius.push_back(glm::length(extent));
+		m_Entities.push_back(entity);
+
+		return static_cast<uint32_t>(m_Entities.size() - 1);
+	}
+
+	void Visibility::Gather(Scene* scene, const glm::vec3& localMin, const glm::vec3& localMax)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		Clear();
+
+		scene->ViewComponent<TransformComponent>([&](uint32_t e, const TransformComponent& comp) {
+
+			Add(comp.GetModel().ToMatrix(), localMin, localMax, e);
+
+			return true;
+		});
+	}
+
+	void Visibility::Cull(const Frustum& frustum, std::vector<uint32_t>& visible, BoundsTest test, const HiZBuffer* occlusion)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		const auto begin = std::chrono::steady_clock::now();
+
+		const size_t count = GetCount();
+
+		const size_t threads = m_Threads ? m_Threads : std::max(1u, std::thread::hardware_concurrency());
+		const size_t parts = std::clamp<size_t>(count / MinBatch, 1, threads);
+
+		// Part bounds are multiples of 8 so SIMD loops stay aligned to lanes.
+		const size_t step = ((count + parts - 1) / parts + 7) & ~static_cast<size_t>(7);
+
+		std::vector<std::vector<uint32_t>> results(parts);
+		std::vector<uint32_t> occludedCounts(parts, 0);
+
+		const auto work = [&](size_t part) {
+			const size_t first = std::min(part * step, count);
+			const size_t last  = std::min(first + step, count);
+
+			auto& result = results[part];
+			result.reserve(last - first);
+
+			CullRange(frustum, test, first, last, result);
+
+			if (occlusion && occlusion->IsValid())
+			{
+				const auto kept = std::remove_if(result.begin(), result.end(), [&](uint32_t i) {
+					return occlusion->IsOccluded(
+						{ m_CenterX[i], m_CenterY[i], m_CenterZ[i] },
+						{ m_ExtentX[i], m_ExtentY[i], m_ExtentZ[i] }
+					);
+				});
+
+				occludedCounts[part] = static_cast<uint32_t>(result.end() - kept);
+
+				result.erase(kept, result.end());
+			}
+		};
+
+		std::vector<std::future<void>> futures;
+		futures.reserve(parts - 1);
+
+		for (size_t part = 1; part < parts; ++part)
+		{
+			futures.emplace_back(std::async(std::launch::async, work, part));
+		}
+
+		work(0);
+
+		for (auto& future : futures)
+		{
+			future.get();
+		}
+
+		visible.clear();
+
+		size_t total = 0;
+		for (const auto& result : results) total += result.size();
+
+		visible.reserve(total);
+
+		m_Stats = {};
+
+		for (size_t part = 0; part < parts; ++part)
+		{
+			visible.insert(visible.end(), results[part].begin(), results[part].end());
+
+			m_Stats.occluded += occludedCounts[part];
+		}
+
+		m_Stats.tested  = static_cast<uint32_t>(count);
+		m_Stats.visible = static_cast<uint32_t>(visible.size());
+		m_Stats.frustum = m_Stats.tested - m_Stats.visible - m_Stats.occluded;
+		m_Stats.time    = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+	}
+
+	void Visibility::CullRange(const Frustum& frustum, BoundsTest test, size_t begin, size_t end, std::vector<uint32_t>& visible) const
+	{
+		const float* cx = m_CenterX.data();
+		const float* cy = m_CenterY.data();
+		const float* cz = m_CenterZ.data();
+		const float* ex = m_ExtentX.data();
+		const float* ey = m_ExtentY.data();
+		const float* ez = m_ExtentZ.data();
+		const float* rd = m_Radius.data();
+
+		const auto& planes = frustum.planes;
+		const bool sphere = test == BoundsTest::Sphere;
+
+		size_t i = begin;
+
+		if (s_Kernel)
+		{
+			i = s_Kernel({ cx, cy, cz, ex, ey, ez, rd }, frustum, sphere, begin, end, visible);
+		}
+
+		for (; i < end; ++i)
+		{
+			bool inside = true;
+
+			for (const auto& plane : planes)
+			{
+				const float d = plane.x * cx[i] + plane.y * cy[i] + plane.z * cz[i] + plane.w;
+				const float s = sphere ? rd[i] : std::abs(plane.x) * ex[i] + std::abs(plane.y) * ey[i] + std::abs(plane.z) * ez[i];
+
+				if (d + s < 0.0f)
+				{
+					inside = false;
+					break;
+				}
+			}
+
+			if (inside) visible.push_back(static_cast<uint32_t>(i));
+		}
+	}
+}
@@ -0,0 +1,162 @@
+/**
+* @file Visibility.h.
+* @brief The Visibility Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Frustum.h"
+
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Neptune {
+
+	class Scene;
+}
+
+namespace Neptune::Render {
+
+	class HiZBuffer;
+
+	/**
+	* @brief Bounding volume used by frustum test.
+	*/
+	enum class BoundsTest : uint8_t
+	{
+		Sphere = 0,     // @brief Bounding sphere, one multiply-add per plane less.
+		AABB,           // @brief World axis aligned box, tighter.
+	};
+
+	/**
+	* @brief Counters of last Cull.
+	*/
+	struct CullStats
+	{
+		uint32_t    tested   = 0;        // @brief Instances tested.
+		uint32_t    frustum  = 0;        // @brief Instances rejected by frustum.
+		uint32_t    occluded = 0;        // @brief Instances rejected by HiZBuffer.
+		uint32_t    visible  = 0;        // @brief Instances visible.
+		float       time     = 0.0f;     // @brief Cull CPU time(ms).
+	};
+
+	/**
+	* @brief Visibility Class.
+	* This class keeps world bounds of instances in SoA arrays and culls them against a Frustum
+	* with AVX2 (picked at startup if the CPU has it), SSE or NEON, split across threads,
+	* optionally followed by a HiZBuffer test.
+	* The result is a compact ascending list of visible instance indices.
+	*/
+	class Visibility
+	{
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		Visibility() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		~Visibility() = default;
+
+		/**
+		* @brief Remove all instances.
+		*/
+		void Clear();
+
+		/**
+		* @brief Reserve instances.
+		*
+		* @param[in] count Instance count.
+		*/
+		void Reserve(size_t count);
+
+		/**
+		* @brief Add an instance.
+		*
+		* @param[in] model Model matrix.
+		* @param[in] localMin Local bounds min.
+		* @param[in] localMax Local bounds max.
+		* @param[in] entity Entity id reported for this instance.
+		*
+		* @return Returns instance index.
+		*/
+		uint32_t Add(const glm::mat4& model, const glm::vec3& localMin, const glm::vec3& localMax, uint32_t entity = 0);
+
+		/**
+		* @brief Rebuild instances from TransformComponents of a scene.
+		*
+		* @param[in] scene Scene.
+		* @param[in] localMin Local bounds min of every entity.
+		* @param[in] localMax Local bounds max of every entity.
+		*/
+		void Gather(Scene* scene, const glm::vec3& localMin = glm::vec3(-0.5f), const glm::vec3& localMax = glm::vec3(0.5f));
+
+		/**
+		* @brief Cull instances.
+		*
+		* @param[in] frustum Frustum.
+		* @param[out] visible Visible instance indices, ascending.
+		* @param[in] test BoundsTest.
+		* @param[in] occlusion HiZBuffer, nullptr to skip occlusion test.
+		*/
+		void Cull(const Frustum& frustum, std::vector<uint32_t>& visible, BoundsTest test = BoundsTest::AABB, const HiZBuffer* occlusion = nullptr);
+
+		/**
+		* @brief Set worker count, 0 uses hardware concurrency.
+		*
+		* @param[in] threads Worker count.
+		*/
+		void SetThreads(uint32_t threads) { m_Threads = threads; }
+
+		/**
+		* @brief Get instance count.
+		*
+		* @return Returns instance count.
+		*/
+		size_t GetCount() const { return m_Entities.size(); }
+
+		/**
+		* @brief Get entity id of instances.
+		*
+		* @return Returns entity ids.
+		*/
+		const std::vector<uint32_t>& GetEntities() const { return m_Entities; }
+
+		/**
+		* @brief Get counters of last Cull.
+		*
+		* @return Returns CullStats.
+		*/
+		const CullStats& GetStats() const { return m_Stats; }
+
+	private:
+
+		/**
+		* @brief Frustum test a range of instances.
+		*
+		* @param[in] frustum Frustum.
+		* @param[in] test BoundsTest.
+		* @param[in] begin First instance.
+		* @param[in] end Last instance, exclusive.
+		* @param[out] visible Visible instance indices.
+		*/
+		void CullRange(const Frustum& frustum, BoundsTest test, size_t begin, size_t end, std::vector<uint32_t>& visible) const;
+
+	private:
+
+		std::vector<float>           m_CenterX;          // @brief World bounds center x.
+		std::vector<float>           m_CenterY;          // @brief World bounds center y.
+		std::vector<float>           m_CenterZ;          // @brief World bounds center z.
+		std::vector<float>           m_ExtentX;          // @brief World bounds half size x.
+		std::vector<float>           m_ExtentY;          // @brief World bounds half size y.
+		std::vector<float>           m_ExtentZ;          // @brief World bounds half size z.
+		std::vector<float>           m_Radius;           // @brief World bounding sphere radius.
+		std::vector<uint32_t>        m_Entities;         // @brief Entity id of instances.
+		uint32_t                     m_Threads = 0;      // @brief Worker count, 0 uses hardware concurrency.
+		CullStats                    m_Stats;            // @brief Counters of last Cull.
+	};
+}
@@ -0,0 +1,112 @@
+#include "Pchheader.h"
+#include "MeshScene.h"
+#include "Device/Graphics/Frontend/RHI/GPUScene.h"
+#include "Resource/Shader/Shader.h"
+#include "Resource/ResourcePool.h"
+
+namespace Neptune {
+
+	MeshScene::MeshScene()
+	{
+		m_RHIResource = CreateSP<RHI::GPUScene>();
+
+		auto& resourcePool = ResourcePool<Shader>::Instance();
+
+		if (!resourcePool.HasResource("MeshCullComp"))
+		{
+			auto s = resourcePool.CreateResource("MeshCullComp");
+
+			s->SetStage(ShaderStage::Compute);
+			s->SetSource("assets/Shaders/src/MeshCull.comp");
+		}
+
+		// Without a compiled cull shader GPUScene is never ready, CullPass and BasePass skip it.
+		if (auto shader = resourcePool.GetResource("MeshCullComp")->GetRHIResource())
+		{
+			m_RHIResource->SetCullShader(shader);
+		}
+	}
+
+	void MeshScene::SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices)
+	{
+		m_RHIResource->SetGeometry(vertices, indices);
+	}
+
+	uint32_t MeshScene::AddMesh(const ShaderCommon::Sphere& boundSphere, const std::vector<ShaderCommon::MeshLod>& lods)
+	{
+		assert(!lods.empty() && lods.size() <= ShaderCommon::MESH_LOD_MAXNUM);
+
+		ShaderCommon::MeshBounds    mesh{};
+		mesh.boundSphere          = boundSphere;
+		mesh.firstLod             = static_cast<uint32_t>(m_Lods.size());
+		mesh.lodCount             = static_cast<uint32_t>(lods.size());
+
+		m_Lods.insert(m_Lods.end(), lods.begin(), lods.end());
+		m_Meshes.push_back(mesh);
+
+		m_MeshesDirty = true;
+
+		return static_cast<uint32_t>(m_Meshes.size() - 1);
+	}
+
+	uint32_t MeshScene::AddInstance(const glm::mat4& model, uint32_t mesh)
+	{
+		assert(mesh < m_Meshes.size());
+
+		ShaderCommon::MeshInstance  instance{};
+		instance.model            = model;
+		instance.mesh             = mesh;
+
+		m_Instances.push_back(instance);
+
+		return static_cast<uint32_t>(m_Instances.size() - 1);
+	}
+
+	void MeshScene::SetInstanceTransform(uint32_t instance, const glm::mat4& model)
+	{
+		m_Instances[instance].model = model;
+
+		// Instances added since last Flush are uploaded whole.
+		if (instance >= m_UploadedCount) return;
+
+		if (m_DirtyBegin == m_DirtyEnd)
+		{
+			m_DirtyBegin = instance;
+			m_DirtyEnd   = instance + 1;
+		}
+		else
+		{
+			m_DirtyBegin = std::min(m_DirtyBegin, instance);
+			m_DirtyEnd   = std::max(m_DirtyEnd, instance + 1);
+		}
+	}
+
+	void MeshScene::SetView(const glm::mat4& viewProjection, const glm::vec3& viewPosition)
+	{
+		m_ViewProjection = viewProjection;
+		m_ViewPosition   = viewPosition;
+	}
+
+	void MeshScene::Flush()
+	{
+		if (m_MeshesDirty)
+		{
+			m_RHIResource->SetMeshes(m_Meshes, m_Lods);
+
+			m_MeshesDirty = false;
+		}
+
+		if (m_UploadedCount != m_Instances.size())
+		{
+			m_RHIResource->SetInstances(m_Instances);
+
+			m_UploadedCount = static_cast<uint32_t>(m_Instances.size());
+		}
+		else if (m_DirtyBegin != m_DirtyEnd)
+		{
+			m_RHIResource->UpdateInstances(m_DirtyBegin, m_Instances.data() + m_DirtyBegin, m_DirtyEnd - m_DirtyBegin);
+		}
+
+		m_DirtyBegin = m_DirtyEnd = 0;
+	}
+}
@@ -0,0 +1,60 @@
+#pragma once
+#include "Core/Core.h"
+#include "Header/ShaderCommon.h"
+#include <glm/glm.hpp>
+#include <vector>
+
+namespace Neptune {
+
+	namespace RHI {
+
+		class GPUScene;
+	}
+
+	class MeshScene
+	{
+	public:
+
+		MeshScene();
+		~MeshScene() = default;
+
+		void SetName(const std::string& name) { m_Name = name; }
+
+		void SetGeometry(const std::vector<ShaderCommon::Vertex>& vertices, const std::vector<uint32_t>& indices);
+
+		uint32_t AddMesh(const ShaderCommon::Sphere& boundSphere, const std::vector<ShaderCommon::MeshLod>& lods);
+
+		uint32_t AddInstance(const glm::mat4& model, uint32_t mesh);
+
+		void SetInstanceTransform(uint32_t instance, const glm::mat4& model);
+
+		void SetView(const glm::mat4& viewProjection, const glm::vec3& viewPosition);
+
+		void Flush();
+
+		SP<RHI::GPUScene> GetRHIResource() { return m_RHIResource; }
+
+		uint32_t GetInstanceCount() const { return static_cast<uint32_t>(m_Instances.size()); }
+
+		const glm::mat4& GetViewProjection() const { return m_ViewProjection; }
+
+		const glm::vec3& GetViewPosition() const { return m_ViewPosition; }
+
+	private:
+
+		std::string                                 m_Name;
+		SP<RHI::GPUScene>                           m_RHIResource;
+
+		std::vector<ShaderCommon::MeshBounds>       m_Meshes;
+		std::vector<ShaderCommon::MeshLod>          m_Lods;
+		std::vector<ShaderCommon::MeshInstance>     m_Instances;
+
+		bool                                        m_MeshesDirty    = false;
+		uint32_t                                    m_UploadedCount  = 0;
+		uint32_t                                    m_DirtyBegin     = 0;
+		uint32_t                                    m_DirtyEnd       = 0;
+
+		glm::mat4                                   m_ViewProjection { 1.0f };
+		glm::vec3                                   m_ViewPosition   { 0.0f };
+	};
+}
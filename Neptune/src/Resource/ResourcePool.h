@@ -34,6 +34,8 @@ namespace Neptune {
 			return sp;
 		}
 
+		void SetResource(const std::string& name, SP<T> sp) { m_Resources[name] = sp; }
+
 		bool HasResource(const std::string& name) { return m_Resources.contains(name); }
 
 		SP<T> GetResource(const std::string& name) { return m_Resources[name]; }
@@ -21,6 +21,7 @@ namespace Neptune {
 			{
 				case ShaderStage::Vertex:   return shaderc_shader_kind::shaderc_vertex_shader;
 				case ShaderStage::Fragment: return shaderc_shader_kind::shaderc_fragment_shader;
+				case ShaderStage::Compute:  return shaderc_shader_kind::shaderc_compute_shader;
 				default:
 				{
 					NEPTUNE_CORE_WARN("Unsupported ShaderStage To shaderc_shader_kind.")
@@ -59,7 +60,15 @@ namespace Neptune {
 		m_RHIResource = CreateSP<RHI::Shader>();
 		m_RHIResource->SetSource(spirv);
 		m_RHIResource->SetName(m_Name);
-		
+
+#else
+
+		// GLSL is compiled by shaderc, which is only linked on Windows. No precompiled SPIR-V is shipped, the RHI Shader stays null.
+		std::stringstream ss;
+		ss << "Shader: [ " << path << " ] is not loaded, GLSL sources are compiled on Windows only";
+
+		NEPTUNE_CORE_ERROR(ss.str());
+
 #endif
 		
 	}
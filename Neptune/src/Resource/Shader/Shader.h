@@ -13,6 +13,7 @@ namespace Neptune {
 	{
 		Vertex = 0,
 		Fragment,
+		Compute,
 
 		Count
 	};
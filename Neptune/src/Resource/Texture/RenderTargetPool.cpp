@@ -0,0 +1,107 @@
+/**
+* @file RenderTargetPool.cpp.
+* @brief The RenderTargetPool Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "RenderTargetPool.h"
+
+namespace Neptune {
+
+	SP<RenderTarget> RenderTargetPool::Acquire(const std::string& name, const RenderTargetCreateInfo& info)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		RenderTargetCreateInfo bucketInfo = info;
+		bucketInfo.width                  = BucketSize(info.width);
+		bucketInfo.height                 = BucketSize(info.height);
+
+		const uint64_t key = Key(bucketInfo);
+
+		SP<RenderTarget> renderTarget;
+
+		if (auto it = m_Free.find(key); it != m_Free.end() && !it->second.empty())
+		{
+			renderTarget = it->second.back().renderTarget;
+
+			it->second.pop_back();
+		}
+		else
+		{
+			renderTarget = CreateSP<RenderTarget>(bucketInfo);
+		}
+
+		renderTarget->SetName(name);
+
+		m_InUse[renderTarget.get()] = key;
+
+		return renderTarget;
+	}
+
+	void RenderTargetPool::Release(const SP<RenderTarget>& renderTarget)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		if (!renderTarget) return;
+
+		const auto it = m_InUse.find(renderTarget.get());
+
+		if (it == m_InUse.end())
+		{
+			NEPTUNE_CORE_WARN("RenderTarget was not acquired from RenderTargetPool.")
+			return;
+		}
+
+		m_Retired.push_back({ renderTarget, it->second, m_Frame });
+
+		m_InUse.erase(it);
+	}
+
+	void RenderTargetPool::Tick()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		++m_Frame;
+
+		// Frames in flight which may reference a retired RenderTarget have completed.
+		for (auto& entry : m_Retired)
+		{
+			if (entry.frame + MaxFrameInFlight > m_Frame) continue;
+
+			m_Free[entry.key].push_back({ std::move(entry.renderTarget), entry.key, m_Frame });
+		}
+
+		std::erase_if(m_Retired, [](const Entry& entry) { return !entry.renderTarget; });
+
+		for (auto& [key, entries] : m_Free)
+		{
+			std::erase_if(entries, [&](const Entry& entry) {
+				return entry.frame + RenderTargetTrimFrames < m_Frame;
+			});
+		}
+	}
+
+	void RenderTargetPool::Reset()
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		m_Free.clear();
+		m_Retired.clear();
+	}
+
+	uint64_t RenderTargetPool::Key(const RenderTargetCreateInfo& info)
+	{
+		NEPTUNE_PROFILE_ZONE
+
+		uint64_t key = 0;
+
+		key |= static_cast<uint64_t>(info.format);
+		key |= static_cast<uint64_t>(info.domain)                        << 16;
+		key |= static_cast<uint64_t>(info.memoryUsage)                   << 20;
+		key |= static_cast<uint64_t>(info.width  / RenderTargetBucketSize) << 24;
+		key |= static_cast<uint64_t>(info.height / RenderTargetBucketSize) << 44;
+
+		return key;
+	}
+}
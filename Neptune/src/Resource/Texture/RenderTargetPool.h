@@ -0,0 +1,118 @@
+/**
+* @file RenderTargetPool.h.
+* @brief The RenderTargetPool Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "RenderTarget.h"
+#include "Render/Frontend/Core.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune {
+
+	constexpr uint32_t RenderTargetBucketSize = 64;                        // @brief RenderTarget size granularity in pixels.
+
+	constexpr uint32_t RenderTargetTrimFrames = 120;                       // @brief Frames a free RenderTarget is kept before destroyed.
+
+	/**
+	* @brief Transient RenderTarget pool.
+	* RenderTargets are keyed by (format, size bucket, usage), released ones are only
+	* reused after all frames in flight that could still use them are retired.
+	*/
+	class RenderTargetPool
+	{
+	public:
+
+		/**
+		* @brief Get RenderTargetPool Instance.
+		*
+		* @return Returns RenderTargetPool Instance.
+		*/
+		static RenderTargetPool& Instance()
+		{
+			static RenderTargetPool instance;
+
+			return instance;
+		}
+
+	public:
+
+		/**
+		* @brief Constructor Function.
+		*/
+		RenderTargetPool() = default;
+
+		/**
+		* @brief Destructor Function.
+		*/
+		virtual ~RenderTargetPool() = default;
+
+		/**
+		* @brief Acquire a RenderTarget, size is rounded up to RenderTargetBucketSize.
+		*
+		* @param[in] name RenderTarget name.
+		* @param[in] info RenderTargetCreateInfo.
+		*
+		* @return Returns RenderTarget.
+		*/
+		SP<RenderTarget> Acquire(const std::string& name, const RenderTargetCreateInfo& info);
+
+		/**
+		* @brief Release a RenderTarget acquired from this pool.
+		*
+		* @param[in] renderTarget RenderTarget.
+		*/
+		void Release(const SP<RenderTarget>& renderTarget);
+
+		/**
+		* @brief Advance a frame, call once per frame after the oldest frame in flight was waited.
+		*/
+		void Tick();
+
+		/**
+		* @brief Destroy all free and retired RenderTargets.
+		*/
+		void Reset();
+
+		/**
+		* @brief Round size up to bucket.
+		*
+		* @param[in] size Size in pixels.
+		*
+		* @return Returns bucket size.
+		*/
+		static uint32_t BucketSize(uint32_t size) { return std::max(1u, (size + RenderTargetBucketSize - 1) / RenderTargetBucketSize) * RenderTargetBucketSize; }
+
+	private:
+
+		/**
+		* @brief Pack a pool key.
+		*
+		* @param[in] info RenderTargetCreateInfo, size already bucketed.
+		*
+		* @return Returns pool key.
+		*/
+		static uint64_t Key(const RenderTargetCreateInfo& info);
+
+	private:
+
+		/**
+		* @brief A pooled RenderTarget.
+		*/
+		struct Entry
+		{
+			SP<RenderTarget> renderTarget;                                 // @brief RenderTarget.
+			uint64_t         key   = 0;                                    // @brief Pool key, see Key.
+			uint64_t         frame = 0;                                    // @brief Frame when retired or freed.
+		};
+
+		uint64_t                                             m_Frame = 0;  // @brief Frames ticked.
+		std::unordered_map<uint64_t, std::vector<Entry>>     m_Free;       // @brief Reusable RenderTargets per key.
+		std::vector<Entry>                                   m_Retired;    // @brief Released RenderTargets frames in flight may still use.
+		std::unordered_map<const RenderTarget*, uint64_t>    m_InUse;      // @brief Key of acquired RenderTargets.
+	};
+}
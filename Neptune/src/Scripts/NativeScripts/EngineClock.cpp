@@ -43,7 +43,8 @@ namespace Neptune {
 
 		m_Clock->m_FrameTime  = m_Timer->SegmentTime();
 		m_Clock->m_EngineTime = m_Timer->DurationTime();
-		m_Clock->m_FrameIndex = (m_Clock->m_FrameIndex + 1) % MaxFrameInFlight;
+		m_Clock->m_FramesInFlight = std::clamp(m_Clock->m_FramesInFlight, 1u, MaxFrameInFlight);
+		m_Clock->m_FrameIndex     = (m_Clock->m_FrameIndex + 1) % m_Clock->m_FramesInFlight;
 	}
 	
 }
\ No newline at end of file
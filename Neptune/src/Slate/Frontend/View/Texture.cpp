@@ -29,13 +29,13 @@ namespace Neptune::View {
 			{
 				EngineEvent event(EngineEventBit::StopTheEngine);
 
-				Event::GetEventCallbackFn()(event);
+				EventBus::Instance().Publish(event);
 			}
 
 			{
 				SlateResizeEvent event(static_cast<uint32_t>(tempSize.x), static_cast<uint32_t>(tempSize.y));
 
-				Event::GetEventCallbackFn()(event);
+				EventBus::Instance().Publish(event);
 			}
 
 			m_TextureID = (ImTextureID)ResourcePool<RenderTarget>::Instance().GetResource("Scene")->GetRHIResource()->CreateBindingID();
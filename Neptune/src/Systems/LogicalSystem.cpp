@@ -12,7 +12,9 @@
 #include "World/Scene/Scene.h"
 #include "World/Component/ScriptComponent.h"
 #include "Core/Event/EngineEvent.h"
+#include "Core/Memory/AllocTracker.h"
 #include "Slate/Frontend/SlateFrontend.h"
+#include "Window/Window.h"
 
 #include <ranges>
 
@@ -22,6 +24,9 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
+        // Slate draws to the swapchain, there is none in headless mode.
+        if (Window::Instance().Implement() == WindowImplement::Headless) return;
+
         m_SlateFrontend = SlateFrontend::Create(SlateBackendEnum::ImGui, RenderBackendEnum::Vulkan, WindowImplement::GLFW);
     }
 
@@ -40,6 +45,8 @@ namespace Neptune {
         {
             NEPTUNE_PROFILE_ZONEN("DynamicScriptTick")
 
+            NEPTUNE_ALLOC_TAG(World)
+
             for (const auto& scene : scenes | std::views::values)
             {
                 scene->ViewComponent<ScriptComponent>([](uint32_t e, const ScriptComponent& comp) {
@@ -50,7 +57,10 @@ namespace Neptune {
             }
         }
         
+        if (m_SlateFrontend)
         {
+            NEPTUNE_ALLOC_TAG(Slate)
+
             m_SlateFrontend->BeginFrame();
         
             m_SlateFrontend->OnLayout();
@@ -90,17 +100,28 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
+        if (!m_SlateFrontend) return false;
+
         if (e.Has(EngineEventBit::InitSlateFrontend))
         {
             auto renderSystem = static_cast<RenderSystem*>(GetSystem(ESystem::Render));
 
             m_SlateFrontend->OnInitialize(renderSystem->GetRenderFrontend()->AccessInfrastructure());
             
-            renderSystem->GetRenderFrontend()->GetRenderDelegate().onDrawSlate.Bind([p = m_SlateFrontend.get()](void* payload){ p->RenderFrame(payload); });
+            m_DrawSlateHandle = renderSystem->GetRenderFrontend()->GetRenderDelegate().onDrawSlate.Bind([p = m_SlateFrontend.get()](void* payload){ p->RenderFrame(payload); });
         }
 
         if (e.Has(EngineEventBit::ShutdownSlateFrontend))
         {
+            if (m_DrawSlateHandle != 0)
+            {
+                auto renderSystem = static_cast<RenderSystem*>(GetSystem(ESystem::Render));
+
+                renderSystem->GetRenderFrontend()->GetRenderDelegate().onDrawSlate.UnBind(m_DrawSlateHandle);
+
+                m_DrawSlateHandle = 0;
+            }
+
             m_SlateFrontend->OnShutDown();
         }
 
@@ -67,11 +67,12 @@ namespace Neptune {
         *
         * @return Returns true if consumed.
         */
-        bool OnEngineEvent(class EngineEvent& e) const;
+        bool OnEngineEvent(class EngineEvent& e);
         
     private:
 
-        SP<SlateFrontend> m_SlateFrontend;    // @brief Slate Frontend.
+        SP<SlateFrontend> m_SlateFrontend;          // @brief Slate Frontend.
+        uint64_t          m_DrawSlateHandle = 0;    // @brief Handle of Slate Frontend bound to onDrawSlate.
 
     };
 }
\ No newline at end of file
@@ -7,10 +7,13 @@
 #include "Pchheader.h"
 #include "RenderSystem.h"
 #include "Render/Frontend/RenderFrontend.h"
+#include "Render/Frontend/ReadbackDump.h"
+#include "Core/Application.h"
 #include "World/World/World.h"
 #include "Core/Event/EngineEvent.h"
 #include "Core/Event/SlateEvent.h"
 #include "Core/Event/WindowEvent.h"
+#include "Core/Memory/AllocTracker.h"
 
 namespace Neptune {
 
@@ -18,13 +21,32 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
-        m_RenderFrontend = RenderFrontend::Create(RenderBackendEnum::Vulkan);
+        m_RenderFrontend = RenderFrontend::Create(Application::GetInfo().backend);
+
+        if (const auto& info = Application::GetInfo(); !info.dump.empty())
+        {
+            m_ReadbackDump = CreateUP<ReadbackDump>(info.dump);
+
+            m_ReadbackHandle = m_RenderFrontend->GetRenderDelegate().onReadback.Bind([p = m_ReadbackDump.get()](const ReadbackData& data){ p->Write(data); });
+        }
     }
 
     void RenderSystem::OnSystemShutDown()
     {
         NEPTUNE_PROFILE_ZONE
 
+        if (m_ReadbackDump)
+        {
+            m_RenderFrontend->GetRenderDelegate().onReadback.UnBind(m_ReadbackHandle);
+
+            std::stringstream ss;
+            ss << "ReadbackDump: " << m_ReadbackDump->GetCount() << " frames written.";
+
+            NEPTUNE_CORE_INFO(ss.str())
+
+            m_ReadbackDump.reset();
+        }
+
         m_RenderFrontend->OnShutDown();
     }
 
@@ -32,6 +54,8 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
+        NEPTUNE_ALLOC_TAG(Render)
+
         auto scene = World::Instance().GetScenes().at("main_level").get();
 
         m_RenderFrontend->BeginFrame(scene);
@@ -70,7 +94,7 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
-        m_RenderFrontend->ConstructDefaultPasses({ e.GetWidth(), e.GetHeight() });
+        m_RenderFrontend->ResizeDefaultPasses({ e.GetWidth(), e.GetHeight() });
 
         return false;
     }
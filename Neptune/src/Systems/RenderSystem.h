@@ -12,6 +12,7 @@
 namespace Neptune {
 
     class RenderFrontend;
+    class ReadbackDump;
     
     /**
     * @brief RenderSystem Class.
@@ -96,6 +97,8 @@ namespace Neptune {
 
     private:
 
-        SP<RenderFrontend> m_RenderFrontend;    // @brief Render Frontend.
+        SP<RenderFrontend> m_RenderFrontend;        // @brief Render Frontend.
+        UP<ReadbackDump>   m_ReadbackDump;          // @brief Writer of headless readbacks, null if not dumping.
+        uint64_t           m_ReadbackHandle = 0;    // @brief Handle of m_ReadbackDump bound to onReadback.
     };
 }
\ No newline at end of file
@@ -6,6 +6,7 @@
 
 #include "Pchheader.h"
 #include "SystemManager.h"
+#include "Core/Event/EventBus.h"
 #include "Core/Event/EventListener.h"
 #include "Systems/LogicalSystem.h"
 #include "Systems/RenderSystem.h"
@@ -17,8 +18,15 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
-        // Set Global EventCallBack
-        Event::SetEventCallbackFn(BIND_EVENT_FN(SystemManager::OnEvent));
+        // Subscribe all Events as root.
+        m_EventHandle = EventBus::Instance().SubscribeAll(BIND_EVENT_FN(SystemManager::OnEvent));
+    }
+
+    SystemManager::~SystemManager()
+    {
+        NEPTUNE_PROFILE_ZONE
+
+        EventBus::Instance().Unsubscribe(m_EventHandle);
     }
 
     void SystemManager::Initialize()
@@ -45,6 +53,9 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
+        // Publish Events queued since last frame.
+        EventBus::Instance().Drain();
+
         for(auto& system : m_Systems)
         {
             system->Tick();
@@ -62,8 +73,6 @@ namespace Neptune {
     {
         NEPTUNE_PROFILE_ZONE
 
-        NEPTUNE_CORE_TRACE(event.ToString())
-
         for(auto& system : m_Systems)
         {
             EventListener::Dispatch(event, system.get());
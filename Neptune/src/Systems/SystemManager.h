@@ -30,7 +30,7 @@ namespace Neptune {
         /**
         * @brief Destructor Function.
         */
-    	virtual ~SystemManager() = default;
+    	virtual ~SystemManager();
 
         /**
         * @brief Initialize Systems.
@@ -81,6 +81,11 @@ namespace Neptune {
         * @brief Systems queue.
         */
         std::array<UP<System>, static_cast<uint8_t>(ESystem::Count)> m_Systems;
+
+        /**
+        * @brief EventBus subscription of OnEvent.
+        */
+        uint32_t m_EventHandle = 0;
     };
 
     template<typename T, typename ...Args>
@@ -10,6 +10,7 @@
 
 #include "WindowImpl.h"
 #include "RenderBackendInterface.h"
+#include "Core/Event/EventBus.h"
 #include "Core/Event/WindowEvent.h"
 #include "Core/Event/KeyEvent.h"
 #include "Core/Event/MouseEvent.h"
@@ -151,7 +152,7 @@ namespace Neptune::EmscriptenGLFW {
             const auto thisWindows = static_cast<WindowImpl*>(glfwGetWindowUserPointer(window));
 
             WindowResizeEvent event(width, height);
-            Event::GetEventCallbackFn()(event);
+            EventBus::Instance().Publish(event);
         });
 
         // Key event Callback.
@@ -161,22 +162,19 @@ namespace Neptune::EmscriptenGLFW {
             {
                 case GLFW_PRESS:
                 {
-                    KeyPressedEvent event(static_cast<KeyCode>(key), 0);
-                    Event::GetEventCallbackFn()(event);
+                    EventBus::Instance().Enqueue<KeyPressedEvent>(static_cast<KeyCode>(key), 0);
 
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    KeyReleasedEvent event(static_cast<KeyCode>(key));
-                    Event::GetEventCallbackFn()(event);
+                    EventBus::Instance().Enqueue<KeyReleasedEvent>(static_cast<KeyCode>(key));
 
                     break;
                 }
                 case GLFW_REPEAT:
                 {
-                    KeyPressedEvent event(static_cast<KeyCode>(key), 1);
-                    Event::GetEventCallbackFn()(event);
+                    EventBus::Instance().Enqueue<KeyPressedEvent>(static_cast<KeyCode>(key), 1);
 
                     break;
                 }
@@ -188,8 +186,7 @@ namespace Neptune::EmscriptenGLFW {
         // Key Input event Callback.
         glfwSetCharCallback(m_Windows, [](GLFWwindow* window, unsigned int keycode)
         {
-            KeyTypedEvent event(static_cast<KeyCode>(keycode));
-            Event::GetEventCallbackFn()(event);
+            EventBus::Instance().Enqueue<KeyTypedEvent>(static_cast<KeyCode>(keycode));
         });
 
         // Mouse Button event Callback.
@@ -199,15 +196,13 @@ namespace Neptune::EmscriptenGLFW {
             {
                 case GLFW_PRESS:
                 {
-                    MouseButtonPressedEvent event(static_cast<MouseCode>(button));
-                    Event::GetEventCallbackFn()(event);
+                    EventBus::Instance().Enqueue<MouseButtonPressedEvent>(static_cast<MouseCode>(button));
 
                     break;
                 }
                 case GLFW_RELEASE:
                 {
-                    MouseButtonReleasedEvent event(static_cast<MouseCode>(button));
-                    Event::GetEventCallbackFn()(event);
+                    EventBus::Instance().Enqueue<MouseButtonReleasedEvent>(static_cast<MouseCode>(button));
 
                     break;
                 }
@@ -219,15 +214,13 @@ namespace Neptune::EmscriptenGLFW {
         // Mouse Scroll event Callback.
         glfwSetScrollCallback(m_Windows, [](GLFWwindow* window, double xOffset, double yOffset)
         {
-            MouseScrolledEvent event(static_cast<float>(xOffset), static_cast<float>(yOffset));
-            Event::GetEventCallbackFn()(event);
+            EventBus::Instance().Enqueue<MouseScrolledEvent>(static_cast<float>(xOffset), static_cast<float>(yOffset));
         });
 
         // Mouse Move event Callback.
         glfwSetCursorPosCallback(m_Windows, [](GLFWwindow* window, double xPos, double yPos)
         {
-            MouseMovedEvent event(static_cast<float>(xPos), static_cast<float>(yPos));
-            Event::GetEventCallbackFn()(event);
+            EventBus::Instance().Enqueue<MouseMovedEvent>(static_cast<float>(xPos), static_cast<float>(yPos));
         });
     }
 
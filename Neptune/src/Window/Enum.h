@@ -21,6 +21,7 @@ namespace Neptune {
         WindowsNative,
         MacOSNative,
         LinuxNative,
+        Headless,
 
         Count,
 
@@ -0,0 +1,17 @@
+/**
+* @file WindowImpl.cpp.
+* @brief The WindowImpl Class Implementation.
+* @author Spices.
+*/
+
+#include "Pchheader.h"
+#include "WindowImpl.h"
+
+namespace Neptune::Headless {
+
+    WindowImpl::WindowImpl(const WindowInfo& initInfo, WindowImplement implement)
+        : Window(implement)
+        , m_Extent(initInfo.width, initInfo.height)
+    {}
+
+}
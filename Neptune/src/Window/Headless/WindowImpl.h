@@ -0,0 +1,69 @@
+/**
+* @file WindowImpl.h.
+* @brief The WindowImpl Class Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Core/Core.h"
+#include "Window/Window.h"
+
+namespace Neptune::Headless {
+
+    /**
+    * @brief WindowImpl Class.
+    * This class defines the WindowImpl behaves.
+    * This class has no native window, it only provides the extent of offscreen rendering.
+    */
+    class WindowImpl : public Window
+    {
+    public:
+
+        /**
+        * @brief Constructor Function.
+        * @param[in] initInfo WindowInfo.
+        * @param[in] implement WindowImplement.
+        */
+        WindowImpl(const WindowInfo& initInfo, WindowImplement implement);
+
+        /**
+        * @brief Destructor Function.
+        */
+        ~WindowImpl() override = default;
+
+        /**
+        * @brief Interface of determine if window is still active.
+        *
+        * @return Returns true, headless frames are bounded by Application.
+        */
+        bool IsWindowActive() const override { return true; }
+
+        /**
+        * @brief Interface of window poll events.
+        */
+        void PollEvents() const override {}
+
+        /**
+        * @brief Interface of window get extent.
+        */
+        glm::ivec2 Extent() const override { return m_Extent; }
+
+        /**
+        * @brief Get Window Extension.
+        *
+        * @return Returns empty Extension, no surface is created.
+        */
+        std::vector<const char*> Extension() const override { return {}; }
+        
+        /**
+        * @brief Interface of get native window pointer.
+        *
+        * @return Returns nullptr.
+        */
+        void* NativeWindow() const override { return nullptr; }
+
+    private:
+        
+        glm::ivec2 m_Extent;               // @brief Offscreen extent.
+    };
+}
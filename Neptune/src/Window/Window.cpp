@@ -6,6 +6,7 @@
 
 #include "Pchheader.h"
 #include "Window.h"
+#include "Window/Headless/WindowImpl.h"
 
 #ifdef NP_PLATFORM_EMSCRIPTEN
 #include "Window/EmscriptenGLFW/WindowImpl.h"
@@ -43,6 +44,13 @@ namespace Neptune {
                 break;
             }
 #endif
+
+            case WindowImplement::Headless:
+            {
+                S_Instance = CreateUP<Headless::WindowImpl>(initInfo, implement);
+                break;
+            }
+
             default:
             {
                 NEPTUNE_CORE_CRITICAL("Not supported Windows Implement.")
@@ -8,7 +8,7 @@
 #include "Core/Core.h"
 #include "Component.h"
 #include "Core/Math/Transform.h"
-#include "Core/Container/BitSet.hpp"
+#include "Core/Container/AtomicBitSet.hpp"
 
 namespace Neptune {
 
@@ -126,16 +126,16 @@ namespace Neptune {
         /**
         * @brief Get WorldMarkFlags this frame.
         * 
-        * @return Returns the TransformComponentFlags.
+        * @return Returns a snapshot of TransformComponentFlags.
         */
-        const Container::BitSet<TransformComponentBits>& GetMarker() const { return m_Marker; }
+        Container::FlagSet<TransformComponentBits> GetMarker() const { return m_Marker.Load(); }
 
         /**
         * @brief Mark TransformComponentFlags with flags.
         * 
         * @param[in] flags In flags.
         */
-        void Mark(const Container::BitSet<TransformComponentBits>& flags) { m_Marker |= flags; }
+        void Mark(const Container::FlagSet<TransformComponentBits>& flags) { m_Marker |= flags; }
 
         /**
         * @brief Mark TransformComponentFlags with flags.
@@ -149,7 +149,7 @@ namespace Neptune {
         * 
         * @param[in] flags In flags.
         */
-        void ClearMarkerWithBits(const Container::BitSet<TransformComponentBits>& flags) { m_Marker ^= flags; }
+        void ClearMarkerWithBits(const Container::FlagSet<TransformComponentBits>& flags) { m_Marker ^= flags; }
 
     private:
 
@@ -162,6 +162,6 @@ namespace Neptune {
 
         glm::mat4 m_ModelMatrix = glm::mat4(1.0f);   // @brief The modelMatrix this component handled.
 
-        Container::BitSet<TransformComponentBits> m_Marker = Clean;  // @brief World State this frame.
+        Container::AtomicBitSet<TransformComponentBits> m_Marker = Clean;  // @brief World State this frame.
     };
 }
\ No newline at end of file
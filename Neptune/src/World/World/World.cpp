@@ -8,6 +8,7 @@
 #include "World.h"
 #include "World/Scene/Scene.h"
 #include "World/Object/Level.h"
+#include "Core/Event/EventBus.h"
 #include "Core/Event/EngineEvent.h"
 
 namespace Neptune {
@@ -35,7 +36,7 @@ namespace Neptune {
 
         EngineEvent event(EngineEventBit::InitSlateFrontend);
 
-        Event::GetEventCallbackFn()(event);
+        EventBus::Instance().Publish(event);
     }
 
     void World::OnDetached()
@@ -45,7 +46,7 @@ namespace Neptune {
         {
             EngineEvent event(EngineEventBit::StopTheEngine);
 
-            Event::GetEventCallbackFn()(event);
+            EventBus::Instance().Publish(event);
         }
 
         DestroyScene();
@@ -53,7 +54,7 @@ namespace Neptune {
         {
             EngineEvent event(EngineEventBit::ShutdownSlateFrontend);
 
-            Event::GetEventCallbackFn()(event);
+            EventBus::Instance().Publish(event);
         }
 
         S_Instance.reset();
@@ -7,7 +7,7 @@
 #pragma once
 #include "Core/Core.h"
 #include "WorldMarkFlag.h"
-#include "Core/Container/BitSet.hpp"
+#include "Core/Container/AtomicBitSet.hpp"
 
 #include <unordered_map>
 
@@ -124,7 +124,7 @@ namespace Neptune {
     private:
         
         std::unordered_map<std::string, UP<Scene>> m_Scenes;      // @brief World activate Scenes.
-        Container::BitSet<WorldMarkBit> m_Flag;                   // @brief WorldMark Flag.
+        Container::AtomicBitSet<WorldMarkBit> m_Flag;             // @brief WorldMark Flag.
     };
 
     /**
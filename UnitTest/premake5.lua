@@ -42,6 +42,7 @@ project "UnitTest"
 		"src",                                                     -- UnitTest Source Folder.
 		"%{vendor.includes.glm}",                                  -- Library: glm Source Folder.
 		"%{vendor.includes.entt}",                                 -- Library: entt Source Folder.
+		"%{vendor.includes.spdlog}",                               -- Library: spdlog Source Folder.
 	}
 
 	-- In Visual Studio, it only works when generated a new solution, remember update solution will not works.
@@ -57,6 +58,10 @@ project "UnitTest"
 		"googlemock",                          -- Dependency: googlemock
 	}
 
+	-- Opt-in sanitizer, premake5 --sanitize=thread.
+	buildoptions { platform.GetSanitizeOptions() }
+	linkoptions  { platform.GetSanitizeOptions() }
+
 	-- Platform: Windows
 	filter "system:windows"
 		systemversion "latest"                 -- Use Lastest WindowSDK
@@ -8,10 +8,28 @@
 #include "Instrumentor.h"
 
 #include <Core/Container/BitSet.hpp>
+#include <Core/Container/FlagSet.hpp>
+#include <Core/Container/AtomicBitSet.hpp>
 #include <gmock/gmock.h>
 
+#include <thread>
+#include <vector>
+
 namespace Neptune::Test {
 
+	/**
+	* @brief Enum for BitSet Test.
+	*/
+	enum class TestBit : uint32_t
+	{
+		A = 0,
+		B,
+		C,
+		D = 40,
+
+		Count = 48
+	};
+
 	/**
 	* @brief Unit Test for BitSet
 	*/
@@ -43,4 +61,120 @@ namespace Neptune::Test {
 		NEPTUNE_TEST_PROFILE_FUNCTION
 
 	}
-}
\ No newline at end of file
+
+	/**
+	* @brief Testing FlagSet in constant expressions.
+	*/
+	TEST(BitSetTest, FlagSet) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		using Flags = Container::FlagSet<TestBit>;
+
+		static constexpr Flags flags{ TestBit::A, TestBit::D };
+
+		static_assert(flags.Test(TestBit::A));
+		static_assert(!flags.Test(TestBit::B));
+		static_assert(flags.Test(TestBit::D));
+		static_assert(flags.Test(TestBit::Count));
+		static_assert(flags.Count() == 2);
+		static_assert(Flags(TestBit::Count).Count() == 48);
+		static_assert((flags | Flags(TestBit::B)).Count() == 3);
+		static_assert((flags & Flags(TestBit::B)).None());
+
+		Flags value = flags;
+
+		value.Flip();
+		EXPECT_EQ(value.Count(), 46u);
+		EXPECT_FALSE(value.Test(TestBit::A));
+
+		value.Reset(TestBit::B);
+		EXPECT_FALSE(value.Test(TestBit::B));
+
+		value.Reset();
+		EXPECT_TRUE(value.None());
+	}
+
+	/**
+	* @brief Testing AtomicBitSet keeps bits of concurrent writers.
+	*/
+	TEST(BitSetTest, AtomicBitSet) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Container::AtomicBitSet<TestBit> flags;
+
+		EXPECT_FALSE(flags.Set(TestBit::C, true));
+		EXPECT_TRUE(flags.Set(TestBit::C, true));
+		EXPECT_TRUE(flags.Set(TestBit::C, false));
+		EXPECT_TRUE(flags.None());
+
+		constexpr uint32_t nThreads = 4;
+
+		std::vector<std::thread> threads;
+
+		for (uint32_t t = 0; t < nThreads; ++t)
+		{
+			threads.emplace_back([&flags, t]() {
+				for (int i = 0; i < 10000; ++i)
+				{
+					for (uint32_t bit = t; bit < static_cast<uint32_t>(TestBit::Count); bit += nThreads)
+					{
+						flags.Set(static_cast<TestBit>(bit), i % 2 == 0);
+					}
+				}
+			});
+		}
+
+		for (auto& thread : threads) thread.join();
+
+		// Last iteration clears every bit, a lost update would leave one set.
+		EXPECT_TRUE(flags.None());
+
+		flags |= Container::FlagSet<TestBit>{ TestBit::A, TestBit::D };
+		EXPECT_EQ(flags.Load().Count(), 2u);
+
+		const auto copy = flags;
+		EXPECT_TRUE(copy == flags.Load());
+	}
+
+	/**
+	* @brief Benchmark Test and Set of BitSet, AtomicBitSet and FlagSet.
+	*/
+	TEST(BitSetTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 10000000;
+
+		auto measure = [](auto& flags) {
+			uint32_t hits = 0;
+
+			const float best = Benchmark::MeasureMs([&] {
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					const auto bit = static_cast<TestBit>(i % 3);
+
+					flags.Set(bit, (i & 4) != 0);
+					hits += flags.Test(bit) ? 1 : 0;
+				}
+			});
+
+			EXPECT_GT(hits, 0u);
+
+			return best;
+		};
+
+		Container::BitSet<TestBit>       locked;
+		Container::AtomicBitSet<TestBit> atomic;
+		Container::FlagSet<TestBit>      value;
+
+		const float lockedMs = measure(locked);
+		const float atomicMs = measure(atomic);
+		const float valueMs  = measure(value);
+
+		Benchmark::Record("BitSetMs",       lockedMs);
+		Benchmark::Record("AtomicBitSetMs", atomicMs);
+		Benchmark::Record("FlagSetMs",      valueMs);
+	}
+}
@@ -0,0 +1,171 @@
+/**
+* @file FlatTreeTest.h.
+* @brief The FlatTreeTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Container/FlatTree.hpp>
+#include <Core/Container/Tree.hpp>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+namespace Neptune::Test {
+
+	/**
+	* @brief Build a complete tree parent array, node i has parent (i - 1) / fanout.
+	*
+	* @param[in] count Nodes count.
+	* @param[in] fanout Children per node.
+	*
+	* @return Returns parent array.
+	*/
+	inline std::vector<uint32_t> MakeParents(uint32_t count, uint32_t fanout)
+	{
+		std::vector<uint32_t> parents(count);
+
+		parents[0] = Container::FlatTree<int>::Invalid;
+
+		for (uint32_t i = 1; i < count; ++i)
+		{
+			parents[i] = (i - 1) / fanout;
+		}
+
+		return parents;
+	}
+
+	/**
+	* @brief Testing PreOrder layout, links and subtree ranges.
+	*/
+	TEST(FlatTreeTest, PreOrder) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		// 0 has children 1, 2; 1 has children 3, 4; 2 has child 5.
+		const std::vector<uint32_t> parents = { Container::FlatTree<int>::Invalid, 0, 0, 1, 1, 2 };
+
+		Container::FlatTree<int> tree({ 0, 1, 2, 3, 4, 5 }, parents);
+
+		EXPECT_EQ(tree.Size(), 6u);
+		EXPECT_THAT(tree.GetData(), testing::ElementsAre(0, 1, 3, 4, 2, 5));
+
+		EXPECT_EQ(tree.Subtree(0), std::make_pair(0u, 6u));
+		EXPECT_EQ(tree.Subtree(1), std::make_pair(1u, 4u));
+		EXPECT_EQ(tree.Subtree(4), std::make_pair(4u, 6u));
+
+		EXPECT_EQ(tree[tree.FirstChild(1)], 3);
+		EXPECT_EQ(tree[tree.NextSibling(2)], 4);
+		EXPECT_EQ(tree[tree.Parent(5)], 2);
+		EXPECT_EQ(tree.Depth(3), 2u);
+		EXPECT_EQ(tree.Source(4), 2u);
+		EXPECT_EQ(tree.LevelCount(), 3u);
+
+		std::vector<int> bfs;
+		tree.ViewBFS([&](const int& v, uint32_t) { bfs.push_back(v); return true; });
+		EXPECT_THAT(bfs, testing::ElementsAre(0, 1, 2, 3, 4, 5));
+	}
+
+	/**
+	* @brief Testing LevelOrder layout, level ranges and DFS.
+	*/
+	TEST(FlatTreeTest, LevelOrder) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		const std::vector<uint32_t> parents = { Container::FlatTree<int>::Invalid, 0, 0, 1, 1, 2 };
+
+		Container::FlatTree<int> tree({ 0, 1, 2, 3, 4, 5 }, parents, Container::FlatTreeLayout::LevelOrder);
+
+		EXPECT_THAT(tree.GetData(), testing::ElementsAre(0, 1, 2, 3, 4, 5));
+		EXPECT_EQ(tree.Level(0), std::make_pair(0u, 1u));
+		EXPECT_EQ(tree.Level(1), std::make_pair(1u, 3u));
+		EXPECT_EQ(tree.Level(2), std::make_pair(3u, 6u));
+
+		std::vector<int> dfs;
+		tree.ViewDFS([&](const int& v, uint32_t) { dfs.push_back(v); return v != 4; });
+		EXPECT_THAT(dfs, testing::ElementsAre(0, 1, 3, 4));
+	}
+
+	/**
+	* @brief Testing parallel per level traversal sees parents done.
+	*/
+	TEST(FlatTreeTest, ParallelForEachLevel) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 100000;
+
+		Container::FlatTree<uint32_t> tree(std::vector<uint32_t>(count, 0), MakeParents(count, 3), Container::FlatTreeLayout::LevelOrder);
+
+		tree.ParallelForEachLevel([&](uint32_t node) {
+			const uint32_t parent = tree.Parent(node);
+			tree[node] = parent == Container::FlatTree<uint32_t>::Invalid ? 0 : tree[parent] + 1;
+		}, 4, 1024);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			ASSERT_EQ(tree[i], tree.Depth(i));
+		}
+	}
+
+	/**
+	* @brief Benchmark FlatTree against Tree at 1M nodes, build and DFS.
+	*/
+	TEST(FlatTreeTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 1000000;
+
+		const auto parents = MakeParents(count, 4);
+
+		std::vector<Container::Tree<uint32_t>*> nodes(count);
+		std::unique_ptr<Container::Tree<uint32_t>> tree;
+
+		const float treeBuildMs = Benchmark::MeasureMs([&] {
+			tree = std::make_unique<Container::Tree<uint32_t>>(0u);
+
+			nodes[0] = tree.get();
+
+			for (uint32_t i = 1; i < count; ++i)
+			{
+				nodes[i] = nodes[parents[i]]->AddChild(i);
+			}
+		});
+
+		Container::FlatTree<uint32_t> flat;
+
+		const float flatBuildMs = Benchmark::MeasureMs([&] {
+			std::vector<uint32_t> data(count);
+
+			for (uint32_t i = 0; i < count; ++i) data[i] = i;
+
+			flat = Container::FlatTree<uint32_t>(std::move(data), parents);
+		});
+
+		uint64_t treeSum = 0;
+		uint64_t flatSum = 0;
+
+		const float treeViewMs = Benchmark::MeasureMs([&] {
+			treeSum = 0;
+			tree->ViewDSF([&](const uint32_t& v, uint32_t) { treeSum += v; return true; });
+		});
+
+		const float flatViewMs = Benchmark::MeasureMs([&] {
+			flatSum = 0;
+			flat.ViewDFS([&](const uint32_t& v, uint32_t) { flatSum += v; return true; });
+		});
+
+		EXPECT_EQ(treeSum, flatSum);
+
+		Benchmark::Record("TreeBuildMs",     treeBuildMs);
+		Benchmark::Record("FlatTreeBuildMs", flatBuildMs);
+		Benchmark::Record("TreeDFSMs",       treeViewMs);
+		Benchmark::Record("FlatTreeDFSMs",   flatViewMs);
+	}
+}
@@ -0,0 +1,221 @@
+/**
+* @file LinkedUnorderedMapTest.h.
+* @brief The LinkedUnorderedMapTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Container/LinkedUnorderedMap.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <list>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::Test {
+
+	/**
+	* @brief Testing order, Erase, Prev and Next.
+	*/
+	TEST(LinkedUnorderedMapTest, Order) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Container::LinkedUnorderedMap<int, int> map;
+
+		for (int i = 0; i < 5; ++i)
+		{
+			map.PushBack(i, i * 10);
+		}
+
+		map.PushBack(2, 21);
+
+		EXPECT_EQ(map.Size(), 5u);
+		EXPECT_EQ(*map.At(2), 21);
+		EXPECT_FALSE(map.At(9));
+
+		EXPECT_TRUE(map.Erase(1));
+		EXPECT_FALSE(map.Erase(1));
+
+		EXPECT_EQ(*map.Next(0), 21);
+		EXPECT_EQ(*map.Prev(2), 0);
+		EXPECT_FALSE(map.Prev(0));
+		EXPECT_FALSE(map.Next(4));
+		EXPECT_EQ(*map.Begin(), 0);
+		EXPECT_EQ(*map.End(), 40);
+		EXPECT_EQ(*map.EndK(), 4);
+
+		EXPECT_TRUE(map.Visit(3, [](int& v) { v += 1; }));
+		EXPECT_FALSE(map.Visit(9, [](int& v) { v += 1; }));
+		EXPECT_EQ(*map.At(3), 31);
+
+		std::vector<int> keys;
+		map.ForEach([&](const int& k, int&) { keys.push_back(k); return false; });
+		EXPECT_THAT(keys, testing::ElementsAre(0, 2, 3, 4));
+
+		map.Clear();
+		EXPECT_EQ(map.Size(), 0u);
+		EXPECT_FALSE(map.Begin());
+	}
+
+	/**
+	* @brief Testing LRU Touch and eviction.
+	*/
+	TEST(LinkedUnorderedMapTest, LRU) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Container::LinkedUnorderedMap<int, int> cache(3);
+
+		cache.PushBack(1, 1);
+		cache.PushBack(2, 2);
+		cache.PushBack(3, 3);
+
+		EXPECT_EQ(*cache.Touch(1), 1);
+
+		cache.PushBack(4, 4);
+
+		EXPECT_FALSE(cache.Contains(2));
+		EXPECT_EQ(cache.Size(), 3u);
+
+		std::vector<int> keys;
+		cache.ForEach([&](const int& k, int&) { keys.push_back(k); return false; });
+		EXPECT_THAT(keys, testing::ElementsAre(3, 1, 4));
+
+		cache.SetCapacity(1);
+		EXPECT_EQ(cache.Size(), 1u);
+		EXPECT_EQ(*cache.Begin(), 4);
+		EXPECT_FALSE(cache.Touch(3));
+	}
+
+	/**
+	* @brief Testing lookups racing LRU eviction and Erase only see whole values.
+	*/
+	TEST(LinkedUnorderedMapTest, Concurrent) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Container::LinkedUnorderedMap<int, std::string> cache(64);
+
+		std::atomic<bool> stop{ false };
+		std::atomic<uint64_t> hits{ 0 };
+		std::vector<std::thread> readers;
+
+		for (int t = 0; t < 4; ++t)
+		{
+			readers.emplace_back([&, t] {
+				for (int i = t; !stop.load(std::memory_order_acquire); ++i)
+				{
+					// Values outlive eviction of their node.
+					if (const auto value = (i & 1) ? cache.Touch(i % 256) : cache.At(i % 256))
+					{
+						EXPECT_EQ(*value, std::string(48, static_cast<char>('a' + i % 256 % 26)));
+						hits.fetch_add(1, std::memory_order_relaxed);
+					}
+				}
+			});
+		}
+
+		for (int i = 0; i < 200000; ++i)
+		{
+			const int key = i % 256;
+
+			cache.PushBack(key, std::string(48, static_cast<char>('a' + key % 26)));
+
+			if (i % 7 == 0) cache.Erase((key + 128) % 256);
+		}
+
+		// Writing can finish before any reader is scheduled.
+		while (hits.load(std::memory_order_relaxed) == 0)
+		{
+			std::this_thread::yield();
+		}
+
+		stop.store(true, std::memory_order_release);
+
+		for (auto& reader : readers)
+		{
+			reader.join();
+		}
+
+		EXPECT_LE(cache.Size(), 64u);
+		EXPECT_GT(hits.load(), 0u);
+	}
+
+	/**
+	* @brief Benchmark Erase and Next of LinkedUnorderedMap against previous list with hashmap version.
+	*/
+	TEST(LinkedUnorderedMapTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr int count = 20000;
+
+		/**
+		* @brief Previous version, list of keys next to hashmap.
+		*/
+		struct Legacy
+		{
+			void PushBack(int key, int value)
+			{
+				bool has;
+				{
+					std::shared_lock lock(mutex);
+					has = map.contains(key);
+				}
+
+				std::unique_lock lock(mutex);
+				if (!has) keys.push_back(key);
+				map[key] = value;
+			}
+
+			int Next(int key)
+			{
+				std::shared_lock lock(mutex);
+				for (auto it = keys.begin(); it != keys.end(); ++it)
+				{
+					if (*it == key) return map[*std::next(it)];
+				}
+				return 0;
+			}
+
+			void Erase(int key)
+			{
+				std::unique_lock lock(mutex);
+				keys.remove(key);
+				map.erase(key);
+			}
+
+			std::list<int>               keys;
+			std::unordered_map<int, int> map;
+			std::shared_mutex            mutex;
+		};
+
+		int64_t sum = 0;
+
+		const float legacyMs = Benchmark::MeasureMs([&] {
+			Legacy legacy;
+			for (int i = 0; i < count; ++i) legacy.PushBack(i, i);
+			for (int i = 0; i < count - 1; i += 2) sum += legacy.Next(i);
+			for (int i = 0; i < count; i += 2) legacy.Erase(i);
+		});
+
+		const float linkedMs = Benchmark::MeasureMs([&] {
+			Container::LinkedUnorderedMap<int, int> map;
+			for (int i = 0; i < count; ++i) map.PushBack(i, i);
+			for (int i = 0; i < count - 1; i += 2) sum += *map.Next(i);
+			for (int i = 0; i < count; i += 2) map.Erase(i);
+		});
+
+		EXPECT_GT(sum, 0);
+
+		Benchmark::Record("LegacyLinkedMapMs",    legacyMs);
+		Benchmark::Record("LinkedUnorderedMapMs", linkedMs);
+	}
+}
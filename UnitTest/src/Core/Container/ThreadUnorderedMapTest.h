@@ -0,0 +1,198 @@
+/**
+* @file ThreadUnorderedMapTest.h.
+* @brief The ThreadUnorderedMapTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Container/ThreadUnorderedMap.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Neptune::Test {
+
+	/**
+	* @brief Testing single thread behaves.
+	*/
+	TEST(ThreadUnorderedMapTest, Basic) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Container::ThreadUnorderedMap<int, int> map;
+
+		EXPECT_TRUE(map.Empty());
+		EXPECT_TRUE(map.Insert(1, 10));
+		EXPECT_FALSE(map.Insert(1, 11));
+		EXPECT_EQ(map.Find(1), 10);
+		EXPECT_FALSE(map.InsertOrAssign(1, 12));
+		EXPECT_TRUE(map.InsertOrAssign(2, 20));
+		EXPECT_EQ(map.Find(1), 12);
+		EXPECT_EQ(map.Find(3), std::nullopt);
+
+		EXPECT_TRUE(map.Visit(2, [](int& v) { v += 1; }));
+		EXPECT_FALSE(map.Visit(3, [](int& v) { v += 1; }));
+		EXPECT_EQ(map.Find(2), 21);
+
+		int sum = 0;
+		map.VisitAll([&](const int& k, const int& v) { sum += k + v; });
+		EXPECT_EQ(sum, 1 + 12 + 2 + 21);
+
+		EXPECT_TRUE(map.Erase(1));
+		EXPECT_FALSE(map.Erase(1));
+		EXPECT_EQ(map.Size(), 1u);
+
+		map.Clear();
+		EXPECT_TRUE(map.Empty());
+	}
+
+	/**
+	* @brief Stress Testing mixed operations from threads, build with premake5 --sanitize=thread to check races.
+	*/
+	TEST(ThreadUnorderedMapTest, Stress) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr int threads = 8;
+		constexpr int ops     = 20000;
+		constexpr int keys    = 512;
+
+		Container::ThreadUnorderedMap<int, int64_t> map;
+
+		for (int k = 0; k < keys; ++k)
+		{
+			map.Insert(k, 0);
+		}
+
+		std::atomic<int64_t> added{ 0 };
+		std::vector<std::thread> workers;
+
+		for (int t = 0; t < threads; ++t)
+		{
+			workers.emplace_back([&, t] {
+				for (int i = 0; i < ops; ++i)
+				{
+					const int k = (i * 31 + t * 7) % keys;
+
+					switch (i % 4)
+					{
+						case 0:
+						{
+							if (map.Visit(k, [](int64_t& v) { ++v; }))
+							{
+								added.fetch_add(1, std::memory_order_relaxed);
+							}
+							break;
+						}
+						case 1:
+						{
+							(void)map.Find(k);
+							break;
+						}
+						case 2:
+						{
+							map.Insert(keys + (i % keys), 0);
+							break;
+						}
+						case 3:
+						{
+							map.Erase(keys + ((i + t) % keys));
+							break;
+						}
+					}
+				}
+			});
+		}
+
+		for (auto& worker : workers)
+		{
+			worker.join();
+		}
+
+		int64_t sum = 0;
+		size_t  count = 0;
+
+		map.VisitAll([&](const int& k, const int64_t& v) {
+			if (k < keys) sum += v;
+			++count;
+		});
+
+		EXPECT_EQ(sum, added.load());
+		EXPECT_EQ(count, map.Size());
+	}
+
+	/**
+	* @brief Benchmark multi thread throughput against single shared_mutex map.
+	*/
+	TEST(ThreadUnorderedMapTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr int threads = 8;
+		constexpr int ops     = 200000;
+		constexpr int keys    = 4096;
+
+		/**
+		* @brief Previous version, one shared_mutex for whole map.
+		*/
+		struct Legacy
+		{
+			void Insert(int k, int v)
+			{
+				std::unique_lock lock(mutex);
+				map[k] = v;
+			}
+
+			int Find(int k)
+			{
+				std::shared_lock lock(mutex);
+				auto it = map.find(k);
+				return it != map.end() ? it->second : 0;
+			}
+
+			std::unordered_map<int, int> map;
+			std::shared_mutex            mutex;
+		};
+
+		auto measure = [&](auto& map) {
+			return Benchmark::MeasureMs([&] {
+				std::vector<std::thread> workers;
+
+				for (int t = 0; t < threads; ++t)
+				{
+					workers.emplace_back([&, t] {
+						for (int i = 0; i < ops; ++i)
+						{
+							const int k = (i * 17 + t) % keys;
+
+							if (i % 8 == 0) map.Insert(k, i);
+							else            (void)map.Find(k);
+						}
+					});
+				}
+
+				for (auto& worker : workers)
+				{
+					worker.join();
+				}
+			});
+		};
+
+		Legacy                                   legacy;
+		Container::ThreadUnorderedMap<int, int>  sharded;
+
+		const float legacyMs  = measure(legacy);
+		const float shardedMs = measure(sharded);
+
+		EXPECT_EQ(sharded.Size(), legacy.map.size());
+
+		Benchmark::Record("SharedMutexMapMs",     legacyMs);
+		Benchmark::Record("ThreadUnorderedMapMs", shardedMs);
+	}
+}
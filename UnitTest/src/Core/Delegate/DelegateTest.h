@@ -0,0 +1,205 @@
+/**
+* @file DelegateTest.h.
+* @brief The DelegateTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Delegate/DelegateBasic.h>
+#include <gmock/gmock.h>
+
+#include <atomic>
+#include <functional>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Neptune::Test {
+
+	DELEGATE(Test, int)
+
+	/**
+	* @brief Testing Bind, UnBind and Broadcast order.
+	*/
+	TEST(DelegateTest, BindUnBind) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		DelegateTest delegate;
+		EXPECT_TRUE(delegate.Empty());
+
+		std::vector<int> order;
+		auto* p = &order;
+
+		const auto a = delegate.Bind([p](int v) { p->push_back(v); });
+		const auto b = delegate.Bind([p](int v) { p->push_back(v * 10); });
+
+		EXPECT_NE(a, b);
+		EXPECT_EQ(delegate.Size(), 2u);
+
+		delegate.Broadcast(1);
+		EXPECT_THAT(order, testing::ElementsAre(1, 10));
+
+		EXPECT_TRUE(delegate.UnBind(a));
+		EXPECT_FALSE(delegate.UnBind(a));
+
+		order.clear();
+		delegate.Broadcast(2);
+		EXPECT_THAT(order, testing::ElementsAre(20));
+
+		EXPECT_TRUE(delegate.UnBind(b));
+		EXPECT_TRUE(delegate.Empty());
+	}
+
+	/**
+	* @brief Testing copies share Agents, and Bind inside Broadcast takes effect next time.
+	*/
+	TEST(DelegateTest, SharedAndReentrant) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		DelegateTest delegate;
+		DelegateTest copy = delegate;
+
+		int calls = 0;
+		auto* c = &calls;
+		auto* d = &delegate;
+
+		delegate.Bind([c, d](int) {
+			if (++*c == 1)
+			{
+				d->Bind([c](int) { ++*c; });
+			}
+		});
+
+		copy.Broadcast(0);
+		EXPECT_EQ(calls, 1);
+
+		copy.Broadcast(0);
+		EXPECT_EQ(calls, 3);
+		EXPECT_EQ(copy.Size(), 2u);
+	}
+
+	/**
+	* @brief Testing every Agent gets a movable argument intact, even if one before moved it out.
+	*/
+	TEST(DelegateTest, MovableArgs) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Delegate_Basic<std::string> delegate;
+
+		std::vector<std::string> received;
+		auto* r = &received;
+
+		delegate.Bind([r](std::string s) { r->push_back(std::move(s)); });
+		delegate.Bind([r](std::string s) { r->push_back(std::move(s)); });
+
+		delegate.Broadcast(std::string(64, 'm'));
+
+		ASSERT_EQ(received.size(), 2u);
+		EXPECT_EQ(received[0], std::string(64, 'm'));
+		EXPECT_EQ(received[1], std::string(64, 'm'));
+	}
+
+	/**
+	* @brief Testing Broadcast from threads while Bind and UnBind.
+	*/
+	TEST(DelegateTest, Concurrent) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		DelegateTest delegate;
+
+		std::atomic<int64_t> sum{ 0 };
+		auto* s = &sum;
+
+		delegate.Bind([s](int v) { s->fetch_add(v, std::memory_order_relaxed); });
+
+		std::atomic<bool> stop{ false };
+		std::vector<std::thread> threads;
+
+		for (int t = 0; t < 4; ++t)
+		{
+			threads.emplace_back([&] {
+				while (!stop.load(std::memory_order_acquire))
+				{
+					delegate.Broadcast(1);
+				}
+			});
+		}
+
+		for (int i = 0; i < 2000; ++i)
+		{
+			const auto handle = delegate.Bind([s](int v) { s->fetch_add(v, std::memory_order_relaxed); });
+			EXPECT_TRUE(delegate.UnBind(handle));
+		}
+
+		// Binding can finish before any broadcaster is scheduled.
+		while (sum.load(std::memory_order_relaxed) == 0)
+		{
+			std::this_thread::yield();
+		}
+
+		stop.store(true, std::memory_order_release);
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+
+		EXPECT_GT(sum.load(), 0);
+		EXPECT_EQ(delegate.Size(), 1u);
+	}
+
+	/**
+	* @brief Benchmark Broadcast of Delegate against locked std::function array.
+	*/
+	TEST(DelegateTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 1000000;
+
+		int64_t sum = 0;
+		auto* s = &sum;
+
+		std::shared_mutex mutex;
+		std::vector<std::function<void(int)>> functions;
+
+		DelegateTest delegate;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			functions.emplace_back([s](int v) { *s += v; });
+			delegate.Bind([s](int v) { *s += v; });
+		}
+
+		const float lockedMs = Benchmark::MeasureMs([&] {
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				std::shared_lock<std::shared_mutex> lock(mutex);
+
+				for (auto& function : functions)
+				{
+					function(1);
+				}
+			}
+		});
+
+		const float delegateMs = Benchmark::MeasureMs([&] {
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				delegate.Broadcast(1);
+			}
+		});
+
+		EXPECT_GT(sum, 0);
+
+		Benchmark::Record("LockedFunctionMs", lockedMs);
+		Benchmark::Record("DelegateMs",       delegateMs);
+	}
+}
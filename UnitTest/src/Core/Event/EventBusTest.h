@@ -0,0 +1,205 @@
+/**
+* @file EventBusTest.h.
+* @brief The EventBusTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Event/EventBus.h>
+#include <Core/Event/KeyEvent.h>
+#include <Core/Event/MouseEvent.h>
+#include <gmock/gmock.h>
+
+#include <functional>
+#include <vector>
+
+namespace Neptune::Test {
+
+	/**
+	* @brief Testing Publish order, wildcard and stop propagation.
+	*/
+	TEST(EventBusTest, Publish) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		EventBus bus;
+
+		std::vector<int> order;
+		auto* p = &order;
+
+		bus.Subscribe<KeyPressedEvent>([p](KeyPressedEvent& e) { p->push_back(e.GetKeyCode()); });
+		bus.SubscribeAll([p](Event&) { p->push_back(-1); });
+
+		KeyPressedEvent key(7, 0);
+		EXPECT_FALSE(bus.Publish(key));
+		EXPECT_THAT(order, testing::ElementsAre(7, -1));
+
+		order.clear();
+
+		MouseMovedEvent move(1.0f, 2.0f);
+		bus.Publish(move);
+		EXPECT_THAT(order, testing::ElementsAre(-1));
+
+		order.clear();
+
+		const auto stop = bus.Subscribe<KeyPressedEvent>([](KeyPressedEvent&) { return true; });
+		bus.Subscribe<KeyPressedEvent>([p](KeyPressedEvent&) { p->push_back(99); });
+
+		KeyPressedEvent handled(8, 0);
+		EXPECT_TRUE(bus.Publish(handled));
+		EXPECT_THAT(order, testing::ElementsAre(8));
+
+		order.clear();
+
+		bus.Unsubscribe(stop);
+
+		KeyPressedEvent unhandled(9, 0);
+		EXPECT_FALSE(bus.Publish(unhandled));
+		EXPECT_THAT(order, testing::ElementsAre(9, 99, -1));
+	}
+
+	/**
+	* @brief Testing Unsubscribe while publishing.
+	*/
+	TEST(EventBusTest, UnsubscribeInHandler) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		EventBus bus;
+
+		int calls = 0;
+		auto* c = &calls;
+		auto* b = &bus;
+		EventBus::Handle self = 0;
+		auto* s = &self;
+
+		self = bus.Subscribe<MouseMovedEvent>([b, s, c](MouseMovedEvent&) { ++*c; b->Unsubscribe(*s); });
+		bus.Subscribe<MouseMovedEvent>([c](MouseMovedEvent&) { ++*c; });
+
+		MouseMovedEvent first(0.0f, 0.0f);
+		bus.Publish(first);
+		EXPECT_EQ(calls, 2);
+
+		MouseMovedEvent second(0.0f, 0.0f);
+		bus.Publish(second);
+		EXPECT_EQ(calls, 3);
+	}
+
+	/**
+	* @brief Testing deferred queue order and MouseMoved coalescing.
+	*/
+	TEST(EventBusTest, Deferred) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		EventBus bus;
+
+		std::vector<float> order;
+		auto* p = &order;
+
+		bus.Subscribe<MouseMovedEvent>([p](MouseMovedEvent& e) { p->push_back(e.GetX()); });
+		bus.Subscribe<KeyPressedEvent>([p](KeyPressedEvent& e) { p->push_back(-static_cast<float>(e.GetKeyCode())); });
+
+		bus.Enqueue<MouseMovedEvent>(1.0f, 0.0f);
+		bus.Enqueue<MouseMovedEvent>(2.0f, 0.0f);
+		bus.Enqueue<MouseMovedEvent>(3.0f, 0.0f);
+		bus.Enqueue<KeyPressedEvent>(KeyCode(5), 0);
+		bus.Enqueue<MouseMovedEvent>(4.0f, 0.0f);
+
+		EXPECT_TRUE(order.empty());
+		EXPECT_EQ(bus.Drain(), 3u);
+		EXPECT_THAT(order, testing::ElementsAre(3.0f, -5.0f, 4.0f));
+		EXPECT_EQ(bus.GetStats().queued, 5u);
+		EXPECT_EQ(bus.GetStats().coalesced, 2u);
+
+		order.clear();
+
+		EXPECT_EQ(bus.Drain(), 0u);
+
+		bus.SetCoalesce(EventType::MouseMoved, false);
+
+		for (int i = 0; i < 4096; ++i)
+		{
+			bus.Enqueue<MouseMovedEvent>(static_cast<float>(i), 0.0f);
+		}
+
+		EXPECT_EQ(bus.Drain(), 4096u);
+		ASSERT_EQ(order.size(), 4096u);
+		EXPECT_EQ(order.back(), 4095.0f);
+	}
+
+	/**
+	* @brief Benchmark of std::function callback path, EventBus Publish and EventBus deferred queue.
+	*/
+	TEST(EventBusTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 1000000;
+
+		/**
+		* @brief Previous path, root std::function copied per event, a name string per event,
+		* and a std::function bound per dispatched handler.
+		*/
+		struct Legacy
+		{
+			bool OnMoved(MouseMovedEvent& e) { sum += e.GetX(); return false; }
+
+			void OnEvent(Event& event)
+			{
+				names += event.ToString().size();
+
+				EventDispatcher dispatcher(event);
+				dispatcher.Dispatch<MouseMovedEvent>(std::function<bool(MouseMovedEvent&)>(std::bind(&Legacy::OnMoved, this, std::placeholders::_1)));
+			}
+
+			float  sum   = 0.0f;
+			size_t names = 0;
+		};
+
+		Legacy legacy;
+		const std::function<void(Event&)> root = std::bind(&Legacy::OnEvent, &legacy, std::placeholders::_1);
+		const auto* rootPtr = &root;
+
+		const float legacyMs = Benchmark::MeasureMs([&] {
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				MouseMovedEvent event(static_cast<float>(i & 1), 0.0f);
+				std::function<void(Event&)> callback = *rootPtr;
+				callback(event);
+			}
+		});
+
+		EventBus bus;
+		bus.SetCoalesce(EventType::MouseMoved, false);
+
+		float sum = 0.0f;
+		auto* s = &sum;
+		bus.Subscribe<MouseMovedEvent>([s](MouseMovedEvent& e) { *s += e.GetX(); return false; });
+
+		const float publishMs = Benchmark::MeasureMs([&] {
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				MouseMovedEvent event(static_cast<float>(i & 1), 0.0f);
+				bus.Publish(event);
+			}
+		});
+
+		const float deferredMs = Benchmark::MeasureMs([&] {
+			for (uint32_t i = 0; i < count; ++i)
+			{
+				bus.Enqueue<MouseMovedEvent>(static_cast<float>(i & 1), 0.0f);
+			}
+			bus.Drain();
+		});
+
+		EXPECT_GT(legacy.sum, 0.0f);
+		EXPECT_GT(sum, 0.0f);
+
+		Benchmark::Record("LegacyDispatchMs",   legacyMs);
+		Benchmark::Record("EventBusPublishMs",  publishMs);
+		Benchmark::Record("EventBusDeferredMs", deferredMs);
+	}
+}
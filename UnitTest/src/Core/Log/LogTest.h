@@ -0,0 +1,371 @@
+/**
+* @file LogTest.h.
+* @brief The LogTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Log/Console.h>
+#include <Core/Log/Log.h>
+#include <Core/Log/LogQueue.h>
+#include <Core/Memory/HeapCounter.h>
+#include <gmock/gmock.h>
+
+#pragma warning(push, 0)
+#include <spdlog/spdlog.h>
+#include <spdlog/sinks/null_sink.h>
+#pragma warning(pop)
+
+#include <atomic>
+#include <charconv>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Neptune::Test {
+
+	/**
+	* @brief Testing LogRing encodes arguments and LogQueue formats them.
+	*/
+	TEST(LogTest, Format) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		LogRing ring;
+		std::string message;
+
+		const std::string name = "Shader";
+
+		EXPECT_TRUE(ring.Write(LogChannel::Core, LogLevel::Info, "{} compiled in {:.2f} ms, {} stages, {}", name, 3.14159, 5u, true));
+		EXPECT_TRUE(ring.Write(LogChannel::Client, LogLevel::Warn, "{{}} {} {} {}", -7, 'c', "text"));
+		EXPECT_TRUE(ring.Write(LogChannel::Core, LogLevel::Error, nullptr, std::string_view("raw {message}")));
+
+		auto record = ring.Front();
+
+		EXPECT_EQ(record->level, LogLevel::Info);
+		EXPECT_EQ(record->args, 4);
+
+		LogQueue::Format(*record, message);
+		EXPECT_EQ(message, "Shader compiled in 3.14 ms, 5 stages, true");
+		ring.Pop();
+
+		record = ring.Front();
+
+		EXPECT_EQ(record->channel, LogChannel::Client);
+
+		LogQueue::Format(*record, message);
+		EXPECT_EQ(message, "{} -7 c text");
+		ring.Pop();
+
+		LogQueue::Format(*ring.Front(), message);
+		EXPECT_EQ(message, "raw {message}");
+		ring.Pop();
+
+		EXPECT_TRUE(ring.Empty());
+		EXPECT_EQ(ring.Front(), nullptr);
+	}
+
+	/**
+	* @brief Testing LogRing wraps in order, reports full and truncates long strings.
+	*/
+	TEST(LogTest, Ring) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		LogRing ring;
+		LogValue values[LogRing::MaxArgs];
+
+		const std::string padding(37, 'x');
+
+		uint64_t written = 0;
+		uint64_t read    = 0;
+		uint64_t bytes   = 0;
+
+		for (int round = 0; round < 64; ++round)
+		{
+			while (ring.Write(LogChannel::Core, LogLevel::Trace, "{} {}", written, std::string_view(padding).substr(0, written % 38)))
+			{
+				++written;
+			}
+
+			// Pop about half, so following rounds wrap at different offsets.
+			for (uint64_t end = read + (written - read) / 2; read < end; ++read)
+			{
+				const LogRecord* record = ring.Front();
+
+				EXPECT_EQ(LogQueue::Decode(*record, values), 2u);
+				EXPECT_EQ(values[0].u, read);
+				EXPECT_EQ(values[1].s.size(), read % 38);
+
+				bytes += record->size;
+				ring.Pop();
+			}
+		}
+
+		EXPECT_GT(bytes, LogRing::Capacity * 8);
+
+		const std::string huge(LogRing::Capacity, 'y');
+
+		while (ring.Front()) ring.Pop();
+
+		EXPECT_TRUE(ring.Write(LogChannel::Core, LogLevel::Info, nullptr, huge));
+
+		const LogRecord* record = ring.Front();
+
+		LogQueue::Decode(*record, values);
+
+		EXPECT_LE(record->size, LogRing::MaxRecord);
+		EXPECT_GT(values[0].s.size(), 0u);
+		EXPECT_LT(values[0].s.size(), huge.size());
+	}
+
+	/**
+	* @brief Testing Log backend drains rings of exited threads.
+	*/
+	TEST(LogTest, Backend) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		std::thread producer([]() {
+			Log::Push(LogChannel::Core, LogLevel::Trace, "LogTest: pushed from thread {}", 1);
+		});
+
+		producer.join();
+
+		Log::Push(LogChannel::Core, LogLevel::Trace, "LogTest: pushed from main thread");
+		Log::Get().Flush();
+
+		EXPECT_TRUE(Log::Get().IsInitialized());
+		EXPECT_TRUE(LogQueue::Producer().Empty());
+	}
+
+	/**
+	* @brief Testing a full ring drops records instead of waiting forever when nothing drains it.
+	*/
+	TEST(LogTest, Dropped) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		LogRing ring;
+
+		auto write = [](LogRing& r) { return r.Write(LogChannel::Core, LogLevel::Info, "LogTest: dropped {}", 1); };
+
+		while (write(ring)) {}
+
+		const uint64_t dropped = LogQueue::Dropped();
+
+		// No backend, dropped at once.
+		EXPECT_FALSE(LogQueue::Write(ring, write, []() { return false; }));
+		EXPECT_EQ(LogQueue::Dropped(), dropped + 1);
+
+		// A backend which never drains, dropped after MaxWait.
+		const float waitMs = Benchmark::ElapsedMs([&] {
+			EXPECT_FALSE(LogQueue::Write(ring, write, []() { return true; }));
+		});
+
+		EXPECT_EQ(LogQueue::Dropped(), dropped + 2);
+		EXPECT_GE(waitMs, static_cast<float>(LogQueue::MaxWait.count()));
+
+		ring.Pop();
+
+		EXPECT_TRUE(LogQueue::Write(ring, write, []() { return false; }));
+		EXPECT_EQ(LogQueue::Dropped(), dropped + 2);
+	}
+
+	/**
+	* @brief Testing Console ring keeps newest lines, interns names and never allocates.
+	*/
+	TEST(LogTest, Console) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Console console(8);
+
+		EXPECT_EQ(console.Capacity(), 8u);
+
+		std::vector<std::string> lines;
+		for (int i = 0; i < 20; ++i) lines.push_back("line " + std::to_string(i));
+
+		const std::string longLine(1000, 'l');
+		std::vector<ConsoleRecord> records(16);
+
+		const auto before = Memory::HeapCounter::Total().allocations;
+
+		for (int i = 0; i < 20; ++i)
+		{
+			console.log(spdlog::details::log_msg(spdlog::source_loc{}, i % 2 ? "Game" : "Engine", i < 10 ? spdlog::level::info : spdlog::level::warn, lines[i]));
+		}
+
+		EXPECT_EQ(console.Written(), 20u);
+		EXPECT_EQ(console.Snapshot(records), 8u);
+		EXPECT_EQ(Memory::HeapCounter::Total().allocations, before);
+
+		EXPECT_EQ(records[0].Text(), "line 12");
+		EXPECT_EQ(records[7].Text(), "line 19");
+		EXPECT_EQ(console.LoggerName(records[0].logger), "Engine");
+		EXPECT_EQ(console.LoggerName(records[1].logger), "Game");
+		EXPECT_EQ(console.Count(spdlog::level::warn), 10u);
+
+		char text[128];
+		const size_t length = console.Format(records[0], text);
+
+		EXPECT_TRUE(std::string_view(text, length).ends_with("[Engine] [Warn] line 12"));
+
+		// Only new lines, and only the newest that fit.
+		EXPECT_EQ(console.Snapshot(records, 18), 2u);
+		EXPECT_EQ(records[0].Text(), "line 18");
+
+		EXPECT_EQ(console.Snapshot(std::span(records).first(3)), 3u);
+		EXPECT_EQ(records[0].Text(), "line 17");
+
+		console.log(spdlog::details::log_msg(spdlog::source_loc{}, "Engine", spdlog::level::err, longLine));
+
+		EXPECT_EQ(console.Snapshot(records, 20), 1u);
+		EXPECT_EQ(records[0].length, ConsoleRecord::TextSize);
+		EXPECT_EQ(records[0].truncated, 1);
+
+		console.Clear();
+
+		EXPECT_EQ(console.Snapshot(records), 0u);
+	}
+
+	/**
+	* @brief Testing Console snapshots taken while lines are written are never torn, and benchmark both sides.
+	*/
+	TEST(LogTest, ConsoleSnapshot) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint64_t count = 200000;
+
+		Console console(256);
+
+		std::atomic<bool> done{ false };
+		float writeMs = 0.0f;
+
+		std::thread writer([&]() {
+			writeMs = Benchmark::ElapsedMs([&] {
+				for (uint64_t i = 0; i < count; ++i)
+				{
+					// Index written twice, a torn copy would differ.
+					char text[48];
+					char* end = std::to_chars(text, text + 20, i).ptr;
+					*end++ = ':';
+					end = std::to_chars(end, text + sizeof(text), i).ptr;
+
+					console.log(spdlog::details::log_msg(spdlog::source_loc{}, "Decoder", spdlog::level::trace, spdlog::string_view_t(text, end - text)));
+				}
+			});
+
+			done.store(true, std::memory_order_release);
+		});
+
+		std::vector<ConsoleRecord> records(console.Capacity());
+
+		uint64_t snapshots = 0;
+		uint64_t torn      = 0;
+		uint64_t unordered = 0;
+		float    readMs    = 0.0f;
+
+		while (!done.load(std::memory_order_acquire))
+		{
+			size_t n = 0;
+			readMs += Benchmark::ElapsedMs([&] { n = console.Snapshot(records); });
+
+			uint64_t last = 0;
+
+			for (size_t i = 0; i < n; ++i)
+			{
+				const std::string_view line = records[i].Text();
+				const size_t colon = line.find(':');
+
+				uint64_t a = 0, b = 0;
+				std::from_chars(line.data(), line.data() + colon, a);
+				std::from_chars(line.data() + colon + 1, line.data() + line.size(), b);
+
+				torn      += a != b;
+				unordered += i > 0 && a <= last;
+				last       = a;
+			}
+
+			++snapshots;
+		}
+
+		writer.join();
+
+		EXPECT_EQ(torn, 0u);
+		EXPECT_EQ(unordered, 0u);
+		EXPECT_EQ(console.Written(), count);
+		EXPECT_EQ(console.Snapshot(records), console.Capacity());
+
+		Benchmark::Record("ConsoleLineNs",     writeMs * 1e6f / count);
+		Benchmark::Record("ConsoleSnapshotUs", snapshots ? readMs * 1e3f / snapshots : 0.0f);
+	}
+
+	/**
+	* @brief Benchmark producer cost of a log call, synchronous formatting against ring encoding.
+	*/
+	TEST(LogTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr int burst = 512;
+		constexpr int count = 400 * burst;
+
+		const std::string name = "Decoder";
+
+		// Previous path: shared_ptr copy per call, message built by stringstream, spdlog formats on the calling thread.
+		auto logger = std::make_shared<spdlog::logger>("Benchmark", std::make_shared<spdlog::sinks::null_sink_st>());
+		logger->set_pattern("[%Y-%m-%d %H:%M:%S] [%n] [%l] %v");
+		logger->set_level(spdlog::level::trace);
+
+		const float syncMs = Benchmark::MeasureMs([&] {
+			for (int i = 0; i < count; ++i)
+			{
+				auto log = logger;
+
+				std::stringstream ss;
+				ss << name << ": parsed chunk " << i << " of " << count << " in " << 0.25f * i << " ms";
+
+				log->info(ss.str());
+			}
+		});
+
+		// Ring path: bursts fit the ring and only the pushes are timed, formatting is left to the backend.
+		LogRing ring;
+		std::string message;
+
+		const float asyncMs = Benchmark::BestMs([&] {
+			float total = 0.0f;
+
+			for (int i = 0; i < count; i += burst)
+			{
+				total += Benchmark::ElapsedMs([&] {
+					for (int j = i; j < i + burst; ++j)
+					{
+						EXPECT_TRUE(ring.Write(LogChannel::Core, LogLevel::Info, "{}: parsed chunk {} of {} in {} ms", name, j, count, 0.25f * j));
+					}
+				});
+
+				while (const LogRecord* record = ring.Front())
+				{
+					LogQueue::Format(*record, message);
+					ring.Pop();
+				}
+			}
+
+			return total;
+		});
+
+		EXPECT_EQ(message, "Decoder: parsed chunk 204799 of 204800 in 51199.75 ms");
+
+		EXPECT_GT(syncMs, 0.0f);
+		EXPECT_GT(asyncMs, 0.0f);
+
+		Benchmark::Record("SyncLogNs",  syncMs  * 1e6f / count);
+		Benchmark::Record("AsyncLogNs", asyncMs * 1e6f / count);
+	}
+}
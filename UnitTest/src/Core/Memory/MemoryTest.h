@@ -0,0 +1,339 @@
+/**
+* @file MemoryTest.h.
+* @brief The MemoryTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Core/Memory/AllocTracker.h>
+#include <Core/Memory/FrameArena.h>
+#include <Core/Memory/HeapCounter.h>
+#include <Core/Memory/LinearArena.h>
+#include <Core/Memory/ObjectPool.h>
+#include <Core/Memory/ScopedArena.h>
+#include <gmock/gmock.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+#include <vector>
+
+namespace Neptune::Test {
+
+	/**
+	* @brief Testing LinearArena alignment, Rewind and block reuse.
+	*/
+	TEST(MemoryTest, LinearArena) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Memory::LinearArena arena(256);
+
+		auto a = arena.allocate(3, 1);
+		auto b = arena.allocate(8, 64);
+
+		EXPECT_EQ(reinterpret_cast<uintptr_t>(b) % 64, 0u);
+		EXPECT_GT(b, a);
+
+		const auto marker = arena.GetMarker();
+
+		auto c = arena.allocate(16, 8);
+		arena.Rewind(marker);
+		EXPECT_EQ(arena.allocate(16, 8), c);
+
+		// Larger than a block spills to a dedicated one.
+		(void)arena.allocate(1024, 16);
+		EXPECT_EQ(arena.BlockCount(), 2u);
+
+		arena.Reset();
+		EXPECT_EQ(arena.allocate(3, 1), a);
+
+		// A warm arena reuses its blocks.
+		arena.Reset();
+		for (int i = 0; i < 10; ++i) (void)arena.allocate(100, 8);
+
+		const size_t blocks = arena.BlockCount();
+
+		arena.Reset();
+		for (int i = 0; i < 10; ++i) (void)arena.allocate(100, 8);
+
+		EXPECT_EQ(arena.BlockCount(), blocks);
+
+		const auto before = arena.GetMarker();
+		{
+			Memory::ArenaScope scope(arena);
+			(void)arena.allocate(64, 8);
+		}
+		const auto after = arena.GetMarker();
+
+		EXPECT_EQ(after.block, before.block);
+		EXPECT_EQ(after.offset, before.offset);
+	}
+
+	/**
+	* @brief Testing FrameArena resets on NextFrame and ScopedArena stays off heap.
+	*/
+	TEST(MemoryTest, FrameArena) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Memory::FrameArena::NextFrame();
+
+		auto first = Memory::FrameArena::Get().allocate(64, 16);
+		(void)Memory::FrameArena::Get().allocate(64, 16);
+
+		Memory::FrameArena::NextFrame();
+
+		EXPECT_EQ(Memory::FrameArena::Get().allocate(64, 16), first);
+
+		const auto before = Memory::HeapCounter::Total().allocations;
+
+		{
+			Memory::ScopedArena<512> arena;
+
+			auto ints = arena.Vector<int>(64);
+			for (int i = 0; i < 64; ++i) ints.push_back(i);
+
+			EXPECT_EQ(ints.back(), 63);
+		}
+
+		EXPECT_EQ(Memory::HeapCounter::Total().allocations, before);
+	}
+
+	/**
+	* @brief Testing ObjectPool and CreatePooledSP recycle blocks.
+	*/
+	TEST(MemoryTest, ObjectPool) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		struct Payload
+		{
+			Payload(int v) : value(v) {}
+
+			int      value;
+			uint64_t pad[3]{};
+		};
+
+		Memory::ObjectPool<Payload> pool(4);
+
+		auto a = pool.New(1);
+		auto b = pool.New(2);
+
+		EXPECT_EQ(pool.Size(), 2u);
+		EXPECT_EQ(b->value, 2);
+
+		pool.Delete(a);
+		EXPECT_EQ(pool.New(3), a);
+
+		pool.Delete(a);
+		pool.Delete(b);
+		EXPECT_EQ(pool.Size(), 0u);
+
+		const Payload* address = nullptr;
+		{
+			auto sp = Memory::CreatePooledSP<Payload>(4);
+			address = sp.get();
+		}
+
+		const auto before = Memory::HeapCounter::Total().allocations;
+
+		auto sp = Memory::CreatePooledSP<Payload>(5);
+
+		EXPECT_EQ(sp.get(), address);
+		EXPECT_EQ(sp->value, 5);
+		EXPECT_EQ(Memory::HeapCounter::Total().allocations, before);
+	}
+
+	/**
+	* @brief Testing AllocTracker attributes bytes to tags and call sites.
+	*/
+	TEST(MemoryTest, AllocTracker) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		using Header = Memory::AllocTracker::Header;
+
+		const auto before = Memory::AllocTracker::GetTagStats(Memory::AllocTag::Video);
+
+		Header headers[3];
+
+		{
+			Memory::AllocTagScope video(Memory::AllocTag::Video);
+
+			EXPECT_EQ(Memory::AllocTracker::CurrentTag(), Memory::AllocTag::Video);
+
+			Memory::AllocTracker::OnAlloc(&headers[0], 100, &headers[0]);
+			Memory::AllocTracker::OnAlloc(&headers[1], 28, &headers[0]);
+
+			{
+				Memory::AllocTagScope slate(Memory::AllocTag::Slate);
+
+				Memory::AllocTracker::OnAlloc(&headers[2], 7, &headers[1]);
+			}
+		}
+
+		EXPECT_EQ(headers[2].tag, Memory::AllocTag::Slate);
+		EXPECT_EQ(headers[0].site, headers[1].site);
+
+		auto video = Memory::AllocTracker::GetTagStats(Memory::AllocTag::Video);
+
+		EXPECT_EQ(video.allocations - before.allocations, 2u);
+		EXPECT_EQ(video.liveBytes - before.liveBytes, 128u);
+
+		Memory::AllocTracker::OnFree(&headers[0]);
+		Memory::AllocTracker::OnFree(&headers[1]);
+		Memory::AllocTracker::OnFree(&headers[2]);
+
+		video = Memory::AllocTracker::GetTagStats(Memory::AllocTag::Video);
+
+		EXPECT_EQ(video.liveBytes, before.liveBytes);
+		EXPECT_EQ(video.frees - before.frees, 2u);
+
+		const auto sites = Memory::AllocTracker::TopSites(1000);
+		bool found = false;
+
+		for (const auto& site : sites)
+		{
+			if (site.site == &headers[0]) found = site.bytes >= 128;
+		}
+
+		EXPECT_TRUE(found);
+
+		const auto path = std::filesystem::temp_directory_path() / "NeptuneAllocReport.txt";
+
+		EXPECT_TRUE(Memory::AllocTracker::WriteReport(path.string()));
+		EXPECT_GT(std::filesystem::file_size(path), 0u);
+
+		std::filesystem::remove(path);
+	}
+
+	/**
+	* @brief Benchmark overhead of AllocTracker bookkeeping over plain malloc and free.
+	*/
+	TEST(MemoryTest, AllocTrackerBenchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr int count = 1000000;
+
+		using Header = Memory::AllocTracker::Header;
+
+		constexpr int batch = 1024;
+
+		std::vector<void*> pointers(batch);
+
+		const float mallocMs = Benchmark::MeasureMs([&] {
+			for (int i = 0; i < count; i += batch)
+			{
+				for (auto& p : pointers) p = std::malloc(sizeof(Header) + 64);
+				for (auto  p : pointers) std::free(p);
+			}
+		});
+
+		const float trackedMs = Benchmark::MeasureMs([&] {
+			Memory::AllocTagScope scope(Memory::AllocTag::Render);
+
+			for (int i = 0; i < count; i += batch)
+			{
+				for (auto& p : pointers)
+				{
+					auto header = static_cast<Header*>(std::malloc(sizeof(Header) + 64));
+					Memory::AllocTracker::OnAlloc(header, 64, NEPTUNE_RETURN_ADDRESS);
+					p = header;
+				}
+
+				for (auto p : pointers)
+				{
+					Memory::AllocTracker::OnFree(static_cast<Header*>(p));
+					std::free(p);
+				}
+			}
+		});
+
+		EXPECT_GT(trackedMs, 0.0f);
+		EXPECT_GT(mallocMs, 0.0f);
+
+		Benchmark::Record("MallocFreeMs",    mallocMs);
+		Benchmark::Record("TrackedMallocMs", trackedMs);
+	}
+
+	/**
+	* @brief Benchmark heap allocations and time of a frame like workload, heap against arenas and pools.
+	*/
+	TEST(MemoryTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr int frames  = 200;
+		constexpr int objects = 256;
+
+		struct CmdList
+		{
+			uint64_t state[8]{};
+		};
+
+		auto measure = [](auto&& fn) {
+			uint64_t allocations = 0;
+
+			const float best = Benchmark::BestMs([&] {
+				const auto heap = Memory::HeapCounter::Total().allocations;
+				const float ms = Benchmark::ElapsedMs(fn);
+
+				allocations = Memory::HeapCounter::Total().allocations - heap;
+
+				return ms;
+			});
+
+			return std::make_pair(best, allocations);
+		};
+
+		uint64_t sum = 0;
+
+		const auto [heapMs, heapAllocations] = measure([&] {
+			for (int f = 0; f < frames; ++f)
+			{
+				std::vector<SP<CmdList>> lists;
+				std::vector<uint32_t> scratch;
+
+				for (int i = 0; i < objects; ++i)
+				{
+					lists.push_back(CreateSP<CmdList>());
+					scratch.push_back(i);
+				}
+
+				sum += lists.size() + scratch.size();
+			}
+		});
+
+		const auto [arenaMs, arenaAllocations] = measure([&] {
+			for (int f = 0; f < frames; ++f)
+			{
+				{
+					auto lists   = Memory::MakeFrameVector<SP<CmdList>>();
+					auto scratch = Memory::MakeFrameVector<uint32_t>();
+
+					for (int i = 0; i < objects; ++i)
+					{
+						lists.push_back(Memory::CreatePooledSP<CmdList>());
+						scratch.push_back(i);
+					}
+
+					sum += lists.size() + scratch.size();
+				}
+
+				Memory::FrameArena::NextFrame();
+			}
+		});
+
+		EXPECT_GT(sum, 0u);
+		EXPECT_LT(arenaAllocations, heapAllocations);
+
+		Benchmark::Record("HeapFrameMs",           heapMs);
+		Benchmark::Record("ArenaFrameMs",          arenaMs);
+		Benchmark::Record("HeapFrameAllocations",  heapAllocations);
+		Benchmark::Record("ArenaFrameAllocations", arenaAllocations);
+	}
+}
@@ -0,0 +1,181 @@
+/**
+* @file GraphicsBackendTest.h.
+* @brief The GraphicsBackendTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_NULL
+
+#include "Instrumentor.h"
+
+#include <Device/Graphics/Backend/Null/GraphicsBackend.h>
+#include <Device/Graphics/Backend/Null/Infrastructure/CommandLog.h>
+#include <Device/Graphics/Frontend/RHI/Shader.h>
+#include <Device/Graphics/Frontend/RHI/CmdList.h>
+#include <Device/Graphics/Frontend/RHI/Decoder.h>
+#include <Device/Graphics/Frontend/RHI/OpticalFlow.h>
+#include <Device/Graphics/Frontend/RHI/Replayer.h>
+#include <Data/Clock.h>
+
+#include <gmock/gmock.h>
+
+namespace Neptune::Null::Test {
+
+	/**
+	* @brief Testing Null::GraphicsBackend Class.
+	*/
+	TEST(NullGraphicsBackendTest, Definition) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+		
+		GraphicsBackend graphicsBackend;
+		
+		graphicsBackend.OnInitialize(nullptr);
+		
+		graphicsBackend.OnShutDown();
+	}
+
+	/**
+	* @brief Testing Null::CommandLog records RHI calls.
+	*/
+	TEST(NullGraphicsBackendTest, CommandLog) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		GraphicsBackend graphicsBackend;
+
+		graphicsBackend.OnInitialize(nullptr);
+
+		{
+			const auto shader = std::any_cast<SP<RHI::RHIShader::Impl>>(graphicsBackend.CreateRHI(RHI::ERHI::Shader, nullptr));
+
+			shader->SetSource(std::vector<uint8_t>(64));
+			shader->SetSource(std::vector<uint8_t>(32));
+		}
+
+		const auto& log = graphicsBackend.GetContext().Get<ICommandLog>();
+
+		EXPECT_EQ(log->GetCount(ECommand::SetShaderSource), 2);
+		EXPECT_EQ(log->GetBytes(ECommand::SetShaderSource), 96);
+		EXPECT_EQ(log->GetEntries().size(), 2);
+
+		log->BeginFrame();
+
+		EXPECT_EQ(log->GetEntries().size(), 1);
+		EXPECT_EQ(log->GetCount(ECommand::SetShaderSource), 2);
+
+		graphicsBackend.OnShutDown();
+	}
+
+	/**
+	* @brief Testing Null::Decoder and Null::OpticalFlow are created and record calls.
+	*/
+	TEST(NullGraphicsBackendTest, VideoRHI) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		GraphicsBackend graphicsBackend;
+
+		graphicsBackend.OnInitialize(nullptr);
+
+		{
+			const auto decoder = std::any_cast<SP<RHI::RHIDecoder::Impl>>(graphicsBackend.CreateRHI(RHI::ERHI::Decoder, nullptr));
+			const auto opticalFlow = std::any_cast<SP<RHI::RHIOpticalFlow::Impl>>(graphicsBackend.CreateRHI(RHI::ERHI::OpticalFlow, nullptr));
+
+			ASSERT_NE(decoder, nullptr);
+			ASSERT_NE(opticalFlow, nullptr);
+
+			std::vector<uint8_t> chunk(128);
+
+			decoder->ParserDataChunk(chunk.data(), chunk.size());
+			decoder->PushNextFrameToRenderTarget();
+
+			EXPECT_EQ(decoder->GetDecodedPictureCount(), 0);
+			EXPECT_TRUE(opticalFlow->CreateOpticalFlowSession());
+
+			opticalFlow->OpticalFlowExecute();
+		}
+
+		const auto& log = graphicsBackend.GetContext().Get<ICommandLog>();
+
+		EXPECT_EQ(log->GetCount(ECommand::ParserDataChunk), 1);
+		EXPECT_EQ(log->GetBytes(ECommand::ParserDataChunk), 128);
+		EXPECT_EQ(log->GetCount(ECommand::PushNextFrameToRenderTarget), 1);
+		EXPECT_EQ(log->GetCount(ECommand::CreateOpticalFlowSession), 1);
+		EXPECT_EQ(log->GetCount(ECommand::OpticalFlowExecute), 1);
+
+		graphicsBackend.OnShutDown();
+	}
+
+	/**
+	* @brief Testing RHI::Capture and RHI::Replayer replay the same calls.
+	*/
+	TEST(NullGraphicsBackendTest, CaptureReplay) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		const std::string path = "NullCaptureReplay.nprc";
+
+		{
+			GraphicsBackend graphicsBackend;
+
+			graphicsBackend.OnInitialize(nullptr);
+
+			RHI::RHIDelegate::SetCreator([&](RHI::ERHI e, void* payload) { return graphicsBackend.CreateRHI(e, payload); });
+
+			EXPECT_TRUE(RHI::Capture::Begin(path));
+
+			{
+				const auto shader  = CreateSP<RHI::Shader>();
+				const auto cmdList = CreateSP<RHI::CmdList>();
+
+				shader->SetSource(std::vector<uint8_t>(64));
+
+				NEPTUNE_RHI_CAPTURE(RHI::ECaptureOp::BeginFrame, nullptr)
+
+				cmdList->SetGraphicCmdList(Data::Clock{});
+				cmdList->CmdDrawFullScreenTriangle();
+
+				NEPTUNE_RHI_CAPTURE(RHI::ECaptureOp::EndFrame, nullptr)
+			}
+
+			RHI::Capture::End();
+
+			RHI::RHIDelegate::SetCreator(nullptr);
+
+			graphicsBackend.OnShutDown();
+		}
+
+		GraphicsBackend graphicsBackend;
+
+		graphicsBackend.OnInitialize(nullptr);
+
+		RHI::RHIDelegate::SetCreator([&](RHI::ERHI e, void* payload) { return graphicsBackend.CreateRHI(e, payload); });
+
+		{
+			RHI::Replayer replayer(path);
+
+			EXPECT_TRUE(replayer.IsValid());
+
+			replayer.ReplayFrame(Data::Clock{});
+			replayer.ReplayFrame(Data::Clock{});
+		}
+
+		const auto& log = graphicsBackend.GetContext().Get<ICommandLog>();
+
+		EXPECT_EQ(log->GetCount(ECommand::SetShaderSource), 1);
+		EXPECT_EQ(log->GetBytes(ECommand::SetShaderSource), 64);
+		EXPECT_EQ(log->GetCount(ECommand::DrawFullScreenTriangle), 2);
+
+		RHI::RHIDelegate::SetCreator(nullptr);
+
+		graphicsBackend.OnShutDown();
+
+		std::remove(path.c_str());
+	}
+	
+}
+
+#endif
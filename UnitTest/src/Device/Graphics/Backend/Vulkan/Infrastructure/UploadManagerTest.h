@@ -0,0 +1,89 @@
+/**
+* @file UploadManagerTest.h.
+* @brief The UploadManagerTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Instrumentor.h"
+
+#include <Device/Graphics/Backend/Vulkan/GraphicsBackend.h>
+#include <Device/Graphics/Backend/Vulkan/Infrastructure/InfrastructureHeader.h>
+#include <Device/Graphics/Backend/Vulkan/Resource/Buffer.h>
+
+#include <gmock/gmock.h>
+#include <vector>
+
+namespace Neptune::Vulkan::Test {
+
+	/**
+	* @brief Benchmark UploadManager throughput, coalesced uploads against one submit and wait per upload.
+	* Runs on any Vulkan ICD, set VK_DRIVER_FILES to lavapipe to measure the software device.
+	*/
+	TEST(UploadManagerTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr VkDeviceSize chunk = 64 * 1024;
+		constexpr uint32_t     count = 256;
+		constexpr VkDeviceSize bytes = chunk * count;
+
+		GraphicsBackend graphicsBackend;
+
+		graphicsBackend.OnInitialize();
+
+		{
+			auto& context = graphicsBackend.GetContext();
+
+			VkBufferCreateInfo                     info{};
+			info.sType                           = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+			info.size                            = bytes;
+			info.usage                           = VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+			info.sharingMode                     = VK_SHARING_MODE_EXCLUSIVE;
+
+			auto buffer = CreateSP<Resource::Buffer>(context);
+			buffer->CreateBuffer(info, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT);
+
+			const auto family  = context.Get<IPhysicalDevice>()->GetQueueFamilies().graphic.value();
+			const auto manager = context.Get<IUploadManager>();
+
+			std::vector<uint8_t> data(chunk, 0x5A);
+
+			UploadTicket ticket = 0;
+
+			const float coalescedMs = Neptune::Test::Benchmark::MeasureMs([&] {
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					ticket = manager->UploadBuffer(buffer->Handle(), data.data(), chunk, i * chunk, family);
+				}
+
+				manager->Flush();
+				manager->Wait(ticket);
+			});
+
+			const float submitWaitMs = Neptune::Test::Benchmark::MeasureMs([&] {
+				for (uint32_t i = 0; i < count; ++i)
+				{
+					manager->Wait(manager->UploadBuffer(buffer->Handle(), data.data(), chunk, i * chunk, family));
+				}
+			});
+
+			EXPECT_NE(ticket, 0ull);
+			EXPECT_TRUE(manager->IsComplete(ticket));
+
+			const float mb = static_cast<float>(bytes) / (1024.0f * 1024.0f);
+
+			Neptune::Test::Benchmark::Record("CoalescedMBps",  mb * 1000.0f / coalescedMs);
+			Neptune::Test::Benchmark::Record("SubmitWaitMBps", mb * 1000.0f / submitWaitMs);
+
+			graphicsBackend.Wait();
+		}
+
+		graphicsBackend.OnShutDown();
+	}
+}
+
+#endif
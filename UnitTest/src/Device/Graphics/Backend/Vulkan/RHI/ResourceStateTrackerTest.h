@@ -0,0 +1,214 @@
+/**
+* @file ResourceStateTrackerTest.h.
+* @brief The ResourceStateTrackerTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+
+#ifdef NP_GRAPHICS_VULKAN
+
+#include "Instrumentor.h"
+
+#include <Device/Graphics/Backend/Vulkan/RHI/ResourceStateTracker.h>
+#include <Core/Memory/FrameArena.h>
+#include <Core/Memory/HeapCounter.h>
+
+#include <gmock/gmock.h>
+#include <vector>
+
+namespace Neptune::Vulkan::Test {
+
+	/**
+	* @brief Barriers handed to one Flush.
+	*/
+	struct Flushed
+	{
+		std::vector<VkImageMemoryBarrier2>  images;
+		std::vector<VkBufferMemoryBarrier2> buffers;
+		uint32_t                            batches = 0;
+	};
+
+	/**
+	* @brief Flush a tracker without a CommandBuffer.
+	*
+	* @param[in] tracker ResourceStateTracker.
+	*
+	* @return Returns Flushed.
+	*/
+	inline Flushed FlushTracker(ResourceStateTracker& tracker)
+	{
+		Flushed flushed;
+
+		tracker.Flush([&](const VkDependencyInfo& info) {
+			flushed.images.assign(info.pImageMemoryBarriers, info.pImageMemoryBarriers + info.imageMemoryBarrierCount);
+			flushed.buffers.assign(info.pBufferMemoryBarriers, info.pBufferMemoryBarriers + info.bufferMemoryBarrierCount);
+			++flushed.batches;
+		});
+
+		return flushed;
+	}
+
+	/**
+	* @brief Fake handle, trackers never dereference handles.
+	*
+	* @param[in] value Handle value.
+	*
+	* @return Returns handle.
+	*/
+	template<typename T>
+	T FakeHandle(uintptr_t value)
+	{
+		return reinterpret_cast<T>(value);
+	}
+
+	/**
+	* @brief Testing first Buffer access waits on any earlier write.
+	*/
+	TEST(ResourceStateTrackerTest, BufferFirstUse) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		ResourceStateTracker tracker;
+
+		const auto buffer = FakeHandle<VkBuffer>(1);
+
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+
+		const auto flushed = FlushTracker(tracker);
+
+		ASSERT_EQ(flushed.buffers.size(), 1);
+		EXPECT_EQ(flushed.buffers[0].srcStageMask,  VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT);
+		EXPECT_EQ(flushed.buffers[0].srcAccessMask, VK_ACCESS_2_MEMORY_WRITE_BIT);
+		EXPECT_EQ(flushed.buffers[0].dstStageMask,  VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
+		EXPECT_EQ(flushed.buffers[0].dstAccessMask, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+	}
+
+	/**
+	* @brief Testing read after read needs no barrier.
+	*/
+	TEST(ResourceStateTrackerTest, BufferReadAfterRead) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		ResourceStateTracker tracker;
+
+		const auto buffer = FakeHandle<VkBuffer>(1);
+
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+		FlushTracker(tracker);
+
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_DRAW_INDIRECT_BIT, VK_ACCESS_2_INDIRECT_COMMAND_READ_BIT);
+
+		EXPECT_EQ(FlushTracker(tracker).batches, 0);
+		EXPECT_EQ(tracker.GetStats().requested, 3);
+		EXPECT_EQ(tracker.GetStats().issued, 1);
+		EXPECT_EQ(tracker.GetStats().batches, 1);
+	}
+
+	/**
+	* @brief Testing accesses before a Flush merge into the pending barrier.
+	*/
+	TEST(ResourceStateTrackerTest, BufferMerge) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		ResourceStateTracker tracker;
+
+		const auto buffer = FakeHandle<VkBuffer>(1);
+
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_COPY_BIT, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+		FlushTracker(tracker);
+
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+		tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT,  VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+
+		const auto flushed = FlushTracker(tracker);
+
+		ASSERT_EQ(flushed.buffers.size(), 1);
+		EXPECT_EQ(flushed.buffers[0].srcStageMask,  VK_PIPELINE_STAGE_2_COPY_BIT);
+		EXPECT_EQ(flushed.buffers[0].srcAccessMask, VK_ACCESS_2_TRANSFER_WRITE_BIT);
+		EXPECT_EQ(flushed.buffers[0].dstStageMask,  VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT | VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT);
+		EXPECT_EQ(flushed.buffers[0].dstAccessMask, VK_ACCESS_2_SHADER_STORAGE_READ_BIT);
+	}
+
+	/**
+	* @brief Testing chained Image transitions before a Flush collapse into one barrier.
+	*/
+	TEST(ResourceStateTrackerTest, ImageCollapse) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		ResourceStateTracker tracker;
+
+		const auto image = FakeHandle<VkImage>(1);
+
+		tracker.TransitionImage(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+		tracker.TransitionImage(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+		const auto flushed = FlushTracker(tracker);
+
+		ASSERT_EQ(flushed.images.size(), 1);
+		EXPECT_EQ(flushed.images[0].oldLayout, VK_IMAGE_LAYOUT_UNDEFINED);
+		EXPECT_EQ(flushed.images[0].newLayout, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+		EXPECT_NE(flushed.images[0].dstStageMask & VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT, 0);
+
+		// Sampling again in the same layout is read after read.
+		tracker.TransitionImage(image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+
+		EXPECT_EQ(FlushTracker(tracker).batches, 0);
+	}
+
+	/**
+	* @brief Testing a write after read Image transition waits on the read.
+	*/
+	TEST(ResourceStateTrackerTest, ImageWriteAfterRead) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		ResourceStateTracker tracker;
+
+		const auto image = FakeHandle<VkImage>(1);
+
+		tracker.TransitionImage(image, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL);
+
+		const auto flushed = FlushTracker(tracker);
+
+		ASSERT_EQ(flushed.images.size(), 1);
+		EXPECT_EQ(flushed.images[0].srcStageMask,  VK_PIPELINE_STAGE_2_VERTEX_SHADER_BIT | VK_PIPELINE_STAGE_2_FRAGMENT_SHADER_BIT | VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT);
+		EXPECT_EQ(flushed.images[0].srcAccessMask, VK_ACCESS_2_NONE);
+		EXPECT_EQ(flushed.images[0].dstStageMask,  VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT);
+	}
+
+	/**
+	* @brief Testing a tracker on FrameArena stays off heap once the arena is warm.
+	*/
+	TEST(ResourceStateTrackerTest, FrameArena) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		const auto image  = FakeHandle<VkImage>(1);
+		const auto buffer = FakeHandle<VkBuffer>(2);
+
+		auto frame = [&]() {
+			ResourceStateTracker tracker(&Memory::FrameArena::Get());
+
+			tracker.TransitionImage(image, VK_IMAGE_LAYOUT_UNDEFINED, VK_IMAGE_ASPECT_COLOR_BIT, 1, VK_IMAGE_LAYOUT_TRANSFER_DST_OPTIMAL);
+			tracker.AccessBuffer(buffer, VK_PIPELINE_STAGE_2_COMPUTE_SHADER_BIT, VK_ACCESS_2_SHADER_STORAGE_WRITE_BIT);
+			tracker.Flush([](const VkDependencyInfo&) {});
+
+			Memory::FrameArena::NextFrame();
+		};
+
+		frame();
+
+		const auto before = Memory::HeapCounter::Total().allocations;
+
+		frame();
+
+		EXPECT_EQ(Memory::HeapCounter::Total().allocations, before);
+	}
+}
+
+#endif
@@ -7,11 +7,13 @@
 #pragma once
 
 #include <Core/Core.h>
+#include <gtest/gtest.h>
 
 #include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <iomanip>
+#include <limits>
 #include <string>
 #include <thread>
 #include <mutex>
@@ -197,6 +199,73 @@ namespace Neptune::Test {
 		bool m_Stopped;
 	};
 
+	namespace Benchmark {
+
+		constexpr int Runs = 5;  // @brief Runs of a benchmark, the fastest is kept.
+
+		/**
+		* @brief Time one run of a function.
+		*
+		* @param[in] fn Function.
+		*
+		* @return Returns elapsed milliseconds.
+		*/
+		template<typename F>
+		float ElapsedMs(F&& fn)
+		{
+			const auto begin = std::chrono::steady_clock::now();
+
+			fn();
+
+			return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - begin).count();
+		}
+
+		/**
+		* @brief Keep the fastest of Runs runs, for runs which time themselves or need untimed setup.
+		*
+		* @param[in] run Run, returns its milliseconds.
+		*
+		* @return Returns fastest milliseconds.
+		*/
+		template<typename F>
+		float BestMs(F&& run)
+		{
+			float best = std::numeric_limits<float>::max();
+
+			for (int r = 0; r < Runs; ++r)
+			{
+				best = std::min(best, static_cast<float>(run()));
+			}
+
+			return best;
+		}
+
+		/**
+		* @brief Time a function, fastest of Runs runs.
+		*
+		* @param[in] fn Function.
+		*
+		* @return Returns fastest milliseconds.
+		*/
+		template<typename F>
+		float MeasureMs(F&& fn)
+		{
+			return BestMs([&]() { return ElapsedMs(fn); });
+		}
+
+		/**
+		* @brief Record a benchmark result as a property of the running test.
+		*
+		* @param[in] key Property name.
+		* @param[in] value Result.
+		*/
+		template<typename T>
+		void Record(const char* key, T value)
+		{
+			::testing::Test::RecordProperty(key, std::to_string(value));
+		}
+	}
+
 	namespace InstrumentorUtils {
 
 		template <size_t N>
@@ -0,0 +1,188 @@
+/**
+* @file DrawQueueTest.h.
+* @brief The DrawQueueTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Render/Frontend/Draw/DrawQueue.h>
+#include <Device/Graphics/Frontend/RHI/CmdList.h>
+#include <Device/Graphics/Frontend/RHI/Pipeline.h>
+#include <Device/Graphics/Frontend/RHI/DescriptorList.h>
+
+#ifdef NP_GRAPHICS_NULL
+#include <Device/Graphics/Backend/Null/GraphicsBackend.h>
+#include <Device/Graphics/Backend/Null/Infrastructure/CommandLog.h>
+#include <Data/Clock.h>
+#endif
+
+#include <gmock/gmock.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+
+namespace Neptune::Render::Test {
+
+	/**
+	* @brief Testing RadixSort matches std::stable_sort.
+	*/
+	TEST(DrawQueueTest, RadixSort) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		std::mt19937_64 rng(5);
+
+		for (uint32_t threads : { 1u, 4u })
+		{
+			std::vector<uint64_t> keys(100003);
+			std::vector<uint32_t> values(keys.size());
+
+			// Few varying digits, the rest must be skipped.
+			for (auto& key : keys) key = rng() & 0xFF00FF000000FFFFull;
+
+			std::iota(values.begin(), values.end(), 0u);
+
+			std::vector<std::pair<uint64_t, uint32_t>> expect(keys.size());
+			for (size_t i = 0; i < keys.size(); ++i) expect[i] = { keys[i], values[i] };
+
+			std::stable_sort(expect.begin(), expect.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+
+			RadixSort sort;
+			sort.SetThreads(threads);
+			sort.Sort(keys, values);
+
+			EXPECT_EQ(sort.GetPassCount(), 4u);
+
+			for (size_t i = 0; i < keys.size(); ++i)
+			{
+				ASSERT_EQ(keys[i],   expect[i].first);
+				ASSERT_EQ(values[i], expect[i].second);
+			}
+		}
+	}
+
+	/**
+	* @brief Testing DrawKey orders passes, state and depth.
+	*/
+	TEST(DrawQueueTest, DrawKey) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		EXPECT_LT(DrawKey::Encode(0, DrawOrder::State, 9, 9, 9, 100.0f), DrawKey::Encode(1, DrawOrder::State, 0, 0, 0, 0.0f));
+		EXPECT_LT(DrawKey::Encode(0, DrawOrder::State, 0, 9, 9, 100.0f), DrawKey::Encode(0, DrawOrder::State, 1, 0, 0, 0.0f));
+		EXPECT_LT(DrawKey::Encode(0, DrawOrder::State, 1, 1, 1, 1.0f),   DrawKey::Encode(0, DrawOrder::State, 1, 1, 1, 2.0f));
+
+		EXPECT_LT(DrawKey::Encode(0, DrawOrder::BackToFront, 9, 9, 9, 2.0f), DrawKey::Encode(0, DrawOrder::BackToFront, 0, 0, 0, 1.0f));
+
+		EXPECT_EQ(DrawKey::Pass(DrawKey::Encode(63, DrawOrder::BackToFront, 1, 2, 3, 4.0f)), 63u);
+	}
+
+#ifdef NP_GRAPHICS_NULL
+
+	/**
+	* @brief Testing DrawQueue merges draws and removes redundant binds.
+	*/
+	TEST(DrawQueueTest, Batch) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		Null::GraphicsBackend graphicsBackend;
+
+		graphicsBackend.OnInitialize(nullptr);
+
+		RHI::RHIDelegate::SetCreator([&](RHI::ERHI e, void* payload) { return graphicsBackend.CreateRHI(e, payload); });
+
+		{
+			const std::vector pipelines   = { CreateSP<RHI::Pipeline>(), CreateSP<RHI::Pipeline>() };
+			const std::vector descriptors = { CreateSP<RHI::DescriptorList>(), CreateSP<RHI::DescriptorList>() };
+
+			DrawQueue queue;
+
+			// Scene order alternates state every draw.
+			for (uint32_t i = 0; i < 64; ++i)
+			{
+				queue.Submit(0, pipelines[i % 2], descriptors[(i / 2) % 2], 36, 0, i, static_cast<float>(64 - i));
+			}
+
+			queue.Build();
+
+			const auto& stats = queue.GetStats();
+
+			EXPECT_EQ(stats.packets,             64u);
+			EXPECT_EQ(stats.batches,             4u);
+			EXPECT_EQ(stats.unsortedPipelines,   64u);
+			EXPECT_EQ(stats.unsortedDescriptors, 64u);
+			EXPECT_EQ(stats.pipelineBinds,       2u);
+			EXPECT_EQ(stats.descriptorBinds,     4u);
+
+			uint32_t instances = 0;
+			for (const auto& batch : queue.GetBatches())
+			{
+				EXPECT_EQ(batch.firstInstance, instances);
+
+				instances += batch.instanceCount;
+			}
+
+			EXPECT_EQ(instances, 64u);
+
+			// Front to back inside a batch.
+			EXPECT_EQ(queue.GetInstances().front(), 60u);
+
+			const auto cmdList = CreateSP<RHI::CmdList>();
+			cmdList->SetGraphicCmdList(Data::Clock{});
+
+			queue.Execute(*cmdList, 0);
+			queue.Execute(*cmdList, 1);
+		}
+
+		const auto& log = graphicsBackend.GetContext().Get<Null::ICommandLog>();
+
+		EXPECT_EQ(log->GetCount(Null::ECommand::BindPipeline),   2);
+		EXPECT_EQ(log->GetCount(Null::ECommand::BindDescriptor), 4);
+		EXPECT_EQ(log->GetCount(Null::ECommand::Draw),           4);
+
+		RHI::RHIDelegate::SetCreator(nullptr);
+
+		graphicsBackend.OnShutDown();
+	}
+
+#endif
+
+	/**
+	* @brief Benchmark RadixSort on 1M keys.
+	*/
+	TEST(DrawQueueTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 1000000;
+
+		std::mt19937_64 rng(1);
+
+		std::vector<uint64_t> source(count);
+		for (auto& key : source) key = rng();
+
+		std::vector<uint64_t> keys;
+		std::vector<uint32_t> values(count);
+
+		RadixSort sort;
+
+		for (uint32_t threads : { 1u, 0u })
+		{
+			sort.SetThreads(threads);
+
+			const float best = Neptune::Test::Benchmark::BestMs([&] {
+				keys = source;
+				std::iota(values.begin(), values.end(), 0u);
+
+				return Neptune::Test::Benchmark::ElapsedMs([&] { sort.Sort(keys, values); });
+			});
+
+			Neptune::Test::Benchmark::Record(threads == 1 ? "SingleThreadMs" : "MultiThreadMs", best);
+		}
+
+		EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end()));
+	}
+}
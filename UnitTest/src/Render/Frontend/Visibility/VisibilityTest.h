@@ -0,0 +1,148 @@
+/**
+* @file VisibilityTest.h.
+* @brief The VisibilityTest Definitions.
+* @author Spices.
+*/
+
+#pragma once
+#include "Instrumentor.h"
+
+#include <Render/Frontend/Visibility/Visibility.h>
+#include <Render/Frontend/Visibility/HiZBuffer.h>
+
+#include <glm/gtc/matrix_transform.hpp>
+#include <gmock/gmock.h>
+#include <random>
+
+namespace Neptune::Render::Test {
+
+	/**
+	* @brief Orthographic view projection of x, y in [-10, 10] and z in [0, 10].
+	*
+	* @return Returns view projection matrix.
+	*/
+	inline glm::mat4 TestViewProjection()
+	{
+		glm::mat4 viewProjection(1.0f);
+		viewProjection[0][0] = 0.1f;
+		viewProjection[1][1] = 0.1f;
+		viewProjection[2][2] = 0.1f;
+
+		return viewProjection;
+	}
+
+	/**
+	* @brief Testing Visibility matches Frustum::Intersect.
+	*/
+	TEST(VisibilityTest, Frustum) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		std::mt19937 rng(7);
+		std::uniform_real_distribution<float> dist(-30.0f, 30.0f);
+
+		Visibility visibility;
+		std::vector<uint32_t> expect;
+
+		const auto frustum = Frustum::FromMatrix(TestViewProjection());
+
+		// Not a multiple of SIMD lanes, tail is tested by scalar path.
+		for (uint32_t i = 0; i < 100003; ++i)
+		{
+			glm::mat4 model(1.0f);
+			model[0][0] = dist(rng) / 10.0f;
+			model[3]    = glm::vec4(dist(rng), dist(rng), dist(rng), 1.0f);
+
+			visibility.Add(model, glm::vec3(-0.5f), glm::vec3(0.5f), i);
+
+			const glm::vec3 extent = glm::abs(glm::vec3(model[0])) * 0.5f + glm::vec3(0.0f, 0.5f, 0.5f);
+
+			if (frustum.Intersect(glm::vec3(model[3]), extent)) expect.push_back(i);
+		}
+
+		std::vector<uint32_t> visible;
+
+		visibility.SetThreads(4);
+		visibility.Cull(frustum, visible);
+
+		EXPECT_EQ(visible, expect);
+		EXPECT_EQ(visibility.GetStats().tested, 100003u);
+		EXPECT_EQ(visibility.GetStats().frustum + visibility.GetStats().visible, 100003u);
+
+		// Sphere is looser than box.
+		std::vector<uint32_t> spheres;
+		visibility.Cull(frustum, spheres, BoundsTest::Sphere);
+
+		EXPECT_GE(spheres.size(), visible.size());
+	}
+
+	/**
+	* @brief Testing HiZBuffer rejects boxes behind depth.
+	*/
+	TEST(VisibilityTest, Occlusion) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		// Reverse z, an occluder at z = 5 covers the whole view.
+		std::vector<float> depth(64 * 60, 0.5f);
+
+		HiZBuffer hiz;
+		hiz.Build(depth.data(), 64, 60, TestViewProjection());
+
+		EXPECT_EQ(hiz.GetLevelCount(), 7u);
+		EXPECT_TRUE (hiz.IsOccluded({ 0.0f, 0.0f, 1.0f }, glm::vec3(0.5f)));
+		EXPECT_FALSE(hiz.IsOccluded({ 0.0f, 0.0f, 9.0f }, glm::vec3(0.5f)));
+
+		Visibility visibility;
+		visibility.Add(glm::translate(glm::mat4(1.0f), { 0.0f, 0.0f, 1.0f }), glm::vec3(-0.5f), glm::vec3(0.5f));
+		visibility.Add(glm::translate(glm::mat4(1.0f), { 0.0f, 0.0f, 9.0f }), glm::vec3(-0.5f), glm::vec3(0.5f));
+
+		std::vector<uint32_t> visible;
+		visibility.Cull(Frustum::FromMatrix(TestViewProjection()), visible, BoundsTest::AABB, &hiz);
+
+		EXPECT_EQ(visible, std::vector<uint32_t>{ 1 });
+		EXPECT_EQ(visibility.GetStats().occluded, 1u);
+	}
+
+	/**
+	* @brief Benchmark Visibility on 1M instances.
+	*/
+	TEST(VisibilityTest, Benchmark) {
+
+		NEPTUNE_TEST_PROFILE_FUNCTION
+
+		constexpr uint32_t count = 1000000;
+
+		std::mt19937 rng(1);
+		std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+
+		Visibility visibility;
+		visibility.Reserve(count);
+
+		for (uint32_t i = 0; i < count; ++i)
+		{
+			visibility.Add(glm::translate(glm::mat4(1.0f), { dist(rng), dist(rng), dist(rng) }), glm::vec3(-0.5f), glm::vec3(0.5f), i);
+		}
+
+		const auto frustum = Frustum::FromMatrix(TestViewProjection());
+
+		std::vector<uint32_t> visible;
+
+		for (uint32_t threads : { 1u, 0u })
+		{
+			visibility.SetThreads(threads);
+
+			// Cull times itself, setup and stats are left out.
+			const float best = Neptune::Test::Benchmark::BestMs([&] {
+				visibility.Cull(frustum, visible);
+
+				return visibility.GetStats().time;
+			});
+
+			Neptune::Test::Benchmark::Record(threads == 1 ? "SingleThreadMs" : "MultiThreadMs", best);
+		}
+
+		EXPECT_EQ(visibility.GetStats().tested, count);
+		EXPECT_GT(visible.size(), 0u);
+	}
+}
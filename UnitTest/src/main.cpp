@@ -14,18 +14,31 @@
 #include "Instrumentor.h"
 
 #include "Core/Container/BitSetTest.h"
+#include "Core/Container/FlatTreeTest.h"
+#include "Core/Container/LinkedUnorderedMapTest.h"
+#include "Core/Container/ThreadUnorderedMapTest.h"
 #include "Core/Container/TreeTest.h"
+#include "Core/Delegate/DelegateTest.h"
+#include "Core/Event/EventBusTest.h"
+#include "Core/Log/LogTest.h"
+#include "Core/Memory/MemoryTest.h"
 
 #include "Device/Compute/Backend/SYCL/SYCLTest.h"
 #include "Device/Graphics/Backend/Common/CommonTest.h"
 #include "Device/Graphics/Backend/Direct3D11/GraphicsBackendTest.h"
 #include "Device/Graphics/Backend/Direct3D12/GraphicsBackendTest.h"
 #include "Device/Graphics/Backend/Metal/GraphicsBackendTest.h"
+#include "Device/Graphics/Backend/Null/GraphicsBackendTest.h"
 #include "Device/Graphics/Backend/OpenGL/GraphicsBackendTest.h"
 #include "Device/Graphics/Backend/Vulkan/GraphicsBackendTest.h"
+#include "Device/Graphics/Backend/Vulkan/Infrastructure/UploadManagerTest.h"
+#include "Device/Graphics/Backend/Vulkan/RHI/ResourceStateTrackerTest.h"
 #include "Device/Graphics/Backend/WebGL/GraphicsBackendTest.h"
 #include "Device/Graphics/Backend/WebGPU/GraphicsBackendTest.h"
 
+#include "Render/Frontend/Draw/DrawQueueTest.h"
+#include "Render/Frontend/Visibility/VisibilityTest.h"
+
 #include <Core/Log/Log.h>
 
 /**
@@ -5,6 +5,33 @@
 -- Define module
 local module = {}
 
+-- @brief Opt-in allocation tracker, tags heap and device memory per subsystem.
+newoption
+{
+    trigger     = "alloc-tracker",
+    description = "Track allocations per subsystem tag and write AllocReport.txt on exit",
+}
+
+-- @brief Opt-in GPU driven path, CullPass and BasePass join the default Passes.
+newoption
+{
+    trigger     = "gpu-driven",
+    description = "Cull GPUScene on GPU and draw BasePass with indirect count",
+}
+
+-- @brief Opt-in sanitizer for Neptune and UnitTest, gcc and clang only.
+newoption
+{
+    trigger     = "sanitize",
+    value       = "KIND",
+    description = "Build Neptune and UnitTest with a sanitizer",
+    allowed     =
+    {
+        { "thread",  "ThreadSanitizer, races in ThreadUnorderedMapTest.Stress and other threaded tests" },
+        { "address", "AddressSanitizer" },
+    },
+}
+
 -- @brief Get Compute Feature Lists.
 -- 
 -- @param[in] toolset ToolSet.
@@ -29,6 +56,9 @@ module.GetGraphicsFeatures = function()
 
     local list = {}
 
+    -- Null backend records RHI calls without a device, available everywhere.
+    table.insert(list, "NP_GRAPHICS_NULL")
+
     if os.target() == "emscripten" then
         table.insert(list, "NP_GRAPHICS_WEBGL")
         table.insert(list, "NP_GRAPHICS_WEBGPU")
@@ -48,6 +78,10 @@ module.GetGraphicsFeatures = function()
         table.insert(list, "NP_GRAPHICS_METAL")
     end
 
+    if _OPTIONS["gpu-driven"] then
+        table.insert(list, "NP_GPU_DRIVEN")               -- Add CullPass and BasePass to default Passes.
+    end
+
     return list
 
 end
@@ -67,6 +101,26 @@ module.GetProfileFeatures = function()
         table.insert(list, "TRACY_IMPORT")                -- Multi dll.
     end
 
+    if _OPTIONS["alloc-tracker"] then
+        table.insert(list, "NP_ALLOC_TRACKER")            -- Hook operator new and VMA into AllocTracker.
+    end
+
+    return list
+
+end
+
+-- @brief Get Sanitize Options, used as both build and link options.
+--
+-- @return Returns Sanitize Options.
+module.GetSanitizeOptions = function()
+
+    local list = {}
+
+    if _OPTIONS["sanitize"] and os.target() ~= "windows" and os.target() ~= "emscripten" then
+        table.insert(list, "-fsanitize=" .. _OPTIONS["sanitize"])
+        table.insert(list, "-fno-omit-frame-pointer")      -- Readable sanitizer stacks.
+    end
+
     return list
 
 end